@@ -6,6 +6,9 @@ dnl Function to detect if libesedb dependencies are available
 AC_DEFUN([AX_LIBESEDB_CHECK_LOCAL],
   [dnl Check for internationalization functions in libesedb/libesedb_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for the monotonic clock function in libesedb/libesedb_io_handle.c
+  AC_CHECK_FUNCS([clock_gettime])
 ])
 
 dnl Function to detect if esedbtools dependencies are available
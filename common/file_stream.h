@@ -105,6 +105,28 @@ extern "C" {
 	fseeko64( stream, offset, whence )
 #endif
 
+/* FILE stream get offset
+ */
+#if defined( WINAPI )
+#define file_stream_get_offset( stream ) \
+	ftell( stream )
+
+#elif defined( HAVE_FTELLO )
+#define file_stream_get_offset( stream ) \
+	ftello( stream )
+
+#elif defined( HAVE_FTELLO64 )
+#define file_stream_get_offset( stream ) \
+	ftello64( stream )
+#endif
+
+/* FILE stream flush
+ */
+#if defined( HAVE_FFLUSH ) || defined( WINAPI )
+#define file_stream_flush( stream ) \
+	fflush( stream )
+#endif
+
 /* End of FILE stream
  */
 #if defined( HAVE_FEOF ) || defined( WINAPI )
@@ -0,0 +1,2877 @@
+/*
+ * Apache Arrow IPC stream writer
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "arrow_writer.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcnotify.h"
+#include "esedbtools_libesedb.h"
+#include "log_handle.h"
+#include "output_buffer.h"
+
+/* The Arrow IPC stream format consists of encapsulated messages:
+ * a continuation marker (0xffffffff), the 32-bit size of the metadata,
+ * the metadata as a flatbuffer padded to 8 bytes, followed by the message body.
+ * The stream consists of a schema message, record batch messages and
+ * is terminated by an end-of-stream marker.
+ *
+ * The flatbuffers are written front to back, where objects are always
+ * stored after the object that references them, since offsets to objects are unsigned.
+ */
+
+/* The message header types
+ */
+#define ARROW_WRITER_MESSAGE_HEADER_SCHEMA		1
+#define ARROW_WRITER_MESSAGE_HEADER_RECORD_BATCH	3
+
+/* The metadata version V5
+ */
+#define ARROW_WRITER_METADATA_VERSION			4
+
+/* The timestamp unit MICROSECOND
+ */
+#define ARROW_WRITER_TIME_UNIT_MICROSECOND		2
+
+/* The number of 100th nano seconds between 1601-01-01 (FILETIME epoch)
+ * and 1970-01-01 (POSIX epoch)
+ */
+#define ARROW_WRITER_FILETIME_POSIX_EPOCH_DELTA		(int64_t) 116444736000000000LL
+
+#define arrow_writer_padded_size( size ) \
+	( ( ( size ) + 7 ) & ~( (size_t) 7 ) )
+
+/* Creates an Arrow writer
+ * Make sure the value arrow_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_initialize(
+     arrow_writer_t **arrow_writer,
+     int maximum_number_of_rows,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_initialize";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arrow_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Arrow writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_rows <= 0 )
+	 || ( maximum_number_of_rows > ( INT32_MAX / 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of rows value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arrow_writer = memory_allocate_structure(
+	                 arrow_writer_t );
+
+	if( *arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Arrow writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arrow_writer,
+	     0,
+	     sizeof( arrow_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Arrow writer.",
+		 function );
+
+		goto on_error;
+	}
+	( *arrow_writer )->maximum_number_of_rows = maximum_number_of_rows;
+
+	return( 1 );
+
+on_error:
+	if( *arrow_writer != NULL )
+	{
+		memory_free(
+		 *arrow_writer );
+
+		*arrow_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an Arrow writer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_free(
+     arrow_writer_t **arrow_writer,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_free";
+	int column_index              = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arrow_writer != NULL )
+	{
+		if( ( *arrow_writer )->columns != NULL )
+		{
+			for( column_index = 0;
+			     column_index < ( *arrow_writer )->number_of_columns;
+			     column_index++ )
+			{
+				column = &( ( ( *arrow_writer )->columns )[ column_index ] );
+
+				if( column->name != NULL )
+				{
+					memory_free(
+					 column->name );
+				}
+				if( column->validity_data != NULL )
+				{
+					memory_free(
+					 column->validity_data );
+				}
+				if( column->offsets_data != NULL )
+				{
+					memory_free(
+					 column->offsets_data );
+				}
+				if( column->values_data != NULL )
+				{
+					memory_free(
+					 column->values_data );
+				}
+			}
+			memory_free(
+			 ( *arrow_writer )->columns );
+		}
+		if( ( *arrow_writer )->metadata_data != NULL )
+		{
+			memory_free(
+			 ( *arrow_writer )->metadata_data );
+		}
+		memory_free(
+		 *arrow_writer );
+
+		*arrow_writer = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a column
+ * The Arrow data type is determined from the (ESE) column type
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_column(
+     arrow_writer_t *arrow_writer,
+     const uint8_t *name,
+     size_t name_size,
+     int record_value_entry,
+     uint32_t column_type,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	void *reallocation            = NULL;
+	static char *function         = "arrow_writer_append_column";
+	size_t bitmap_size            = 0;
+	size_t values_data_size       = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size == 0 )
+	 || ( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->number_of_rows != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Arrow writer - record batch already contains rows.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                arrow_writer->columns,
+	                sizeof( arrow_writer_column_t ) * ( arrow_writer->number_of_columns + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize columns.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer->columns = (arrow_writer_column_t *) reallocation;
+
+	column = &( ( arrow_writer->columns )[ arrow_writer->number_of_columns ] );
+
+	if( memory_set(
+	     column,
+	     0,
+	     sizeof( arrow_writer_column_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column.",
+		 function );
+
+		return( -1 );
+	}
+	/* The column is counted from here on so that it is freed by arrow_writer_free
+	 */
+	arrow_writer->number_of_columns += 1;
+
+	column->record_value_entry = record_value_entry;
+	column->column_type        = column_type;
+
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			column->arrow_type = ARROW_WRITER_TYPE_BOOLEAN;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			column->arrow_type = ARROW_WRITER_TYPE_INTEGER;
+			column->value_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			column->arrow_type = ARROW_WRITER_TYPE_INTEGER;
+			column->value_size = 2;
+			column->is_signed  = (uint8_t) ( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			column->arrow_type = ARROW_WRITER_TYPE_INTEGER;
+			column->value_size = 4;
+			column->is_signed  = (uint8_t) ( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			column->arrow_type = ARROW_WRITER_TYPE_INTEGER;
+			column->value_size = 8;
+			column->is_signed  = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			column->arrow_type = ARROW_WRITER_TYPE_FLOATING_POINT;
+			column->value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			column->arrow_type = ARROW_WRITER_TYPE_FLOATING_POINT;
+			column->value_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			column->arrow_type = ARROW_WRITER_TYPE_TIMESTAMP;
+			column->value_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			column->arrow_type = ARROW_WRITER_TYPE_UTF8;
+			break;
+
+		default:
+			column->arrow_type = ARROW_WRITER_TYPE_BINARY;
+			break;
+	}
+	column->name = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * name_size );
+
+	if( column->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     column->name,
+	     name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	column->name_size = name_size;
+
+	bitmap_size = ( (size_t) arrow_writer->maximum_number_of_rows + 7 ) / 8;
+
+	column->validity_data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * bitmap_size );
+
+	if( column->validity_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create validity data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     column->validity_data,
+	     0,
+	     bitmap_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear validity data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column->arrow_type == ARROW_WRITER_TYPE_UTF8 )
+	 || ( column->arrow_type == ARROW_WRITER_TYPE_BINARY ) )
+	{
+		/* The values data of variable size values is allocated on demand
+		 */
+		column->offsets_data = (uint8_t *) memory_allocate(
+		                                    sizeof( uint32_t ) * ( arrow_writer->maximum_number_of_rows + 1 ) );
+
+		if( column->offsets_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create offsets data.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 column->offsets_data,
+		 0 );
+	}
+	else
+	{
+		if( column->arrow_type == ARROW_WRITER_TYPE_BOOLEAN )
+		{
+			values_data_size = bitmap_size;
+		}
+		else
+		{
+			values_data_size = (size_t) arrow_writer->maximum_number_of_rows * column->value_size;
+		}
+		column->values_data = (uint8_t *) memory_allocate(
+		                                   sizeof( uint8_t ) * values_data_size );
+
+		if( column->values_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create values data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     column->values_data,
+		     0,
+		     values_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear values data.",
+			 function );
+
+			return( -1 );
+		}
+		column->values_data_size = values_data_size;
+	}
+	return( 1 );
+}
+
+/* Sets the columns from the columns of a table
+ * If value entries are provided only the columns of these record value entries are set
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_set_columns_from_table(
+     arrow_writer_t *arrow_writer,
+     libesedb_table_t *table,
+     const int *value_entries,
+     int number_of_value_entries,
+     libcerror_error_t **error )
+{
+	uint8_t column_name[ 256 ];
+
+	libesedb_column_t *column = NULL;
+	static char *function     = "arrow_writer_set_columns_from_table";
+	size_t column_name_size   = 0;
+	uint32_t column_type      = 0;
+	int column_entry          = 0;
+	int column_iterator       = 0;
+	int number_of_columns     = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_get_number_of_columns(
+	     table,
+	     &number_of_columns,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_entries != NULL )
+	{
+		number_of_columns = number_of_value_entries;
+	}
+	for( column_iterator = 0;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
+	{
+		if( value_entries != NULL )
+		{
+			column_entry = value_entries[ column_iterator ];
+		}
+		else
+		{
+			column_entry = column_iterator;
+		}
+		if( libesedb_table_get_column(
+		     table,
+		     column_entry,
+		     &column,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_type(
+		     column,
+		     &column_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d type.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_utf8_name_size(
+		     column,
+		     &column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the size of the column name.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( column_name_size < 2 )
+		 || ( column_name_size > 256 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid column name size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_utf8_name(
+		     column,
+		     column_name,
+		     column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the column name.",
+			 function );
+
+			goto on_error;
+		}
+		if( arrow_writer_append_column(
+		     arrow_writer,
+		     column_name,
+		     column_name_size - 1,
+		     column_entry,
+		     column_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append column: %d.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		if( libesedb_column_free(
+		     &column,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the columns from the values of a record
+ * This is used for records that are not read from a table, such as index records
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_set_columns_from_record(
+     arrow_writer_t *arrow_writer,
+     libesedb_record_t *record,
+     libcerror_error_t **error )
+{
+	uint8_t column_name[ 256 ];
+
+	static char *function   = "arrow_writer_set_columns_from_record";
+	size_t column_name_size = 0;
+	uint32_t column_type    = 0;
+	int number_of_values    = 0;
+	int value_iterator      = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_iterator = 0;
+	     value_iterator < number_of_values;
+	     value_iterator++ )
+	{
+		if( libesedb_record_get_column_type(
+		     record,
+		     value_iterator,
+		     &column_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column type of value: %d.",
+			 function,
+			 value_iterator );
+
+			return( -1 );
+		}
+		if( libesedb_record_get_utf8_column_name_size(
+		     record,
+		     value_iterator,
+		     &column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the size of the column name of value: %d.",
+			 function,
+			 value_iterator );
+
+			return( -1 );
+		}
+		if( ( column_name_size < 2 )
+		 || ( column_name_size > 256 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid column name size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_record_get_utf8_column_name(
+		     record,
+		     value_iterator,
+		     column_name,
+		     column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the column name of value: %d.",
+			 function,
+			 value_iterator );
+
+			return( -1 );
+		}
+		if( arrow_writer_append_column(
+		     arrow_writer,
+		     column_name,
+		     column_name_size - 1,
+		     value_iterator,
+		     column_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append column: %d.",
+			 function,
+			 value_iterator );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Resizes the values data of a column of variable size values
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_resize_values_data(
+     arrow_writer_column_t *column,
+     size_t required_values_data_size,
+     libcerror_error_t **error )
+{
+	void *reallocation      = NULL;
+	static char *function   = "arrow_writer_resize_values_data";
+	size_t values_data_size = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_values_data_size <= column->values_data_size )
+	{
+		return( 1 );
+	}
+	/* The offsets of variable size values are 32-bit signed integers
+	 */
+	if( required_values_data_size > (size_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: values data of record batch exceeds maximum, use a smaller number of rows per batch.",
+		 function );
+
+		return( -1 );
+	}
+	values_data_size = column->values_data_size * 2;
+
+	if( values_data_size < 4096 )
+	{
+		values_data_size = 4096;
+	}
+	if( values_data_size < required_values_data_size )
+	{
+		values_data_size = required_values_data_size;
+	}
+	if( values_data_size > (size_t) INT32_MAX )
+	{
+		values_data_size = (size_t) INT32_MAX;
+	}
+	if( values_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid values data size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                column->values_data,
+	                sizeof( uint8_t ) * values_data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize values data.",
+		 function );
+
+		return( -1 );
+	}
+	column->values_data      = (uint8_t *) reallocation;
+	column->values_data_size = values_data_size;
+
+	return( 1 );
+}
+
+/* Appends zero-filled data to the metadata
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_metadata(
+     arrow_writer_t *arrow_writer,
+     size_t alignment,
+     size_t size,
+     size_t *metadata_offset,
+     libcerror_error_t **error )
+{
+	void *reallocation        = NULL;
+	static char *function     = "arrow_writer_append_metadata";
+	size_t metadata_data_size = 0;
+	size_t padding_size       = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( alignment == 0 )
+	 || ( alignment > 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid alignment value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) ( INT32_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata offset.",
+		 function );
+
+		return( -1 );
+	}
+	padding_size = ( alignment - ( arrow_writer->metadata_data_offset % alignment ) ) % alignment;
+
+	metadata_data_size = arrow_writer->metadata_data_offset + padding_size + size;
+
+	if( metadata_data_size > (size_t) ( INT32_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid metadata data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_data_size > arrow_writer->metadata_data_size )
+	{
+		if( metadata_data_size < ( arrow_writer->metadata_data_size * 2 ) )
+		{
+			metadata_data_size = arrow_writer->metadata_data_size * 2;
+		}
+		if( metadata_data_size < 1024 )
+		{
+			metadata_data_size = 1024;
+		}
+		reallocation = memory_reallocate(
+		                arrow_writer->metadata_data,
+		                sizeof( uint8_t ) * metadata_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize metadata data.",
+			 function );
+
+			return( -1 );
+		}
+		arrow_writer->metadata_data      = (uint8_t *) reallocation;
+		arrow_writer->metadata_data_size = metadata_data_size;
+	}
+	if( memory_set(
+	     &( arrow_writer->metadata_data[ arrow_writer->metadata_data_offset ] ),
+	     0,
+	     padding_size + size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata data.",
+		 function );
+
+		return( -1 );
+	}
+	*metadata_offset = arrow_writer->metadata_data_offset + padding_size;
+
+	arrow_writer->metadata_data_offset += padding_size + size;
+
+	return( 1 );
+}
+
+/* Appends a flatbuffer table to the metadata
+ * The table is stored after its vtable and its fields are stored in order of
+ * the field identifiers where the field size is 0 for fields that are not stored.
+ * The metadata offsets of the stored fields are returned in field_offsets
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_metadata_table(
+     arrow_writer_t *arrow_writer,
+     int number_of_fields,
+     const uint8_t *field_sizes,
+     size_t *table_offset,
+     size_t *field_offsets,
+     libcerror_error_t **error )
+{
+	uint16_t relative_field_offsets[ 8 ];
+
+	static char *function = "arrow_writer_append_metadata_table";
+	size_t table_size     = 4;
+	size_t vtable_offset  = 0;
+	size_t vtable_size    = 0;
+	int field_index       = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_fields < 0 )
+	 || ( number_of_fields > 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of fields value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_fields > 0 )
+	 && ( ( field_sizes == NULL )
+	  ||  ( field_offsets == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field sizes or offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The table starts with a 32-bit signed offset to its vtable
+	 * and is 8-byte aligned so that every field is aligned to its size
+	 */
+	for( field_index = 0;
+	     field_index < number_of_fields;
+	     field_index++ )
+	{
+		relative_field_offsets[ field_index ] = 0;
+
+		if( field_sizes[ field_index ] == 0 )
+		{
+			continue;
+		}
+		table_size += ( field_sizes[ field_index ] - ( table_size % field_sizes[ field_index ] ) ) % field_sizes[ field_index ];
+
+		relative_field_offsets[ field_index ] = (uint16_t) table_size;
+
+		table_size += field_sizes[ field_index ];
+	}
+	vtable_size = 4 + ( 2 * (size_t) number_of_fields );
+
+	if( arrow_writer_append_metadata(
+	     arrow_writer,
+	     2,
+	     vtable_size,
+	     &vtable_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append vtable.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_append_metadata(
+	     arrow_writer,
+	     8,
+	     table_size,
+	     table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append table.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( arrow_writer->metadata_data[ vtable_offset ] ),
+	 (uint16_t) vtable_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( arrow_writer->metadata_data[ vtable_offset + 2 ] ),
+	 (uint16_t) table_size );
+
+	for( field_index = 0;
+	     field_index < number_of_fields;
+	     field_index++ )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 &( arrow_writer->metadata_data[ vtable_offset + 4 + ( 2 * field_index ) ] ),
+		 relative_field_offsets[ field_index ] );
+
+		if( relative_field_offsets[ field_index ] == 0 )
+		{
+			field_offsets[ field_index ] = 0;
+		}
+		else
+		{
+			field_offsets[ field_index ] = *table_offset + relative_field_offsets[ field_index ];
+		}
+	}
+	/* The vtable is stored before the table, hence the offset is positive
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( arrow_writer->metadata_data[ *table_offset ] ),
+	 (uint32_t) ( *table_offset - vtable_offset ) );
+
+	return( 1 );
+}
+
+/* Appends a flatbuffer vector to the metadata
+ * The elements are zero-filled and stored directly after the 32-bit number of elements
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_metadata_vector(
+     arrow_writer_t *arrow_writer,
+     size_t element_size,
+     size_t element_alignment,
+     int number_of_elements,
+     size_t *vector_offset,
+     libcerror_error_t **error )
+{
+	static char *function  = "arrow_writer_append_metadata_vector";
+	size_t metadata_offset = 0;
+	size_t padding_size    = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element_size == 0 )
+	 || ( element_size > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_elements < 0 )
+	 || ( number_of_elements > ( INT32_MAX / 32 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of elements value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( vector_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid vector offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_alignment < 4 )
+	{
+		element_alignment = 4;
+	}
+	/* The elements rather than the number of elements need to be aligned
+	 */
+	padding_size = ( element_alignment - ( ( arrow_writer->metadata_data_offset + 4 ) % element_alignment ) ) % element_alignment;
+
+	if( arrow_writer_append_metadata(
+	     arrow_writer,
+	     1,
+	     padding_size + 4 + ( element_size * (size_t) number_of_elements ),
+	     &metadata_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append vector.",
+		 function );
+
+		return( -1 );
+	}
+	*vector_offset = metadata_offset + padding_size;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( arrow_writer->metadata_data[ *vector_offset ] ),
+	 (uint32_t) number_of_elements );
+
+	return( 1 );
+}
+
+/* Appends a flatbuffer string to the metadata
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_metadata_string(
+     arrow_writer_t *arrow_writer,
+     const uint8_t *string,
+     size_t string_length,
+     size_t *string_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_append_metadata_string";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The string is stored with its 32-bit length and an end-of-string character
+	 */
+	if( arrow_writer_append_metadata(
+	     arrow_writer,
+	     4,
+	     4 + string_length + 1,
+	     string_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( arrow_writer->metadata_data[ *string_offset ] ),
+	 (uint32_t) string_length );
+
+	if( memory_copy(
+	     &( arrow_writer->metadata_data[ *string_offset + 4 ] ),
+	     string,
+	     string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets a flatbuffer offset in the metadata
+ * The offset is relative to where it is stored
+ */
+void arrow_writer_set_metadata_offset(
+      arrow_writer_t *arrow_writer,
+      size_t metadata_offset,
+      size_t target_offset )
+{
+	if( arrow_writer == NULL )
+	{
+		return;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( arrow_writer->metadata_data[ metadata_offset ] ),
+	 (uint32_t) ( target_offset - metadata_offset ) );
+}
+
+/* Starts new message metadata
+ * The metadata offset of the message header offset is returned in header_offset
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_message_metadata(
+     arrow_writer_t *arrow_writer,
+     uint8_t header_type,
+     uint64_t body_length,
+     size_t *header_offset,
+     libcerror_error_t **error )
+{
+	/* Message: version, header_type, header, bodyLength
+	 */
+	uint8_t message_field_sizes[ 4 ] = { 2, 1, 4, 8 };
+
+	size_t message_field_offsets[ 4 ];
+
+	static char *function            = "arrow_writer_append_message_metadata";
+	size_t message_offset            = 0;
+	size_t root_offset               = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header offset.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer->metadata_data_offset = 0;
+
+	if( arrow_writer_append_metadata(
+	     arrow_writer,
+	     4,
+	     4,
+	     &root_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_append_metadata_table(
+	     arrow_writer,
+	     4,
+	     message_field_sizes,
+	     &message_offset,
+	     message_field_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append message table.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer_set_metadata_offset(
+	 arrow_writer,
+	 root_offset,
+	 message_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( arrow_writer->metadata_data[ message_field_offsets[ 0 ] ] ),
+	 ARROW_WRITER_METADATA_VERSION );
+
+	arrow_writer->metadata_data[ message_field_offsets[ 1 ] ] = header_type;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( arrow_writer->metadata_data[ message_field_offsets[ 3 ] ] ),
+	 body_length );
+
+	*header_offset = message_field_offsets[ 2 ];
+
+	return( 1 );
+}
+
+/* Writes the encapsulated message metadata
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_message_metadata(
+     arrow_writer_t *arrow_writer,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	uint8_t message_prefix[ 8 ];
+
+	static char *function  = "arrow_writer_write_message_metadata";
+	size_t metadata_offset = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	/* Pad the metadata so that the message body is 8-byte aligned
+	 */
+	if( arrow_writer_append_metadata(
+	     arrow_writer,
+	     8,
+	     0,
+	     &metadata_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to pad metadata.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 message_prefix,
+	 0xffffffffUL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( message_prefix[ 4 ] ),
+	 (uint32_t) arrow_writer->metadata_data_offset );
+
+	output_buffer_write_data(
+	 output_buffer,
+	 (char *) message_prefix,
+	 8 );
+
+	output_buffer_write_data(
+	 output_buffer,
+	 (char *) arrow_writer->metadata_data,
+	 arrow_writer->metadata_data_offset );
+
+	return( 1 );
+}
+
+/* Writes the schema message
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_schema(
+     arrow_writer_t *arrow_writer,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	/* Schema: endianness (not stored, defaults to little-endian), fields
+	 */
+	uint8_t schema_field_sizes[ 2 ] = { 0, 4 };
+
+	/* Field: name, nullable, type_type, type, dictionary (not stored), children
+	 */
+	uint8_t field_field_sizes[ 6 ]  = { 4, 1, 1, 4, 0, 4 };
+
+	uint8_t type_field_sizes[ 2 ];
+	size_t field_field_offsets[ 6 ];
+	size_t schema_field_offsets[ 2 ];
+	size_t type_field_offsets[ 2 ];
+
+	arrow_writer_column_t *column   = NULL;
+	static char *function           = "arrow_writer_write_schema";
+	size_t children_vector_offset   = 0;
+	size_t field_offset             = 0;
+	size_t fields_vector_offset     = 0;
+	size_t header_offset            = 0;
+	size_t schema_offset            = 0;
+	size_t string_offset            = 0;
+	size_t type_offset              = 0;
+	int column_index                = 0;
+	int number_of_type_fields       = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_append_message_metadata(
+	     arrow_writer,
+	     ARROW_WRITER_MESSAGE_HEADER_SCHEMA,
+	     0,
+	     &header_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append message.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_append_metadata_table(
+	     arrow_writer,
+	     2,
+	     schema_field_sizes,
+	     &schema_offset,
+	     schema_field_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append schema table.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer_set_metadata_offset(
+	 arrow_writer,
+	 header_offset,
+	 schema_offset );
+
+	if( arrow_writer_append_metadata_vector(
+	     arrow_writer,
+	     4,
+	     4,
+	     arrow_writer->number_of_columns,
+	     &fields_vector_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append fields vector.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer_set_metadata_offset(
+	 arrow_writer,
+	 schema_field_offsets[ 1 ],
+	 fields_vector_offset );
+
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( ( arrow_writer->columns )[ column_index ] );
+
+		if( arrow_writer_append_metadata_table(
+		     arrow_writer,
+		     6,
+		     field_field_sizes,
+		     &field_offset,
+		     field_field_offsets,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append field table: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		arrow_writer_set_metadata_offset(
+		 arrow_writer,
+		 fields_vector_offset + 4 + ( 4 * column_index ),
+		 field_offset );
+
+		if( arrow_writer_append_metadata_string(
+		     arrow_writer,
+		     column->name,
+		     column->name_size,
+		     &string_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append field: %d name.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		arrow_writer_set_metadata_offset(
+		 arrow_writer,
+		 field_field_offsets[ 0 ],
+		 string_offset );
+
+		arrow_writer->metadata_data[ field_field_offsets[ 1 ] ] = 1;
+		arrow_writer->metadata_data[ field_field_offsets[ 2 ] ] = column->arrow_type;
+
+		switch( column->arrow_type )
+		{
+			case ARROW_WRITER_TYPE_INTEGER:
+				/* Int: bitWidth, is_signed
+				 */
+				type_field_sizes[ 0 ] = 4;
+				type_field_sizes[ 1 ] = 1;
+				number_of_type_fields = 2;
+				break;
+
+			case ARROW_WRITER_TYPE_FLOATING_POINT:
+				/* FloatingPoint: precision
+				 */
+				type_field_sizes[ 0 ] = 2;
+				number_of_type_fields = 1;
+				break;
+
+			case ARROW_WRITER_TYPE_TIMESTAMP:
+				/* Timestamp: unit, timezone
+				 */
+				type_field_sizes[ 0 ] = 2;
+				type_field_sizes[ 1 ] = 4;
+				number_of_type_fields = 2;
+				break;
+
+			default:
+				/* Binary, Bool and Utf8 have no fields
+				 */
+				number_of_type_fields = 0;
+				break;
+		}
+		if( arrow_writer_append_metadata_table(
+		     arrow_writer,
+		     number_of_type_fields,
+		     type_field_sizes,
+		     &type_offset,
+		     type_field_offsets,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append field: %d type table.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		arrow_writer_set_metadata_offset(
+		 arrow_writer,
+		 field_field_offsets[ 3 ],
+		 type_offset );
+
+		switch( column->arrow_type )
+		{
+			case ARROW_WRITER_TYPE_INTEGER:
+				byte_stream_copy_from_uint32_little_endian(
+				 &( arrow_writer->metadata_data[ type_field_offsets[ 0 ] ] ),
+				 (uint32_t) column->value_size * 8 );
+
+				arrow_writer->metadata_data[ type_field_offsets[ 1 ] ] = column->is_signed;
+
+				break;
+
+			case ARROW_WRITER_TYPE_FLOATING_POINT:
+				/* The precision is SINGLE (1) or DOUBLE (2)
+				 */
+				byte_stream_copy_from_uint16_little_endian(
+				 &( arrow_writer->metadata_data[ type_field_offsets[ 0 ] ] ),
+				 (uint16_t) ( ( column->value_size == 4 ) ? 1 : 2 ) );
+
+				break;
+
+			case ARROW_WRITER_TYPE_TIMESTAMP:
+				byte_stream_copy_from_uint16_little_endian(
+				 &( arrow_writer->metadata_data[ type_field_offsets[ 0 ] ] ),
+				 ARROW_WRITER_TIME_UNIT_MICROSECOND );
+
+				if( arrow_writer_append_metadata_string(
+				     arrow_writer,
+				     (uint8_t *) "UTC",
+				     3,
+				     &string_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append field: %d timezone.",
+					 function,
+					 column_index );
+
+					return( -1 );
+				}
+				arrow_writer_set_metadata_offset(
+				 arrow_writer,
+				 type_field_offsets[ 1 ],
+				 string_offset );
+
+				break;
+
+			default:
+				break;
+		}
+		/* Readers require the children vector even if it is empty
+		 */
+		if( arrow_writer_append_metadata_vector(
+		     arrow_writer,
+		     4,
+		     4,
+		     0,
+		     &children_vector_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append field: %d children vector.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		arrow_writer_set_metadata_offset(
+		 arrow_writer,
+		 field_field_offsets[ 5 ],
+		 children_vector_offset );
+	}
+	if( arrow_writer_write_message_metadata(
+	     arrow_writer,
+	     output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write schema message.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a record value to a column of the current record batch
+ * A record of NULL is used to append a value that is not set
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_value(
+     arrow_writer_t *arrow_writer,
+     arrow_writer_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function    = "arrow_writer_append_value";
+	size_t row_index         = 0;
+	double value_double      = 0.0;
+	float value_float        = 0.0;
+	int64_t timestamp        = 0;
+	uint64_t value_64bit     = 0;
+	uint32_t value_32bit     = 0;
+	uint16_t value_16bit     = 0;
+	uint8_t value_8bit       = 0;
+	uint8_t value_data_flags = 0;
+	int result               = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	row_index = (size_t) arrow_writer->number_of_rows;
+
+	if( record != NULL )
+	{
+		if( libesedb_record_get_value_data_flags(
+		     record,
+		     record_value_entry,
+		     &value_data_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d data flags.",
+			 function,
+			 record_value_entry );
+
+			return( -1 );
+		}
+		/* Multi values have no equivalent in the flat schema and are stored as not set
+		 */
+		if( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+		{
+			result = 0;
+		}
+		else if( ( column->arrow_type == ARROW_WRITER_TYPE_UTF8 )
+		      || ( column->arrow_type == ARROW_WRITER_TYPE_BINARY ) )
+		{
+			result = arrow_writer_append_data_value(
+			          column,
+			          record,
+			          record_value_entry,
+			          value_data_flags,
+			          log_handle,
+			          error );
+		}
+		else if( ( value_data_flags & ~( LIBESEDB_VALUE_FLAG_VARIABLE_SIZE ) ) == 0 )
+		{
+			switch( column->column_type )
+			{
+				case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+					result = libesedb_record_get_value_boolean(
+						  record,
+						  record_value_entry,
+						  &value_8bit,
+						  error );
+
+					if( ( result == 1 )
+					 && ( value_8bit != 0 ) )
+					{
+						column->values_data[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+					}
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+					result = libesedb_record_get_value_8bit(
+						  record,
+						  record_value_entry,
+						  &value_8bit,
+						  error );
+
+					if( result == 1 )
+					{
+						column->values_data[ row_index ] = value_8bit;
+					}
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+					result = libesedb_record_get_value_16bit(
+						  record,
+						  record_value_entry,
+						  &value_16bit,
+						  error );
+
+					if( result == 1 )
+					{
+						byte_stream_copy_from_uint16_little_endian(
+						 &( column->values_data[ row_index * 2 ] ),
+						 value_16bit );
+					}
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+					result = libesedb_record_get_value_32bit(
+						  record,
+						  record_value_entry,
+						  &value_32bit,
+						  error );
+
+					if( result == 1 )
+					{
+						byte_stream_copy_from_uint32_little_endian(
+						 &( column->values_data[ row_index * 4 ] ),
+						 value_32bit );
+					}
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_CURRENCY:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+					result = libesedb_record_get_value_64bit(
+						  record,
+						  record_value_entry,
+						  &value_64bit,
+						  error );
+
+					if( result == 1 )
+					{
+						byte_stream_copy_from_uint64_little_endian(
+						 &( column->values_data[ row_index * 8 ] ),
+						 value_64bit );
+					}
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+					result = libesedb_record_get_value_floating_point_32bit(
+						  record,
+						  record_value_entry,
+						  &value_float,
+						  error );
+
+					if( result == 1 )
+					{
+						memory_copy(
+						 &value_32bit,
+						 &value_float,
+						 sizeof( uint32_t ) );
+
+						byte_stream_copy_from_uint32_little_endian(
+						 &( column->values_data[ row_index * 4 ] ),
+						 value_32bit );
+					}
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+					result = libesedb_record_get_value_floating_point_64bit(
+						  record,
+						  record_value_entry,
+						  &value_double,
+						  error );
+
+					if( result == 1 )
+					{
+						memory_copy(
+						 &value_64bit,
+						 &value_double,
+						 sizeof( uint64_t ) );
+
+						byte_stream_copy_from_uint64_little_endian(
+						 &( column->values_data[ row_index * 8 ] ),
+						 value_64bit );
+					}
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+					result = libesedb_record_get_value_filetime(
+						  record,
+						  record_value_entry,
+						  &value_64bit,
+						  error );
+
+					if( ( result == 1 )
+					 && ( value_64bit > (uint64_t) INT64_MAX ) )
+					{
+						result = 0;
+					}
+					if( result == 1 )
+					{
+						/* Convert the FILETIME into microseconds since the POSIX epoch,
+						 * rounded towards negative infinity
+						 */
+						timestamp = (int64_t) value_64bit - ARROW_WRITER_FILETIME_POSIX_EPOCH_DELTA;
+
+						if( ( timestamp < 0 )
+						 && ( ( timestamp % 10 ) != 0 ) )
+						{
+							timestamp = ( timestamp / 10 ) - 1;
+						}
+						else
+						{
+							timestamp /= 10;
+						}
+						byte_stream_copy_from_uint64_little_endian(
+						 &( column->values_data[ row_index * 8 ] ),
+						 (uint64_t) timestamp );
+					}
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 record_value_entry );
+
+			return( -1 );
+		}
+	}
+	if( result != 0 )
+	{
+		column->validity_data[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+	}
+	else
+	{
+		column->null_count += 1;
+
+		if( column->value_size > 0 )
+		{
+			if( memory_set(
+			     &( column->values_data[ row_index * column->value_size ] ),
+			     0,
+			     column->value_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( column->offsets_data != NULL )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( column->offsets_data[ ( row_index + 1 ) * 4 ] ),
+		 (uint32_t) column->values_data_offset );
+	}
+	return( 1 );
+}
+
+/* Appends a string or binary data record value to the values data of a column
+ * A long value that cannot be read is logged and stored as not set
+ * Returns 1 if successful, 0 if the value is not set or -1 on error
+ */
+int arrow_writer_append_data_value(
+     arrow_writer_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint8_t value_data_flags,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_t *long_value = NULL;
+	uint8_t *value_data               = NULL;
+	static char *function             = "arrow_writer_append_data_value";
+	size64_t long_value_data_size     = 0;
+	size_t string_length              = 0;
+	size_t value_data_size            = 0;
+	int result                        = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	{
+		if( libesedb_record_get_long_value(
+		     record,
+		     record_value_entry,
+		     &long_value,
+		     error ) != 1 )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "Unable to retrieve long value of record entry: %d.\n",
+			 record_value_entry );
+
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to retrieve long value of record entry: %d.\n",
+				 function,
+				 record_value_entry );
+			}
+			libcerror_error_free(
+			 error );
+
+			return( 0 );
+		}
+		if( column->arrow_type == ARROW_WRITER_TYPE_UTF8 )
+		{
+			result = libesedb_long_value_get_utf8_string_size(
+			          long_value,
+			          &value_data_size,
+			          error );
+		}
+		else
+		{
+			result = libesedb_long_value_get_data_size(
+			          long_value,
+			          &long_value_data_size,
+			          error );
+
+			if( long_value_data_size > (size64_t) INT32_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid long value data size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			value_data_size = (size_t) long_value_data_size;
+		}
+	}
+	else if( column->arrow_type == ARROW_WRITER_TYPE_UTF8 )
+	{
+		result = libesedb_record_get_value_utf8_string_size(
+		          record,
+		          record_value_entry,
+		          &value_data_size,
+		          error );
+	}
+	else if( ( column->column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		result = libesedb_record_get_value_binary_data_size(
+		          record,
+		          record_value_entry,
+		          &value_data_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_record_get_value_data_size(
+		          record,
+		          record_value_entry,
+		          &value_data_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data size.",
+		 function,
+		 record_value_entry );
+
+		goto on_error;
+	}
+	if( ( result == 0 )
+	 || ( value_data_size == 0 ) )
+	{
+		if( long_value != NULL )
+		{
+			if( libesedb_long_value_free(
+			     &long_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		return( 0 );
+	}
+	if( arrow_writer_resize_values_data(
+	     column,
+	     column->values_data_offset + value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize values data.",
+		 function );
+
+		goto on_error;
+	}
+	value_data = &( column->values_data[ column->values_data_offset ] );
+
+	if( long_value != NULL )
+	{
+		if( column->arrow_type == ARROW_WRITER_TYPE_UTF8 )
+		{
+			result = libesedb_long_value_get_utf8_string(
+			          long_value,
+			          value_data,
+			          value_data_size,
+			          error );
+		}
+		else
+		{
+			result = libesedb_long_value_get_data(
+			          long_value,
+			          value_data,
+			          value_data_size,
+			          error );
+		}
+	}
+	else if( column->arrow_type == ARROW_WRITER_TYPE_UTF8 )
+	{
+		result = libesedb_record_get_value_utf8_string(
+		          record,
+		          record_value_entry,
+		          value_data,
+		          value_data_size,
+		          error );
+	}
+	else if( ( column->column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		result = libesedb_record_get_value_binary_data(
+		          record,
+		          record_value_entry,
+		          value_data,
+		          value_data_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_record_get_value_data(
+		          record,
+		          record_value_entry,
+		          value_data,
+		          value_data_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data.",
+		 function,
+		 record_value_entry );
+
+		goto on_error;
+	}
+	if( long_value != NULL )
+	{
+		if( libesedb_long_value_free(
+		     &long_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free long value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( column->arrow_type == ARROW_WRITER_TYPE_UTF8 )
+	{
+		/* Strings are stored without the end-of-string character
+		 */
+		string_length = 0;
+
+		while( ( string_length < value_data_size )
+		    && ( value_data[ string_length ] != 0 ) )
+		{
+			string_length++;
+		}
+		value_data_size = string_length;
+	}
+	column->values_data_offset += value_data_size;
+
+	return( 1 );
+
+on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a record to the current record batch
+ * The record batch is written when it contains the maximum number of rows
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_record(
+     arrow_writer_t *arrow_writer,
+     libesedb_record_t *record,
+     output_buffer_t *output_buffer,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column   = NULL;
+	libesedb_record_t *value_record = NULL;
+	static char *function           = "arrow_writer_append_record";
+	int column_index                = 0;
+	int number_of_values            = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( ( arrow_writer->columns )[ column_index ] );
+
+		/* Columns without a corresponding value are stored as not set
+		 */
+		if( column->record_value_entry < number_of_values )
+		{
+			value_record = record;
+		}
+		else
+		{
+			value_record = NULL;
+		}
+		if( arrow_writer_append_value(
+		     arrow_writer,
+		     column,
+		     value_record,
+		     column->record_value_entry,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+	}
+	arrow_writer->number_of_rows += 1;
+
+	if( arrow_writer->number_of_rows >= arrow_writer->maximum_number_of_rows )
+	{
+		if( arrow_writer_write_record_batch(
+		     arrow_writer,
+		     output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record batch.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the current record batch, if it contains rows
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_record_batch(
+     arrow_writer_t *arrow_writer,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	/* RecordBatch: length, nodes, buffers
+	 */
+	uint8_t record_batch_field_sizes[ 3 ] = { 8, 4, 4 };
+
+	uint8_t padding[ 8 ]                  = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	size_t buffer_sizes[ 3 ];
+	size_t record_batch_field_offsets[ 3 ];
+
+	arrow_writer_column_t *column         = NULL;
+	static char *function                 = "arrow_writer_write_record_batch";
+	size_t bitmap_size                    = 0;
+	size_t body_length                    = 0;
+	size_t body_offset                    = 0;
+	size_t buffer_offset                  = 0;
+	size_t buffers_vector_offset          = 0;
+	size_t header_offset                  = 0;
+	size_t nodes_vector_offset            = 0;
+	size_t record_batch_offset            = 0;
+	uint8_t *buffer_data                  = NULL;
+	int buffer_index                      = 0;
+	int column_index                      = 0;
+	int number_of_buffers                 = 0;
+	int number_of_column_buffers          = 0;
+	int pass                              = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->number_of_rows == 0 )
+	{
+		return( 1 );
+	}
+	bitmap_size = ( (size_t) arrow_writer->number_of_rows + 7 ) / 8;
+
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( ( arrow_writer->columns )[ column_index ] );
+
+		body_length += arrow_writer_padded_size( bitmap_size );
+
+		if( column->offsets_data != NULL )
+		{
+			body_length       += arrow_writer_padded_size( ( (size_t) arrow_writer->number_of_rows + 1 ) * 4 );
+			body_length       += arrow_writer_padded_size( column->values_data_offset );
+			number_of_buffers += 3;
+		}
+		else
+		{
+			if( column->arrow_type == ARROW_WRITER_TYPE_BOOLEAN )
+			{
+				body_length += arrow_writer_padded_size( bitmap_size );
+			}
+			else
+			{
+				body_length += arrow_writer_padded_size( (size_t) arrow_writer->number_of_rows * column->value_size );
+			}
+			number_of_buffers += 2;
+		}
+	}
+	if( arrow_writer->number_of_columns == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Arrow writer - missing columns.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first pass determines the body layout and creates the metadata,
+	 * the second pass writes the body
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		body_offset  = 0;
+		buffer_index = 0;
+
+		for( column_index = 0;
+		     column_index < arrow_writer->number_of_columns;
+		     column_index++ )
+		{
+			column = &( ( arrow_writer->columns )[ column_index ] );
+
+			/* The buffers are the validity bitmap followed by either the values
+			 * or the offsets and the values of variable size values
+			 */
+			buffer_sizes[ 0 ] = bitmap_size;
+
+			if( column->offsets_data != NULL )
+			{
+				buffer_sizes[ 1 ]        = ( (size_t) arrow_writer->number_of_rows + 1 ) * 4;
+				buffer_sizes[ 2 ]        = column->values_data_offset;
+				number_of_column_buffers = 3;
+			}
+			else
+			{
+				if( column->arrow_type == ARROW_WRITER_TYPE_BOOLEAN )
+				{
+					buffer_sizes[ 1 ] = bitmap_size;
+				}
+				else
+				{
+					buffer_sizes[ 1 ] = (size_t) arrow_writer->number_of_rows * column->value_size;
+				}
+				number_of_column_buffers = 2;
+			}
+			if( pass == 1 )
+			{
+				if( column_index == 0 )
+				{
+					if( arrow_writer_write_message_metadata(
+					     arrow_writer,
+					     output_buffer,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to write record batch message.",
+						 function );
+
+						return( -1 );
+					}
+				}
+				for( buffer_index = 0;
+				     buffer_index < number_of_column_buffers;
+				     buffer_index++ )
+				{
+					if( buffer_index == 0 )
+					{
+						buffer_data = column->validity_data;
+					}
+					else if( ( buffer_index == 1 )
+					      && ( column->offsets_data != NULL ) )
+					{
+						buffer_data = column->offsets_data;
+					}
+					else
+					{
+						buffer_data = column->values_data;
+					}
+					output_buffer_write_data(
+					 output_buffer,
+					 (char *) buffer_data,
+					 buffer_sizes[ buffer_index ] );
+
+					output_buffer_write_data(
+					 output_buffer,
+					 (char *) padding,
+					 arrow_writer_padded_size( buffer_sizes[ buffer_index ] ) - buffer_sizes[ buffer_index ] );
+				}
+				continue;
+			}
+			if( column_index == 0 )
+			{
+				if( arrow_writer_append_message_metadata(
+				     arrow_writer,
+				     ARROW_WRITER_MESSAGE_HEADER_RECORD_BATCH,
+				     (uint64_t) body_length,
+				     &header_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append message.",
+					 function );
+
+					return( -1 );
+				}
+				if( arrow_writer_append_metadata_table(
+				     arrow_writer,
+				     3,
+				     record_batch_field_sizes,
+				     &record_batch_offset,
+				     record_batch_field_offsets,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append record batch table.",
+					 function );
+
+					return( -1 );
+				}
+				arrow_writer_set_metadata_offset(
+				 arrow_writer,
+				 header_offset,
+				 record_batch_offset );
+
+				byte_stream_copy_from_uint64_little_endian(
+				 &( arrow_writer->metadata_data[ record_batch_field_offsets[ 0 ] ] ),
+				 (uint64_t) arrow_writer->number_of_rows );
+
+				/* The FieldNode and Buffer structs consist of 2 64-bit values
+				 */
+				if( arrow_writer_append_metadata_vector(
+				     arrow_writer,
+				     16,
+				     8,
+				     arrow_writer->number_of_columns,
+				     &nodes_vector_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append nodes vector.",
+					 function );
+
+					return( -1 );
+				}
+				arrow_writer_set_metadata_offset(
+				 arrow_writer,
+				 record_batch_field_offsets[ 1 ],
+				 nodes_vector_offset );
+
+				if( arrow_writer_append_metadata_vector(
+				     arrow_writer,
+				     16,
+				     8,
+				     number_of_buffers,
+				     &buffers_vector_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append buffers vector.",
+					 function );
+
+					return( -1 );
+				}
+				arrow_writer_set_metadata_offset(
+				 arrow_writer,
+				 record_batch_field_offsets[ 2 ],
+				 buffers_vector_offset );
+
+				buffer_offset = buffers_vector_offset + 4;
+			}
+			byte_stream_copy_from_uint64_little_endian(
+			 &( arrow_writer->metadata_data[ nodes_vector_offset + 4 + ( 16 * column_index ) ] ),
+			 (uint64_t) arrow_writer->number_of_rows );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( arrow_writer->metadata_data[ nodes_vector_offset + 4 + ( 16 * column_index ) + 8 ] ),
+			 (uint64_t) column->null_count );
+
+			for( buffer_index = 0;
+			     buffer_index < number_of_column_buffers;
+			     buffer_index++ )
+			{
+				byte_stream_copy_from_uint64_little_endian(
+				 &( arrow_writer->metadata_data[ buffer_offset ] ),
+				 (uint64_t) body_offset );
+
+				byte_stream_copy_from_uint64_little_endian(
+				 &( arrow_writer->metadata_data[ buffer_offset + 8 ] ),
+				 (uint64_t) buffer_sizes[ buffer_index ] );
+
+				buffer_offset += 16;
+				body_offset   += arrow_writer_padded_size( buffer_sizes[ buffer_index ] );
+			}
+		}
+	}
+	/* Reset the record batch
+	 */
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( ( arrow_writer->columns )[ column_index ] );
+
+		if( memory_set(
+		     column->validity_data,
+		     0,
+		     bitmap_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear validity data.",
+			 function );
+
+			return( -1 );
+		}
+		if( column->arrow_type == ARROW_WRITER_TYPE_BOOLEAN )
+		{
+			if( memory_set(
+			     column->values_data,
+			     0,
+			     bitmap_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear values data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		column->values_data_offset = 0;
+		column->null_count         = 0;
+	}
+	arrow_writer->number_of_rows = 0;
+
+	return( 1 );
+}
+
+/* Writes the current record batch and the end-of-stream marker
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_end_of_stream(
+     arrow_writer_t *arrow_writer,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	uint8_t end_of_stream[ 8 ] = { 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 };
+
+	static char *function      = "arrow_writer_write_end_of_stream";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_write_record_batch(
+	     arrow_writer,
+	     output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record batch.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer_write_data(
+	 output_buffer,
+	 (char *) end_of_stream,
+	 8 );
+
+	return( 1 );
+}
+
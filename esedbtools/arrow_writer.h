@@ -0,0 +1,264 @@
+/*
+ * Apache Arrow IPC stream writer
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ARROW_WRITER_H )
+#define _ARROW_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+#include "log_handle.h"
+#include "output_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The Arrow data types, the values are those of the Type union of the Arrow schema
+ */
+enum ARROW_WRITER_TYPES
+{
+	ARROW_WRITER_TYPE_INTEGER		= 2,
+	ARROW_WRITER_TYPE_FLOATING_POINT	= 3,
+	ARROW_WRITER_TYPE_BINARY		= 4,
+	ARROW_WRITER_TYPE_UTF8			= 5,
+	ARROW_WRITER_TYPE_BOOLEAN		= 6,
+	ARROW_WRITER_TYPE_TIMESTAMP		= 10
+};
+
+typedef struct arrow_writer_column arrow_writer_column_t;
+
+struct arrow_writer_column
+{
+	/* The UTF-8 encoded name, without end-of-string character
+	 */
+	uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The record value entry
+	 */
+	int record_value_entry;
+
+	/* The (ESE) column type
+	 */
+	uint32_t column_type;
+
+	/* The Arrow data type
+	 */
+	uint8_t arrow_type;
+
+	/* The size of a fixed size value in bytes
+	 * or 0 for booleans and variable size values
+	 */
+	uint8_t value_size;
+
+	/* Value to indicate the integer is signed
+	 */
+	uint8_t is_signed;
+
+	/* The validity bitmap
+	 */
+	uint8_t *validity_data;
+
+	/* The offsets of variable size values
+	 */
+	uint8_t *offsets_data;
+
+	/* The values data
+	 */
+	uint8_t *values_data;
+
+	/* The values data size
+	 */
+	size_t values_data_size;
+
+	/* The values data offset
+	 */
+	size_t values_data_offset;
+
+	/* The number of values that are not set in the current record batch
+	 */
+	int null_count;
+};
+
+typedef struct arrow_writer arrow_writer_t;
+
+struct arrow_writer
+{
+	/* The columns
+	 */
+	arrow_writer_column_t *columns;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The maximum number of rows in a record batch
+	 */
+	int maximum_number_of_rows;
+
+	/* The number of rows in the current record batch
+	 */
+	int number_of_rows;
+
+	/* The metadata (flatbuffer) data
+	 */
+	uint8_t *metadata_data;
+
+	/* The metadata data size
+	 */
+	size_t metadata_data_size;
+
+	/* The metadata data offset
+	 */
+	size_t metadata_data_offset;
+};
+
+int arrow_writer_initialize(
+     arrow_writer_t **arrow_writer,
+     int maximum_number_of_rows,
+     libcerror_error_t **error );
+
+int arrow_writer_free(
+     arrow_writer_t **arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_append_column(
+     arrow_writer_t *arrow_writer,
+     const uint8_t *name,
+     size_t name_size,
+     int record_value_entry,
+     uint32_t column_type,
+     libcerror_error_t **error );
+
+int arrow_writer_set_columns_from_table(
+     arrow_writer_t *arrow_writer,
+     libesedb_table_t *table,
+     const int *value_entries,
+     int number_of_value_entries,
+     libcerror_error_t **error );
+
+int arrow_writer_set_columns_from_record(
+     arrow_writer_t *arrow_writer,
+     libesedb_record_t *record,
+     libcerror_error_t **error );
+
+int arrow_writer_resize_values_data(
+     arrow_writer_column_t *column,
+     size_t required_values_data_size,
+     libcerror_error_t **error );
+
+int arrow_writer_append_metadata(
+     arrow_writer_t *arrow_writer,
+     size_t alignment,
+     size_t size,
+     size_t *metadata_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_append_metadata_table(
+     arrow_writer_t *arrow_writer,
+     int number_of_fields,
+     const uint8_t *field_sizes,
+     size_t *table_offset,
+     size_t *field_offsets,
+     libcerror_error_t **error );
+
+int arrow_writer_append_metadata_vector(
+     arrow_writer_t *arrow_writer,
+     size_t element_size,
+     size_t element_alignment,
+     int number_of_elements,
+     size_t *vector_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_append_metadata_string(
+     arrow_writer_t *arrow_writer,
+     const uint8_t *string,
+     size_t string_length,
+     size_t *string_offset,
+     libcerror_error_t **error );
+
+void arrow_writer_set_metadata_offset(
+      arrow_writer_t *arrow_writer,
+      size_t metadata_offset,
+      size_t target_offset );
+
+int arrow_writer_append_message_metadata(
+     arrow_writer_t *arrow_writer,
+     uint8_t header_type,
+     uint64_t body_length,
+     size_t *header_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_write_message_metadata(
+     arrow_writer_t *arrow_writer,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int arrow_writer_write_schema(
+     arrow_writer_t *arrow_writer,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int arrow_writer_append_value(
+     arrow_writer_t *arrow_writer,
+     arrow_writer_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int arrow_writer_append_data_value(
+     arrow_writer_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint8_t value_data_flags,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int arrow_writer_append_record(
+     arrow_writer_t *arrow_writer,
+     libesedb_record_t *record,
+     output_buffer_t *output_buffer,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int arrow_writer_write_record_batch(
+     arrow_writer_t *arrow_writer,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int arrow_writer_write_end_of_stream(
+     arrow_writer_t *arrow_writer,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ARROW_WRITER_H ) */
+
@@ -0,0 +1,364 @@
+/*
+ * Checkpoint file
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "checkpoint_file.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcfile.h"
+
+/* Reads a checkpoint file
+ * The checkpoint file contains the index of the next record to export, the offset
+ * of the output stream up to which the preceding records were written and the checksum
+ * of the export settings, such as: "1024 65536 2166136261"
+ * A checkpoint file that cannot be parsed is considered to be at the start of the export
+ * Returns 1 if successful, 0 if the checkpoint file does not exist or -1 on error
+ */
+int checkpoint_file_read(
+     const system_character_t *filename,
+     uint32_t settings_checksum,
+     int *record_index,
+     off64_t *stream_offset,
+     libcerror_error_t **error )
+{
+	char line[ 64 ];
+	uint64_t values[ 3 ];
+
+	FILE *stream          = NULL;
+	static char *function = "checkpoint_file_read";
+	size_t line_index     = 0;
+	size_t value_start    = 0;
+	int result            = 0;
+	int value_index       = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+	          filename,
+	          error );
+#else
+	result = libcfile_file_exists(
+	          filename,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	*record_index  = 0;
+	*stream_offset = 0;
+
+	/* An interrupted write of the checkpoint file can leave it empty or truncated
+	 */
+	if( file_stream_get_string(
+	     stream,
+	     line,
+	     64 ) != NULL )
+	{
+		for( value_index = 0;
+		     value_index < 3;
+		     value_index++ )
+		{
+			values[ value_index ] = 0;
+			value_start           = line_index;
+
+			while( ( line_index < 63 )
+			    && ( line[ line_index ] >= '0' )
+			    && ( line[ line_index ] <= '9' ) )
+			{
+				if( values[ value_index ] > (uint64_t) ( INT64_MAX / 10 ) )
+				{
+					break;
+				}
+				values[ value_index ] *= 10;
+				values[ value_index ] += (uint64_t) ( line[ line_index ] - '0' );
+
+				line_index++;
+			}
+			if( line_index == value_start )
+			{
+				break;
+			}
+			if( ( value_index < 2 )
+			 && ( line[ line_index++ ] != ' ' ) )
+			{
+				break;
+			}
+		}
+		if( ( value_index == 3 )
+		 && ( ( line[ line_index ] == '\n' )
+		  ||  ( line[ line_index ] == '\r' ) )
+		 && ( values[ 0 ] <= (uint64_t) INT32_MAX )
+		 && ( values[ 1 ] <= (uint64_t) INT64_MAX )
+		 && ( values[ 2 ] <= (uint64_t) UINT32_MAX ) )
+		{
+			*record_index  = (int) values[ 0 ];
+			*stream_offset = (off64_t) values[ 1 ];
+
+			if( (uint32_t) values[ 2 ] != settings_checksum )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISMATCH,
+				 "%s: export settings of: %" PRIs_SYSTEM " do not match, the format, compression method, columns and condition need to be the same to resume.",
+				 function,
+				 filename );
+
+				file_stream_close(
+				 stream );
+
+				return( -1 );
+			}
+		}
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a checkpoint file
+ * Returns 1 if successful or -1 on error
+ */
+int checkpoint_file_write(
+     const system_character_t *filename,
+     uint32_t settings_checksum,
+     int record_index,
+     off64_t stream_offset,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "checkpoint_file_write";
+	int print_count       = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid record index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid stream offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	print_count = fprintf(
+	               stream,
+	               "%d %" PRIi64 " %" PRIu32 "\n",
+	               record_index,
+	               (int64_t) stream_offset,
+	               settings_checksum );
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	if( print_count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes a checkpoint file
+ * Returns 1 if successful or -1 on error
+ */
+int checkpoint_file_remove(
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "checkpoint_file_remove";
+	int result            = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_remove_wide(
+	          filename,
+	          error );
+#else
+	result = libcfile_file_remove(
+	          filename,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 "%s: unable to remove: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
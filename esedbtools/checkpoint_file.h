@@ -0,0 +1,57 @@
+/*
+ * Checkpoint file
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CHECKPOINT_FILE_H )
+#define _CHECKPOINT_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int checkpoint_file_read(
+     const system_character_t *filename,
+     uint32_t settings_checksum,
+     int *record_index,
+     off64_t *stream_offset,
+     libcerror_error_t **error );
+
+int checkpoint_file_write(
+     const system_character_t *filename,
+     uint32_t settings_checksum,
+     int record_index,
+     off64_t stream_offset,
+     libcerror_error_t **error );
+
+int checkpoint_file_remove(
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CHECKPOINT_FILE_H ) */
+
@@ -60,26 +60,96 @@ void usage_fprint(
 	fprintf( stream, "Use esedbexport to export items stored in an Extensible Storage Engine (ESE)\n"
 	                 "Database (EDB) file\n\n" );
 
-	fprintf( stream, "Usage: esedbexport [ -c codepage ] [ -l logfile ] [ -m mode ] [ -t target ]\n"
-	                 "                   [ -T table_name ] [ -hvV ] source\n\n" );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	fprintf( stream, "Usage: esedbexport [ -b rows ] [ -c codepage ] [ -C column_names ]\n"
+	                 "                   [ -f format ] [ -j jobs ] [ -l logfile ] [ -m mode ]\n"
+	                 "                   [ -t target ] [ -T table_name ] [ -w condition ]\n"
+	                 "                   [ -z compression_method ] [ -hprvV ] source\n\n" );
+#else
+	fprintf( stream, "Usage: esedbexport [ -b rows ] [ -c codepage ] [ -C column_names ]\n"
+	                 "                   [ -f format ] [ -l logfile ] [ -m mode ] [ -t target ]\n"
+	                 "                   [ -T table_name ] [ -w condition ]\n"
+	                 "                   [ -z compression_method ] [ -hprvV ] source\n\n" );
+#endif
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+#if defined( HAVE_SQLITE3 )
+	fprintf( stream, "\t-b:     the number of records (rows) per record batch of the arrow\n"
+	                 "\t        output format or per transaction of the sqlite output\n"
+	                 "\t        format, for every output format this is also the number\n"
+	                 "\t        of records between export checkpoints (default is 65536)\n" );
+#else
+	fprintf( stream, "\t-b:     the number of records (rows) per record batch of the arrow\n"
+	                 "\t        output format, for every output format this is also the\n"
+	                 "\t        number of records between export checkpoints (default is\n"
+	                 "\t        65536)\n" );
+#endif
 	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
 	                 "\t        windows-932, windows-936, windows-1250, windows-1251,\n"
 	                 "\t        windows-1252 (default), windows-1253, windows-1254\n"
 	                 "\t        windows-1255, windows-1256, windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-C:     exports only the specified columns of the table, where\n"
+	                 "\t        column_names is a comma separated list (requires -T)\n" );
+#if defined( HAVE_SQLITE3 )
+	fprintf( stream, "\t-f:     output format, options: arrow, csv, jsonl, sqlite,\n"
+	                 "\t        text (default)\n"
+	                 "\t        'arrow' writes an Apache Arrow IPC stream,\n"
+	                 "\t        'csv' writes RFC 4180 comma separated values with a header,\n"
+	                 "\t        'jsonl' writes a JSON object per line, 'sqlite' writes\n"
+	                 "\t        the tables into a SQLite database with the suffix .db,\n"
+	                 "\t        'text' writes tab separated values\n" );
+#else
+	fprintf( stream, "\t-f:     output format, options: arrow, csv, jsonl, text (default)\n"
+	                 "\t        'arrow' writes an Apache Arrow IPC stream,\n"
+	                 "\t        'csv' writes RFC 4180 comma separated values with a header,\n"
+	                 "\t        'jsonl' writes a JSON object per line, 'text' writes tab\n"
+	                 "\t        separated values\n" );
+#endif
 	fprintf( stream, "\t-h:     shows this help\n" );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	fprintf( stream, "\t-j:     the number of concurrent export jobs (threads), where\n"
+	                 "\t        every job exports a table to its own file and jobs should\n"
+	                 "\t        be a value from 1 to 32 (default is 1)\n" );
+#endif
 	fprintf( stream, "\t-l:     logs information about the exported items\n" );
-	fprintf( stream, "\t-m:     export mode, option: all, tables (default)\n"
+	fprintf( stream, "\t-m:     export mode, option: all, carve, keys, tables (default)\n"
 	                 "\t        'all' exports all the tables or a single specified table with indexes,\n"
+	                 "\t        'carve' exports all the tables or a single specified table with\n"
+	                 "\t        the deleted records recovered from its pages, only supported\n"
+	                 "\t        by the text export format,\n"
+	                 "\t        'keys' exports all the tables or a single specified table with\n"
+	                 "\t        the keys and bookmarks of the index records in hexadecimal,\n"
 	                 "\t        'tables' exports all the tables or a single specified table\n" );
+	fprintf( stream, "\t-p:     prints the progress of the export of every table to stderr,\n"
+	                 "\t        such as records per second, MiB per second read, number of\n"
+	                 "\t        pages read, page cache hit ratio, number of decompressed\n"
+	                 "\t        bytes and the estimated time of completion\n" );
+	fprintf( stream, "\t-r:     resumes an interrupted export to the target, tables that\n"
+	                 "\t        were exported completely are skipped and the export of\n"
+	                 "\t        other tables continues from their last checkpoint, which\n"
+	                 "\t        requires the same -C, -f, -w and -z options\n" );
 	fprintf( stream, "\t-t:     specify the basename of the target directory to export to\n"
 	                 "\t        (default is the source filename) esedbexport will add the suffix\n"
 	                 "\t        .export to the basename\n" );
 	fprintf( stream, "\t-T:     exports only a specific table\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-w:     exports only the records (rows) of the table that match\n"
+	                 "\t        the condition, such as: \"Id >= 100\", where the operator\n"
+	                 "\t        is one of: =, !=, <, <=, > or >= and string values are\n"
+	                 "\t        compared case sensitive (requires -T)\n" );
+	fprintf( stream, "\t-z:     compresses the exported table and index files, options:\n"
+	                 "\t        none (default)" );
+#if defined( HAVE_ZLIB )
+	fprintf( stream, ", gzip" );
+#endif
+#if defined( HAVE_ZSTD )
+	fprintf( stream, ", zstd" );
+#endif
+	fprintf( stream, "\n"
+	                 "\t        'gzip' adds the suffix .gz and 'zstd' the suffix .zst to\n"
+	                 "\t        the exported files\n" );
 }
 
 /* Signal handler for esedbexport
@@ -136,7 +206,12 @@ int main( int argc, char * const argv[] )
 {
 	system_character_t *log_filename          = NULL;
 	system_character_t *option_ascii_codepage = NULL;
+	system_character_t *option_batch_rows     = NULL;
+	system_character_t *option_column_names   = NULL;
+	system_character_t *option_compression    = NULL;
+	system_character_t *option_export_format  = NULL;
 	system_character_t *option_export_mode    = NULL;
+	system_character_t *option_record_filter  = NULL;
 	system_character_t *option_table_name     = NULL;
 	system_character_t *option_target_path    = NULL;
 	system_character_t *path_separator        = NULL;
@@ -147,9 +222,15 @@ int main( int argc, char * const argv[] )
 	size_t source_length                      = 0;
 	size_t option_table_name_length           = 0;
 	system_integer_t option                   = 0;
+	uint8_t print_status_information          = 0;
+	uint8_t resume_export                     = 0;
 	int result                                = 0;
 	int verbose                               = 0;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	system_character_t *option_jobs           = NULL;
+#endif
+
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
@@ -183,7 +264,11 @@ int main( int argc, char * const argv[] )
 	while( ( option = esedbtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:hl:m:t:T:vV" ) ) ) != (system_integer_t) -1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	                   _SYSTEM_STRING( "b:C:c:f:hj:l:m:prt:T:vVw:z:" ) ) ) != (system_integer_t) -1 )
+#else
+	                   _SYSTEM_STRING( "b:C:c:f:hl:m:prt:T:vVw:z:" ) ) ) != (system_integer_t) -1 )
+#endif
 	{
 		switch( option )
 		{
@@ -199,17 +284,39 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'b':
+				option_batch_rows = optarg;
+
+				break;
+
 			case (system_integer_t) 'c':
 				option_ascii_codepage = optarg;
 
 				break;
 
+			case (system_integer_t) 'C':
+				option_column_names = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_export_format = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			case (system_integer_t) 'j':
+				option_jobs = optarg;
+
+				break;
+#endif
+
 			case (system_integer_t) 'l':
 				log_filename = optarg;
 
@@ -220,6 +327,16 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'p':
+				print_status_information = 1;
+
+				break;
+
+			case (system_integer_t) 'r':
+				resume_export = 1;
+
+				break;
+
 			case (system_integer_t) 't':
 				option_target_path = optarg;
 
@@ -240,6 +357,16 @@ int main( int argc, char * const argv[] )
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'w':
+				option_record_filter = optarg;
+
+				break;
+
+			case (system_integer_t) 'z':
+				option_compression = optarg;
+
+				break;
 		}
 	}
 	if( optind == argc )
@@ -253,6 +380,19 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
+	if( ( option_table_name == NULL )
+	 && ( ( option_column_names != NULL )
+	  || ( option_record_filter != NULL ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Column names and condition require a table name.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
 	source = argv[ optind ];
 
 	if( option_target_path == NULL )
@@ -308,9 +448,8 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-/* TODO
 	esedbexport_export_handle->print_status_information = print_status_information;
-*/
+
 	if( option_export_mode != NULL )
 	{
 		result = export_handle_set_export_mode(
@@ -333,6 +472,115 @@ int main( int argc, char * const argv[] )
 			 "Unsupported export mode defaulting to: tables.\n" );
 		}
 	}
+	if( option_export_format != NULL )
+	{
+		result = export_handle_set_export_format(
+			  esedbexport_export_handle,
+			  option_export_format,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set export format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported export format defaulting to: text.\n" );
+		}
+	}
+	if( ( esedbexport_export_handle->export_mode == EXPORT_MODE_KEYS )
+	 && ( esedbexport_export_handle->export_format == EXPORT_FORMAT_ARROW ) )
+	{
+		fprintf(
+		 stderr,
+		 "The keys export mode is not supported by the arrow export format.\n" );
+
+		goto on_error;
+	}
+	if( ( esedbexport_export_handle->export_mode == EXPORT_MODE_CARVE )
+	 && ( esedbexport_export_handle->export_format != EXPORT_FORMAT_TEXT ) )
+	{
+		fprintf(
+		 stderr,
+		 "The carve export mode is only supported by the text export format.\n" );
+
+		goto on_error;
+	}
+	if( resume_export != 0 )
+	{
+		/* The SQLite export format does not write checkpoints
+		 */
+		if( esedbexport_export_handle->export_format == EXPORT_FORMAT_SQLITE )
+		{
+			fprintf(
+			 stderr,
+			 "Resume is not supported by the sqlite export format.\n" );
+
+			goto on_error;
+		}
+		esedbexport_export_handle->resume = 1;
+	}
+	if( option_compression != NULL )
+	{
+		result = export_handle_set_compression_method(
+		          esedbexport_export_handle,
+		          option_compression,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set compression method.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported compression method defaulting to: none.\n" );
+		}
+		/* The SQLite export format writes a database instead of item files
+		 */
+		if( ( esedbexport_export_handle->export_format == EXPORT_FORMAT_SQLITE )
+		 && ( esedbexport_export_handle->compression_method != EXPORT_COMPRESSION_METHOD_NONE ) )
+		{
+			fprintf(
+			 stderr,
+			 "Compression is not supported by the sqlite export format.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_batch_rows != NULL )
+	{
+		result = export_handle_set_number_of_rows_per_batch(
+		          esedbexport_export_handle,
+		          option_batch_rows,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of rows per batch.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of rows per batch defaulting to: 65536.\n" );
+		}
+	}
 	if( option_ascii_codepage != NULL )
 	{
 		result = export_handle_set_ascii_codepage(
@@ -355,6 +603,78 @@ int main( int argc, char * const argv[] )
 			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
 		}
 	}
+	if( option_column_names != NULL )
+	{
+		result = export_handle_set_column_names(
+		          esedbexport_export_handle,
+		          option_column_names,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set column names.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported column names.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_record_filter != NULL )
+	{
+		result = export_handle_set_record_condition(
+		          esedbexport_export_handle,
+		          option_record_filter,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set record condition.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported record condition.\n" );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( option_jobs != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+		          esedbexport_export_handle,
+		          option_jobs,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: 1.\n" );
+		}
+	}
+#endif
 	if( export_handle_set_target_path(
 	     esedbexport_export_handle,
 	     option_target_path,
@@ -380,12 +700,19 @@ int main( int argc, char * const argv[] )
 	}
 	else if( result == 0 )
 	{
+		if( resume_export == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "%" PRIs_SYSTEM " already exists.\n",
+			 esedbexport_export_handle->items_export_path );
+
+			goto on_error;
+		}
 		fprintf(
-		 stderr,
-		 "%" PRIs_SYSTEM " already exists.\n",
+		 stdout,
+		 "Resuming export to: %" PRIs_SYSTEM ".\n",
 		 esedbexport_export_handle->items_export_path );
-
-		goto on_error;
 	}
 	if( log_handle_open(
 	     log_handle,
@@ -58,11 +58,29 @@ void usage_fprint(
 	fprintf( stream, "Use esedbinfo to determine information about an Extensible Storage Engine (ESE)\n"
 	                 "Database File (EDB).\n\n" );
 
-	fprintf( stream, "Usage: esedbinfo [ -hvV ] source\n\n" );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	fprintf( stream, "Usage: esedbinfo [ -j jobs ] [ -m map_file ] [ -hpsvV ] source\n\n" );
+#else
+	fprintf( stream, "Usage: esedbinfo [ -m map_file ] [ -hpsvV ] source\n\n" );
+#endif
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-h:     shows this help\n" );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	fprintf( stream, "\t-j:     the number of concurrent jobs (threads) of the page layout\n"
+	                 "\t        and space statistics, where jobs should be a value from 1\n"
+	                 "\t        to 32 (default is 1)\n" );
+#endif
+	fprintf( stream, "\t-m:     writes the page map of the page layout to map_file, with\n"
+	                 "\t        6 bytes per page: the 32-bit little-endian father data page\n"
+	                 "\t        object identifier, the page type and the fill level in\n"
+	                 "\t        percent (implies -p)\n" );
+	fprintf( stream, "\t-p:     print the page layout, which are the page types, the page\n"
+	                 "\t        fill levels and the pages and extents per object, determined\n"
+	                 "\t        from the page headers\n" );
+	fprintf( stream, "\t-s:     print the space statistics of the tables, determined from\n"
+	                 "\t        the space trees and page headers without reading the records\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -119,11 +137,19 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libesedb_error_t *error    = NULL;
-	system_character_t *source = NULL;
-	char *program              = "esedbinfo";
-	system_integer_t option    = 0;
-	int verbose                = 0;
+	libesedb_error_t *error          = NULL;
+	system_character_t *map_filename = NULL;
+	system_character_t *source       = NULL;
+	char *program                    = "esedbinfo";
+	system_integer_t option          = 0;
+	uint8_t page_layout              = 0;
+	uint8_t space_statistics         = 0;
+	int verbose                      = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	system_character_t *option_jobs  = NULL;
+	int result                       = 0;
+#endif
 
 	libcnotify_stream_set(
 	 stderr,
@@ -158,7 +184,11 @@ int main( int argc, char * const argv[] )
 	while( ( option = esedbtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "hvV" ) ) ) != (system_integer_t) -1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	                   _SYSTEM_STRING( "hj:m:psvV" ) ) ) != (system_integer_t) -1 )
+#else
+	                   _SYSTEM_STRING( "hm:psvV" ) ) ) != (system_integer_t) -1 )
+#endif
 	{
 		switch( option )
 		{
@@ -180,6 +210,29 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			case (system_integer_t) 'j':
+				option_jobs = optarg;
+
+				break;
+#endif
+
+			case (system_integer_t) 'm':
+				map_filename = optarg;
+				page_layout  = 1;
+
+				break;
+
+			case (system_integer_t) 'p':
+				page_layout = 1;
+
+				break;
+
+			case (system_integer_t) 's':
+				space_statistics = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -223,6 +276,34 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	esedbinfo_info_handle->print_page_layout      = page_layout;
+	esedbinfo_info_handle->print_space_statistics = space_statistics;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( option_jobs != NULL )
+	{
+		result = info_handle_set_number_of_threads(
+		          esedbinfo_info_handle,
+		          option_jobs,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: 1.\n" );
+		}
+	}
+#endif
+
 	if( info_handle_open(
 	     esedbinfo_info_handle,
 	     source,
@@ -245,6 +326,20 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( page_layout != 0 )
+	{
+		if( info_handle_page_layout_fprint(
+		     esedbinfo_info_handle,
+		     map_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print page layout.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close(
 	     esedbinfo_info_handle,
 	     &error ) != 0 )
@@ -0,0 +1,462 @@
+/*
+ * Scans data, such as a disk image or memory dump, for Extensible Storage Engine (ESE) Database (EDB) pages
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedbtools_getopt.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libclocale.h"
+#include "esedbtools_libcnotify.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_output.h"
+#include "esedbtools_signal.h"
+#include "esedbtools_unused.h"
+#include "page_scanner.h"
+
+page_scanner_t *esedbscan_page_scanner = NULL;
+int esedbscan_abort                    = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use esedbscan to scan data, such as a disk image or memory dump, for\n"
+	                 "Extensible Storage Engine (ESE) Database (EDB) pages.\n\n" );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	fprintf( stream, "Usage: esedbscan [ -a alignment ] [ -j jobs ] [ -p page_size ]\n"
+	                 "                 [ -t target ] [ -hvV ] source\n\n" );
+#else
+	fprintf( stream, "Usage: esedbscan [ -a alignment ] [ -p page_size ] [ -t target ]\n"
+	                 "                 [ -hvV ] source\n\n" );
+#endif
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-a:     the alignment of the pages in the source, where alignment\n"
+	                 "\t        should be a power of 2 from 512 to 32768 (default is 512)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	fprintf( stream, "\t-j:     the number of concurrent scan jobs (threads), where jobs\n"
+	                 "\t        should be a value from 1 to 32 (default is 1)\n" );
+#endif
+	fprintf( stream, "\t-p:     the page size to scan for, options: 2048, 4096, 8192, 16384\n"
+	                 "\t        or 32768 (default is to scan for all page sizes)\n" );
+	fprintf( stream, "\t-t:     writes the pages of the database page size to a rebuilt\n"
+	                 "\t        database image in target, which can be read with the other\n"
+	                 "\t        esedbtools\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for esedbscan
+ */
+void esedbscan_signal_handler(
+      esedbtools_signal_t signal ESEDBTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "esedbscan_signal_handler";
+
+	ESEDBTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	esedbscan_abort = 1;
+
+	if( esedbscan_page_scanner != NULL )
+	{
+		if( page_scanner_signal_abort(
+		     esedbscan_page_scanner,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal page scanner to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error              = NULL;
+	system_character_t *option_alignment  = NULL;
+	system_character_t *option_page_size  = NULL;
+	system_character_t *source            = NULL;
+	system_character_t *target            = NULL;
+	char *program                         = "esedbscan";
+	system_integer_t option               = 0;
+	int result                            = 0;
+	int verbose                           = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	system_character_t *option_jobs       = NULL;
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+             "esedbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+        if( esedbtools_output_initialize(
+             _IONBF,
+             &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	esedboutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = esedbtools_getopt(
+	                   argc,
+	                   argv,
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	                   _SYSTEM_STRING( "a:hj:p:t:vV" ) ) ) != (system_integer_t) -1 )
+#else
+	                   _SYSTEM_STRING( "a:hp:t:vV" ) ) ) != (system_integer_t) -1 )
+#endif
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'a':
+				option_alignment = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			case (system_integer_t) 'j':
+				option_jobs = optarg;
+
+				break;
+#endif
+
+			case (system_integer_t) 'p':
+				option_page_size = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				target = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				esedboutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libesedb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libesedb_notify_set_verbose(
+	 verbose );
+
+	if( page_scanner_initialize(
+	     &esedbscan_page_scanner,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize page scanner.\n" );
+
+		goto on_error;
+	}
+	if( option_alignment != NULL )
+	{
+		result = page_scanner_set_alignment(
+		          esedbscan_page_scanner,
+		          option_alignment,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set alignment.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported alignment defaulting to: 512.\n" );
+		}
+	}
+	if( option_page_size != NULL )
+	{
+		result = page_scanner_set_page_size(
+		          esedbscan_page_scanner,
+		          option_page_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set page size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported page size defaulting to: all.\n" );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( option_jobs != NULL )
+	{
+		result = page_scanner_set_number_of_threads(
+		          esedbscan_page_scanner,
+		          option_jobs,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: 1.\n" );
+		}
+	}
+#endif
+	if( esedbtools_signal_attach(
+	     esedbscan_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_scanner_scan(
+	     esedbscan_page_scanner,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to scan: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( page_scanner_fprint(
+	     esedbscan_page_scanner,
+	     stdout,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print scan results.\n" );
+
+		goto on_error;
+	}
+	if( ( target != NULL )
+	 && ( esedbscan_abort == 0 ) )
+	{
+		if( esedbscan_page_scanner->number_of_pages == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "No pages found, database image not written.\n" );
+		}
+		else
+		{
+			if( esedbscan_page_scanner->file_header_offset == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "No file header found, writing database image with a created file header.\n" );
+			}
+			if( page_scanner_write_image(
+			     esedbscan_page_scanner,
+			     target,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write database image: %" PRIs_SYSTEM ".\n",
+				 target );
+
+				goto on_error;
+			}
+		}
+	}
+	if( esedbtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( esedbscan_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Scan aborted.\n" );
+	}
+	if( page_scanner_free(
+	     &esedbscan_page_scanner,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free page scanner.\n" );
+
+		goto on_error;
+	}
+	if( esedbscan_abort != 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( esedbscan_page_scanner != NULL )
+	{
+		page_scanner_free(
+		 &esedbscan_page_scanner,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
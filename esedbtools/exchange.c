@@ -39,6 +39,7 @@
 #include "exchange.h"
 #include "export.h"
 #include "export_handle.h"
+#include "output_buffer.h"
 
 enum EXPORT_EXCHANGE_KNOWN_COLUMN_TYPES
 {
@@ -60,7 +61,7 @@ enum EXPORT_EXCHANGE_KNOWN_COLUMN_TYPES
 int exchange_export_record_binary_data(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	uint8_t *value_data    = NULL;
@@ -85,13 +86,13 @@ int exchange_export_record_binary_data(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -218,7 +219,7 @@ int exchange_export_record_binary_data(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 
 		memory_free(
 		 value_data );
@@ -241,7 +242,7 @@ int exchange_export_record_value_32bit(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	uint8_t *value_data      = NULL;
@@ -275,13 +276,13 @@ int exchange_export_record_value_32bit(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -408,10 +409,9 @@ int exchange_export_record_value_32bit(
 				 value_data,
 				 value_32bit );
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIu32 "",
-			 value_32bit );
+			output_buffer_write_unsigned_decimal(
+			 record_output_buffer,
+			 (uint64_t) value_32bit );
 		}
 	}
 	else
@@ -419,7 +419,7 @@ int exchange_export_record_value_32bit(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -442,7 +442,7 @@ int exchange_export_record_value_64bit(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	uint8_t *value_data      = NULL;
@@ -476,13 +476,13 @@ int exchange_export_record_value_64bit(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -611,8 +611,8 @@ int exchange_export_record_value_64bit(
 				 value_64bit );
 			}
 /* TODO for now print as hexadecimal */
-			fprintf(
-			 record_file_stream,
+			output_buffer_printf(
+			 record_output_buffer,
 			 "0x%" PRIx64 "",
 			 value_64bit );
 		}
@@ -622,7 +622,7 @@ int exchange_export_record_value_64bit(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -645,7 +645,7 @@ int exchange_export_record_value_filetime(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	system_character_t filetime_string[ 32 ];
@@ -669,13 +669,13 @@ int exchange_export_record_value_filetime(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -859,9 +859,8 @@ int exchange_export_record_value_filetime(
 
 				goto on_error;
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIs_SYSTEM "",
+			output_buffer_write_system_string(
+			 record_output_buffer,
 			 filetime_string );
 		}
 	}
@@ -870,7 +869,7 @@ int exchange_export_record_value_filetime(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -899,7 +898,7 @@ int exchange_export_record_value_guid(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	system_character_t guid_string[ 48 ];
@@ -923,13 +922,13 @@ int exchange_export_record_value_guid(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -1102,9 +1101,8 @@ int exchange_export_record_value_guid(
 
 					goto on_error;
 				}
-				fprintf(
-				 record_file_stream,
-				 "%" PRIs_SYSTEM "",
+				output_buffer_write_system_string(
+				 record_output_buffer,
 				 guid_string );
 			}
 		}
@@ -1113,7 +1111,7 @@ int exchange_export_record_value_guid(
 			export_binary_data(
 			 value_data,
 			 value_data_size,
-			 record_file_stream );
+			 record_output_buffer );
 		}
 	}
 	else
@@ -1121,7 +1119,7 @@ int exchange_export_record_value_guid(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -1149,7 +1147,7 @@ on_error:
 int exchange_export_record_value_mapi_entryid(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	uint8_t *value_data      = NULL;
@@ -1175,13 +1173,13 @@ int exchange_export_record_value_mapi_entryid(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -1339,15 +1337,15 @@ int exchange_export_record_value_mapi_entryid(
 			}
 #endif
 #if defined( HAVE_DEBUG_OUTPUT )
-			fprintf(
-			 record_file_stream,
+			output_buffer_write_string(
+			 record_output_buffer,
 			 "ENTRYID: " );
 #endif
 
 			export_binary_data(
 			 value_data,
 			 value_data_size,
-			 record_file_stream );
+			 record_output_buffer );
 		}
 	}
 	else
@@ -1355,7 +1353,7 @@ int exchange_export_record_value_mapi_entryid(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -1377,7 +1375,7 @@ on_error:
 int exchange_export_record_value_mapi_multi_value(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	libesedb_multi_value_t *multi_value = NULL;
@@ -1408,13 +1406,13 @@ int exchange_export_record_value_mapi_multi_value(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -1671,7 +1669,7 @@ int exchange_export_record_value_mapi_multi_value(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -1704,7 +1702,7 @@ on_error:
 int exchange_export_record_value_sid(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	system_character_t sid_string[ 128 ];
@@ -1729,13 +1727,13 @@ int exchange_export_record_value_sid(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -1937,9 +1935,8 @@ int exchange_export_record_value_sid(
 
 				goto on_error;
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIs_SYSTEM "",
+			output_buffer_write_system_string(
+			 record_output_buffer,
 			 sid_string );
 		}
 	}
@@ -1948,7 +1945,7 @@ int exchange_export_record_value_sid(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -1976,7 +1973,7 @@ on_error:
 int exchange_export_record_value_string(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	uint8_t *value_data    = NULL;
@@ -1995,13 +1992,13 @@ int exchange_export_record_value_string(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -2089,7 +2086,7 @@ int exchange_export_record_value_string(
 	export_narrow_text(
 	 (char *) value_data,
 	 value_data_size,
-	 record_file_stream );
+	 record_output_buffer );
 
 	memory_free(
 	 value_data );
@@ -2110,7 +2107,7 @@ on_error:
  */
 int exchange_export_record_folders(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2136,13 +2133,13 @@ int exchange_export_record_folders(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -2389,7 +2386,7 @@ int exchange_export_record_folders(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
@@ -2398,7 +2395,7 @@ int exchange_export_record_folders(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
@@ -2407,7 +2404,7 @@ int exchange_export_record_folders(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
@@ -2416,7 +2413,7 @@ int exchange_export_record_folders(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID )
@@ -2424,7 +2421,7 @@ int exchange_export_record_folders(
 			result = exchange_export_record_value_mapi_entryid(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID )
@@ -2432,7 +2429,7 @@ int exchange_export_record_folders(
 			result = exchange_export_record_value_sid(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
@@ -2440,7 +2437,7 @@ int exchange_export_record_folders(
 			result = exchange_export_record_value_string(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
@@ -2448,7 +2445,7 @@ int exchange_export_record_folders(
 			result = export_handle_export_record_value(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -2466,15 +2463,15 @@ int exchange_export_record_folders(
 		}
 		if( value_entry == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
@@ -2485,7 +2482,7 @@ int exchange_export_record_folders(
  */
 int exchange_export_record_global(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2511,13 +2508,13 @@ int exchange_export_record_global(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -2713,7 +2710,7 @@ int exchange_export_record_global(
 			result = exchange_export_record_binary_data(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT )
@@ -2722,7 +2719,7 @@ int exchange_export_record_global(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
@@ -2731,7 +2728,7 @@ int exchange_export_record_global(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
@@ -2740,7 +2737,7 @@ int exchange_export_record_global(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
@@ -2749,7 +2746,7 @@ int exchange_export_record_global(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_MULTI_VALUE )
@@ -2757,7 +2754,7 @@ int exchange_export_record_global(
 			result = exchange_export_record_value_mapi_multi_value(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
@@ -2765,7 +2762,7 @@ int exchange_export_record_global(
 			result = exchange_export_record_value_string(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
@@ -2773,7 +2770,7 @@ int exchange_export_record_global(
 			result = export_handle_export_record_value(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -2791,15 +2788,15 @@ int exchange_export_record_global(
 		}
 		if( value_entry == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
@@ -2811,7 +2808,7 @@ int exchange_export_record_global(
  */
 int exchange_export_record_mailbox(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2837,13 +2834,13 @@ int exchange_export_record_mailbox(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -3022,7 +3019,7 @@ int exchange_export_record_mailbox(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
@@ -3031,7 +3028,7 @@ int exchange_export_record_mailbox(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
@@ -3040,7 +3037,7 @@ int exchange_export_record_mailbox(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
@@ -3049,7 +3046,7 @@ int exchange_export_record_mailbox(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID )
@@ -3057,7 +3054,7 @@ int exchange_export_record_mailbox(
 			result = exchange_export_record_value_sid(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
@@ -3065,7 +3062,7 @@ int exchange_export_record_mailbox(
 			result = exchange_export_record_value_string(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
@@ -3073,7 +3070,7 @@ int exchange_export_record_mailbox(
 			result = export_handle_export_record_value(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -3091,15 +3088,15 @@ int exchange_export_record_mailbox(
 		}
 		if( value_entry == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
@@ -3110,7 +3107,7 @@ int exchange_export_record_mailbox(
  */
 int exchange_export_record_msg(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -3136,13 +3133,13 @@ int exchange_export_record_msg(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -3314,7 +3311,7 @@ int exchange_export_record_msg(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
@@ -3323,7 +3320,7 @@ int exchange_export_record_msg(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
@@ -3332,7 +3329,7 @@ int exchange_export_record_msg(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
@@ -3341,7 +3338,7 @@ int exchange_export_record_msg(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID )
@@ -3349,7 +3346,7 @@ int exchange_export_record_msg(
 			result = exchange_export_record_value_sid(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
@@ -3357,7 +3354,7 @@ int exchange_export_record_msg(
 			result = exchange_export_record_value_string(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
@@ -3365,7 +3362,7 @@ int exchange_export_record_msg(
 			result = export_handle_export_record_value(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -3383,15 +3380,15 @@ int exchange_export_record_msg(
 		}
 		if( value_entry == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
@@ -3402,7 +3399,7 @@ int exchange_export_record_msg(
  */
 int exchange_export_record_per_user_read(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -3428,13 +3425,13 @@ int exchange_export_record_per_user_read(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -3597,7 +3594,7 @@ int exchange_export_record_per_user_read(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
@@ -3606,7 +3603,7 @@ int exchange_export_record_per_user_read(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
@@ -3615,7 +3612,7 @@ int exchange_export_record_per_user_read(
 				  record,
 				  value_entry,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
@@ -3623,7 +3620,7 @@ int exchange_export_record_per_user_read(
 			result = export_handle_export_record_value(
 				  record,
 				  value_entry,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -3641,15 +3638,15 @@ int exchange_export_record_per_user_read(
 		}
 		if( value_entry == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
@@ -29,6 +29,7 @@
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libesedb.h"
 #include "log_handle.h"
+#include "output_buffer.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -37,88 +38,88 @@ extern "C" {
 int exchange_export_record_binary_data(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int exchange_export_record_value_32bit(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int exchange_export_record_value_64bit(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int exchange_export_record_value_filetime(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int exchange_export_record_value_guid(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int exchange_export_record_value_mapi_entryid(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int exchange_export_record_value_mapi_multi_value(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int exchange_export_record_value_sid(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int exchange_export_record_value_string(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int exchange_export_record_folders(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int exchange_export_record_global(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int exchange_export_record_mailbox(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int exchange_export_record_msg(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int exchange_export_record_per_user_read(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
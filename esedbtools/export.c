@@ -29,26 +29,21 @@
 #include "esedbtools_libesedb.h"
 #include "esedbtools_libfdatetime.h"
 #include "export.h"
+#include "output_buffer.h"
 
 /* Exports binary data
  */
 void export_binary_data(
       const uint8_t *data,
       size_t data_size,
-      FILE *stream )
+      output_buffer_t *output_buffer )
 {
 	if( data != NULL )
 	{
-		while( data_size > 0 )
-		{
-			fprintf(
-			 stream,
-			 "%02" PRIx8 "",
-			 *data );
-
-			data      += 1;
-			data_size -= 1;
-		}
+		output_buffer_write_hexadecimal_data(
+		 output_buffer,
+		 data,
+		 data_size );
 	}
 }
 
@@ -58,7 +53,7 @@ void export_binary_data(
 void export_narrow_text(
       const char *string,
       size_t string_size,
-      FILE *stream )
+      output_buffer_t *output_buffer )
 {
 	if( string != NULL )
 	{
@@ -69,44 +64,43 @@ void export_narrow_text(
 				case 0:
 					if( string_size > 1 )
 					{
-						fprintf(
-						 stream,
+						output_buffer_write_string(
+						 output_buffer,
 						 "\\0" );
 					}
 					break;
 
 				case '\\':
-					fprintf(
-					 stream,
+					output_buffer_write_string(
+					 output_buffer,
 					 "\\\\" );
 
 					break;
 
 				case '\n':
-					fprintf(
-					 stream,
+					output_buffer_write_string(
+					 output_buffer,
 					 "\\n" );
 
 					break;
 
 				case '\r':
-					fprintf(
-					 stream,
+					output_buffer_write_string(
+					 output_buffer,
 					 "\\r" );
 
 					break;
 
 				case '\t':
-					fprintf(
-					 stream,
+					output_buffer_write_string(
+					 output_buffer,
 					 "\\t" );
 
 					break;
 
 				default:
-					fprintf(
-					 stream,
-					 "%c",
+					output_buffer_write_character(
+					 output_buffer,
 					 *string );
 
 					break;
@@ -123,7 +117,7 @@ void export_narrow_text(
 void export_text(
       const system_character_t *string,
       size_t string_size,
-      FILE *stream )
+      output_buffer_t *output_buffer )
 {
 	if( string != NULL )
 	{
@@ -134,46 +128,51 @@ void export_text(
 				case 0:
 					if( string_size > 1 )
 					{
-						fprintf(
-						 stream,
+						output_buffer_write_string(
+						 output_buffer,
 						 "\\0" );
 					}
 					break;
 
 				case (system_character_t) '\\':
-					fprintf(
-					 stream,
+					output_buffer_write_string(
+					 output_buffer,
 					 "\\\\" );
 
 					break;
 
 				case (system_character_t) '\n':
-					fprintf(
-					 stream,
+					output_buffer_write_string(
+					 output_buffer,
 					 "\\n" );
 
 					break;
 
 				case (system_character_t) '\r':
-					fprintf(
-					 stream,
+					output_buffer_write_string(
+					 output_buffer,
 					 "\\r" );
 
 					break;
 
 				case (system_character_t) '\t':
-					fprintf(
-					 stream,
+					output_buffer_write_string(
+					 output_buffer,
 					 "\\t" );
 
 					break;
 
 				default:
-					fprintf(
-					 stream,
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+					output_buffer_printf(
+					 output_buffer,
 					 "%" PRIc_SYSTEM "",
 					 *string );
-
+#else
+					output_buffer_write_character(
+					 output_buffer,
+					 *string );
+#endif
 					break;
 			}
 			string      += 1;
@@ -189,7 +188,7 @@ int export_filetime(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	system_character_t date_time_string[ 32 ];
@@ -213,13 +212,13 @@ int export_filetime(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -404,9 +403,8 @@ int export_filetime(
 
 				goto on_error;
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIs_SYSTEM "",
+			output_buffer_write_system_string(
+			 record_output_buffer,
 			 date_time_string );
 		}
 	}
@@ -415,7 +413,7 @@ int export_filetime(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -444,7 +442,7 @@ int export_floatingtime(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	system_character_t date_time_string[ 32 ];
@@ -468,13 +466,13 @@ int export_floatingtime(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -657,9 +655,8 @@ int export_floatingtime(
 
 				goto on_error;
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIs_SYSTEM "",
+			output_buffer_write_system_string(
+			 record_output_buffer,
 			 date_time_string );
 		}
 	}
@@ -668,7 +665,7 @@ int export_floatingtime(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -27,6 +27,7 @@
 #include <types.h>
 
 #include "esedbtools_libesedb.h"
+#include "output_buffer.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -35,30 +36,30 @@ extern "C" {
 void export_binary_data(
       const uint8_t *data,
       size_t data_size,
-      FILE *stream );
+      output_buffer_t *output_buffer );
 
 void export_narrow_text(
       const char *string,
       size_t string_size,
-      FILE *stream );
+      output_buffer_t *output_buffer );
 
 void export_text(
       const system_character_t *string,
       size_t string_size,
-      FILE *stream );
+      output_buffer_t *output_buffer );
 
 int export_filetime(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int export_floatingtime(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int export_get_long_value_data(
@@ -27,6 +27,8 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "arrow_writer.h"
+#include "checkpoint_file.h"
 #include "database_types.h"
 #include "esedbtools_libcdata.h"
 #include "esedbtools_libcerror.h"
@@ -34,12 +36,18 @@
 #include "esedbtools_libcnotify.h"
 #include "esedbtools_libcfile.h"
 #include "esedbtools_libcpath.h"
+#include "esedbtools_libcthreads.h"
 #include "esedbtools_libesedb.h"
 #include "esedbtools_libfdatetime.h"
 #include "esedbtools_system_string.h"
 #include "exchange.h"
 #include "export.h"
 #include "export_handle.h"
+#include "output_buffer.h"
+#include "process_status.h"
+#include "record_filter.h"
+#include "record_writer.h"
+#include "sqlite_writer.h"
 #include "srumdb.h"
 #include "webcache.h"
 #include "windows_search.h"
@@ -47,6 +55,13 @@
 
 #define EXPORT_HANDLE_NOTIFY_STREAM	stdout
 
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS	32
+
+#define EXPORT_HANDLE_OUTPUT_BUFFER_SIZE	( 1024 * 1024 )
+
+#define EXPORT_HANDLE_DEFAULT_NUMBER_OF_ROWS_PER_BATCH	65536
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_ROWS_PER_BATCH	( 16 * 1024 * 1024 )
+
 /* Creates an export handle
  * Make sure the value export_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -121,9 +136,15 @@ int export_handle_initialize(
 		goto on_error;
 	}
 	( *export_handle )->export_mode    = EXPORT_MODE_TABLES;
+	( *export_handle )->export_format  = EXPORT_FORMAT_TEXT;
 	( *export_handle )->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
 	( *export_handle )->notify_stream  = EXPORT_HANDLE_NOTIFY_STREAM;
 
+	( *export_handle )->number_of_rows_per_batch = EXPORT_HANDLE_DEFAULT_NUMBER_OF_ROWS_PER_BATCH;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	( *export_handle )->number_of_threads = 1;
+#endif
 	return( 1 );
 
 on_error:
@@ -173,6 +194,13 @@ int export_handle_free(
 
 			result = -1;
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *export_handle )->input_filename != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->input_filename );
+		}
+#endif
 		if( ( *export_handle )->target_path != NULL )
 		{
 			memory_free(
@@ -183,6 +211,34 @@ int export_handle_free(
 			memory_free(
 			 ( *export_handle )->items_export_path );
 		}
+		if( ( *export_handle )->column_names != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->column_names );
+		}
+		if( ( *export_handle )->record_condition != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->record_condition );
+		}
+#if defined( HAVE_SQLITE3 )
+		if( ( *export_handle )->sqlite_writer != NULL )
+		{
+			if( sqlite_writer_free(
+			     &( ( *export_handle )->sqlite_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SQLite writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		memory_free(
 		 *export_handle );
 
@@ -265,6 +321,30 @@ int export_handle_set_export_mode(
 			result = 1;
 		}
 	}
+	else if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "keys" ),
+		     4 ) == 0 )
+		{
+			export_handle->export_mode = EXPORT_MODE_KEYS;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "carve" ),
+		     5 ) == 0 )
+		{
+			export_handle->export_mode = EXPORT_MODE_CARVE;
+
+			result = 1;
+		}
+	}
 	else if( string_length == 6 )
 	{
 		if( system_string_compare(
@@ -280,6 +360,179 @@ int export_handle_set_export_mode(
 	return( result );
 }
 
+/* Sets the export format
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int export_handle_set_export_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_export_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "csv" ),
+		     3 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_CSV;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "text" ),
+		     4 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_TEXT;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "arrow" ),
+		     5 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_ARROW;
+
+			result = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "jsonl" ),
+		          5 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_JSONL;
+
+			result = 1;
+		}
+	}
+#if defined( HAVE_SQLITE3 )
+	else if( string_length == 6 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "sqlite" ),
+		     6 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_SQLITE;
+
+			result = 1;
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Sets the compression method
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_compression_method(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_compression_method";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "none" ),
+		     4 ) == 0 )
+		{
+			export_handle->compression_method = EXPORT_COMPRESSION_METHOD_NONE;
+
+			result = 1;
+		}
+#if defined( HAVE_ZLIB )
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "gzip" ),
+		          4 ) == 0 )
+		{
+			export_handle->compression_method = EXPORT_COMPRESSION_METHOD_GZIP;
+
+			result = 1;
+		}
+#endif
+#if defined( HAVE_ZSTD )
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "zstd" ),
+		          4 ) == 0 )
+		{
+			export_handle->compression_method = EXPORT_COMPRESSION_METHOD_ZSTD;
+
+			result = 1;
+		}
+#endif
+	}
+	return( result );
+}
+
 /* Sets the ascii codepage
  * Returns 1 if successful or -1 on error
  */
@@ -339,22 +592,17 @@ int export_handle_set_ascii_codepage(
 	return( result );
 }
 
-/* Sets the target path
- * Returns 1 if successful or -1 on error
+/* Sets the number of rows per record batch of the Arrow export format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_set_target_path(
+int export_handle_set_number_of_rows_per_batch(
      export_handle_t *export_handle,
-     const system_character_t *target_path,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function                = "export_handle_set_target_path";
-	size_t target_path_length            = 0;
-
-#if defined( WINAPI )
-	system_character_t *full_target_path = NULL;
-        size_t full_target_path_size         = 0;
-	int result                           = 0;
-#endif
+	static char *function = "export_handle_set_number_of_rows_per_batch";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
 
 	if( export_handle == NULL )
 	{
@@ -367,134 +615,56 @@ int export_handle_set_target_path(
 
 		return( -1 );
 	}
-	if( target_path == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid target path.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_handle->target_path != NULL )
-	{
-		memory_free(
-		 export_handle->target_path );
-
-		export_handle->target_path      = NULL;
-		export_handle->target_path_size = 0;
-	}
-	target_path_length = system_string_length(
-	                      target_path );
+	string_length = system_string_length(
+	                 string );
 
-#if defined( WINAPI )
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcpath_path_get_full_path_wide(
-	          target_path,
-                  target_path_length,
-                  &full_target_path,
-                  &full_target_path_size,
-                  error );
-#else
-	result = libcpath_path_get_full_path(
-	          target_path,
-                  target_path_length,
-                  &full_target_path,
-                  &full_target_path_size,
-                  error );
-#endif
-        if( result == -1 )
-        {
+	if( esedbtools_system_string_copy_to_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create extended-length target path.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to determine number of rows per batch.",
 		 function );
 
-		goto on_error;
-        }
-        else if( result != 0 )
-        {
-                target_path        = full_target_path;
-                target_path_length = full_target_path_size - 1;
-        }
-#endif
-	if( target_path_length > 0 )
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) EXPORT_HANDLE_MAXIMUM_NUMBER_OF_ROWS_PER_BATCH ) )
 	{
-		export_handle->target_path = system_string_allocate(
-		                              target_path_length + 1 );
+		return( 0 );
+	}
+	export_handle->number_of_rows_per_batch = (int) value_64bit;
 
-		if( export_handle->target_path == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create target path.",
-			 function );
+	return( 1 );
+}
 
-			goto on_error;
-		}
-		if( system_string_copy(
-		     export_handle->target_path,
-		     target_path,
-		     target_path_length ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy target path.",
-			 function );
-
-			goto on_error;
-		}
-		( export_handle->target_path )[ target_path_length ] = 0;
-
-		export_handle->target_path_size = target_path_length + 1;
-	}
-#if defined( WINAPI )
-	memory_free(
-	 full_target_path );
-#endif
-	return( 1 );
-
-on_error:
-	if( export_handle->target_path != NULL )
-	{
-		memory_free(
-		 export_handle->target_path );
-
-		export_handle->target_path      = NULL;
-		export_handle->target_path_size = 0;
-	}
-#if defined( WINAPI )
-	if( full_target_path != NULL )
-	{
-		memory_free(
-		 full_target_path );
-	}
-#endif
-	return( -1 );
-}
-
-/* Sets an export path consisting of a base path and a suffix
- * Returns 1 if successful or -1 on error
+/* Sets the names of the columns to export
+ * The names are separated by a comma
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_set_export_path(
+int export_handle_set_column_names(
      export_handle_t *export_handle,
-     const system_character_t *base_path,
-     size_t base_path_length,
-     const system_character_t *suffix,
-     size_t suffix_length,
-     system_character_t **export_path,
-     size_t *export_path_size,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_export_path";
+	static char *function = "export_handle_set_column_names";
+	size_t string_length  = 0;
 
 	if( export_handle == NULL )
 	{
@@ -507,149 +677,205 @@ int export_handle_set_export_path(
 
 		return( -1 );
 	}
-	if( base_path == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid base path.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	if( base_path_length > (size_t) SSIZE_MAX )
+	if( export_handle->column_names != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid base path length value exceeds maximum.",
-		 function );
+		memory_free(
+		 export_handle->column_names );
 
-		return( -1 );
+		export_handle->column_names      = NULL;
+		export_handle->column_names_size = 0;
 	}
-	if( suffix == NULL )
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	export_handle->column_names = system_string_allocate(
+	                               string_length + 1 );
+
+	if( export_handle->column_names == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid suffix.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column names.",
 		 function );
 
 		return( -1 );
 	}
-	if( suffix_length > (size_t) SSIZE_MAX )
+	if( system_string_copy(
+	     export_handle->column_names,
+	     string,
+	     string_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid suffix length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy column names.",
 		 function );
 
+		memory_free(
+		 export_handle->column_names );
+
+		export_handle->column_names = NULL;
+
 		return( -1 );
 	}
-	if( export_path == NULL )
+	( export_handle->column_names )[ string_length ] = 0;
+
+	export_handle->column_names_size = string_length + 1;
+
+	return( 1 );
+}
+
+/* Sets the condition that the exported records need to match
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_record_condition(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function      = "export_handle_set_record_condition";
+	size_t column_name_length  = 0;
+	size_t column_name_offset  = 0;
+	size_t string_length       = 0;
+	size_t value_length        = 0;
+	size_t value_offset        = 0;
+	uint8_t condition_operator = 0;
+	int result                 = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export path.",
+		 "%s: invalid export handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_path_size == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export path size.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	if( *export_path != NULL )
+	if( export_handle->record_condition != NULL )
 	{
 		memory_free(
-		 *export_path );
+		 export_handle->record_condition );
 
-		*export_path      = NULL;
-		*export_path_size = 0;
+		export_handle->record_condition      = NULL;
+		export_handle->record_condition_size = 0;
 	}
-	*export_path_size = base_path_length + suffix_length + 1;
+	string_length = system_string_length(
+	                 string );
 
-	*export_path = system_string_allocate(
-	                *export_path_size );
+	/* Only the syntax of the condition is validated here since the column
+	 * is resolved per table
+	 */
+	result = record_filter_parse_condition(
+	          string,
+	          string_length,
+	          &column_name_offset,
+	          &column_name_length,
+	          &condition_operator,
+	          &value_offset,
+	          &value_length,
+	          error );
 
-	if( *export_path == NULL )
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse record condition.",
+			 function );
+		}
+		return( result );
+	}
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	export_handle->record_condition = system_string_allocate(
+	                                   string_length + 1 );
+
+	if( export_handle->record_condition == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create export path.",
+		 "%s: unable to create record condition.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( system_string_copy(
-	     *export_path,
-	     base_path,
-	     base_path_length ) == NULL )
+	     export_handle->record_condition,
+	     string,
+	     string_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy base path to item export path.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy record condition.",
 		 function );
 
-		goto on_error;
-	}
-	if( system_string_copy(
-	     &( ( *export_path )[ base_path_length ] ),
-	     suffix,
-	     suffix_length ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy suffix to item export path.",
-		 function );
+		memory_free(
+		 export_handle->record_condition );
 
-		goto on_error;
-	}
-	( *export_path )[ *export_path_size - 1 ] = 0;
+		export_handle->record_condition = NULL;
 
-	return( 1 );
+		return( -1 );
+	}
+	( export_handle->record_condition )[ string_length ] = 0;
 
-on_error:
-	if( *export_path != NULL )
-	{
-		memory_free(
-		 *export_path );
+	export_handle->record_condition_size = string_length + 1;
 
-		*export_path      = NULL;
-		*export_path_size = 0;
-	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Creates the items export path
- * Returns 1 if successful, 0 if already exists or -1 on error
+/* Retrieves a checksum of the export settings that determine the content of the table files
+ * The checksum covers the export format, compression method, column names and record condition
+ * and is stored in the checkpoint file to detect a resume with different settings
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_create_items_export_path(
+int export_handle_get_settings_checksum(
      export_handle_t *export_handle,
+     uint32_t *settings_checksum,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_create_items_export_path";
-	int result            = 0;
+	static char *function = "export_handle_get_settings_checksum";
+	size_t string_index   = 0;
+	uint32_t checksum     = 0;
 
 	if( export_handle == NULL )
 	{
@@ -662,62 +888,72 @@ int export_handle_create_items_export_path(
 
 		return( -1 );
 	}
-	if( export_handle_set_export_path(
-	     export_handle,
-	     export_handle->target_path,
-	     export_handle->target_path_size - 1,
-	     _SYSTEM_STRING( ".export" ),
-	     7,
-	     &( export_handle->items_export_path ),
-	     &( export_handle->items_export_path_size ),
-	     error ) != 1 )
+	if( settings_checksum == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set items export path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid settings checksum.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_exists_wide(
-		  export_handle->items_export_path,
-		  error );
-#else
-	result = libcfile_file_exists(
-		  export_handle->items_export_path,
-		  error );
-#endif
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
-		 function,
-		 export_handle->items_export_path );
+	/* A 32-bit FNV-1a hash where the column names and record condition
+	 * are preceded by their option character to keep them apart
+	 */
+	checksum = 0x811c9dc5UL;
 
-		return( -1 );
+	checksum ^= (uint32_t) export_handle->export_format;
+	checksum *= 0x01000193UL;
+
+	checksum ^= (uint32_t) export_handle->compression_method;
+	checksum *= 0x01000193UL;
+
+	checksum ^= (uint32_t) 'C';
+	checksum *= 0x01000193UL;
+
+	if( export_handle->column_names != NULL )
+	{
+		for( string_index = 0;
+		     string_index < export_handle->column_names_size;
+		     string_index++ )
+		{
+			checksum ^= (uint32_t) export_handle->column_names[ string_index ];
+			checksum *= 0x01000193UL;
+		}
 	}
-	else if( result == 1 )
+	checksum ^= (uint32_t) 'w';
+	checksum *= 0x01000193UL;
+
+	if( export_handle->record_condition != NULL )
 	{
-		return( 0 );
+		for( string_index = 0;
+		     string_index < export_handle->record_condition_size;
+		     string_index++ )
+		{
+			checksum ^= (uint32_t) export_handle->record_condition[ string_index ];
+			checksum *= 0x01000193UL;
+		}
 	}
+	*settings_checksum = checksum;
+
 	return( 1 );
 }
 
-/* Opens the export handle
- * Returns 1 if successful or -1 on error
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Sets the number of threads used to export tables
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_open(
+int export_handle_set_number_of_threads(
      export_handle_t *export_handle,
-     const system_character_t *filename,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_open";
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
 
 	if( export_handle == NULL )
 	{
@@ -730,40 +966,63 @@ int export_handle_open(
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libesedb_file_open_wide(
-	     export_handle->input_file,
-	     filename,
-	     LIBESEDB_OPEN_READ,
-	     error ) != 1 )
-#else
-	if( libesedb_file_open(
-	     export_handle->input_file,
-	     filename,
-	     LIBESEDB_OPEN_READ,
-	     error ) != 1 )
-#endif
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
+	string_length = system_string_length(
+	                 string );
 
-/* Closes the export handle
- * Returns the 0 if succesful or -1 on error
- */
-int export_handle_close(
+	if( esedbtools_system_string_copy_to_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to determine number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+	export_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Sets the target path
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_target_path(
      export_handle_t *export_handle,
+     const system_character_t *target_path,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_close";
+	static char *function                = "export_handle_set_target_path";
+	size_t target_path_length            = 0;
+
+#if defined( WINAPI )
+	system_character_t *full_target_path = NULL;
+        size_t full_target_path_size         = 0;
+	int result                           = 0;
+#endif
 
 	if( export_handle == NULL )
 	{
@@ -776,73 +1035,134 @@ int export_handle_close(
 
 		return( -1 );
 	}
-	if( libesedb_file_close(
-	     export_handle->input_file,
-	     error ) != 0 )
+	if( target_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close input file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
 		 function );
 
 		return( -1 );
 	}
-	return( 0 );
-}
-
-/* Database functions
- */
+	if( export_handle->target_path != NULL )
+	{
+		memory_free(
+		 export_handle->target_path );
 
-/* Frees a table name
- * Returns 1 if successful or -1 on error
- */
-int export_handle_free_table_name(
-     char **table_name,
-     libcerror_error_t **error )
-{
-	static char *function = "export_handle_free_table_name";
+		export_handle->target_path      = NULL;
+		export_handle->target_path_size = 0;
+	}
+	target_path_length = system_string_length(
+	                      target_path );
 
-	if( table_name == NULL )
-	{
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_get_full_path_wide(
+	          target_path,
+                  target_path_length,
+                  &full_target_path,
+                  &full_target_path_size,
+                  error );
+#else
+	result = libcpath_path_get_full_path(
+	          target_path,
+                  target_path_length,
+                  &full_target_path,
+                  &full_target_path_size,
+                  error );
+#endif
+        if( result == -1 )
+        {
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table name.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extended-length target path.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+        }
+        else if( result != 0 )
+        {
+                target_path        = full_target_path;
+                target_path_length = full_target_path_size - 1;
+        }
+#endif
+	if( target_path_length > 0 )
+	{
+		export_handle->target_path = system_string_allocate(
+		                              target_path_length + 1 );
+
+		if( export_handle->target_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create target path.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     export_handle->target_path,
+		     target_path,
+		     target_path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy target path.",
+			 function );
+
+			goto on_error;
+		}
+		( export_handle->target_path )[ target_path_length ] = 0;
+
+		export_handle->target_path_size = target_path_length + 1;
 	}
-	if( *table_name != NULL )
+#if defined( WINAPI )
+	memory_free(
+	 full_target_path );
+#endif
+	return( 1 );
+
+on_error:
+	if( export_handle->target_path != NULL )
 	{
 		memory_free(
-		 *table_name );
+		 export_handle->target_path );
 
-		*table_name = NULL;
+		export_handle->target_path      = NULL;
+		export_handle->target_path_size = 0;
 	}
-	return( 1 );
+#if defined( WINAPI )
+	if( full_target_path != NULL )
+	{
+		memory_free(
+		 full_target_path );
+	}
+#endif
+	return( -1 );
 }
 
-/* Item generic export functions
- */
-
-/* Creates an item filename
+/* Sets an export path consisting of a base path and a suffix
  * Returns 1 if successful or -1 on error
  */
-int export_handle_create_item_filename(
+int export_handle_set_export_path(
      export_handle_t *export_handle,
-     int item_index,
-     const system_character_t *item_name,
-     size_t item_name_length,
-     system_character_t **item_filename,
-     size_t *item_filename_size,
+     const system_character_t *base_path,
+     size_t base_path_length,
+     const system_character_t *suffix,
+     size_t suffix_length,
+     system_character_t **export_path,
+     size_t *export_path_size,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_create_item_filename";
-	int number_of_digits  = 0;
-	int remainder         = 0;
+	static char *function = "export_handle_set_export_path";
 
 	if( export_handle == NULL )
 	{
@@ -855,141 +1175,149 @@ int export_handle_create_item_filename(
 
 		return( -1 );
 	}
-	if( item_index < 0 )
+	if( base_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid item index value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base path.",
 		 function );
 
 		return( -1 );
 	}
-	if( item_name == NULL )
+	if( base_path_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item name.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base path length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( item_filename == NULL )
+	if( suffix == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item filename.",
+		 "%s: invalid suffix.",
 		 function );
 
 		return( -1 );
 	}
-	if( item_filename_size == NULL )
+	if( suffix_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item filename size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid suffix length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	remainder = item_index;
+	if( export_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export path.",
+		 function );
 
-	do
+		return( -1 );
+	}
+	if( export_path_size == NULL )
 	{
-		number_of_digits++;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export path size.",
+		 function );
 
-		remainder /= 10;
+		return( -1 );
 	}
-	while( remainder > 0 );
+	if( *export_path != NULL )
+	{
+		memory_free(
+		 *export_path );
 
-	*item_filename_size = item_name_length + number_of_digits + 2;
+		*export_path      = NULL;
+		*export_path_size = 0;
+	}
+	*export_path_size = base_path_length + suffix_length + 1;
 
-	*item_filename = system_string_allocate(
-	                  *item_filename_size );
+	*export_path = system_string_allocate(
+	                *export_path_size );
 
-	if( *item_filename == NULL )
+	if( *export_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create item filename string.",
+		 "%s: unable to create export path.",
 		 function );
 
 		goto on_error;
 	}
 	if( system_string_copy(
-	     *item_filename,
-	     item_name,
-	     item_name_length ) == NULL )
+	     *export_path,
+	     base_path,
+	     base_path_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy item name.",
+		 "%s: unable to copy base path to item export path.",
 		 function );
 
 		goto on_error;
 	}
-	( *item_filename )[ item_name_length++ ] = (system_character_t) '.';
-
-	if( esedbtools_system_string_copy_from_64_bit_in_decimal(
-	     *item_filename,
-	     *item_filename_size,
-	     &item_name_length,
-	     (uint64_t) item_index,
-	     error ) != 1 )
+	if( system_string_copy(
+	     &( ( *export_path )[ base_path_length ] ),
+	     suffix,
+	     suffix_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy item index to string.",
+		 "%s: unable to copy suffix to item export path.",
 		 function );
 
 		goto on_error;
 	}
-	( *item_filename )[ item_name_length ] = 0;
-	
+	( *export_path )[ *export_path_size - 1 ] = 0;
+
 	return( 1 );
 
 on_error:
-	if( *item_filename != NULL )
+	if( *export_path != NULL )
 	{
 		memory_free(
-		 *item_filename );
+		 *export_path );
 
-		*item_filename = NULL;
+		*export_path      = NULL;
+		*export_path_size = 0;
 	}
-	*item_filename_size = 0;
-
 	return( -1 );
 }
 
-/* Creates a text item file
- * Returns 1 if successful, 0 if the file already exists or -1 on error
+/* Creates the items export path
+ * Returns 1 if successful, 0 if already exists or -1 on error
  */
-int export_handle_create_text_item_file(
+int export_handle_create_items_export_path(
      export_handle_t *export_handle,
-     const system_character_t *item_filename,
-     size_t item_filename_length,
-     const system_character_t *export_path,
-     size_t export_path_length,
-     FILE **item_file_stream,
      libcerror_error_t **error )
 {
-	system_character_t *item_filename_path = NULL;
-	static char *function                  = "export_handle_create_text_item_file";
-	size_t item_filename_path_size         = 0;
-	int result                             = 0;
+	static char *function = "export_handle_create_items_export_path";
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1002,54 +1330,51 @@ int export_handle_create_text_item_file(
 
 		return( -1 );
 	}
-	if( item_file_stream == NULL )
+	/* The SQLite export format writes a single database file instead of a directory
+	 */
+	if( export_handle->export_format == EXPORT_FORMAT_SQLITE )
+	{
+		result = export_handle_set_export_path(
+		          export_handle,
+		          export_handle->target_path,
+		          export_handle->target_path_size - 1,
+		          _SYSTEM_STRING( ".db" ),
+		          3,
+		          &( export_handle->items_export_path ),
+		          &( export_handle->items_export_path_size ),
+		          error );
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item file stream.",
-		 function );
-
-		return( -1 );
+		result = export_handle_set_export_path(
+		          export_handle,
+		          export_handle->target_path,
+		          export_handle->target_path_size - 1,
+		          _SYSTEM_STRING( ".export" ),
+		          7,
+		          &( export_handle->items_export_path ),
+		          &( export_handle->items_export_path_size ),
+		          error );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libcpath_path_join_wide(
-	     &item_filename_path,
-	     &item_filename_path_size,
-	     export_path,
-	     export_path_length,
-	     item_filename,
-	     item_filename_length,
-	     error ) != 1 )
-#else
-	if( libcpath_path_join(
-	     &item_filename_path,
-	     &item_filename_path_size,
-	     export_path,
-	     export_path_length,
-	     item_filename,
-	     item_filename_length,
-	     error ) != 1 )
-#endif
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item filename path.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set items export path.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libcfile_file_exists_wide(
-	          item_filename_path,
-	          error );
+		  export_handle->items_export_path,
+		  error );
 #else
 	result = libcfile_file_exists(
-	          item_filename_path,
-	          error );
+		  export_handle->items_export_path,
+		  error );
 #endif
 	if( result == -1 )
 	{
@@ -1059,190 +1384,3013 @@ int export_handle_create_text_item_file(
 		 LIBCERROR_IO_ERROR_GENERIC,
 		 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
 		 function,
-		 item_filename_path );
+		 export_handle->items_export_path );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	else if( result == 1 )
 	{
-		memory_free(
-		 item_filename_path );
-
 		return( 0 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	*item_file_stream = file_stream_open_wide(
-	                     item_filename_path,
-	                     _SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
-#else
-	*item_file_stream = file_stream_open(
-	                     item_filename_path,
-	                     FILE_STREAM_OPEN_WRITE );
-#endif
-
-	if( *item_file_stream == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open: %" PRIs_SYSTEM ".",
-		 function,
-		 item_filename_path );
-
-		goto on_error;
-	}
-	memory_free(
-	 item_filename_path );
-
 	return( 1 );
-
-on_error:
-	if( item_filename_path != NULL )
-	{
-		memory_free(
-		 item_filename_path );
-	}
-	return( -1 );
 }
 
-/* Exports the table
+/* Opens the export handle
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_table(
+int export_handle_open(
      export_handle_t *export_handle,
-     int database_type,
-     libesedb_table_t *table,
-     int table_index,
-     const system_character_t *table_name,
-     size_t table_name_length,
-     const system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
+     const system_character_t *filename,
      libcerror_error_t **error )
 {
-	system_character_t *item_filename = NULL;
-	system_character_t *value_string  = NULL;
-	libesedb_column_t *column         = NULL;
-	libesedb_record_t *record         = NULL;
-	FILE *table_file_stream           = NULL;
-	static char *function             = "export_handle_export_table";
-	size_t item_filename_size         = 0;
-	size_t value_string_size          = 0;
-	int column_iterator               = 0;
-	int known_table                   = 0;
-	int number_of_columns             = 0;
-	int number_of_records             = 0;
-	int record_iterator               = 0;
-	int result                        = 0;
+	static char *function = "export_handle_open";
 
-	if( table == NULL )
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table.",
+		 "%s: invalid export handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( table_name == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table name.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_handle_create_item_filename(
-	     export_handle,
-	     table_index,
-	     table_name,
-	     table_name_length,
-	     &item_filename,
-	     &item_filename_size,
-	     error ) != 1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->input_filename != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item filename.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - input filename value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = export_handle_create_text_item_file(
-	          export_handle,
-	          item_filename,
-	          item_filename_size - 1,
-	          export_path,
-	          export_path_length,
-	          &table_file_stream,
-	          error );
+#endif
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     export_handle->input_file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libesedb_file_open(
+	     export_handle->input_file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The input filename is retained so that every export thread
+	 * can open its own input file
+	 */
+	export_handle->input_filename_size = system_string_length(
+	                                      filename ) + 1;
+
+	export_handle->input_filename = system_string_allocate(
+	                                 export_handle->input_filename_size );
+
+	if( export_handle->input_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create table file.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input filename.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result == 0 )
+	if( system_string_copy(
+	     export_handle->input_filename,
+	     filename,
+	     export_handle->input_filename_size ) == NULL )
 	{
-		log_handle_printf(
-		 log_handle,
-		 "Skipping table: %" PRIs_SYSTEM " it already exists.\n",
-		 item_filename );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy input filename.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( export_handle->input_filename != NULL )
+	{
 		memory_free(
-		 item_filename );
+		 export_handle->input_filename );
 
-		return( 1 );
+		export_handle->input_filename = NULL;
 	}
-	memory_free(
-	 item_filename );
+	export_handle->input_filename_size = 0;
 
-	item_filename = NULL;
+	libesedb_file_close(
+	 export_handle->input_file,
+	 NULL );
 
-	/* Write the column names to the table file
-	 */
-	if( libesedb_table_get_number_of_columns(
-	     table,
-	     &number_of_columns,
-	     0,
-	     error ) != 1 )
+	return( -1 );
+#endif
+}
+
+/* Closes the export handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close";
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of columns.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( column_iterator = 0;
-	     column_iterator < number_of_columns;
-	     column_iterator++ )
+	if( libesedb_file_close(
+	     export_handle->input_file,
+	     error ) != 0 )
 	{
-		if( libesedb_table_get_column(
-		     table,
-		     column_iterator,
-		     &column,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Database functions
+ */
+
+/* Frees a table name
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free_table_name(
+     char **table_name,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free_table_name";
+
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_name != NULL )
+	{
+		memory_free(
+		 *table_name );
+
+		*table_name = NULL;
+	}
+	return( 1 );
+}
+
+/* Item generic export functions
+ */
+
+/* Creates an item filename
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_create_item_filename(
+     export_handle_t *export_handle,
+     int item_index,
+     const system_character_t *item_name,
+     size_t item_name_length,
+     system_character_t **item_filename,
+     size_t *item_filename_size,
+     libcerror_error_t **error )
+{
+	const system_character_t *suffix = NULL;
+	static char *function            = "export_handle_create_item_filename";
+	size_t suffix_length             = 0;
+	int number_of_digits             = 0;
+	int remainder                    = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item name.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item filename size.",
+		 function );
+
+		return( -1 );
+	}
+	remainder = item_index;
+
+	do
+	{
+		number_of_digits++;
+
+		remainder /= 10;
+	}
+	while( remainder > 0 );
+
+	/* Compressed item files have the suffix of the compression method
+	 */
+	if( export_handle->compression_method == EXPORT_COMPRESSION_METHOD_GZIP )
+	{
+		suffix        = _SYSTEM_STRING( ".gz" );
+		suffix_length = 3;
+	}
+	else if( export_handle->compression_method == EXPORT_COMPRESSION_METHOD_ZSTD )
+	{
+		suffix        = _SYSTEM_STRING( ".zst" );
+		suffix_length = 4;
+	}
+	*item_filename_size = item_name_length + number_of_digits + suffix_length + 2;
+
+	*item_filename = system_string_allocate(
+	                  *item_filename_size );
+
+	if( *item_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item filename string.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     *item_filename,
+	     item_name,
+	     item_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy item name.",
+		 function );
+
+		goto on_error;
+	}
+	( *item_filename )[ item_name_length++ ] = (system_character_t) '.';
+
+	if( esedbtools_system_string_copy_from_64_bit_in_decimal(
+	     *item_filename,
+	     *item_filename_size,
+	     &item_name_length,
+	     (uint64_t) item_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy item index to string.",
+		 function );
+
+		goto on_error;
+	}
+	if( suffix != NULL )
+	{
+		if( system_string_copy(
+		     &( ( *item_filename )[ item_name_length ] ),
+		     suffix,
+		     suffix_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy item filename suffix.",
+			 function );
+
+			goto on_error;
+		}
+		item_name_length += suffix_length;
+	}
+	( *item_filename )[ item_name_length ] = 0;
+	
+	return( 1 );
+
+on_error:
+	if( *item_filename != NULL )
+	{
+		memory_free(
+		 *item_filename );
+
+		*item_filename = NULL;
+	}
+	*item_filename_size = 0;
+
+	return( -1 );
+}
+
+/* Creates a text item file
+ * Returns 1 if successful, 0 if the file already exists or -1 on error
+ */
+int export_handle_create_text_item_file(
+     export_handle_t *export_handle,
+     const system_character_t *item_filename,
+     size_t item_filename_length,
+     const system_character_t *export_path,
+     size_t export_path_length,
+     FILE **item_file_stream,
+     libcerror_error_t **error )
+{
+	system_character_t *item_filename_path = NULL;
+	static char *function                  = "export_handle_create_text_item_file";
+	size_t item_filename_path_size         = 0;
+	int result                             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item file stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_path_join_wide(
+	     &item_filename_path,
+	     &item_filename_path_size,
+	     export_path,
+	     export_path_length,
+	     item_filename,
+	     item_filename_length,
+	     error ) != 1 )
+#else
+	if( libcpath_path_join(
+	     &item_filename_path,
+	     &item_filename_path_size,
+	     export_path,
+	     export_path_length,
+	     item_filename,
+	     item_filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item filename path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+	          item_filename_path,
+	          error );
+#else
+	result = libcfile_file_exists(
+	          item_filename_path,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+		 function,
+		 item_filename_path );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		memory_free(
+		 item_filename_path );
+
+		return( 0 );
+	}
+	/* Formats other than text define their own line endings and are written in binary mode
+	 */
+	if( ( export_handle->export_format != EXPORT_FORMAT_TEXT )
+	 || ( export_handle->compression_method != EXPORT_COMPRESSION_METHOD_NONE ) )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		*item_file_stream = file_stream_open_wide(
+		                     item_filename_path,
+		                     _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+		*item_file_stream = file_stream_open(
+		                     item_filename_path,
+		                     FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		*item_file_stream = file_stream_open_wide(
+		                     item_filename_path,
+		                     _SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
+#else
+		*item_file_stream = file_stream_open(
+		                     item_filename_path,
+		                     FILE_STREAM_OPEN_WRITE );
+#endif
+	}
+
+	if( *item_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 item_filename_path );
+
+		goto on_error;
+	}
+	memory_free(
+	 item_filename_path );
+
+	return( 1 );
+
+on_error:
+	if( item_filename_path != NULL )
+	{
+		memory_free(
+		 item_filename_path );
+	}
+	return( -1 );
+}
+
+/* Creates the checkpoint filename of an item file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_create_checkpoint_filename(
+     export_handle_t *export_handle,
+     const system_character_t *item_filename,
+     size_t item_filename_length,
+     const system_character_t *export_path,
+     size_t export_path_length,
+     system_character_t **checkpoint_filename,
+     size_t *checkpoint_filename_size,
+     libcerror_error_t **error )
+{
+	system_character_t *item_filename_path = NULL;
+	static char *function                  = "export_handle_create_checkpoint_filename";
+	size_t item_filename_path_size         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checkpoint_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checkpoint filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint filename size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_path_join_wide(
+	     &item_filename_path,
+	     &item_filename_path_size,
+	     export_path,
+	     export_path_length,
+	     item_filename,
+	     item_filename_length,
+	     error ) != 1 )
+#else
+	if( libcpath_path_join(
+	     &item_filename_path,
+	     &item_filename_path_size,
+	     export_path,
+	     export_path_length,
+	     item_filename,
+	     item_filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item filename path.",
+		 function );
+
+		goto on_error;
+	}
+	/* The checkpoint filename consists of the item filename path and the suffix .checkpoint
+	 */
+	*checkpoint_filename_size = item_filename_path_size + 11;
+
+	*checkpoint_filename = system_string_allocate(
+	                        *checkpoint_filename_size );
+
+	if( *checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoint filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     *checkpoint_filename,
+	     item_filename_path,
+	     item_filename_path_size - 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set checkpoint filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( ( *checkpoint_filename )[ item_filename_path_size - 1 ] ),
+	     _SYSTEM_STRING( ".checkpoint" ),
+	     11 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set checkpoint filename suffix.",
+		 function );
+
+		goto on_error;
+	}
+	( *checkpoint_filename )[ *checkpoint_filename_size - 1 ] = 0;
+
+	memory_free(
+	 item_filename_path );
+
+	return( 1 );
+
+on_error:
+	if( *checkpoint_filename != NULL )
+	{
+		memory_free(
+		 *checkpoint_filename );
+
+		*checkpoint_filename = NULL;
+	}
+	*checkpoint_filename_size = 0;
+
+	if( item_filename_path != NULL )
+	{
+		memory_free(
+		 item_filename_path );
+	}
+	return( -1 );
+}
+
+/* Opens a text item file of an interrupted export to resume it
+ * The item file is truncated to the stream offset of its checkpoint
+ * Returns 1 if successful, 0 if the item file is smaller than the stream offset or -1 on error
+ */
+int export_handle_resume_text_item_file(
+     export_handle_t *export_handle,
+     const system_character_t *item_filename,
+     size_t item_filename_length,
+     const system_character_t *export_path,
+     size_t export_path_length,
+     off64_t stream_offset,
+     FILE **item_file_stream,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *item_file             = NULL;
+	system_character_t *item_filename_path = NULL;
+	static char *function                  = "export_handle_resume_text_item_file";
+	size64_t item_file_size                = 0;
+	size_t item_filename_path_size         = 0;
+	int result                             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid stream offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item file stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_path_join_wide(
+	     &item_filename_path,
+	     &item_filename_path_size,
+	     export_path,
+	     export_path_length,
+	     item_filename,
+	     item_filename_length,
+	     error ) != 1 )
+#else
+	if( libcpath_path_join(
+	     &item_filename_path,
+	     &item_filename_path_size,
+	     export_path,
+	     export_path_length,
+	     item_filename,
+	     item_filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item filename path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          item_file,
+	          item_filename_path,
+	          LIBCFILE_OPEN_WRITE,
+	          error );
+#else
+	result = libcfile_file_open(
+	          item_file,
+	          item_filename_path,
+	          LIBCFILE_OPEN_WRITE,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 item_filename_path );
+
+		goto on_error;
+	}
+	if( libcfile_file_get_size(
+	     item_file,
+	     &item_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item file size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data after the checkpoint belongs to records that are exported again
+	 */
+	if( item_file_size >= (size64_t) stream_offset )
+	{
+		if( libcfile_file_resize(
+		     item_file,
+		     (size64_t) stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to truncate: %" PRIs_SYSTEM ".",
+			 function,
+			 item_filename_path );
+
+			goto on_error;
+		}
+		result = 1;
+	}
+	else
+	{
+		result = 0;
+	}
+	if( libcfile_file_close(
+	     item_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close item file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free item file.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		memory_free(
+		 item_filename_path );
+
+		return( 0 );
+	}
+	if( ( export_handle->export_format != EXPORT_FORMAT_TEXT )
+	 || ( export_handle->compression_method != EXPORT_COMPRESSION_METHOD_NONE ) )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		*item_file_stream = file_stream_open_wide(
+		                     item_filename_path,
+		                     _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_APPEND ) );
+#else
+		*item_file_stream = file_stream_open(
+		                     item_filename_path,
+		                     FILE_STREAM_BINARY_OPEN_APPEND );
+#endif
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		*item_file_stream = file_stream_open_wide(
+		                     item_filename_path,
+		                     _SYSTEM_STRING( FILE_STREAM_OPEN_APPEND ) );
+#else
+		*item_file_stream = file_stream_open(
+		                     item_filename_path,
+		                     FILE_STREAM_OPEN_APPEND );
+#endif
+	}
+	if( *item_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 item_filename_path );
+
+		goto on_error;
+	}
+	/* Make sure the offset of the stream is that of the end of the item file,
+	 * which is used by the next checkpoint
+	 */
+	if( file_stream_seek_offset(
+	     *item_file_stream,
+	     0,
+	     SEEK_END ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek end of: %" PRIs_SYSTEM ".",
+		 function,
+		 item_filename_path );
+
+		file_stream_close(
+		 *item_file_stream );
+
+		*item_file_stream = NULL;
+
+		goto on_error;
+	}
+	memory_free(
+	 item_filename_path );
+
+	return( 1 );
+
+on_error:
+	if( item_file != NULL )
+	{
+		libcfile_file_free(
+		 &item_file,
+		 NULL );
+	}
+	if( item_filename_path != NULL )
+	{
+		memory_free(
+		 item_filename_path );
+	}
+	return( -1 );
+}
+
+/* Writes a checkpoint of the export of a table
+ * The output buffer is flushed so that the checkpoint contains the stream offset
+ * of the records that precede the record index
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_checkpoint(
+     export_handle_t *export_handle,
+     const system_character_t *checkpoint_filename,
+     int record_index,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function      = "export_handle_write_checkpoint";
+	off64_t stream_offset      = 0;
+	uint32_t settings_checksum = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	/* A compressed item file is resumed with a new gzip member or zstd frame
+	 */
+	if( output_buffer_finish(
+	     output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream_flush(
+	     output_buffer->stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output stream.",
+		 function );
+
+		return( -1 );
+	}
+	stream_offset = (off64_t) file_stream_get_offset(
+	                           output_buffer->stream );
+
+	if( stream_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to retrieve output stream offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_get_settings_checksum(
+	     export_handle,
+	     &settings_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve settings checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_file_write(
+	     checkpoint_filename,
+	     settings_checksum,
+	     record_index,
+	     stream_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports a specific table of an input file
+ * The number of tables is used in the notification, where 0 represents a specific table
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_table_by_index(
+     export_handle_t *export_handle,
+     libesedb_file_t *input_file,
+     int database_type,
+     int table_index,
+     const system_character_t *table_name,
+     size_t table_name_length,
+     int number_of_tables,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libesedb_table_t *table            = NULL;
+	system_character_t *sanitized_name = NULL;
+	static char *function              = "export_handle_export_table_by_index";
+	size_t sanitized_name_size         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_get_table(
+	     input_file,
+	     table_index,
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table: %d.",
+		 function,
+		 table_index );
+
+		goto on_error;
+	}
+	/* The notification is written with a single call so that it is not
+	 * interleaved with the output of other export threads
+	 */
+	if( number_of_tables > 0 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Exporting table %d (%" PRIs_SYSTEM ") out of %d.\n",
+		 table_index + 1,
+		 table_name,
+		 number_of_tables );
+	}
+	else
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Exporting table %d (%" PRIs_SYSTEM ").\n",
+		 table_index + 1,
+		 table_name );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_path_get_sanitized_filename_wide(
+	     table_name,
+	     table_name_length,
+	     &sanitized_name,
+	     &sanitized_name_size,
+	     error ) != 1 )
+#else
+	if( libcpath_path_get_sanitized_filename(
+	     table_name,
+	     table_name_length,
+	     &sanitized_name,
+	     &sanitized_name_size,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable sanitize table name.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_export_table(
+	     export_handle,
+	     input_file,
+	     database_type,
+	     table,
+	     table_index,
+	     sanitized_name,
+	     sanitized_name_size - 1,
+	     export_handle->items_export_path,
+	     export_handle->items_export_path_size - 1,
+	     log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export table: %d.",
+		 function,
+		 table_index );
+
+		goto on_error;
+	}
+	memory_free(
+	 sanitized_name );
+
+	sanitized_name = NULL;
+
+	if( libesedb_table_free(
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table: %d.",
+		 function,
+		 table_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sanitized_name != NULL )
+	{
+		memory_free(
+		 sanitized_name );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Exports the table of a table job
+ * This function is the callback of the export thread pool. A libesedb file
+ * is not thread-safe, hence every table job opens its own input file. The
+ * result and error are stored in the table job
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_table_job(
+     export_table_job_t *table_job,
+     export_handle_t *export_handle )
+{
+	libesedb_file_t *input_file = NULL;
+	static char *function       = "export_handle_export_table_job";
+
+	if( table_job == NULL )
+	{
+		return( -1 );
+	}
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 &( table_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_file_initialize(
+	     &input_file,
+	     &( table_job->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( table_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only the catalog definitions of the exported table are read
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     input_file,
+	     export_handle->input_filename,
+	     LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	     &( table_job->error ) ) != 1 )
+#else
+	if( libesedb_file_open(
+	     input_file,
+	     export_handle->input_filename,
+	     LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	     &( table_job->error ) ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 &( table_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_export_table_by_index(
+	     export_handle,
+	     input_file,
+	     table_job->database_type,
+	     table_job->table_index,
+	     table_job->table_name,
+	     table_job->table_name_length,
+	     table_job->number_of_tables,
+	     table_job->log_handle,
+	     &( table_job->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( table_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export table: %d.",
+		 function,
+		 table_job->table_index );
+
+		goto on_error;
+	}
+	if( libesedb_file_close(
+	     input_file,
+	     &( table_job->error ) ) != 0 )
+	{
+		libcerror_error_set(
+		 &( table_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_free(
+	     &input_file,
+	     &( table_job->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( table_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input file.",
+		 function );
+
+		goto on_error;
+	}
+	table_job->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( input_file != NULL )
+	{
+		libesedb_file_free(
+		 &input_file,
+		 NULL );
+	}
+	table_job->result = -1;
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Exports the table
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_table(
+     export_handle_t *export_handle,
+     libesedb_file_t *input_file,
+     int database_type,
+     libesedb_table_t *table,
+     int table_index,
+     const system_character_t *table_name,
+     size_t table_name_length,
+     const system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *checkpoint_filename = NULL;
+	system_character_t *item_filename       = NULL;
+	system_character_t *value_string        = NULL;
+	libesedb_column_t *column               = NULL;
+	libesedb_record_t *record               = NULL;
+	FILE *table_file_stream                 = NULL;
+	arrow_writer_t *arrow_writer            = NULL;
+	output_buffer_t *table_output_buffer    = NULL;
+	process_status_t *process_status        = NULL;
+	record_filter_t *record_filter          = NULL;
+	record_writer_t *record_writer          = NULL;
+	const int *value_entries                = NULL;
+	static char *function                   = "export_handle_export_table";
+	size_t checkpoint_filename_size         = 0;
+	size_t item_filename_size               = 0;
+	size_t value_string_size                = 0;
+	off64_t stream_offset                   = 0;
+	uint32_t settings_checksum              = 0;
+	int checkpoint_record_index             = 0;
+	int column_entry                        = 0;
+	int column_iterator                     = 0;
+	int first_record_index                  = 0;
+	int known_table                         = 0;
+	int number_of_columns                   = 0;
+	int number_of_records                   = 0;
+	int number_of_value_entries             = 0;
+	int record_iterator                     = 0;
+	int result                              = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_SQLITE3 )
+	if( export_handle->sqlite_writer != NULL )
+	{
+		if( export_handle_export_table_to_sqlite(
+		     export_handle,
+		     table,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export table to SQLite database.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	if( export_handle_create_item_filename(
+	     export_handle,
+	     table_index,
+	     table_name,
+	     table_name_length,
+	     &item_filename,
+	     &item_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_create_checkpoint_filename(
+	     export_handle,
+	     item_filename,
+	     item_filename_size - 1,
+	     export_path,
+	     export_path_length,
+	     &checkpoint_filename,
+	     &checkpoint_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_get_settings_checksum(
+	     export_handle,
+	     &settings_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve settings checksum.",
+		 function );
+
+		goto on_error;
+	}
+	/* A table file with a checkpoint file was not exported completely
+	 * the checkpoint file is only used with the same export settings
+	 */
+	if( export_handle->resume != 0 )
+	{
+		result = checkpoint_file_read(
+		          checkpoint_filename,
+		          settings_checksum,
+		          &first_record_index,
+		          &stream_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read checkpoint file.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			result = export_handle_resume_text_item_file(
+			          export_handle,
+			          item_filename,
+			          item_filename_size - 1,
+			          export_path,
+			          export_path_length,
+			          stream_offset,
+			          &table_file_stream,
+			          error );
+
+			if( result == 0 )
+			{
+				log_handle_printf(
+				 log_handle,
+				 "Table: %" PRIs_SYSTEM " is smaller than its checkpoint, restarting its export.\n",
+				 item_filename );
+
+				first_record_index = 0;
+				stream_offset      = 0;
+
+				result = export_handle_resume_text_item_file(
+				          export_handle,
+				          item_filename,
+				          item_filename_size - 1,
+				          export_path,
+				          export_path_length,
+				          stream_offset,
+				          &table_file_stream,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to resume table file.",
+				 function );
+
+				goto on_error;
+			}
+			log_handle_printf(
+			 log_handle,
+			 "Resuming table: %" PRIs_SYSTEM " at record: %d.\n",
+			 item_filename,
+			 first_record_index );
+
+			checkpoint_record_index = first_record_index;
+		}
+	}
+	if( table_file_stream == NULL )
+	{
+		result = export_handle_create_text_item_file(
+		          export_handle,
+		          item_filename,
+		          item_filename_size - 1,
+		          export_path,
+		          export_path_length,
+		          &table_file_stream,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create table file.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "Skipping table: %" PRIs_SYSTEM " it already exists.\n",
+			 item_filename );
+
+			memory_free(
+			 checkpoint_filename );
+			memory_free(
+			 item_filename );
+
+			return( 1 );
+		}
+		if( checkpoint_file_write(
+		     checkpoint_filename,
+		     settings_checksum,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write checkpoint file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 item_filename );
+
+	item_filename = NULL;
+
+	if( output_buffer_initialize(
+	     &table_output_buffer,
+	     table_file_stream,
+	     EXPORT_HANDLE_OUTPUT_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_set_compression_method(
+	     table_output_buffer,
+	     (int) export_handle->compression_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compression method of table output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( export_handle->column_names != NULL )
+	 || ( export_handle->record_condition != NULL ) )
+	{
+		if( record_filter_initialize(
+		     &record_filter,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record filter.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle->column_names != NULL )
+		{
+			if( record_filter_set_columns(
+			     record_filter,
+			     table,
+			     export_handle->column_names,
+			     export_handle->column_names_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set columns in record filter.",
+				 function );
+
+				goto on_error;
+			}
+			value_entries           = record_filter->value_entries;
+			number_of_value_entries = record_filter->number_of_value_entries;
+
+			/* The table specific export functions export all columns
+			 */
+			database_type = DATABASE_TYPE_UNKNOWN;
+		}
+		if( export_handle->record_condition != NULL )
+		{
+			if( record_filter_set_condition(
+			     record_filter,
+			     table,
+			     export_handle->record_condition,
+			     export_handle->record_condition_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set condition in record filter.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_ARROW )
+	{
+		if( arrow_writer_initialize(
+		     &arrow_writer,
+		     export_handle->number_of_rows_per_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create Arrow writer.",
+			 function );
+
+			goto on_error;
+		}
+		if( arrow_writer_set_columns_from_table(
+		     arrow_writer,
+		     table,
+		     value_entries,
+		     number_of_value_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set columns in Arrow writer.",
+			 function );
+
+			goto on_error;
+		}
+		/* A resumed table file already contains the schema
+		 */
+		if( stream_offset == 0 )
+		{
+			if( arrow_writer_write_schema(
+			     arrow_writer,
+			     table_output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write schema.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The table specific export functions only support the text format
+		 */
+		database_type = DATABASE_TYPE_UNKNOWN;
+	}
+	else if( export_handle->export_format != EXPORT_FORMAT_TEXT )
+	{
+		if( record_writer_initialize(
+		     &record_writer,
+		     (int) export_handle->export_format,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record writer.",
+			 function );
+
+			goto on_error;
+		}
+		if( record_writer_set_column_names_from_table(
+		     record_writer,
+		     table,
+		     value_entries,
+		     number_of_value_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column names in record writer.",
+			 function );
+
+			goto on_error;
+		}
+		/* A resumed table file already contains the header
+		 */
+		if( stream_offset == 0 )
+		{
+			if( record_writer_write_header(
+			     record_writer,
+			     table_output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write header.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The table specific export functions only support the text format
+		 */
+		database_type = DATABASE_TYPE_UNKNOWN;
+	}
+	else if( stream_offset == 0 )
+	{
+		/* Write the column names to the table file
+		 */
+		if( libesedb_table_get_number_of_columns(
+		     table,
+		     &number_of_columns,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns.",
+			 function );
+
+			goto on_error;
+		}
+		if( value_entries != NULL )
+		{
+			number_of_columns = number_of_value_entries;
+		}
+		for( column_iterator = 0;
+		     column_iterator < number_of_columns;
+		     column_iterator++ )
+		{
+			if( value_entries != NULL )
+			{
+				column_entry = value_entries[ column_iterator ];
+			}
+			else
+			{
+				column_entry = column_iterator;
+			}
+			if( libesedb_table_get_column(
+			     table,
+			     column_entry,
+			     &column,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column: %d.",
+				 function,
+				 column_entry );
+
+				goto on_error;
+			}
+	#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libesedb_column_get_utf16_name_size(
+			          column,
+			          &value_string_size,
+			          error );
+	#else
+			result = libesedb_column_get_utf8_name_size(
+			          column,
+			          &value_string_size,
+			          error );
+	#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the size of the column name.",
+				 function );
+
+				goto on_error;
+			}
+			if( value_string_size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing column name.",
+				 function );
+
+				goto on_error;
+			}
+			value_string = system_string_allocate(
+			                value_string_size );
+
+			if( value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create column name string.",
+				 function );
+
+				goto on_error;
+			}
+	#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libesedb_column_get_utf16_name(
+			          column,
+			          (uint16_t *) value_string,
+			          value_string_size,
+			          error );
+	#else
+			result = libesedb_column_get_utf8_name(
+			          column,
+			          (uint8_t *) value_string,
+			          value_string_size,
+			          error );
+	#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the column name.",
+				 function );
+
+				goto on_error;
+			}
+			output_buffer_write_system_string(
+			 table_output_buffer,
+			 value_string );
+
+			memory_free(
+			 value_string );
+
+			value_string = NULL;
+
+			if( libesedb_column_free(
+			     &column,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free column.",
+				 function );
+
+				goto on_error;
+			}
+			if( column_iterator == ( number_of_columns - 1 ) )
+			{
+				output_buffer_write_character(
+				 table_output_buffer,
+				 '\n' );
+			}
+			else
+			{
+				output_buffer_write_character(
+				 table_output_buffer,
+				 '\t' );
+			}
+		}
+	}
+	/* Write the record (row) values to the table file
+	 */
+	if( libesedb_table_get_number_of_records(
+	     table,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->print_status_information != 0 )
+	{
+		if( process_status_initialize(
+		     &process_status,
+		     stderr,
+		     export_handle->print_status_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create process status.",
+			 function );
+
+			goto on_error;
+		}
+		if( process_status_start(
+		     process_status,
+		     input_file,
+		     table_name,
+		     number_of_records,
+		     first_record_index,
+		     stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start process status.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( record_iterator = first_record_index;
+	     record_iterator < number_of_records;
+	     record_iterator++ )
+	{
+		if( libesedb_table_get_record(
+		     table,
+		     record_iterator,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_iterator );
+
+			goto on_error;
+		}
+		if( record_filter != NULL )
+		{
+			result = record_filter_match_record(
+			          record_filter,
+			          record,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to determine if record: %d matches filter.",
+				 function,
+				 record_iterator );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( libesedb_record_free(
+				     &record,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record.",
+					 function );
+
+					goto on_error;
+				}
+				if( export_handle->abort != 0 )
+				{
+					break;
+				}
+				continue;
+			}
+		}
+/* TODO move to separate export table functions */
+		known_table = 0;
+
+		switch( database_type )
+		{
+			case DATABASE_TYPE_EXCHANGE:
+				if( table_name_length == 3 )
+				{
+					if( system_string_compare(
+					     table_name,
+					     _SYSTEM_STRING( "Msg" ),
+					     3 ) == 0 )
+					{
+						known_table = 1;
+
+						result = exchange_export_record_msg(
+							  record,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+				}
+				else if( table_name_length == 6 )
+				{
+					if( system_string_compare(
+					     table_name,
+					     _SYSTEM_STRING( "Global" ),
+					     6 ) == 0 )
+					{
+						known_table = 1;
+
+						result = exchange_export_record_global(
+							  record,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+				}
+				else if( table_name_length == 7 )
+				{
+					if( system_string_compare(
+					     table_name,
+					     _SYSTEM_STRING( "Folders" ),
+					     7 ) == 0 )
+					{
+						known_table = 1;
+
+						result = exchange_export_record_folders(
+							  record,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+					else if( system_string_compare(
+						  table_name,
+						  _SYSTEM_STRING( "Mailbox" ),
+						  7 ) == 0 )
+					{
+						known_table = 1;
+
+						result = exchange_export_record_mailbox(
+							  record,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+				}
+				else if( table_name_length == 11 )
+				{
+					if( system_string_compare(
+					     table_name,
+					     _SYSTEM_STRING( "PerUserRead" ),
+					     11 ) == 0 )
+					{
+						known_table = 1;
+
+						result = exchange_export_record_per_user_read(
+							  record,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+				}
+				break;
+
+			case DATABASE_TYPE_SRUM:
+				if( table_name_length == 38 )
+				{
+					if( ( table_name[ 0 ] == '{' )
+					 && ( table_name[ 9 ] == '-' )
+					 && ( table_name[ 14 ] == '-' )
+					 && ( table_name[ 19 ] == '-' )
+					 && ( table_name[ 24 ] == '-' )
+					 && ( table_name[ 37 ] == '}' ) )
+					{
+						known_table = 1;
+
+						result = srumdb_export_record_guid(
+							  record,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+				}
+				break;
+
+			case DATABASE_TYPE_WEBCACHE:
+				if( table_name_length == 10 )
+				{
+					if( system_string_compare(
+					     table_name,
+					     _SYSTEM_STRING( "Containers" ),
+					     10 ) == 0 )
+					{
+						known_table = 1;
+
+						result = webcache_export_record_containers(
+							  record,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+				}
+				if( table_name_length >= 10 )
+				{
+					if( system_string_compare(
+					     table_name,
+					     _SYSTEM_STRING( "Container_" ),
+					     10 ) == 0 )
+					{
+						known_table = 1;
+
+						result = webcache_export_record_container(
+							  record,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+				}
+				break;
+
+			case DATABASE_TYPE_WINDOWS_SEARCH:
+				if( table_name_length == 14 )
+				{
+					if( system_string_compare(
+					     table_name,
+					     _SYSTEM_STRING( "SystemIndex_0A" ),
+					     14 ) == 0 )
+					{
+						known_table = 1;
+
+						result = windows_search_export_record_systemindex_0a(
+							  record,
+							  export_handle->ascii_codepage,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+				}
+				else if( table_name_length == 16 )
+				{
+					if( system_string_compare(
+					     table_name,
+					     _SYSTEM_STRING( "SystemIndex_Gthr" ),
+					     16 ) == 0 )
+					{
+						known_table = 1;
+
+						result = windows_search_export_record_systemindex_gthr(
+							  record,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+				}
+				break;
+
+			case DATABASE_TYPE_WINDOWS_SECURITY:
+				if( table_name_length == 12 )
+				{
+					if( system_string_compare(
+					     table_name,
+					     _SYSTEM_STRING( "SmTblSection" ),
+					     12 ) == 0 )
+					{
+						known_table = 1;
+
+						result = windows_security_export_record_smtblsection(
+							  record,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+					else if( system_string_compare(
+						  table_name,
+						  _SYSTEM_STRING( "SmTblVersion" ),
+						  12 ) == 0 )
+					{
+						known_table = 1;
+
+						result = windows_security_export_record_smtblversion(
+							  record,
+							  table_output_buffer,
+							  log_handle,
+							  error );
+					}
+				}
+				break;
+
+			case DATABASE_TYPE_UNKNOWN:
+			default:
+				break;
+		}
+		if( known_table == 0 )
+		{
+			if( arrow_writer != NULL )
+			{
+				result = arrow_writer_append_record(
+				          arrow_writer,
+				          record,
+				          table_output_buffer,
+				          log_handle,
+				          error );
+			}
+			else if( record_writer != NULL )
+			{
+				result = record_writer_write_record(
+				          record_writer,
+				          record,
+				          table_output_buffer,
+				          log_handle,
+				          error );
+			}
+			else
+			{
+				result = export_handle_export_record(
+				          record,
+				          value_entries,
+				          number_of_value_entries,
+				          table_output_buffer,
+				          log_handle,
+				          error );
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+		/* The Arrow writer buffers the rows of a record batch, hence a checkpoint
+		 * is only written after a record batch was written
+		 */
+		if( ( ( record_iterator + 1 - checkpoint_record_index ) >= export_handle->number_of_rows_per_batch )
+		 && ( ( arrow_writer == NULL )
+		  || ( arrow_writer->number_of_rows == 0 ) ) )
+		{
+			if( export_handle_write_checkpoint(
+			     export_handle,
+			     checkpoint_filename,
+			     record_iterator + 1,
+			     table_output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint of record: %d.",
+				 function,
+				 record_iterator );
+
+				goto on_error;
+			}
+			checkpoint_record_index = record_iterator + 1;
+		}
+		if( process_status != NULL )
+		{
+			if( process_status_update(
+			     process_status,
+			     record_iterator + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update process status.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	if( arrow_writer != NULL )
+	{
+		if( arrow_writer_write_end_of_stream(
+		     arrow_writer,
+		     table_output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write end of stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( arrow_writer_free(
+		     &arrow_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Arrow writer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( record_writer != NULL )
+	{
+		if( record_writer_free(
+		     &record_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record writer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( record_filter != NULL )
+	{
+		if( record_filter_free(
+		     &record_filter,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record filter.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( output_buffer_finish(
+	     table_output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write table file.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_free(
+	     &table_output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status != NULL )
+	{
+		/* The record at which the export was aborted was exported
+		 */
+		if( record_iterator < number_of_records )
+		{
+			record_iterator++;
+		}
+		if( process_status_stop(
+		     process_status,
+		     record_iterator,
+		     file_stream_get_offset(
+		      table_file_stream ),
+		     ( export_handle->abort != 0 ) ? PROCESS_STATUS_ABORTED : PROCESS_STATUS_COMPLETED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop process status.",
+			 function );
+
+			goto on_error;
+		}
+		if( process_status_free(
+		     &process_status,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free process status.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     table_file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close table file.",
+		 function );
+
+		goto on_error;
+	}
+	table_file_stream = NULL;
+
+	/* The checkpoint file of an aborted export is kept so that the export can be resumed
+	 */
+	if( export_handle->abort == 0 )
+	{
+		if( checkpoint_file_remove(
+		     checkpoint_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 "%s: unable to remove checkpoint file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 checkpoint_filename );
+
+	checkpoint_filename = NULL;
+
+	if( export_handle->abort == 0 )
+	{
+		if( export_handle->export_mode == EXPORT_MODE_CARVE )
+		{
+			if( export_handle_export_carved_records(
+			     export_handle,
+			     table,
+			     table_index,
+			     table_name,
+			     table_name_length,
+			     export_path,
+			     export_path_length,
+			     log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export carved records.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( export_handle->export_mode != EXPORT_MODE_TABLES )
+		{
+			if( export_handle_export_indexes(
+			     export_handle,
+			     table,
+			     table_name,
+			     table_name_length,
+			     export_path,
+			     export_path_length,
+			     log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export indexes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( checkpoint_filename != NULL )
+	{
+		memory_free(
+		 checkpoint_filename );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( arrow_writer != NULL )
+	{
+		arrow_writer_free(
+		 &arrow_writer,
+		 NULL );
+	}
+	if( record_writer != NULL )
+	{
+		record_writer_free(
+		 &record_writer,
+		 NULL );
+	}
+	if( record_filter != NULL )
+	{
+		record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	if( process_status != NULL )
+	{
+		if( table_file_stream != NULL )
+		{
+			process_status_stop(
+			 process_status,
+			 record_iterator,
+			 file_stream_get_offset(
+			  table_file_stream ),
+			 PROCESS_STATUS_FAILED,
+			 NULL );
+		}
+		else
+		{
+			process_status_stop(
+			 process_status,
+			 record_iterator,
+			 0,
+			 PROCESS_STATUS_FAILED,
+			 NULL );
+		}
+		process_status_free(
+		 &process_status,
+		 NULL );
+	}
+	if( table_output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &table_output_buffer,
+		 NULL );
+	}
+	if( table_file_stream != NULL )
+	{
+		file_stream_close(
+		 table_file_stream );
+	}
+	if( item_filename != NULL )
+	{
+		memory_free(
+		 item_filename );
+	}
+	return( -1 );
+}
+
+/* Exports the records carved from the pages of the table
+ * The carved records are written to a separate text file with the page number,
+ * the offset and the confidence of every record preceding its values
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_carved_records(
+     export_handle_t *export_handle,
+     libesedb_table_t *table,
+     int table_index,
+     const system_character_t *table_name,
+     size_t table_name_length,
+     const system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *item_filename     = NULL;
+	system_character_t *item_name         = NULL;
+	system_character_t *value_string      = NULL;
+	libesedb_column_t *column             = NULL;
+	libesedb_record_t *record             = NULL;
+	FILE *carved_file_stream              = NULL;
+	output_buffer_t *carved_output_buffer = NULL;
+	static char *function                 = "export_handle_export_carved_records";
+	size_t item_filename_size             = 0;
+	size_t item_name_size                 = 0;
+	size_t value_string_size              = 0;
+	off64_t data_offset                   = 0;
+	uint32_t page_number                  = 0;
+	uint8_t carve_confidence              = 0;
+	int column_iterator                   = 0;
+	int number_of_columns                 = 0;
+	int number_of_records                 = 0;
+	int record_iterator                   = 0;
+	int result                            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page range is limited to the last page by the library
+	 */
+	if( libesedb_table_carve_records(
+	     table,
+	     1,
+	     0xffffffffUL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve records.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_table_get_number_of_carved_records(
+	          table,
+	          &number_of_records,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of carved records.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result == 0 )
+	 || ( number_of_records == 0 ) )
+	{
+		return( 1 );
+	}
+	/* The carved records are stored in: <table name>.carved.<table index>
+	 */
+	item_name_size = table_name_length + 8;
+
+	item_name = system_string_allocate(
+	             item_name_size );
+
+	if( item_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item name string.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     item_name,
+	     table_name,
+	     table_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy table name.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( item_name[ table_name_length ] ),
+	     _SYSTEM_STRING( ".carved" ),
+	     7 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy item name suffix.",
+		 function );
+
+		goto on_error;
+	}
+	item_name[ item_name_size - 1 ] = 0;
+
+	if( export_handle_create_item_filename(
+	     export_handle,
+	     table_index,
+	     item_name,
+	     item_name_size - 1,
+	     &item_filename,
+	     &item_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item filename.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 item_name );
+
+	item_name = NULL;
+
+	result = export_handle_create_text_item_file(
+	          export_handle,
+	          item_filename,
+	          item_filename_size - 1,
+	          export_path,
+	          export_path_length,
+	          &carved_file_stream,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create carved records file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipping carved records: %" PRIs_SYSTEM " it already exists.\n",
+		 item_filename );
+
+		memory_free(
+		 item_filename );
+
+		return( 1 );
+	}
+	memory_free(
+	 item_filename );
+
+	item_filename = NULL;
+
+	if( output_buffer_initialize(
+	     &carved_output_buffer,
+	     carved_file_stream,
+	     EXPORT_HANDLE_OUTPUT_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create carved records output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_set_compression_method(
+	     carved_output_buffer,
+	     (int) export_handle->compression_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compression method of carved records output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* Write the provenance and column names to the carved records file
+	 */
+	output_buffer_write_string(
+	 carved_output_buffer,
+	 "PageNumber\tOffset\tConfidence" );
+
+	if( libesedb_table_get_number_of_columns(
+	     table,
+	     &number_of_columns,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of columns.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_iterator = 0;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
+	{
+		if( libesedb_table_get_column(
+		     table,
+		     column_iterator,
+		     &column,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 			 "%s: unable to retrieve column: %d.",
@@ -1322,9 +4470,12 @@ int export_handle_export_table(
 
 			goto on_error;
 		}
-		fprintf(
-		 table_file_stream,
-		 "%" PRIs_SYSTEM "",
+		output_buffer_write_character(
+		 carved_output_buffer,
+		 '\t' );
+
+		output_buffer_write_system_string(
+		 carved_output_buffer,
 		 value_string );
 
 		memory_free(
@@ -1345,40 +4496,18 @@ int export_handle_export_table(
 
 			goto on_error;
 		}
-		if( column_iterator == ( number_of_columns - 1 ) )
-		{
-			fprintf(
-			 table_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 table_file_stream,
-			 "\t" );
-		}
 	}
-	/* Write the record (row) values to the table file
-	 */
-	if( libesedb_table_get_number_of_records(
-	     table,
-	     &number_of_records,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
-		 function );
+	output_buffer_write_character(
+	 carved_output_buffer,
+	 '\n' );
 
-		goto on_error;
-	}
+	/* Write the carved record (row) values to the carved records file
+	 */
 	for( record_iterator = 0;
 	     record_iterator < number_of_records;
 	     record_iterator++ )
 	{
-		if( libesedb_table_get_record(
+		if( libesedb_table_get_carved_record(
 		     table,
 		     record_iterator,
 		     &record,
@@ -1388,241 +4517,111 @@ int export_handle_export_table(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %d.",
+			 "%s: unable to retrieve carved record: %d.",
 			 function,
 			 record_iterator );
 
 			goto on_error;
 		}
-/* TODO move to separate export table functions */
-		known_table = 0;
-
-		switch( database_type )
+		if( libesedb_record_get_page_number(
+		     record,
+		     &page_number,
+		     error ) != 1 )
 		{
-			case DATABASE_TYPE_EXCHANGE:
-				if( table_name_length == 3 )
-				{
-					if( system_string_compare(
-					     table_name,
-					     _SYSTEM_STRING( "Msg" ),
-					     3 ) == 0 )
-					{
-						known_table = 1;
-
-						result = exchange_export_record_msg(
-							  record,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-				}
-				else if( table_name_length == 6 )
-				{
-					if( system_string_compare(
-					     table_name,
-					     _SYSTEM_STRING( "Global" ),
-					     6 ) == 0 )
-					{
-						known_table = 1;
-
-						result = exchange_export_record_global(
-							  record,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-				}
-				else if( table_name_length == 7 )
-				{
-					if( system_string_compare(
-					     table_name,
-					     _SYSTEM_STRING( "Folders" ),
-					     7 ) == 0 )
-					{
-						known_table = 1;
-
-						result = exchange_export_record_folders(
-							  record,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-					else if( system_string_compare(
-						  table_name,
-						  _SYSTEM_STRING( "Mailbox" ),
-						  7 ) == 0 )
-					{
-						known_table = 1;
-
-						result = exchange_export_record_mailbox(
-							  record,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-				}
-				else if( table_name_length == 11 )
-				{
-					if( system_string_compare(
-					     table_name,
-					     _SYSTEM_STRING( "PerUserRead" ),
-					     11 ) == 0 )
-					{
-						known_table = 1;
-
-						result = exchange_export_record_per_user_read(
-							  record,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-				}
-				break;
-
-			case DATABASE_TYPE_SRUM:
-				if( table_name_length == 38 )
-				{
-					if( ( table_name[ 0 ] == '{' )
-					 && ( table_name[ 9 ] == '-' )
-					 && ( table_name[ 14 ] == '-' )
-					 && ( table_name[ 19 ] == '-' )
-					 && ( table_name[ 24 ] == '-' )
-					 && ( table_name[ 37 ] == '}' ) )
-					{
-						known_table = 1;
-
-						result = srumdb_export_record_guid(
-							  record,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-				}
-				break;
-
-			case DATABASE_TYPE_WEBCACHE:
-				if( table_name_length == 10 )
-				{
-					if( system_string_compare(
-					     table_name,
-					     _SYSTEM_STRING( "Containers" ),
-					     10 ) == 0 )
-					{
-						known_table = 1;
-
-						result = webcache_export_record_containers(
-							  record,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-				}
-				if( table_name_length >= 10 )
-				{
-					if( system_string_compare(
-					     table_name,
-					     _SYSTEM_STRING( "Container_" ),
-					     10 ) == 0 )
-					{
-						known_table = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page number of carved record: %d.",
+			 function,
+			 record_iterator );
 
-						result = webcache_export_record_container(
-							  record,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-				}
-				break;
+			goto on_error;
+		}
+		if( libesedb_record_get_data_offset(
+		     record,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data offset of carved record: %d.",
+			 function,
+			 record_iterator );
 
-			case DATABASE_TYPE_WINDOWS_SEARCH:
-				if( table_name_length == 14 )
-				{
-					if( system_string_compare(
-					     table_name,
-					     _SYSTEM_STRING( "SystemIndex_0A" ),
-					     14 ) == 0 )
-					{
-						known_table = 1;
+			goto on_error;
+		}
+		if( libesedb_record_get_carve_confidence(
+		     record,
+		     &carve_confidence,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve carve confidence of carved record: %d.",
+			 function,
+			 record_iterator );
 
-						result = windows_search_export_record_systemindex_0a(
-							  record,
-							  export_handle->ascii_codepage,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-				}
-				else if( table_name_length == 16 )
-				{
-					if( system_string_compare(
-					     table_name,
-					     _SYSTEM_STRING( "SystemIndex_Gthr" ),
-					     16 ) == 0 )
-					{
-						known_table = 1;
+			goto on_error;
+		}
+		output_buffer_write_unsigned_decimal(
+		 carved_output_buffer,
+		 (uint64_t) page_number );
 
-						result = windows_search_export_record_systemindex_gthr(
-							  record,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-				}
-				break;
+		output_buffer_printf(
+		 carved_output_buffer,
+		 "\t0x%08" PRIx64 "\t",
+		 (uint64_t) data_offset );
 
-			case DATABASE_TYPE_WINDOWS_SECURITY:
-				if( table_name_length == 12 )
-				{
-					if( system_string_compare(
-					     table_name,
-					     _SYSTEM_STRING( "SmTblSection" ),
-					     12 ) == 0 )
-					{
-						known_table = 1;
+		switch( carve_confidence )
+		{
+			case LIBESEDB_CARVE_CONFIDENCE_HIGH:
+				output_buffer_write_string(
+				 carved_output_buffer,
+				 "high" );
+				break;
 
-						result = windows_security_export_record_smtblsection(
-							  record,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-					else if( system_string_compare(
-						  table_name,
-						  _SYSTEM_STRING( "SmTblVersion" ),
-						  12 ) == 0 )
-					{
-						known_table = 1;
+			case LIBESEDB_CARVE_CONFIDENCE_MEDIUM:
+				output_buffer_write_string(
+				 carved_output_buffer,
+				 "medium" );
+				break;
 
-						result = windows_security_export_record_smtblversion(
-							  record,
-							  table_file_stream,
-							  log_handle,
-							  error );
-					}
-				}
+			case LIBESEDB_CARVE_CONFIDENCE_LOW:
+				output_buffer_write_string(
+				 carved_output_buffer,
+				 "low" );
 				break;
 
-			case DATABASE_TYPE_UNKNOWN:
 			default:
+				output_buffer_write_string(
+				 carved_output_buffer,
+				 "unknown" );
 				break;
 		}
-		if( known_table == 0 )
-		{
-			result = export_handle_export_record(
-			          record,
-			          table_file_stream,
-			          log_handle,
-			          error );
-		}
-		if( result != 1 )
+		output_buffer_write_character(
+		 carved_output_buffer,
+		 '\t' );
+
+		if( export_handle_export_record(
+		     record,
+		     NULL,
+		     0,
+		     carved_output_buffer,
+		     log_handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record.",
-			 function );
+			 "%s: unable to export carved record: %d.",
+			 function,
+			 record_iterator );
 
 			goto on_error;
 		}
@@ -1634,7 +4633,7 @@ int export_handle_export_table(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record.",
+			 "%s: unable to free carved record.",
 			 function );
 
 			goto on_error;
@@ -1644,43 +4643,338 @@ int export_handle_export_table(
 			break;
 		}
 	}
+	if( output_buffer_finish(
+	     carved_output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write carved records file.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_free(
+	     &carved_output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free carved records output buffer.",
+		 function );
+
+		goto on_error;
+	}
 	if( file_stream_close(
-	     table_file_stream ) != 0 )
+	     carved_file_stream ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close table file.",
+		 "%s: unable to close carved records file.",
 		 function );
 
 		goto on_error;
 	}
-	table_file_stream = NULL;
+	carved_file_stream = NULL;
 
-	if( export_handle->abort == 0 )
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( carved_output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &carved_output_buffer,
+		 NULL );
+	}
+	if( carved_file_stream != NULL )
+	{
+		file_stream_close(
+		 carved_file_stream );
+	}
+	if( item_filename != NULL )
+	{
+		memory_free(
+		 item_filename );
+	}
+	if( item_name != NULL )
+	{
+		memory_free(
+		 item_name );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_SQLITE3 )
+
+/* Exports the table to the SQLite database
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_table_to_sqlite(
+     export_handle_t *export_handle,
+     libesedb_table_t *table,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libesedb_record_t *record      = NULL;
+	record_filter_t *record_filter = NULL;
+	const int *value_entries       = NULL;
+	static char *function          = "export_handle_export_table_to_sqlite";
+	int number_of_records          = 0;
+	int number_of_value_entries    = 0;
+	int record_iterator            = 0;
+	int result                     = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->column_names != NULL )
+	 || ( export_handle->record_condition != NULL ) )
 	{
-		if( export_handle->export_mode != EXPORT_MODE_TABLES )
+		if( record_filter_initialize(
+		     &record_filter,
+		     error ) != 1 )
 		{
-			if( export_handle_export_indexes(
-			     export_handle,
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record filter.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle->column_names != NULL )
+		{
+			if( record_filter_set_columns(
+			     record_filter,
 			     table,
-			     table_name,
-			     table_name_length,
-			     export_path,
-			     export_path_length,
-			     log_handle,
+			     export_handle->column_names,
+			     export_handle->column_names_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set columns in record filter.",
+				 function );
+
+				goto on_error;
+			}
+			value_entries           = record_filter->value_entries;
+			number_of_value_entries = record_filter->number_of_value_entries;
+		}
+		if( export_handle->record_condition != NULL )
+		{
+			if( record_filter_set_condition(
+			     record_filter,
+			     table,
+			     export_handle->record_condition,
+			     export_handle->record_condition_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set condition in record filter.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	result = sqlite_writer_create_table(
+	          export_handle->sqlite_writer,
+	          table,
+	          value_entries,
+	          number_of_value_entries,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table in SQLite database.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libesedb_table_get_number_of_records(
+		     table,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_iterator = 0;
+		     record_iterator < number_of_records;
+		     record_iterator++ )
+		{
+			if( libesedb_table_get_record(
+			     table,
+			     record_iterator,
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 record_iterator );
+
+				goto on_error;
+			}
+			result = 1;
+
+			if( record_filter != NULL )
+			{
+				result = record_filter_match_record(
+				          record_filter,
+				          record,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to determine if record: %d matches filter.",
+					 function,
+					 record_iterator );
+
+					goto on_error;
+				}
+			}
+			if( result != 0 )
+			{
+				if( sqlite_writer_insert_record(
+				     export_handle->sqlite_writer,
+				     record,
+				     log_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to insert record: %d.",
+					 function,
+					 record_iterator );
+
+					goto on_error;
+				}
+			}
+			if( libesedb_record_free(
+			     &record,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to export indexes.",
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
 				 function );
 
 				goto on_error;
 			}
+			if( export_handle->abort != 0 )
+			{
+				break;
+			}
+		}
+		/* The records inserted before an abort are committed as well
+		 */
+		if( sqlite_writer_finish_table(
+		     export_handle->sqlite_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finish table in SQLite database.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipping table without columns.\n" );
+	}
+	if( record_filter != NULL )
+	{
+		if( record_filter_free(
+		     &record_filter,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record filter.",
+			 function );
+
+			goto on_error;
 		}
 	}
 	return( 1 );
@@ -1692,30 +4986,17 @@ on_error:
 		 &record,
 		 NULL );
 	}
-	if( value_string != NULL )
-	{
-		memory_free(
-		 value_string );
-	}
-	if( column != NULL )
+	if( record_filter != NULL )
 	{
-		libesedb_column_free(
-		 &column,
+		record_filter_free(
+		 &record_filter,
 		 NULL );
 	}
-	if( table_file_stream != NULL )
-	{
-		file_stream_close(
-		 table_file_stream );
-	}
-	if( item_filename != NULL )
-	{
-		memory_free(
-		 item_filename );
-	}
 	return( -1 );
 }
 
+#endif /* defined( HAVE_SQLITE3 ) */
+
 /* Exports the indexes of a specific table
  * Returns 1 if successful or -1 on error
  */
@@ -1950,24 +5231,15 @@ int export_handle_export_indexes(
 
 			goto on_error;
 		}
+		/* The notification is written with a single call so that it is not
+		 * interleaved with the output of other export threads
+		 */
 		fprintf(
 		 export_handle->notify_stream,
-		 "Exporting index %d (%" PRIs_SYSTEM ")",
+		 "Exporting index %d (%" PRIs_SYSTEM ").\n",
 		 index_iterator + 1,
 		 index_name );
 
-		/* TODO want to change this to an export index name or refactor */
-		if( index_name == NULL )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 " out of %d",
-			 number_of_indexes );
-		}
-		fprintf(
-		 export_handle->notify_stream,
-		 ".\n" );
-
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		if( libcpath_path_get_sanitized_filename_wide(
 		     index_name,
@@ -2080,15 +5352,18 @@ int export_handle_export_index(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	system_character_t *item_filename = NULL;
-	libesedb_record_t *record         = NULL;
-	FILE *index_file_stream           = NULL;
-	static char *function             = "export_handle_export_index";
-	int known_index                   = 0;
-	size_t item_filename_size         = 0;
-	int number_of_records             = 0;
-	int record_iterator               = 0;
-	int result                        = 0;
+	system_character_t *item_filename    = NULL;
+	libesedb_record_t *record            = NULL;
+	FILE *index_file_stream              = NULL;
+	arrow_writer_t *arrow_writer         = NULL;
+	output_buffer_t *index_output_buffer = NULL;
+	record_writer_t *record_writer       = NULL;
+	static char *function                = "export_handle_export_index";
+	int known_index                      = 0;
+	size_t item_filename_size            = 0;
+	int number_of_records                = 0;
+	int record_iterator                  = 0;
+	int result                           = 0;
 
 	if( index == NULL )
 	{
@@ -2167,6 +5442,36 @@ int export_handle_export_index(
 
 	item_filename = NULL;
 
+	if( output_buffer_initialize(
+	     &index_output_buffer,
+	     index_file_stream,
+	     EXPORT_HANDLE_OUTPUT_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_set_compression_method(
+	     index_output_buffer,
+	     (int) export_handle->compression_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compression method of index output buffer.",
+		 function );
+
+		goto on_error;
+	}
+
 #ifdef TODO
 	/* Write the column names to the index file
 	 */
@@ -2271,120 +5576,356 @@ int export_handle_export_index(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the column name.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the column name.",
+			 function );
+
+			goto on_error;
+		}
+		output_buffer_write_system_string(
+		 index_output_buffer,
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+
+		if( libesedb_column_free(
+		     &column,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column.",
+			 function );
+
+			goto on_error;
+		}
+		if( column_iterator == ( number_of_columns - 1 ) )
+		{
+			output_buffer_write_character(
+			 index_output_buffer,
+			 '\n' );
+		}
+		else
+		{
+			output_buffer_write_character(
+			 index_output_buffer,
+			 '\t' );
+		}
+	}
+#endif
+	if( export_handle->export_mode == EXPORT_MODE_KEYS )
+	{
+		if( export_handle_export_index_keys(
+		     export_handle,
+		     index,
+		     index_output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export keys.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( export_handle->export_format == EXPORT_FORMAT_ARROW )
+	{
+		if( arrow_writer_initialize(
+		     &arrow_writer,
+		     export_handle->number_of_rows_per_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create Arrow writer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( export_handle->export_format != EXPORT_FORMAT_TEXT )
+	{
+		if( record_writer_initialize(
+		     &record_writer,
+		     (int) export_handle->export_format,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record writer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Write the record (row) values to the index file
+	 */
+	if( export_handle->export_mode != EXPORT_MODE_KEYS )
+	{
+		if( libesedb_index_get_number_of_records(
+		     index,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( record_iterator = 0;
+	     record_iterator < number_of_records;
+	     record_iterator++ )
+	{
+		if( libesedb_index_get_record(
+		     index,
+		     record_iterator,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_iterator );
+
+			goto on_error;
+		}
+		known_index = 0;
+
+		if( ( arrow_writer != NULL )
+		 && ( record_iterator == 0 ) )
+		{
+			/* The columns of an index are determined from its first record
+			 */
+			if( arrow_writer_set_columns_from_record(
+			     arrow_writer,
+			     record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set columns in Arrow writer.",
+				 function );
+
+				goto on_error;
+			}
+			if( arrow_writer_write_schema(
+			     arrow_writer,
+			     index_output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write schema.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( ( record_writer != NULL )
+		 && ( record_iterator == 0 ) )
+		{
+			/* The column names of an index are determined from its first record
+			 */
+			if( record_writer_set_column_names_from_record(
+			     record_writer,
+			     record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set column names in record writer.",
+				 function );
+
+				goto on_error;
+			}
+			if( record_writer_write_header(
+			     record_writer,
+			     index_output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write header.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( known_index == 0 )
+		{
+			if( arrow_writer != NULL )
+			{
+				result = arrow_writer_append_record(
+				          arrow_writer,
+				          record,
+				          index_output_buffer,
+				          log_handle,
+				          error );
+			}
+			else if( record_writer != NULL )
+			{
+				result = record_writer_write_record(
+				          record_writer,
+				          record,
+				          index_output_buffer,
+				          log_handle,
+				          error );
+			}
+			else
+			{
+				result = export_handle_export_record(
+				          record,
+				          NULL,
+				          0,
+				          index_output_buffer,
+				          log_handle,
+				          error );
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 index_file_stream,
-		 "%" PRIs_SYSTEM "",
-		 value_string );
-
-		memory_free(
-		 value_string );
-
-		value_string = NULL;
-
-		if( libesedb_column_free(
-		     &column,
+		if( libesedb_record_free(
+		     &record,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free column.",
+			 "%s: unable to free record.",
 			 function );
 
 			goto on_error;
 		}
-		if( column_iterator == ( number_of_columns - 1 ) )
-		{
-			fprintf(
-			 index_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 index_file_stream,
-			 "\t" );
-		}
 	}
-#endif
-	/* Write the record (row) values to the index file
-	 */
-	if( libesedb_index_get_number_of_records(
-	     index,
-	     &number_of_records,
-	     error ) != 1 )
+	if( arrow_writer != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
-		 function );
+		/* An index without records is stored as a stream with an empty schema
+		 */
+		if( number_of_records == 0 )
+		{
+			if( arrow_writer_write_schema(
+			     arrow_writer,
+			     index_output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write schema.",
+				 function );
 
-		goto on_error;
-	}
-	for( record_iterator = 0;
-	     record_iterator < number_of_records;
-	     record_iterator++ )
-	{
-		if( libesedb_index_get_record(
-		     index,
-		     record_iterator,
-		     &record,
+				goto on_error;
+			}
+		}
+		if( arrow_writer_write_end_of_stream(
+		     arrow_writer,
+		     index_output_buffer,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %d.",
-			 function,
-			 record_iterator );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write end of stream.",
+			 function );
 
 			goto on_error;
 		}
-		known_index = 0;
-
-		if( known_index == 0 )
-		{
-			result = export_handle_export_record(
-			          record,
-			          index_file_stream,
-			          log_handle,
-			          error );
-		}
-		if( result != 1 )
+		if( arrow_writer_free(
+		     &arrow_writer,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Arrow writer.",
 			 function );
 
 			goto on_error;
 		}
-		if( libesedb_record_free(
-		     &record,
+	}
+	if( record_writer != NULL )
+	{
+		if( record_writer_free(
+		     &record_writer,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record.",
+			 "%s: unable to free record writer.",
 			 function );
 
 			goto on_error;
 		}
 	}
+	if( output_buffer_finish(
+	     index_output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_free(
+	     &index_output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index output buffer.",
+		 function );
+
+		goto on_error;
+	}
 	if( file_stream_close(
 	     index_file_stream ) != 0 )
 	{
@@ -2421,6 +5962,24 @@ on_error:
 		 NULL );
 	}
 #endif
+	if( arrow_writer != NULL )
+	{
+		arrow_writer_free(
+		 &arrow_writer,
+		 NULL );
+	}
+	if( record_writer != NULL )
+	{
+		record_writer_free(
+		 &record_writer,
+		 NULL );
+	}
+	if( index_output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &index_output_buffer,
+		 NULL );
+	}
 	if( index_file_stream != NULL )
 	{
 		file_stream_close(
@@ -2434,18 +5993,254 @@ on_error:
 	return( -1 );
 }
 
+/* Exports the keys and bookmarks of the records of an index
+ * The keys and bookmarks are read from the index without retrieving the records from the table
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_index_keys(
+     export_handle_t *export_handle,
+     libesedb_index_t *index,
+     output_buffer_t *index_output_buffer,
+     libcerror_error_t **error )
+{
+	uint8_t *value_data       = NULL;
+	void *reallocation        = NULL;
+	static char *function     = "export_handle_export_index_keys";
+	size_t maximum_value_size = 0;
+	size_t value_size         = 0;
+	int number_of_records     = 0;
+	int record_iterator       = 0;
+	int result                = 0;
+	int value_iterator        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_index_get_number_of_records(
+	     index,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_CSV )
+	{
+		output_buffer_write_string(
+		 index_output_buffer,
+		 "Key,Bookmark\r\n" );
+	}
+	else if( export_handle->export_format == EXPORT_FORMAT_TEXT )
+	{
+		output_buffer_write_string(
+		 index_output_buffer,
+		 "Key\tBookmark\n" );
+	}
+	for( record_iterator = 0;
+	     record_iterator < number_of_records;
+	     record_iterator++ )
+	{
+		if( export_handle->export_format == EXPORT_FORMAT_JSONL )
+		{
+			output_buffer_write_string(
+			 index_output_buffer,
+			 "{\"Key\":\"" );
+		}
+		/* The key and bookmark are written as hexadecimal strings
+		 */
+		for( value_iterator = 0;
+		     value_iterator < 2;
+		     value_iterator++ )
+		{
+			if( value_iterator == 0 )
+			{
+				result = libesedb_index_get_record_key_size(
+				          index,
+				          record_iterator,
+				          &value_size,
+				          error );
+			}
+			else
+			{
+				result = libesedb_index_get_record_bookmark_size(
+				          index,
+				          record_iterator,
+				          &value_size,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value: %d size of record: %d.",
+				 function,
+				 value_iterator,
+				 record_iterator );
+
+				goto on_error;
+			}
+			if( value_size > maximum_value_size )
+			{
+				if( value_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid value size value exceeds maximum.",
+					 function );
+
+					goto on_error;
+				}
+				reallocation = memory_reallocate(
+				                value_data,
+				                sizeof( uint8_t ) * value_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize value data.",
+					 function );
+
+					goto on_error;
+				}
+				value_data         = (uint8_t *) reallocation;
+				maximum_value_size = value_size;
+			}
+			if( value_size > 0 )
+			{
+				if( value_iterator == 0 )
+				{
+					result = libesedb_index_get_record_key(
+					          index,
+					          record_iterator,
+					          value_data,
+					          value_size,
+					          error );
+				}
+				else
+				{
+					result = libesedb_index_get_record_bookmark(
+					          index,
+					          record_iterator,
+					          value_data,
+					          value_size,
+					          error );
+				}
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value: %d of record: %d.",
+					 function,
+					 value_iterator,
+					 record_iterator );
+
+					goto on_error;
+				}
+				output_buffer_write_hexadecimal_data(
+				 index_output_buffer,
+				 value_data,
+				 value_size );
+			}
+			if( value_iterator == 0 )
+			{
+				if( export_handle->export_format == EXPORT_FORMAT_CSV )
+				{
+					output_buffer_write_character(
+					 index_output_buffer,
+					 ',' );
+				}
+				else if( export_handle->export_format == EXPORT_FORMAT_JSONL )
+				{
+					output_buffer_write_string(
+					 index_output_buffer,
+					 "\",\"Bookmark\":\"" );
+				}
+				else
+				{
+					output_buffer_write_character(
+					 index_output_buffer,
+					 '\t' );
+				}
+			}
+		}
+		if( export_handle->export_format == EXPORT_FORMAT_CSV )
+		{
+			output_buffer_write_string(
+			 index_output_buffer,
+			 "\r\n" );
+		}
+		else if( export_handle->export_format == EXPORT_FORMAT_JSONL )
+		{
+			output_buffer_write_string(
+			 index_output_buffer,
+			 "\"}\n" );
+		}
+		else
+		{
+			output_buffer_write_character(
+			 index_output_buffer,
+			 '\n' );
+		}
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	if( value_data != NULL )
+	{
+		memory_free(
+		 value_data );
+	}
+	return( 1 );
+
+on_error:
+	if( value_data != NULL )
+	{
+		memory_free(
+		 value_data );
+	}
+	return( -1 );
+}
+
 /* Exports the values in a record
+ * If value_entries is set only the corresponding record values are exported
  * Returns 1 if successful or -1 on error
  */
 int export_handle_export_record(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     const int *value_entries,
+     int number_of_value_entries,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_export_record";
-	int number_of_values  = 0;
-	int value_iterator    = 0;
+	static char *function  = "export_handle_export_record";
+	int number_of_values   = 0;
+	int record_value_entry = 0;
+	int value_iterator     = 0;
 
 	if( record == NULL )
 	{
@@ -2458,13 +6253,13 @@ int export_handle_export_record(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -2483,38 +6278,55 @@ int export_handle_export_record(
 
 		return( -1 );
 	}
+	if( value_entries == NULL )
+	{
+		number_of_value_entries = number_of_values;
+	}
 	for( value_iterator = 0;
-	     value_iterator < number_of_values;
+	     value_iterator < number_of_value_entries;
 	     value_iterator++ )
 	{
-		if( export_handle_export_record_value(
-		     record,
-		     value_iterator,
-		     record_file_stream,
-		     log_handle,
-		     error ) != 1 )
+		if( value_entries == NULL )
+		{
+			record_value_entry = value_iterator;
+		}
+		else
+		{
+			record_value_entry = value_entries[ value_iterator ];
+		}
+		/* A record can contain less values than the table has columns
+		 */
+		if( record_value_entry < number_of_values )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
-			 function,
-			 value_iterator );
+			if( export_handle_export_record_value(
+			     record,
+			     record_value_entry,
+			     record_output_buffer,
+			     log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export record value: %d.",
+				 function,
+				 record_value_entry );
 
-			return( -1 );
+				return( -1 );
+			}
 		}
-		if( value_iterator == ( number_of_values - 1 ) )
+		if( value_iterator == ( number_of_value_entries - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
@@ -2526,7 +6338,7 @@ int export_handle_export_record(
 int export_handle_export_record_value(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2558,13 +6370,13 @@ int export_handle_export_record_value(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -2622,7 +6434,7 @@ int export_handle_export_record_value(
 		if( export_handle_export_basic_record_value(
 		     record,
 		     record_value_entry,
-		     record_file_stream,
+		     record_output_buffer,
 		     log_handle,
 		     error ) != 1 )
 		{
@@ -2729,7 +6541,7 @@ int export_handle_export_record_value(
 						export_text(
 						 value_string,
 						 value_string_size,
-						 record_file_stream );
+						 record_output_buffer );
 
 						memory_free(
 						 value_string );
@@ -2808,7 +6620,7 @@ int export_handle_export_record_value(
 					export_binary_data(
 					 binary_data,
 					 binary_data_size,
-					 record_file_stream );
+					 record_output_buffer );
 
 					memory_free(
 					 binary_data );
@@ -2821,7 +6633,7 @@ int export_handle_export_record_value(
 				export_binary_data(
 				 value_data,
 				 value_data_size,
-				 record_file_stream );
+				 record_output_buffer );
 
 				break;
 		}
@@ -2832,7 +6644,7 @@ int export_handle_export_record_value(
 		result = export_handle_export_long_record_value(
 		          record,
 		          record_value_entry,
-		          record_file_stream,
+		          record_output_buffer,
 		          log_handle,
 		          error );
 
@@ -2967,7 +6779,7 @@ int export_handle_export_record_value(
 					export_text(
 					 value_string,
 					 value_string_size,
-					 record_file_stream );
+					 record_output_buffer );
 
 					memory_free(
 					 value_string );
@@ -2976,8 +6788,8 @@ int export_handle_export_record_value(
 				}
 				if( multi_value_iterator < ( number_of_multi_values - 1 ) )
 				{
-					fprintf(
-					 record_file_stream,
+					output_buffer_write_string(
+					 record_output_buffer,
 					 "; " );
 				}
 			}
@@ -3037,7 +6849,7 @@ int export_handle_export_record_value(
 					export_binary_data(
 					 multi_value_data,
 					 multi_value_data_size,
-					 record_file_stream );
+					 record_output_buffer );
 
 					memory_free(
 					 multi_value_data );
@@ -3066,7 +6878,7 @@ int export_handle_export_record_value(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	return( 1 );
 
@@ -3106,7 +6918,7 @@ on_error:
 int export_handle_export_basic_record_value(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -3140,13 +6952,13 @@ int export_handle_export_basic_record_value(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -3237,14 +7049,14 @@ int export_handle_export_basic_record_value(
 			{
 				if( value_8bit == 0 )
 				{
-					fprintf(
-					 record_file_stream,
+					output_buffer_write_string(
+					 record_output_buffer,
 					 "false" );
 				}
 				else
 				{
-					fprintf(
-					 record_file_stream,
+					output_buffer_write_string(
+					 record_output_buffer,
 					 "true" );
 				}
 			}
@@ -3271,10 +7083,9 @@ int export_handle_export_basic_record_value(
 			}
 			else if( result != 0 )
 			{
-				fprintf(
-				 record_file_stream,
-				 "%" PRIu8 "",
-				 value_8bit );
+				output_buffer_write_unsigned_decimal(
+				 record_output_buffer,
+				 (uint64_t) value_8bit );
 			}
 			break;
 
@@ -3302,17 +7113,15 @@ int export_handle_export_basic_record_value(
 			{
 				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
 				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIi16 "",
+					output_buffer_write_signed_decimal(
+					 record_output_buffer,
 					 (int16_t) value_16bit );
 				}
 				else
 				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIu16 "",
-					 value_16bit );
+					output_buffer_write_unsigned_decimal(
+					 record_output_buffer,
+					 (uint64_t) value_16bit );
 				}
 			}
 			break;
@@ -3341,17 +7150,15 @@ int export_handle_export_basic_record_value(
 			{
 				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
 				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIi32 "",
+					output_buffer_write_signed_decimal(
+					 record_output_buffer,
 					 (int32_t) value_32bit );
 				}
 				else
 				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIu32 "",
-					 value_32bit );
+					output_buffer_write_unsigned_decimal(
+					 record_output_buffer,
+					 (uint64_t) value_32bit );
 				}
 			}
 			break;
@@ -3380,16 +7187,14 @@ int export_handle_export_basic_record_value(
 			{
 				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED )
 				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIi64 "",
+					output_buffer_write_signed_decimal(
+					 record_output_buffer,
 					 (int64_t) value_64bit );
 				}
 				else
 				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIu64 "",
+					output_buffer_write_unsigned_decimal(
+					 record_output_buffer,
 					 value_64bit );
 				}
 			}
@@ -3482,9 +7287,8 @@ int export_handle_export_basic_record_value(
 
 					goto on_error;
 				}
-				fprintf(
-				 record_file_stream,
-				 "%" PRIs_SYSTEM "",
+				output_buffer_write_system_string(
+				 record_output_buffer,
 				 filetime_string );
 			}
 			break;
@@ -3510,8 +7314,8 @@ int export_handle_export_basic_record_value(
 			}
 			else if( result != 0 )
 			{
-				fprintf(
-				 record_file_stream,
+				output_buffer_printf(
+				 record_output_buffer,
 				 "%f",
 				 value_float );
 			}
@@ -3538,8 +7342,8 @@ int export_handle_export_basic_record_value(
 			}
 			else if( result != 0 )
 			{
-				fprintf(
-				 record_file_stream,
+				output_buffer_printf(
+				 record_output_buffer,
 				 "%f",
 				 value_double );
 			}
@@ -3633,7 +7437,7 @@ int export_handle_export_basic_record_value(
 					export_text(
 					 value_string,
 					 value_string_size,
-					 record_file_stream );
+					 record_output_buffer );
 
 					memory_free(
 					 value_string );
@@ -3696,7 +7500,7 @@ int export_handle_export_basic_record_value(
 				export_binary_data(
 				 value_data,
 				 value_data_size,
-				 record_file_stream );
+				 record_output_buffer );
 
 				memory_free(
 				 value_data );
@@ -3733,7 +7537,7 @@ on_error:
 int export_handle_export_long_record_value(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -3759,13 +7563,13 @@ int export_handle_export_long_record_value(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -3980,7 +7784,7 @@ int export_handle_export_long_record_value(
 					export_text(
 					 value_string,
 					 value_string_size,
-					 record_file_stream );
+					 record_output_buffer );
 
 					memory_free(
 					 value_string );
@@ -4053,7 +7857,7 @@ int export_handle_export_long_record_value(
 				export_binary_data(
 				 value_data,
 				 value_data_size,
-				 record_file_stream );
+				 record_output_buffer );
 
 				memory_free(
 				 value_data );
@@ -4109,10 +7913,8 @@ int export_handle_export_file(
 {
 	libcdata_array_t *table_names      = NULL;
 	libesedb_table_t *table            = NULL;
-	system_character_t *sanitized_name = NULL;
 	system_character_t *table_name     = NULL;
 	static char *function              = "export_handle_export_file";
-	size_t sanitized_name_size         = 0;
 	size_t table_name_length           = 0;
 	size_t table_name_size             = 0;
 	int database_type                  = 0;
@@ -4122,6 +7924,11 @@ int export_handle_export_file(
 	int table_exported                 = 0;
 	int table_index                    = 0;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	export_table_job_t *table_jobs         = NULL;
+#endif
+
 	if( export_handle == NULL )
 	{
 		libcerror_error_set(
@@ -4320,10 +8127,74 @@ int export_handle_export_file(
 	 "Database type: %" PRIs_SYSTEM ".\n",
 	 database_type_descriptions[ database_type ] );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* A SQLite database has a single writer hence its tables are exported sequentially
+	 */
+	if( ( export_handle->number_of_threads > 1 )
+	 && ( export_handle->export_format != EXPORT_FORMAT_SQLITE ) )
+	{
+		table_jobs = (export_table_job_t *) memory_allocate(
+		                                     sizeof( export_table_job_t ) * number_of_tables );
+
+		if( table_jobs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create table jobs.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     table_jobs,
+		     0,
+		     sizeof( export_table_job_t ) * number_of_tables ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear table jobs.",
+			 function );
+
+			memory_free(
+			 table_jobs );
+
+			table_jobs = NULL;
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     export_handle->number_of_threads,
+		     number_of_tables,
+		     (int (*)(intptr_t *, void *)) &export_handle_export_table_job,
+		     (void *) export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 	for( table_index = 0;
 	     table_index < number_of_tables;
 	     table_index++ )
 	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
 		if( libcdata_array_get_entry_by_index(
 		     table_names,
 		     table_index,
@@ -4373,147 +8244,281 @@ int export_handle_export_file(
 				continue;
 			}
 		}
-		if( libesedb_file_get_table(
-		     export_handle->input_file,
-		     table_index,
-		     &table,
-		     error ) != 1 )
+		if( table_exported == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve table: %d.",
-			 function,
-			 table_index );
+#if defined( HAVE_SQLITE3 )
+			if( export_handle->export_format == EXPORT_FORMAT_SQLITE )
+			{
+				if( sqlite_writer_initialize(
+				     &( export_handle->sqlite_writer ),
+				     export_handle->number_of_rows_per_batch,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create SQLite writer.",
+					 function );
 
-			table_name = NULL;
+					table_name = NULL;
 
-			goto on_error;
-		}
-		if( table_exported == 0 )
-		{
+					goto on_error;
+				}
+				if( sqlite_writer_open(
+				     export_handle->sqlite_writer,
+				     export_handle->items_export_path,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to create database: %" PRIs_SYSTEM ".",
+					 function,
+					 export_handle->items_export_path );
+
+					table_name = NULL;
+
+					goto on_error;
+				}
+				log_handle_printf(
+				 log_handle,
+				 "Created database: %" PRIs_SYSTEM ".\n",
+				 export_handle->items_export_path );
+			}
+			else
+#endif
+			{
+				result = 0;
+
+				if( export_handle->resume != 0 )
+				{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			if( libcpath_path_make_directory_wide(
-			     export_handle->items_export_path,
-			     error ) != 1 )
+					result = libcfile_file_exists_wide(
+					          export_handle->items_export_path,
+					          error );
 #else
-			if( libcpath_path_make_directory(
-			     export_handle->items_export_path,
-			     error ) != 1 )
+					result = libcfile_file_exists(
+					          export_handle->items_export_path,
+					          error );
+#endif
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_GENERIC,
+						 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+						 function,
+						 export_handle->items_export_path );
+
+						table_name = NULL;
+
+						goto on_error;
+					}
+				}
+				if( result != 0 )
+				{
+					log_handle_printf(
+					 log_handle,
+					 "Resuming export in directory: %" PRIs_SYSTEM ".\n",
+					 export_handle->items_export_path );
+				}
+				else
+				{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+					if( libcpath_path_make_directory_wide(
+					     export_handle->items_export_path,
+					     error ) != 1 )
+#else
+					if( libcpath_path_make_directory(
+					     export_handle->items_export_path,
+					     error ) != 1 )
 #endif
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to make directory: %" PRIs_SYSTEM ".",
+						 function,
+						 export_handle->items_export_path );
+
+						table_name = NULL;
+
+						goto on_error;
+					}
+					log_handle_printf(
+					 log_handle,
+					 "Created directory: %" PRIs_SYSTEM ".\n",
+					 export_handle->items_export_path );
+				}
+			}
+			table_exported = 1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( thread_pool != NULL )
+		{
+			table_jobs[ table_index ].database_type     = database_type;
+			table_jobs[ table_index ].table_index       = table_index;
+			table_jobs[ table_index ].table_name        = table_name;
+			table_jobs[ table_index ].table_name_length = table_name_length;
+			table_jobs[ table_index ].log_handle        = log_handle;
+
+			if( export_table_name == NULL )
+			{
+				table_jobs[ table_index ].number_of_tables = number_of_tables;
+			}
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( table_jobs[ table_index ] ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to make directory: %" PRIs_SYSTEM ".",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push table: %d onto thread pool queue.",
 				 function,
-				 export_handle->items_export_path );
+				 table_index );
 
 				table_name = NULL;
 
 				goto on_error;
 			}
-			log_handle_printf(
-			 log_handle,
-			 "Created directory: %" PRIs_SYSTEM ".\n",
-			 export_handle->items_export_path );
-
-			table_exported = 1;
+			continue;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Exporting table %d (%" PRIs_SYSTEM ")",
-		 table_index + 1,
-		 table_name );
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 		if( export_table_name == NULL )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 " out of %d",
-			 number_of_tables );
+			result = export_handle_export_table_by_index(
+			          export_handle,
+			          export_handle->input_file,
+			          database_type,
+			          table_index,
+			          table_name,
+			          table_name_length,
+			          number_of_tables,
+			          log_handle,
+			          error );
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 ".\n" );
-
-/* TODO move into export_handle_export_table */
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libcpath_path_get_sanitized_filename_wide(
-		     table_name,
-		     table_name_length,
-		     &sanitized_name,
-		     &sanitized_name_size,
-		     error ) != 1 )
-#else
-		if( libcpath_path_get_sanitized_filename(
-		     table_name,
-		     table_name_length,
-		     &sanitized_name,
-		     &sanitized_name_size,
-		     error ) != 1 )
-#endif
+		else
+		{
+			result = export_handle_export_table_by_index(
+			          export_handle,
+			          export_handle->input_file,
+			          database_type,
+			          table_index,
+			          table_name,
+			          table_name_length,
+			          0,
+			          log_handle,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable sanitize table name.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export table: %d.",
+			 function,
+			 table_index );
 
 			table_name = NULL;
 
 			goto on_error;
 		}
-		if( export_handle_export_table(
-		     export_handle,
-		     database_type,
-		     table,
-		     table_index,
-		     sanitized_name,
-		     sanitized_name_size - 1,
-		     export_handle->items_export_path,
-		     export_handle->items_export_path_size - 1,
-		     log_handle,
+	}
+	table_name = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export table: %d.",
-			 function,
-			 table_index );
-
-			table_name = NULL;
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
 
 			goto on_error;
 		}
+		for( table_index = 0;
+		     table_index < number_of_tables;
+		     table_index++ )
+		{
+			if( table_jobs[ table_index ].table_name == NULL )
+			{
+				continue;
+			}
+			if( ( table_jobs[ table_index ].result == -1 )
+			 || ( ( table_jobs[ table_index ].result == 0 )
+			  && ( export_handle->abort == 0 ) ) )
+			{
+				/* Move the error of the table job to the caller
+				 */
+				if( error != NULL )
+				{
+					*error                          = table_jobs[ table_index ].error;
+					table_jobs[ table_index ].error = NULL;
+				}
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export table: %d.",
+				 function,
+				 table_index );
+
+				goto on_error;
+			}
+		}
 		memory_free(
-		 sanitized_name );
+		 table_jobs );
 
-		sanitized_name = NULL;
+		table_jobs = NULL;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
-		if( libesedb_table_free(
-		     &table,
+#if defined( HAVE_SQLITE3 )
+	if( export_handle->sqlite_writer != NULL )
+	{
+		if( sqlite_writer_close(
+		     export_handle->sqlite_writer,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close database.",
+			 function );
+
+			goto on_error;
+		}
+		if( sqlite_writer_free(
+		     &( export_handle->sqlite_writer ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free table: %d.",
-			 function,
-			 table_index );
-
-			table_name = NULL;
+			 "%s: unable to free SQLite writer.",
+			 function );
 
 			goto on_error;
 		}
 	}
+#endif
 	if( libcdata_array_free(
 	     &table_names,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &export_handle_free_table_name,
@@ -4531,11 +8536,37 @@ int export_handle_export_file(
 	return( table_exported );
 
 on_error:
-	if( sanitized_name != NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( table_jobs != NULL )
 	{
+		for( table_index = 0;
+		     table_index < number_of_tables;
+		     table_index++ )
+		{
+			if( table_jobs[ table_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( table_jobs[ table_index ].error ) );
+			}
+		}
 		memory_free(
-		 sanitized_name );
+		 table_jobs );
+	}
+#endif
+#if defined( HAVE_SQLITE3 )
+	if( export_handle->sqlite_writer != NULL )
+	{
+		sqlite_writer_free(
+		 &( export_handle->sqlite_writer ),
+		 NULL );
 	}
+#endif
 	if( table_name != NULL )
 	{
 		memory_free(
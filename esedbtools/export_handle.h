@@ -28,8 +28,12 @@
 
 #include "esedbtools_libcdata.h"
 #include "esedbtools_libcerror.h"
+#include "esedbtools_libcthreads.h"
 #include "esedbtools_libesedb.h"
 #include "log_handle.h"
+#include "output_buffer.h"
+#include "record_writer.h"
+#include "sqlite_writer.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -38,9 +42,27 @@ extern "C" {
 enum EXPORT_MODES
 {
 	EXPORT_MODE_ALL			= (int) 'a',
+	EXPORT_MODE_CARVE		= (int) 'c',
+	EXPORT_MODE_KEYS		= (int) 'k',
 	EXPORT_MODE_TABLES		= (int) 't'
 };
 
+enum EXPORT_FORMATS
+{
+	EXPORT_FORMAT_ARROW		= (int) 'a',
+	EXPORT_FORMAT_CSV		= RECORD_WRITER_FORMAT_CSV,
+	EXPORT_FORMAT_JSONL		= RECORD_WRITER_FORMAT_JSONL,
+	EXPORT_FORMAT_SQLITE		= (int) 's',
+	EXPORT_FORMAT_TEXT		= (int) 't'
+};
+
+enum EXPORT_COMPRESSION_METHODS
+{
+	EXPORT_COMPRESSION_METHOD_NONE	= OUTPUT_BUFFER_COMPRESSION_METHOD_NONE,
+	EXPORT_COMPRESSION_METHOD_GZIP	= OUTPUT_BUFFER_COMPRESSION_METHOD_GZIP,
+	EXPORT_COMPRESSION_METHOD_ZSTD	= OUTPUT_BUFFER_COMPRESSION_METHOD_ZSTD
+};
+
 typedef struct export_handle export_handle_t;
 
 struct export_handle
@@ -49,10 +71,52 @@ struct export_handle
 	 */
 	uint8_t export_mode;
 
+	/* The export format
+	 */
+	uint8_t export_format;
+
+	/* The compression method of the exported item files
+	 */
+	uint8_t compression_method;
+
+	/* Value to indicate an interrupted export should be resumed
+	 */
+	uint8_t resume;
+
+	/* Value to indicate if the status information of the export should be printed
+	 */
+	uint8_t print_status_information;
+
+	/* The number of rows per record batch of the Arrow export format
+	 * or per transaction of the SQLite export format
+	 * and the number of rows between checkpoints of every export format
+	 */
+	int number_of_rows_per_batch;
+
+#if defined( HAVE_SQLITE3 )
+	/* The SQLite writer of the SQLite export format
+	 */
+	sqlite_writer_t *sqlite_writer;
+#endif
+
 	/* The libesedb input file
 	 */
 	libesedb_file_t *input_file;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The input filename
+	 */
+	system_character_t *input_filename;
+
+	/* The input filename size
+	 */
+	size_t input_filename_size;
+
+	/* The number of threads used to export tables
+	 */
+	int number_of_threads;
+#endif
+
 	/* The target path
 	 */
 	system_character_t *target_path;
@@ -69,6 +133,22 @@ struct export_handle
 	 */
 	size_t items_export_path_size;
 
+	/* The names of the columns to export
+	 */
+	system_character_t *column_names;
+
+	/* The column names size
+	 */
+	size_t column_names_size;
+
+	/* The condition that the exported records need to match
+	 */
+	system_character_t *record_condition;
+
+	/* The record condition size
+	 */
+	size_t record_condition_size;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -82,6 +162,48 @@ struct export_handle
 	int abort;
 };
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct export_table_job export_table_job_t;
+
+struct export_table_job
+{
+	/* The database type
+	 */
+	int database_type;
+
+	/* The table index
+	 */
+	int table_index;
+
+	/* The table name
+	 */
+	const system_character_t *table_name;
+
+	/* The table name length
+	 */
+	size_t table_name_length;
+
+	/* The number of tables or 0 if a specific table is exported
+	 */
+	int number_of_tables;
+
+	/* The log handle
+	 */
+	log_handle_t *log_handle;
+
+	/* The result of the job
+	 * 0 if the job did not run, 1 if successful or -1 on error
+	 */
+	int result;
+
+	/* The error of the job
+	 */
+	libcerror_error_t *error;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int export_handle_initialize(
      export_handle_t **export_handle,
      libcerror_error_t **error );
@@ -99,11 +221,50 @@ int export_handle_set_export_mode(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_export_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_compression_method(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_set_ascii_codepage(
      export_handle_t *export_handle,
      const system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_number_of_rows_per_batch(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_column_names(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_record_condition(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_get_settings_checksum(
+     export_handle_t *export_handle,
+     uint32_t *settings_checksum,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+#endif
+
 int export_handle_set_target_path(
      export_handle_t *export_handle,
      const system_character_t *target_path,
@@ -158,8 +319,55 @@ int export_handle_create_text_item_file(
      FILE **item_file_stream,
      libcerror_error_t **error );
 
+int export_handle_create_checkpoint_filename(
+     export_handle_t *export_handle,
+     const system_character_t *item_filename,
+     size_t item_filename_length,
+     const system_character_t *export_path,
+     size_t export_path_length,
+     system_character_t **checkpoint_filename,
+     size_t *checkpoint_filename_size,
+     libcerror_error_t **error );
+
+int export_handle_resume_text_item_file(
+     export_handle_t *export_handle,
+     const system_character_t *item_filename,
+     size_t item_filename_length,
+     const system_character_t *export_path,
+     size_t export_path_length,
+     off64_t stream_offset,
+     FILE **item_file_stream,
+     libcerror_error_t **error );
+
+int export_handle_write_checkpoint(
+     export_handle_t *export_handle,
+     const system_character_t *checkpoint_filename,
+     int record_index,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int export_handle_export_table_by_index(
+     export_handle_t *export_handle,
+     libesedb_file_t *input_file,
+     int database_type,
+     int table_index,
+     const system_character_t *table_name,
+     size_t table_name_length,
+     int number_of_tables,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_export_table_job(
+     export_table_job_t *table_job,
+     export_handle_t *export_handle );
+
+#endif
+
 int export_handle_export_table(
      export_handle_t *export_handle,
+     libesedb_file_t *input_file,
      int database_type,
      libesedb_table_t *table,
      int table_index,
@@ -170,6 +378,27 @@ int export_handle_export_table(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_export_carved_records(
+     export_handle_t *export_handle,
+     libesedb_table_t *table,
+     int table_index,
+     const system_character_t *table_name,
+     size_t table_name_length,
+     const system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_SQLITE3 )
+
+int export_handle_export_table_to_sqlite(
+     export_handle_t *export_handle,
+     libesedb_table_t *table,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#endif
+
 int export_handle_export_indexes(
      export_handle_t *export_handle,
      libesedb_table_t *table,
@@ -191,30 +420,38 @@ int export_handle_export_index(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_export_index_keys(
+     export_handle_t *export_handle,
+     libesedb_index_t *index,
+     output_buffer_t *index_output_buffer,
+     libcerror_error_t **error );
+
 int export_handle_export_record(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     const int *value_entries,
+     int number_of_value_entries,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int export_handle_export_record_value(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int export_handle_export_basic_record_value(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int export_handle_export_long_record_value(
      libesedb_record_t *record,
      int record_value_entry,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
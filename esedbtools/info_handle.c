@@ -29,12 +29,17 @@
 
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libclocale.h"
+#include "esedbtools_libcthreads.h"
 #include "esedbtools_libesedb.h"
 #include "esedbtools_libfdatetime.h"
+#include "esedbtools_system_string.h"
 #include "info_handle.h"
+#include "page_layout.h"
 
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
 
+#define INFO_HANDLE_MAXIMUM_NUMBER_OF_THREADS	32
+
 /* Retrieve a description of the column type
  */
 const char *info_handle_get_column_type_description(
@@ -176,6 +181,9 @@ int info_handle_initialize(
 	}
 	( *info_handle )->notify_stream = INFO_HANDLE_NOTIFY_STREAM;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	( *info_handle )->number_of_threads = 1;
+#endif
 	return( 1 );
 
 on_error:
@@ -225,6 +233,13 @@ int info_handle_free(
 
 			result = -1;
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *info_handle )->input_filename != NULL )
+		{
+			memory_free(
+			 ( *info_handle )->input_filename );
+		}
+#endif
 		memory_free(
 		 *info_handle );
 
@@ -333,6 +348,72 @@ int info_handle_set_ascii_codepage(
 	return( result );
 }
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Sets the number of threads used to scan the pages
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( esedbtools_system_string_copy_to_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to determine number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) INFO_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+	info_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Opens the info handle
  * Returns 1 if successful or -1 on error
  */
@@ -354,6 +435,30 @@ int info_handle_open(
 
 		return( -1 );
 	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( info_handle->input_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - input filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libesedb_file_open_wide(
 	     info_handle->input_file,
@@ -377,7 +482,61 @@ int info_handle_open(
 
 		return( -1 );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The input filename is retained so that every page scan thread
+	 * can open its own input file
+	 */
+	info_handle->input_filename_size = system_string_length(
+	                                    filename ) + 1;
+
+	info_handle->input_filename = system_string_allocate(
+	                               info_handle->input_filename_size );
+
+	if( info_handle->input_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     info_handle->input_filename,
+	     filename,
+	     info_handle->input_filename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy input filename.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( info_handle->input_filename != NULL )
+	{
+		memory_free(
+		 info_handle->input_filename );
+
+		info_handle->input_filename = NULL;
+	}
+	info_handle->input_filename_size = 0;
+
+	libesedb_file_close(
+	 info_handle->input_file,
+	 NULL );
+
+	return( -1 );
+#endif
 }
 
 /* Closes the info handle
@@ -1217,21 +1376,22 @@ on_error:
 	return( -1 );
 }
 
-/* Prints the file information to a stream
+/* Prints the table space statistics to a stream
+ * The statistics contain LIBESEDB_NUMBER_OF_TABLE_STATISTICS values
  * Returns 1 if successful or -1 on error
  */
-int info_handle_file_fprint(
+int info_handle_table_space_statistics_fprint(
      info_handle_t *info_handle,
+     int table_iterator,
+     libesedb_table_t *table,
+     const uint64_t *statistics,
      libcerror_error_t **error )
 {
-	libesedb_table_t *table  = NULL;
-	static char *function    = "esedbinfo_file_info_fprint";
-	uint32_t file_type       = 0;
-	uint32_t format_revision = 0;
-	uint32_t format_version  = 0;
-	uint32_t page_size       = 0;
-	int number_of_tables     = 0;
-	int table_iterator       = 0;
+	system_character_t *value_string = NULL;
+	static char *function            = "info_handle_table_space_statistics_fprint";
+	size_t value_string_size         = 0;
+	uint32_t table_identifier        = 0;
+	int result                       = 0;
 
 	if( info_handle == NULL )
 	{
@@ -1244,123 +1404,1510 @@ int info_handle_file_fprint(
 
 		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "Extensible Storage Engine Database information:\n" );
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
 
-	if( libesedb_file_get_type(
-	     info_handle->input_file,
-	     &file_type,
+		return( -1 );
+	}
+	if( libesedb_table_get_identifier(
+	     table,
+	     &table_identifier,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file type.",
+		 "%s: unable to retrieve the table identifier.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tFile type:\t\t" );
-
-	if( file_type == LIBESEDB_FILE_TYPE_DATABASE )
-	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "Database" );
-	}
-	else if( file_type == LIBESEDB_FILE_TYPE_STREAMING_FILE )
-	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "Streaming file" );
-	}
-	else
-	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "Unknown" );
-	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
-	if( libesedb_file_get_creation_format_version(
-	     info_handle->input_file,
-	     &format_version,
-	     &format_revision,
-	     error ) != 1 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_table_get_utf16_name_size(
+	          table,
+	          &value_string_size,
+	          error );
+#else
+	result = libesedb_table_get_utf8_name_size(
+	          table,
+	          &value_string_size,
+	          error );
+#endif
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve creation format version.",
+		 "%s: unable to retrieve the size of the table name.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tCreated in format:\t0x%" PRIx32 ",%" PRIu32 "\n",
-	 format_version,
-	 format_revision );
-
-	if( libesedb_file_get_format_version(
-	     info_handle->input_file,
-	     &format_version,
-	     &format_revision,
-	     error ) != 1 )
+	if( value_string_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve format version.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing table name.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tCurrent format:\t\t0x%" PRIx32 ",%" PRIu32 "\n",
-	 format_version,
-	 format_revision );
+	value_string = system_string_allocate(
+	                value_string_size );
 
-	if( libesedb_file_get_page_size(
-	     info_handle->input_file,
-	     &page_size,
-	     error ) != 1 )
+	if( value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table name string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_table_get_utf16_name(
+	          table,
+	          (uint16_t *) value_string,
+	          value_string_size,
+	          error );
+#else
+	result = libesedb_table_get_utf8_name(
+	          table,
+	          (uint8_t *) value_string,
+	          value_string_size,
+	          error );
+#endif
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page size.",
+		 "%s: unable to retrieve the table name.",
 		 function );
 
 		goto on_error;
 	}
 	fprintf(
 	 info_handle->notify_stream,
-	 "\tPage size:\t\t%" PRIu32 " bytes\n",
-	 page_size );
+	 "Table: %d\t\t\t%" PRIs_SYSTEM " (%d)\n",
+	 table_iterator + 1,
+	 value_string,
+	 table_identifier );
+
+	memory_free(
+	 value_string );
+
+	value_string = NULL;
 
 	fprintf(
 	 info_handle->notify_stream,
-	 "\n" );
+	 "\tOwned pages:\t\t\t%" PRIu64 " in %" PRIu64 " extent(s)\n",
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_OWNED_PAGES ],
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_OWNED_EXTENTS ] );
 
-	if( file_type == LIBESEDB_FILE_TYPE_DATABASE )
-	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "Catalog content:\n" );
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tAvailable pages:\t\t%" PRIu64 " in %" PRIu64 " extent(s)\n",
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_AVAILABLE_PAGES ],
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_AVAILABLE_EXTENTS ] );
 
-		if( libesedb_file_get_number_of_tables(
-		     info_handle->input_file,
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of pages:\t\t%" PRIu64 "\n",
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_PAGES ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of leaf pages:\t\t%" PRIu64 " (%" PRIu64 " sampled)\n",
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES ],
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_SAMPLED_LEAF_PAGES ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tEstimated number of records:\t%" PRIu64 "\n",
+	 statistics[ LIBESEDB_TABLE_STATISTIC_ESTIMATED_NUMBER_OF_RECORDS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tAverage fill factor:\t\t%" PRIu64 "%%\n",
+	 statistics[ LIBESEDB_TABLE_STATISTIC_FILL_FACTOR ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( -1 );
+}
+
+/* Retrieves the space statistics of a range of tables
+ * The statistics contain LIBESEDB_NUMBER_OF_TABLE_STATISTICS values per table
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_get_tables_space_statistics(
+     info_handle_t *info_handle,
+     libesedb_file_t *input_file,
+     int first_table_index,
+     int number_of_tables,
+     uint64_t *statistics,
+     libcerror_error_t **error )
+{
+	libesedb_table_t *table = NULL;
+	static char *function   = "info_handle_get_tables_space_statistics";
+	int table_index         = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_table_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first table index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_tables < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of tables value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	for( table_index = 0;
+	     table_index < number_of_tables;
+	     table_index++ )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libesedb_file_get_table(
+		     input_file,
+		     first_table_index + table_index,
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table: %d.",
+			 function,
+			 first_table_index + table_index + 1 );
+
+			goto on_error;
+		}
+		if( libesedb_table_get_space_statistics(
+		     table,
+		     &( statistics[ table_index * LIBESEDB_NUMBER_OF_TABLE_STATISTICS ] ),
+		     LIBESEDB_NUMBER_OF_TABLE_STATISTICS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve space statistics of table: %d.",
+			 function,
+			 first_table_index + table_index + 1 );
+
+			goto on_error;
+		}
+		if( libesedb_table_free(
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Retrieves the space statistics of the table range of a space statistics job
+ * This function is the callback of the space statistics thread pool. Every
+ * space statistics job opens its own input file and sets the statistics of
+ * a disjoint table range. The result and error are stored in the space
+ * statistics job
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_space_statistics_job(
+     info_space_statistics_job_t *space_statistics_job,
+     info_handle_t *info_handle )
+{
+	libesedb_file_t *input_file = NULL;
+	static char *function       = "info_handle_space_statistics_job";
+
+	if( space_statistics_job == NULL )
+	{
+		return( -1 );
+	}
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 &( space_statistics_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_file_initialize(
+	     &input_file,
+	     &( space_statistics_job->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( space_statistics_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only the table definitions of the table range are read from the catalog
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     input_file,
+	     info_handle->input_filename,
+	     LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	     &( space_statistics_job->error ) ) != 1 )
+#else
+	if( libesedb_file_open(
+	     input_file,
+	     info_handle->input_filename,
+	     LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	     &( space_statistics_job->error ) ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 &( space_statistics_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_get_tables_space_statistics(
+	     info_handle,
+	     input_file,
+	     space_statistics_job->first_table_index,
+	     space_statistics_job->number_of_tables,
+	     space_statistics_job->statistics,
+	     &( space_statistics_job->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( space_statistics_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve space statistics of tables: %d - %d.",
+		 function,
+		 space_statistics_job->first_table_index + 1,
+		 space_statistics_job->first_table_index + space_statistics_job->number_of_tables );
+
+		goto on_error;
+	}
+	if( libesedb_file_close(
+	     input_file,
+	     &( space_statistics_job->error ) ) != 0 )
+	{
+		libcerror_error_set(
+		 &( space_statistics_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_free(
+	     &input_file,
+	     &( space_statistics_job->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( space_statistics_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input file.",
+		 function );
+
+		goto on_error;
+	}
+	space_statistics_job->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( input_file != NULL )
+	{
+		libesedb_file_free(
+		 &input_file,
+		 NULL );
+	}
+	space_statistics_job->result = -1;
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Prints the space statistics of the tables to a stream
+ * The space statistics of all tables are retrieved before they are printed
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_space_statistics_fprint(
+     info_handle_t *info_handle,
+     int number_of_tables,
+     libcerror_error_t **error )
+{
+	libesedb_table_t *table = NULL;
+	uint64_t *statistics    = NULL;
+	static char *function   = "info_handle_space_statistics_fprint";
+	size_t statistics_size  = 0;
+	int table_iterator      = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool             = NULL;
+	info_space_statistics_job_t *space_statistics_jobs = NULL;
+	int first_table_index                              = 0;
+	int job_index                                      = 0;
+	int number_of_jobs                                 = 0;
+	int number_of_tables_per_job                       = 0;
+#endif
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_tables < 0 )
+	 || ( (size_t) number_of_tables > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( sizeof( uint64_t ) * LIBESEDB_NUMBER_OF_TABLE_STATISTICS ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of tables value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_tables == 0 )
+	{
+		return( 1 );
+	}
+	statistics_size = sizeof( uint64_t ) * LIBESEDB_NUMBER_OF_TABLE_STATISTICS * (size_t) number_of_tables;
+
+	statistics = (uint64_t *) memory_allocate(
+	                           statistics_size );
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     statistics,
+	     0,
+	     statistics_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Every job retrieves the space statistics of a contiguous range of tables
+	 * with its own input file
+	 */
+	if( ( info_handle->number_of_threads > 1 )
+	 && ( number_of_tables > 1 ) )
+	{
+		number_of_jobs = info_handle->number_of_threads;
+
+		if( number_of_jobs > number_of_tables )
+		{
+			number_of_jobs = number_of_tables;
+		}
+		number_of_tables_per_job = number_of_tables / number_of_jobs;
+
+		space_statistics_jobs = (info_space_statistics_job_t *) memory_allocate(
+		                                                         sizeof( info_space_statistics_job_t ) * number_of_jobs );
+
+		if( space_statistics_jobs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create space statistics jobs.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     space_statistics_jobs,
+		     0,
+		     sizeof( info_space_statistics_job_t ) * number_of_jobs ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear space statistics jobs.",
+			 function );
+
+			memory_free(
+			 space_statistics_jobs );
+
+			space_statistics_jobs = NULL;
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_jobs,
+		     number_of_jobs,
+		     (int (*)(intptr_t *, void *)) &info_handle_space_statistics_job,
+		     (void *) info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		first_table_index = 0;
+
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			space_statistics_jobs[ job_index ].first_table_index = first_table_index;
+			space_statistics_jobs[ job_index ].statistics        = &( statistics[ first_table_index * LIBESEDB_NUMBER_OF_TABLE_STATISTICS ] );
+
+			/* The last job also handles the remainder of the tables
+			 */
+			if( job_index == ( number_of_jobs - 1 ) )
+			{
+				space_statistics_jobs[ job_index ].number_of_tables = number_of_tables - first_table_index;
+			}
+			else
+			{
+				space_statistics_jobs[ job_index ].number_of_tables = number_of_tables_per_job;
+			}
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( space_statistics_jobs[ job_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push space statistics job: %d onto thread pool queue.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+			first_table_index += number_of_tables_per_job;
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( ( space_statistics_jobs[ job_index ].result == -1 )
+			 || ( ( space_statistics_jobs[ job_index ].result == 0 )
+			  && ( info_handle->abort == 0 ) ) )
+			{
+				/* Move the error of the space statistics job to the caller
+				 */
+				if( error != NULL )
+				{
+					*error                                   = space_statistics_jobs[ job_index ].error;
+					space_statistics_jobs[ job_index ].error = NULL;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to retrieve space statistics of space statistics job: %d.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 space_statistics_jobs );
+
+		space_statistics_jobs = NULL;
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	if( info_handle_get_tables_space_statistics(
+	     info_handle,
+	     info_handle->input_file,
+	     0,
+	     number_of_tables,
+	     statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve space statistics of tables.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_iterator = 0;
+	     table_iterator < number_of_tables;
+	     table_iterator++ )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libesedb_file_get_table(
+		     info_handle->input_file,
+		     table_iterator,
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table: %d.",
+			 function,
+			 table_iterator + 1 );
+
+			goto on_error;
+		}
+		if( info_handle_table_space_statistics_fprint(
+		     info_handle,
+		     table_iterator,
+		     table,
+		     &( statistics[ table_iterator * LIBESEDB_NUMBER_OF_TABLE_STATISTICS ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print space statistics of table: %d.",
+			 function,
+			 table_iterator + 1 );
+
+			goto on_error;
+		}
+		if( libesedb_table_free(
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 statistics );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( space_statistics_jobs != NULL )
+	{
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( space_statistics_jobs[ job_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( space_statistics_jobs[ job_index ].error ) );
+			}
+		}
+		memory_free(
+		 space_statistics_jobs );
+	}
+#endif
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( statistics != NULL )
+	{
+		memory_free(
+		 statistics );
+	}
+	return( -1 );
+}
+
+/* Scans a range of pages and sets their page map entries in the page layout
+ * Pages that cannot be read are set as unknown pages
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_scan_pages(
+     info_handle_t *info_handle,
+     libesedb_file_t *input_file,
+     page_layout_t *page_layout,
+     uint32_t first_page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error )
+{
+	static char *function                       = "info_handle_scan_pages";
+	uint32_t father_data_page_object_identifier = 0;
+	uint32_t last_page_number                   = 0;
+	uint32_t page_number                        = 0;
+	uint32_t page_size                          = 0;
+	uint16_t available_data_size                = 0;
+	uint8_t fill_level                          = 0;
+	uint8_t page_type                           = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_page_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_get_page_size(
+	     input_file,
+	     &page_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	last_page_number = first_page_number + number_of_pages;
+
+	for( page_number = first_page_number;
+	     page_number < last_page_number;
+	     page_number++ )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libesedb_file_get_page_information(
+		     input_file,
+		     page_number,
+		     &father_data_page_object_identifier,
+		     &page_type,
+		     &available_data_size,
+		     error ) != 1 )
+		{
+			/* A page that cannot be read, such as a page with corrupted values,
+			 * is not fatal for the page layout
+			 */
+			libcerror_error_free(
+			 error );
+
+			father_data_page_object_identifier = 0;
+			page_type                          = LIBESEDB_PAGE_TYPE_UNKNOWN;
+			fill_level                         = 0;
+		}
+		else if( (uint32_t) available_data_size >= page_size )
+		{
+			fill_level = 0;
+		}
+		else
+		{
+			fill_level = (uint8_t) ( ( ( page_size - available_data_size ) * 100 ) / page_size );
+		}
+		if( page_layout_set_page(
+		     page_layout,
+		     page_number,
+		     father_data_page_object_identifier,
+		     page_type,
+		     fill_level,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set page: %" PRIu32 " in page layout.",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Scans the page range of a page layout job
+ * This function is the callback of the page scan thread pool. A libesedb file
+ * is not thread-safe, hence every page layout job opens its own input file.
+ * The jobs set the page map entries of disjoint page ranges. The result and
+ * error are stored in the page layout job
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_page_layout_job(
+     info_page_layout_job_t *page_layout_job,
+     info_handle_t *info_handle )
+{
+	libesedb_file_t *input_file = NULL;
+	static char *function       = "info_handle_page_layout_job";
+
+	if( page_layout_job == NULL )
+	{
+		return( -1 );
+	}
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 &( page_layout_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_file_initialize(
+	     &input_file,
+	     &( page_layout_job->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( page_layout_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The pages are read directly hence the catalog is not needed
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     input_file,
+	     info_handle->input_filename,
+	     LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	     &( page_layout_job->error ) ) != 1 )
+#else
+	if( libesedb_file_open(
+	     input_file,
+	     info_handle->input_filename,
+	     LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	     &( page_layout_job->error ) ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 &( page_layout_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_scan_pages(
+	     info_handle,
+	     input_file,
+	     page_layout_job->page_layout,
+	     page_layout_job->first_page_number,
+	     page_layout_job->number_of_pages,
+	     &( page_layout_job->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( page_layout_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan pages: %" PRIu32 " - %" PRIu32 ".",
+		 function,
+		 page_layout_job->first_page_number,
+		 page_layout_job->first_page_number + page_layout_job->number_of_pages - 1 );
+
+		goto on_error;
+	}
+	if( libesedb_file_close(
+	     input_file,
+	     &( page_layout_job->error ) ) != 0 )
+	{
+		libcerror_error_set(
+		 &( page_layout_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_free(
+	     &input_file,
+	     &( page_layout_job->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( page_layout_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input file.",
+		 function );
+
+		goto on_error;
+	}
+	page_layout_job->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( input_file != NULL )
+	{
+		libesedb_file_free(
+		 &input_file,
+		 NULL );
+	}
+	page_layout_job->result = -1;
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Prints the page layout to a stream
+ * Every page is classified by its page header, the pages are aggregated per
+ * father data page (FDP) object identifier. If a map filename is provided
+ * the page map is written to the file
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_page_layout_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *map_filename,
+     libcerror_error_t **error )
+{
+	page_layout_t *page_layout = NULL;
+	static char *function      = "info_handle_page_layout_fprint";
+	uint32_t number_of_pages   = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool   = NULL;
+	info_page_layout_job_t *page_layout_jobs = NULL;
+	uint32_t first_page_number               = 0;
+	uint32_t number_of_pages_per_job         = 0;
+	int job_index                            = 0;
+	int number_of_jobs                       = 0;
+#endif
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_get_number_of_pages(
+	     info_handle->input_file,
+	     &number_of_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pages.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_pages == 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Page layout:\n"
+		 "\tNumber of pages:\t0\n"
+		 "\n" );
+
+		return( 1 );
+	}
+	if( page_layout_initialize(
+	     &page_layout,
+	     number_of_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page layout.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Every job scans a contiguous range of pages with its own input file
+	 */
+	if( ( info_handle->number_of_threads > 1 )
+	 && ( number_of_pages >= (uint32_t) info_handle->number_of_threads ) )
+	{
+		number_of_jobs          = info_handle->number_of_threads;
+		number_of_pages_per_job = number_of_pages / (uint32_t) number_of_jobs;
+
+		page_layout_jobs = (info_page_layout_job_t *) memory_allocate(
+		                                               sizeof( info_page_layout_job_t ) * number_of_jobs );
+
+		if( page_layout_jobs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page layout jobs.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     page_layout_jobs,
+		     0,
+		     sizeof( info_page_layout_job_t ) * number_of_jobs ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear page layout jobs.",
+			 function );
+
+			memory_free(
+			 page_layout_jobs );
+
+			page_layout_jobs = NULL;
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     info_handle->number_of_threads,
+		     number_of_jobs,
+		     (int (*)(intptr_t *, void *)) &info_handle_page_layout_job,
+		     (void *) info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		first_page_number = 1;
+
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			page_layout_jobs[ job_index ].first_page_number = first_page_number;
+			page_layout_jobs[ job_index ].page_layout       = page_layout;
+
+			/* The last job also scans the remainder of the pages
+			 */
+			if( job_index == ( number_of_jobs - 1 ) )
+			{
+				page_layout_jobs[ job_index ].number_of_pages = number_of_pages - first_page_number + 1;
+			}
+			else
+			{
+				page_layout_jobs[ job_index ].number_of_pages = number_of_pages_per_job;
+			}
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( page_layout_jobs[ job_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push page layout job: %d onto thread pool queue.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+			first_page_number += number_of_pages_per_job;
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( ( page_layout_jobs[ job_index ].result == -1 )
+			 || ( ( page_layout_jobs[ job_index ].result == 0 )
+			  && ( info_handle->abort == 0 ) ) )
+			{
+				/* Move the error of the page layout job to the caller
+				 */
+				if( error != NULL )
+				{
+					*error                              = page_layout_jobs[ job_index ].error;
+					page_layout_jobs[ job_index ].error = NULL;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan pages of page layout job: %d.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 page_layout_jobs );
+
+		page_layout_jobs = NULL;
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	if( info_handle_scan_pages(
+	     info_handle,
+	     info_handle->input_file,
+	     page_layout,
+	     1,
+	     number_of_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan pages.",
+		 function );
+
+		goto on_error;
+	}
+	if( page_layout_analyze(
+	     page_layout,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to analyze page layout.",
+		 function );
+
+		goto on_error;
+	}
+	if( page_layout_fprint(
+	     page_layout,
+	     info_handle->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print page layout.",
+		 function );
+
+		goto on_error;
+	}
+	if( map_filename != NULL )
+	{
+		if( page_layout_write_map(
+		     page_layout,
+		     map_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write page map.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( page_layout_free(
+	     &page_layout,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page layout.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( page_layout_jobs != NULL )
+	{
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( page_layout_jobs[ job_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( page_layout_jobs[ job_index ].error ) );
+			}
+		}
+		memory_free(
+		 page_layout_jobs );
+	}
+#endif
+	if( page_layout != NULL )
+	{
+		page_layout_free(
+		 &page_layout,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the file information to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libesedb_table_t *table  = NULL;
+	static char *function    = "esedbinfo_file_info_fprint";
+	uint32_t file_type       = 0;
+	uint32_t format_revision = 0;
+	uint32_t format_version  = 0;
+	uint32_t page_size       = 0;
+	int number_of_tables     = 0;
+	int table_iterator       = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Extensible Storage Engine Database information:\n" );
+
+	if( libesedb_file_get_type(
+	     info_handle->input_file,
+	     &file_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file type.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tFile type:\t\t" );
+
+	if( file_type == LIBESEDB_FILE_TYPE_DATABASE )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Database" );
+	}
+	else if( file_type == LIBESEDB_FILE_TYPE_STREAMING_FILE )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Streaming file" );
+	}
+	else
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Unknown" );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	if( libesedb_file_get_creation_format_version(
+	     info_handle->input_file,
+	     &format_version,
+	     &format_revision,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation format version.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tCreated in format:\t0x%" PRIx32 ",%" PRIu32 "\n",
+	 format_version,
+	 format_revision );
+
+	if( libesedb_file_get_format_version(
+	     info_handle->input_file,
+	     &format_version,
+	     &format_revision,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tCurrent format:\t\t0x%" PRIx32 ",%" PRIu32 "\n",
+	 format_version,
+	 format_revision );
+
+	if( libesedb_file_get_page_size(
+	     info_handle->input_file,
+	     &page_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page size.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tPage size:\t\t%" PRIu32 " bytes\n",
+	 page_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	/* The page layout is printed instead of the catalog content
+	 */
+	if( ( file_type == LIBESEDB_FILE_TYPE_DATABASE )
+	 && ( info_handle->print_page_layout == 0 ) )
+	{
+		if( info_handle->print_space_statistics != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "Space statistics:\n" );
+		}
+		else
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "Catalog content:\n" );
+		}
+
+		if( libesedb_file_get_number_of_tables(
+		     info_handle->input_file,
 		     &number_of_tables,
 		     error ) != 1 )
 		{
@@ -1382,54 +2929,74 @@ int info_handle_file_fprint(
 		 info_handle->notify_stream,
 		 "\n" );
 
-		for( table_iterator = 0;
-		     table_iterator < number_of_tables;
-		     table_iterator++ )
+		if( info_handle->print_space_statistics != 0 )
 		{
-			if( libesedb_file_get_table(
-			     info_handle->input_file,
-			     table_iterator,
-			     &table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve table: %d.",
-				 function,
-				 table_iterator + 1 );
-
-				goto on_error;
-			}
-			if( info_handle_table_fprint(
+			if( info_handle_space_statistics_fprint(
 			     info_handle,
-			     table_iterator,
-			     table,
+			     number_of_tables,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print table: %d.",
-				 function,
-				 table_iterator + 1 );
+				 "%s: unable to print space statistics.",
+				 function );
 
 				goto on_error;
 			}
-			if( libesedb_table_free(
-			     &table,
-			     error ) != 1 )
+		}
+		else
+		{
+			for( table_iterator = 0;
+			     table_iterator < number_of_tables;
+			     table_iterator++ )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free table.",
-				 function );
-
-				goto on_error;
+				if( libesedb_file_get_table(
+				     info_handle->input_file,
+				     table_iterator,
+				     &table,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve table: %d.",
+					 function,
+					 table_iterator + 1 );
+
+					goto on_error;
+				}
+				if( info_handle_table_fprint(
+				     info_handle,
+				     table_iterator,
+				     table,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print table: %d.",
+					 function,
+					 table_iterator + 1 );
+
+					goto on_error;
+				}
+				if( libesedb_table_free(
+				     &table,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free table.",
+					 function );
+
+					goto on_error;
+				}
 			}
 		}
 		fprintf(
@@ -28,6 +28,7 @@
 
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libesedb.h"
+#include "page_layout.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -41,6 +42,20 @@ struct info_handle
 	 */
 	libesedb_file_t *input_file;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The input filename
+	 */
+	system_character_t *input_filename;
+
+	/* The input filename size
+	 */
+	size_t input_filename_size;
+
+	/* The number of threads used to scan the pages
+	 */
+	int number_of_threads;
+#endif
+
 	/* The ascii codepage
 	 */
 	int ascii_codepage;
@@ -49,11 +64,75 @@ struct info_handle
 	 */
 	FILE *notify_stream;
 
+	/* Value to indicate if the space statistics should be printed
+	 */
+	uint8_t print_space_statistics;
+
+	/* Value to indicate if the page layout should be printed
+	 */
+	uint8_t print_page_layout;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
 };
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct info_page_layout_job info_page_layout_job_t;
+
+struct info_page_layout_job
+{
+	/* The first page number of the page range
+	 */
+	uint32_t first_page_number;
+
+	/* The number of pages in the page range
+	 */
+	uint32_t number_of_pages;
+
+	/* The page layout
+	 */
+	page_layout_t *page_layout;
+
+	/* The result of the job
+	 * 0 if the job did not run, 1 if successful or -1 on error
+	 */
+	int result;
+
+	/* The error of the job
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct info_space_statistics_job info_space_statistics_job_t;
+
+struct info_space_statistics_job
+{
+	/* The first table index of the table range
+	 */
+	int first_table_index;
+
+	/* The number of tables in the table range
+	 */
+	int number_of_tables;
+
+	/* The space statistics of the tables in the table range
+	 */
+	uint64_t *statistics;
+
+	/* The result of the job
+	 * 0 if the job did not run, 1 if successful or -1 on error
+	 */
+	int result;
+
+	/* The error of the job
+	 */
+	libcerror_error_t *error;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 const char *info_handle_get_column_type_description(
              uint32_t column_type );
 
@@ -74,6 +153,15 @@ int info_handle_set_ascii_codepage(
      const system_character_t *string,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int info_handle_open(
      info_handle_t *info_handle,
      const system_character_t *filename,
@@ -101,6 +189,55 @@ int info_handle_table_fprint(
      libesedb_table_t *table,
      libcerror_error_t **error );
 
+int info_handle_table_space_statistics_fprint(
+     info_handle_t *info_handle,
+     int table_iterator,
+     libesedb_table_t *table,
+     const uint64_t *statistics,
+     libcerror_error_t **error );
+
+int info_handle_get_tables_space_statistics(
+     info_handle_t *info_handle,
+     libesedb_file_t *input_file,
+     int first_table_index,
+     int number_of_tables,
+     uint64_t *statistics,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int info_handle_space_statistics_job(
+     info_space_statistics_job_t *space_statistics_job,
+     info_handle_t *info_handle );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int info_handle_space_statistics_fprint(
+     info_handle_t *info_handle,
+     int number_of_tables,
+     libcerror_error_t **error );
+
+int info_handle_scan_pages(
+     info_handle_t *info_handle,
+     libesedb_file_t *input_file,
+     page_layout_t *page_layout,
+     uint32_t first_page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int info_handle_page_layout_job(
+     info_page_layout_job_t *page_layout_job,
+     info_handle_t *info_handle );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int info_handle_page_layout_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *map_filename,
+     libcerror_error_t **error );
+
 int info_handle_file_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
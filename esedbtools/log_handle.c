@@ -34,6 +34,7 @@
 #endif
 
 #include "esedbtools_libcerror.h"
+#include "esedbtools_libcthreads.h"
 #include "log_handle.h"
 
 /* Creates a log handle
@@ -96,6 +97,21 @@ int log_handle_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *log_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -117,6 +133,7 @@ int log_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "log_handle_free";
+	int result            = 1;
 
 	if( log_handle == NULL )
 	{
@@ -131,12 +148,27 @@ int log_handle_free(
 	}
 	if( *log_handle != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *log_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *log_handle );
 
 		*log_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Opens the log handle
@@ -243,7 +275,8 @@ int log_handle_close(
 
 #endif
 
-/* Print a formatted string on the notify stream
+/* Print a formatted string on the log stream
+ * The string is written as a whole when the log handle is shared between threads
  */
 void VARARGS(
       log_handle_printf,
@@ -255,6 +288,14 @@ void VARARGS(
 	if( ( log_handle != NULL )
 	 && ( log_handle->log_stream != NULL ) )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     log_handle->mutex,
+		     NULL ) != 1 )
+		{
+			return;
+		}
+#endif
 		VASTART(
 		 argument_list,
 		 char *,
@@ -267,6 +308,12 @@ void VARARGS(
 
 		VAEND(
 		 argument_list );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		libcthreads_mutex_release(
+		 log_handle->mutex,
+		 NULL );
+#endif
 	}
 }
 
@@ -27,6 +27,7 @@
 #include <types.h>
 
 #include "esedbtools_libcerror.h"
+#include "esedbtools_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -39,6 +40,12 @@ struct log_handle
 	/* The log stream
 	 */
 	FILE *log_stream;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes writes to the log stream
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
 };
 
 int log_handle_initialize(
@@ -0,0 +1,1063 @@
+/*
+ * Output buffer
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDARG_H ) || defined( WINAPI )
+#include <stdarg.h>
+#elif defined( HAVE_VARARGS_H )
+#include <varargs.h>
+#else
+#error Missing headers stdarg.h and varargs.h
+#endif
+
+#include "esedbtools_libcerror.h"
+#include "output_buffer.h"
+
+/* Creates an output buffer
+ * Make sure the value output_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_initialize(
+     output_buffer_t **output_buffer,
+     FILE *stream,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_initialize";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*output_buffer = memory_allocate_structure(
+	                  output_buffer_t );
+
+	if( *output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_buffer,
+	     0,
+	     sizeof( output_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_buffer )->data = (char *) memory_allocate(
+	                                     sizeof( char ) * data_size );
+
+	if( ( *output_buffer )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_buffer )->stream    = stream;
+	( *output_buffer )->data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( *output_buffer != NULL )
+	{
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output buffer
+ * Data that was not flushed is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_free(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_free";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+#if defined( HAVE_ZLIB )
+		if( ( *output_buffer )->compression_method == OUTPUT_BUFFER_COMPRESSION_METHOD_GZIP )
+		{
+			deflateEnd(
+			 &( ( *output_buffer )->zlib_stream ) );
+		}
+#endif
+#if defined( HAVE_ZSTD )
+		if( ( *output_buffer )->zstd_context != NULL )
+		{
+			ZSTD_freeCCtx(
+			 ( *output_buffer )->zstd_context );
+		}
+#endif
+		if( ( *output_buffer )->compressed_data != NULL )
+		{
+			memory_free(
+			 ( *output_buffer )->compressed_data );
+		}
+		if( ( *output_buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *output_buffer )->data );
+		}
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the compression method
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_set_compression_method(
+     output_buffer_t *output_buffer,
+     int compression_method,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_set_compression_method";
+
+#if defined( HAVE_ZLIB )
+	int result            = 0;
+#endif
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->compression_method != OUTPUT_BUFFER_COMPRESSION_METHOD_NONE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output buffer - compression method value already set.",
+		 function );
+
+		return( -1 );
+	}
+	switch( compression_method )
+	{
+		case OUTPUT_BUFFER_COMPRESSION_METHOD_NONE:
+			return( 1 );
+
+#if defined( HAVE_ZLIB )
+		case OUTPUT_BUFFER_COMPRESSION_METHOD_GZIP:
+			break;
+#endif
+
+#if defined( HAVE_ZSTD )
+		case OUTPUT_BUFFER_COMPRESSION_METHOD_ZSTD:
+			break;
+#endif
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression method: %d.",
+			 function,
+			 compression_method );
+
+			return( -1 );
+	}
+	output_buffer->compressed_data = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * output_buffer->data_size );
+
+	if( output_buffer->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	output_buffer->compressed_data_size = output_buffer->data_size;
+
+#if defined( HAVE_ZLIB )
+	if( compression_method == OUTPUT_BUFFER_COMPRESSION_METHOD_GZIP )
+	{
+		/* A window bits value of 15 + 16 makes deflate write a gzip header and footer
+		 */
+		result = deflateInit2(
+		          &( output_buffer->zlib_stream ),
+		          Z_DEFAULT_COMPRESSION,
+		          Z_DEFLATED,
+		          15 + 16,
+		          8,
+		          Z_DEFAULT_STRATEGY );
+
+		if( result != Z_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize zlib stream with error: %d.",
+			 function,
+			 result );
+
+			goto on_error;
+		}
+	}
+#endif
+#if defined( HAVE_ZSTD )
+	if( compression_method == OUTPUT_BUFFER_COMPRESSION_METHOD_ZSTD )
+	{
+		output_buffer->zstd_context = ZSTD_createCCtx();
+
+		if( output_buffer->zstd_context == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create zstd compression context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	output_buffer->compression_method = compression_method;
+
+	return( 1 );
+
+on_error:
+	if( output_buffer->compressed_data != NULL )
+	{
+		memory_free(
+		 output_buffer->compressed_data );
+
+		output_buffer->compressed_data = NULL;
+	}
+	output_buffer->compressed_data_size = 0;
+
+	return( -1 );
+}
+
+/* Compresses data and writes it to the output stream
+ * If finish is set the compressed stream is ended with a complete gzip member or zstd frame
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_write_compressed_data(
+     output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     int finish,
+     libcerror_error_t **error )
+{
+	static char *function       = "output_buffer_write_compressed_data";
+	size_t compressed_data_size = 0;
+	size_t write_count          = 0;
+
+#if defined( HAVE_ZLIB )
+	int result                  = 0;
+#endif
+#if defined( HAVE_ZSTD )
+	ZSTD_inBuffer zstd_input;
+	ZSTD_outBuffer zstd_output;
+
+	size_t remaining_size       = 0;
+#endif
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid output buffer - missing compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( finish == 0 )
+	{
+		if( data_size == 0 )
+		{
+			return( 1 );
+		}
+	}
+	else if( ( data_size == 0 )
+	      && ( output_buffer->compressed_stream_pending == 0 ) )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_ZLIB )
+	if( output_buffer->compression_method == OUTPUT_BUFFER_COMPRESSION_METHOD_GZIP )
+	{
+		output_buffer->zlib_stream.next_in  = (Bytef *) data;
+		output_buffer->zlib_stream.avail_in = (uInt) data_size;
+
+		do
+		{
+			output_buffer->zlib_stream.next_out  = (Bytef *) output_buffer->compressed_data;
+			output_buffer->zlib_stream.avail_out = (uInt) output_buffer->compressed_data_size;
+
+			if( finish != 0 )
+			{
+				result = deflate(
+				          &( output_buffer->zlib_stream ),
+				          Z_FINISH );
+			}
+			else
+			{
+				result = deflate(
+				          &( output_buffer->zlib_stream ),
+				          Z_NO_FLUSH );
+			}
+			if( result == Z_STREAM_ERROR )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to compress data.",
+				 function );
+
+				return( -1 );
+			}
+			compressed_data_size = output_buffer->compressed_data_size
+			                     - (size_t) output_buffer->zlib_stream.avail_out;
+
+			if( compressed_data_size > 0 )
+			{
+				write_count = file_stream_write(
+				               output_buffer->stream,
+				               output_buffer->compressed_data,
+				               compressed_data_size );
+
+				if( write_count != compressed_data_size )
+				{
+					output_buffer->write_failed = 1;
+				}
+			}
+		}
+		while( output_buffer->zlib_stream.avail_out == 0 );
+
+		if( finish != 0 )
+		{
+			if( result != Z_STREAM_END )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to finish compressed stream.",
+				 function );
+
+				return( -1 );
+			}
+			/* The next compressed data is written as a new gzip member
+			 */
+			if( deflateReset(
+			     &( output_buffer->zlib_stream ) ) != Z_OK )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to reset zlib stream.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+#endif
+#if defined( HAVE_ZSTD )
+	if( output_buffer->compression_method == OUTPUT_BUFFER_COMPRESSION_METHOD_ZSTD )
+	{
+		zstd_input.src  = data;
+		zstd_input.size = data_size;
+		zstd_input.pos  = 0;
+
+		do
+		{
+			zstd_output.dst  = output_buffer->compressed_data;
+			zstd_output.size = output_buffer->compressed_data_size;
+			zstd_output.pos  = 0;
+
+			/* After a frame was ended the next compressed data is written as a new frame
+			 */
+			if( finish != 0 )
+			{
+				remaining_size = ZSTD_compressStream2(
+				                  output_buffer->zstd_context,
+				                  &zstd_output,
+				                  &zstd_input,
+				                  ZSTD_e_end );
+			}
+			else
+			{
+				remaining_size = ZSTD_compressStream2(
+				                  output_buffer->zstd_context,
+				                  &zstd_output,
+				                  &zstd_input,
+				                  ZSTD_e_continue );
+			}
+			if( ZSTD_isError(
+			     remaining_size ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to compress data with error: %s.",
+				 function,
+				 ZSTD_getErrorName(
+				  remaining_size ) );
+
+				return( -1 );
+			}
+			compressed_data_size = zstd_output.pos;
+
+			if( compressed_data_size > 0 )
+			{
+				write_count = file_stream_write(
+				               output_buffer->stream,
+				               output_buffer->compressed_data,
+				               compressed_data_size );
+
+				if( write_count != compressed_data_size )
+				{
+					output_buffer->write_failed = 1;
+				}
+			}
+		}
+		while( ( ( finish != 0 )
+		      && ( remaining_size != 0 ) )
+		    || ( zstd_input.pos < zstd_input.size ) );
+	}
+#endif
+	if( finish != 0 )
+	{
+		output_buffer->compressed_stream_pending = 0;
+	}
+	else
+	{
+		output_buffer->compressed_stream_pending = 1;
+	}
+	return( 1 );
+}
+
+/* Writes the buffered data to the output stream
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_flush(
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_flush";
+	size_t write_count    = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->compression_method != OUTPUT_BUFFER_COMPRESSION_METHOD_NONE )
+	{
+		if( output_buffer_write_compressed_data(
+		     output_buffer,
+		     (uint8_t *) output_buffer->data,
+		     output_buffer->data_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write compressed data.",
+			 function );
+
+			output_buffer->data_offset  = 0;
+			output_buffer->write_failed = 1;
+
+			return( -1 );
+		}
+		output_buffer->data_offset = 0;
+	}
+	else if( output_buffer->data_offset > 0 )
+	{
+		write_count = file_stream_write(
+		               output_buffer->stream,
+		               output_buffer->data,
+		               output_buffer->data_offset );
+
+		if( write_count != output_buffer->data_offset )
+		{
+			output_buffer->write_failed = 1;
+		}
+		output_buffer->data_offset = 0;
+	}
+	if( output_buffer->write_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data to output stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Flushes the output buffer and finishes the compressed stream
+ * A compressed output stream then ends with a complete gzip member or zstd frame,
+ * data written afterwards is compressed into a new member or frame
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_finish(
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_finish";
+
+	if( output_buffer_flush(
+	     output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->compression_method != OUTPUT_BUFFER_COMPRESSION_METHOD_NONE )
+	{
+		if( output_buffer_write_compressed_data(
+		     output_buffer,
+		     NULL,
+		     0,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to finish compressed data.",
+			 function );
+
+			output_buffer->write_failed = 1;
+
+			return( -1 );
+		}
+		if( output_buffer->write_failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data to output stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes data to the output buffer
+ * A failure to write is reported by the next output_buffer_flush or output_buffer_finish
+ */
+void output_buffer_write_data(
+      output_buffer_t *output_buffer,
+      const char *data,
+      size_t data_size )
+{
+	libcerror_error_t *error = NULL;
+	size_t copy_size         = 0;
+
+	if( ( output_buffer == NULL )
+	 || ( data == NULL ) )
+	{
+		return;
+	}
+	while( data_size > 0 )
+	{
+		if( output_buffer->data_offset >= output_buffer->data_size )
+		{
+			if( output_buffer_flush(
+			     output_buffer,
+			     &error ) != 1 )
+			{
+				libcerror_error_free(
+				 &error );
+
+				return;
+			}
+		}
+		copy_size = output_buffer->data_size - output_buffer->data_offset;
+
+		if( copy_size > data_size )
+		{
+			copy_size = data_size;
+		}
+		if( memory_copy(
+		     &( output_buffer->data[ output_buffer->data_offset ] ),
+		     data,
+		     copy_size ) == NULL )
+		{
+			output_buffer->write_failed = 1;
+
+			return;
+		}
+		output_buffer->data_offset += copy_size;
+
+		data      += copy_size;
+		data_size -= copy_size;
+	}
+}
+
+/* Writes a character to the output buffer
+ * A failure to write is reported by the next output_buffer_flush or output_buffer_finish
+ */
+void output_buffer_write_character(
+      output_buffer_t *output_buffer,
+      char character )
+{
+	libcerror_error_t *error = NULL;
+
+	if( output_buffer == NULL )
+	{
+		return;
+	}
+	if( output_buffer->data_offset >= output_buffer->data_size )
+	{
+		if( output_buffer_flush(
+		     output_buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return;
+		}
+	}
+	output_buffer->data[ output_buffer->data_offset++ ] = character;
+}
+
+/* Writes a narrow character string to the output buffer
+ */
+void output_buffer_write_string(
+      output_buffer_t *output_buffer,
+      const char *string )
+{
+	if( string == NULL )
+	{
+		return;
+	}
+	output_buffer_write_data(
+	 output_buffer,
+	 string,
+	 narrow_string_length(
+	  string ) );
+}
+
+/* Writes a system character string to the output buffer
+ */
+void output_buffer_write_system_string(
+      output_buffer_t *output_buffer,
+      const system_character_t *string )
+{
+	if( string == NULL )
+	{
+		return;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* The conversion of wide characters is left to the print function
+	 * so that the output is the same as that of fprintf
+	 */
+	output_buffer_printf(
+	 output_buffer,
+	 "%" PRIs_SYSTEM "",
+	 string );
+#else
+	output_buffer_write_data(
+	 output_buffer,
+	 string,
+	 system_string_length(
+	  string ) );
+#endif
+}
+
+/* Writes data as a lower case hexadecimal string to the output buffer
+ * Every byte is written as 2 characters, which is equivalent to "%02" PRIx8
+ */
+void output_buffer_write_hexadecimal_data(
+      output_buffer_t *output_buffer,
+      const uint8_t *data,
+      size_t data_size )
+{
+	static char *hexadecimal_digits = "0123456789abcdef";
+	size_t write_size               = 0;
+
+	if( ( output_buffer == NULL )
+	 || ( data == NULL ) )
+	{
+		return;
+	}
+	while( data_size > 0 )
+	{
+		write_size = ( output_buffer->data_size - output_buffer->data_offset ) / 2;
+
+		if( write_size == 0 )
+		{
+			/* The byte does not fit in the remainder of the buffer
+			 */
+			output_buffer_write_character(
+			 output_buffer,
+			 hexadecimal_digits[ *data >> 4 ] );
+
+			output_buffer_write_character(
+			 output_buffer,
+			 hexadecimal_digits[ *data & 0x0f ] );
+
+			data      += 1;
+			data_size -= 1;
+
+			continue;
+		}
+		if( write_size > data_size )
+		{
+			write_size = data_size;
+		}
+		data_size -= write_size;
+
+		while( write_size > 0 )
+		{
+			output_buffer->data[ output_buffer->data_offset++ ] = hexadecimal_digits[ *data >> 4 ];
+			output_buffer->data[ output_buffer->data_offset++ ] = hexadecimal_digits[ *data & 0x0f ];
+
+			data       += 1;
+			write_size -= 1;
+		}
+	}
+}
+
+/* Writes an unsigned decimal value to the output buffer
+ * The value is written in the same way as "%" PRIu64
+ */
+void output_buffer_write_unsigned_decimal(
+      output_buffer_t *output_buffer,
+      uint64_t value_64bit )
+{
+	char string[ 20 ];
+
+	size_t string_index = 20;
+
+	do
+	{
+		string_index--;
+
+		string[ string_index ] = (char) ( '0' + ( value_64bit % 10 ) );
+
+		value_64bit /= 10;
+	}
+	while( value_64bit > 0 );
+
+	output_buffer_write_data(
+	 output_buffer,
+	 &( string[ string_index ] ),
+	 20 - string_index );
+}
+
+/* Writes a signed decimal value to the output buffer
+ * The value is written in the same way as "%" PRIi64
+ */
+void output_buffer_write_signed_decimal(
+      output_buffer_t *output_buffer,
+      int64_t value_64bit )
+{
+	if( value_64bit < 0 )
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 '-' );
+
+		/* Negate in 2 steps to prevent overflowing the minimum value
+		 */
+		output_buffer_write_unsigned_decimal(
+		 output_buffer,
+		 (uint64_t) -( value_64bit + 1 ) + 1 );
+	}
+	else
+	{
+		output_buffer_write_unsigned_decimal(
+		 output_buffer,
+		 (uint64_t) value_64bit );
+	}
+}
+
+#if defined( HAVE_STDARG_H ) || defined( WINAPI )
+#define VARARGS( function, type, argument ) \
+	function( output_buffer_t *output_buffer, type argument, ... )
+#define VASTART( argument_list, type, name ) \
+	va_start( argument_list, name )
+#define VAEND( argument_list ) \
+	va_end( argument_list )
+
+#elif defined( HAVE_VARARGS_H )
+#define VARARGS( function, type, argument ) \
+	function( output_buffer_t *output_buffer, va_alist ) va_dcl
+#define VASTART( argument_list, type, name ) \
+	{ type name; va_start( argument_list ); name = va_arg( argument_list, type )
+#define VAEND( argument_list ) \
+	va_end( argument_list ); }
+
+#endif
+
+/* Print a formatted string to the output buffer
+ * A formatted string that does not fit in the remainder of the buffer is formatted
+ * into a scratch buffer, of which the size is determined by the first print
+ * A failure to write is reported by the next output_buffer_flush or output_buffer_finish
+ */
+void VARARGS(
+      output_buffer_printf,
+      const char *,
+      format )
+{
+	va_list argument_list;
+
+	char *string          = NULL;
+	size_t available_size = 0;
+	size_t string_size    = 0;
+	int print_count       = 0;
+
+	if( output_buffer == NULL )
+	{
+		return;
+	}
+	available_size = output_buffer->data_size - output_buffer->data_offset;
+
+	VASTART(
+	 argument_list,
+	 const char *,
+	 format );
+
+	print_count = narrow_string_vsnprintf(
+	               &( output_buffer->data[ output_buffer->data_offset ] ),
+	               available_size,
+	               format,
+	               argument_list );
+
+	VAEND(
+	 argument_list );
+
+	if( print_count < 0 )
+	{
+		output_buffer->write_failed = 1;
+
+		return;
+	}
+	if( (size_t) print_count < available_size )
+	{
+		output_buffer->data_offset += (size_t) print_count;
+
+		return;
+	}
+	string_size = (size_t) print_count + 1;
+
+	string = narrow_string_allocate(
+	          string_size );
+
+	if( string == NULL )
+	{
+		output_buffer->write_failed = 1;
+
+		return;
+	}
+	VASTART(
+	 argument_list,
+	 const char *,
+	 format );
+
+	print_count = narrow_string_vsnprintf(
+	               string,
+	               string_size,
+	               format,
+	               argument_list );
+
+	VAEND(
+	 argument_list );
+
+	if( ( print_count >= 0 )
+	 && ( (size_t) print_count < string_size ) )
+	{
+		output_buffer_write_data(
+		 output_buffer,
+		 string,
+		 (size_t) print_count );
+	}
+	else
+	{
+		output_buffer->write_failed = 1;
+	}
+	memory_free(
+	 string );
+}
+
+#undef VARARGS
+#undef VASTART
+#undef VAEND
+
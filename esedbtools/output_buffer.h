@@ -0,0 +1,173 @@
+/*
+ * Output buffer
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OUTPUT_BUFFER_H )
+#define _OUTPUT_BUFFER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_ZLIB )
+#include <zlib.h>
+#endif
+
+#if defined( HAVE_ZSTD )
+#include <zstd.h>
+#endif
+
+#include "esedbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum OUTPUT_BUFFER_COMPRESSION_METHODS
+{
+	OUTPUT_BUFFER_COMPRESSION_METHOD_NONE	= 0,
+	OUTPUT_BUFFER_COMPRESSION_METHOD_GZIP	= (int) 'g',
+	OUTPUT_BUFFER_COMPRESSION_METHOD_ZSTD	= (int) 'z'
+};
+
+typedef struct output_buffer output_buffer_t;
+
+struct output_buffer
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The data
+	 */
+	char *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset
+	 */
+	size_t data_offset;
+
+	/* Value to indicate if writing to the output stream failed
+	 */
+	int write_failed;
+
+	/* The compression method
+	 */
+	int compression_method;
+
+	/* The compressed data
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* Value to indicate the compressed stream contains data that was not finished
+	 */
+	int compressed_stream_pending;
+
+#if defined( HAVE_ZLIB )
+	/* The zlib stream
+	 */
+	z_stream zlib_stream;
+#endif
+
+#if defined( HAVE_ZSTD )
+	/* The zstd compression context
+	 */
+	ZSTD_CCtx *zstd_context;
+#endif
+};
+
+int output_buffer_initialize(
+     output_buffer_t **output_buffer,
+     FILE *stream,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int output_buffer_free(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error );
+
+int output_buffer_set_compression_method(
+     output_buffer_t *output_buffer,
+     int compression_method,
+     libcerror_error_t **error );
+
+int output_buffer_write_compressed_data(
+     output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     int finish,
+     libcerror_error_t **error );
+
+int output_buffer_flush(
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int output_buffer_finish(
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+void output_buffer_write_data(
+      output_buffer_t *output_buffer,
+      const char *data,
+      size_t data_size );
+
+void output_buffer_write_character(
+      output_buffer_t *output_buffer,
+      char character );
+
+void output_buffer_write_string(
+      output_buffer_t *output_buffer,
+      const char *string );
+
+void output_buffer_write_system_string(
+      output_buffer_t *output_buffer,
+      const system_character_t *string );
+
+void output_buffer_write_hexadecimal_data(
+      output_buffer_t *output_buffer,
+      const uint8_t *data,
+      size_t data_size );
+
+void output_buffer_write_unsigned_decimal(
+      output_buffer_t *output_buffer,
+      uint64_t value_64bit );
+
+void output_buffer_write_signed_decimal(
+      output_buffer_t *output_buffer,
+      int64_t value_64bit );
+
+void output_buffer_printf(
+      output_buffer_t *output_buffer,
+      const char *format,
+      ... );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _OUTPUT_BUFFER_H ) */
+
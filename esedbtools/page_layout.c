@@ -0,0 +1,729 @@
+/*
+ * Page layout functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+#include "page_layout.h"
+
+const char *page_layout_page_type_descriptions[ PAGE_LAYOUT_NUMBER_OF_PAGE_TYPES ] = {
+	"Unknown",
+	"Empty",
+	"Root",
+	"Branch",
+	"Leaf",
+	"Space tree",
+	"Long value" };
+
+/* Creates a page layout
+ * Make sure the value page_layout is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int page_layout_initialize(
+     page_layout_t **page_layout,
+     uint32_t number_of_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "page_layout_initialize";
+	size_t page_map_size  = 0;
+
+	if( page_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_layout != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page layout value already set.",
+		 function );
+
+		return( -1 );
+	}
+	page_map_size = (size_t) number_of_pages * PAGE_LAYOUT_MAP_ENTRY_SIZE;
+
+	if( ( number_of_pages == 0 )
+	 || ( page_map_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of pages value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*page_layout = memory_allocate_structure(
+	                page_layout_t );
+
+	if( *page_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page layout.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_layout,
+	     0,
+	     sizeof( page_layout_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page layout.",
+		 function );
+
+		memory_free(
+		 *page_layout );
+
+		*page_layout = NULL;
+
+		return( -1 );
+	}
+	( *page_layout )->page_map = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * page_map_size );
+
+	if( ( *page_layout )->page_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *page_layout )->page_map,
+	     0,
+	     sizeof( uint8_t ) * page_map_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page map.",
+		 function );
+
+		goto on_error;
+	}
+	( *page_layout )->number_of_pages = number_of_pages;
+	( *page_layout )->page_map_size   = page_map_size;
+
+	return( 1 );
+
+on_error:
+	if( *page_layout != NULL )
+	{
+		if( ( *page_layout )->page_map != NULL )
+		{
+			memory_free(
+			 ( *page_layout )->page_map );
+		}
+		memory_free(
+		 *page_layout );
+
+		*page_layout = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a page layout
+ * Returns 1 if successful or -1 on error
+ */
+int page_layout_free(
+     page_layout_t **page_layout,
+     libcerror_error_t **error )
+{
+	static char *function = "page_layout_free";
+
+	if( page_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_layout != NULL )
+	{
+		if( ( *page_layout )->objects != NULL )
+		{
+			memory_free(
+			 ( *page_layout )->objects );
+		}
+		if( ( *page_layout )->page_map != NULL )
+		{
+			memory_free(
+			 ( *page_layout )->page_map );
+		}
+		memory_free(
+		 *page_layout );
+
+		*page_layout = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the page map entry of a specific page
+ * The page number is 1-based. Distinct pages can be set concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int page_layout_set_page(
+     page_layout_t *page_layout,
+     uint32_t page_number,
+     uint32_t object_identifier,
+     uint8_t page_type,
+     uint8_t fill_level,
+     libcerror_error_t **error )
+{
+	uint8_t *page_map_entry = NULL;
+	static char *function   = "page_layout_set_page";
+
+	if( page_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > page_layout->number_of_pages ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_type >= PAGE_LAYOUT_NUMBER_OF_PAGE_TYPES )
+	{
+		page_type = LIBESEDB_PAGE_TYPE_UNKNOWN;
+	}
+	if( fill_level > 100 )
+	{
+		fill_level = 100;
+	}
+	page_map_entry = &( page_layout->page_map[ ( page_number - 1 ) * PAGE_LAYOUT_MAP_ENTRY_SIZE ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 page_map_entry,
+	 object_identifier );
+
+	page_map_entry[ 4 ] = page_type;
+	page_map_entry[ 5 ] = fill_level;
+
+	return( 1 );
+}
+
+/* Retrieves the object of a specific object identifier
+ * The object is added if it does not exist, the objects are kept sorted
+ * by object identifier
+ * Returns 1 if successful or -1 on error
+ */
+int page_layout_get_object(
+     page_layout_t *page_layout,
+     uint32_t object_identifier,
+     page_layout_object_t **object,
+     libcerror_error_t **error )
+{
+	void *reallocation            = NULL;
+	static char *function         = "page_layout_get_object";
+	int maximum_number_of_objects = 0;
+	int object_index              = 0;
+	int lower_index               = 0;
+	int upper_index               = 0;
+
+	if( page_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = page_layout->number_of_objects;
+
+	while( lower_index < upper_index )
+	{
+		object_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( page_layout->objects[ object_index ].object_identifier == object_identifier )
+		{
+			*object = &( page_layout->objects[ object_index ] );
+
+			return( 1 );
+		}
+		else if( page_layout->objects[ object_index ].object_identifier < object_identifier )
+		{
+			lower_index = object_index + 1;
+		}
+		else
+		{
+			upper_index = object_index;
+		}
+	}
+	if( page_layout->number_of_objects >= page_layout->maximum_number_of_objects )
+	{
+		if( page_layout->maximum_number_of_objects == 0 )
+		{
+			maximum_number_of_objects = 64;
+		}
+		else
+		{
+			maximum_number_of_objects = page_layout->maximum_number_of_objects * 2;
+		}
+		if( ( maximum_number_of_objects <= page_layout->maximum_number_of_objects )
+		 || ( (size_t) maximum_number_of_objects > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( page_layout_object_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of objects value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                page_layout->objects,
+		                sizeof( page_layout_object_t ) * maximum_number_of_objects );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize objects.",
+			 function );
+
+			return( -1 );
+		}
+		page_layout->objects                   = (page_layout_object_t *) reallocation;
+		page_layout->maximum_number_of_objects = maximum_number_of_objects;
+	}
+	/* The source and destination overlap hence the objects are moved one at a time
+	 */
+	for( object_index = page_layout->number_of_objects;
+	     object_index > lower_index;
+	     object_index-- )
+	{
+		page_layout->objects[ object_index ] = page_layout->objects[ object_index - 1 ];
+	}
+	if( memory_set(
+	     &( page_layout->objects[ lower_index ] ),
+	     0,
+	     sizeof( page_layout_object_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear object.",
+		 function );
+
+		return( -1 );
+	}
+	page_layout->objects[ lower_index ].object_identifier = object_identifier;
+
+	page_layout->number_of_objects += 1;
+
+	*object = &( page_layout->objects[ lower_index ] );
+
+	return( 1 );
+}
+
+/* Analyzes the page map
+ * Determines the number of pages per type, the fill level histogram and
+ * the pages and extents per object. Empty and unknown pages are not
+ * attributed to an object
+ * Returns 1 if successful or -1 on error
+ */
+int page_layout_analyze(
+     page_layout_t *page_layout,
+     libcerror_error_t **error )
+{
+	page_layout_object_t *object = NULL;
+	uint8_t *page_map_entry      = NULL;
+	static char *function        = "page_layout_analyze";
+	uint32_t object_identifier   = 0;
+	uint32_t page_number         = 0;
+	uint8_t fill_level           = 0;
+	uint8_t page_type            = 0;
+
+	if( page_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     page_layout->number_of_pages_per_type,
+	     0,
+	     sizeof( uint32_t ) * PAGE_LAYOUT_NUMBER_OF_PAGE_TYPES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear number of pages per type.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     page_layout->fill_level_histogram,
+	     0,
+	     sizeof( uint32_t ) * PAGE_LAYOUT_NUMBER_OF_FILL_LEVELS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear fill level histogram.",
+		 function );
+
+		return( -1 );
+	}
+	page_layout->number_of_objects = 0;
+
+	page_map_entry = page_layout->page_map;
+
+	for( page_number = 1;
+	     page_number <= page_layout->number_of_pages;
+	     page_number++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 page_map_entry,
+		 object_identifier );
+
+		page_type  = page_map_entry[ 4 ];
+		fill_level = page_map_entry[ 5 ];
+
+		page_map_entry += PAGE_LAYOUT_MAP_ENTRY_SIZE;
+
+		page_layout->number_of_pages_per_type[ page_type ] += 1;
+
+		if( ( page_type == LIBESEDB_PAGE_TYPE_UNKNOWN )
+		 || ( page_type == LIBESEDB_PAGE_TYPE_EMPTY ) )
+		{
+			continue;
+		}
+		page_layout->fill_level_histogram[ fill_level / 10 ] += 1;
+
+		if( page_layout_get_object(
+		     page_layout,
+		     object_identifier,
+		     &object,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve object: %" PRIu32 ".",
+			 function,
+			 object_identifier );
+
+			return( -1 );
+		}
+		/* The pages are analyzed in ascending order hence a page that
+		 * does not follow the last page of the object starts a new extent
+		 */
+		if( ( object->number_of_pages == 0 )
+		 || ( ( object->last_page_number + 1 ) != page_number ) )
+		{
+			object->number_of_extents += 1;
+		}
+		if( page_type == LIBESEDB_PAGE_TYPE_LEAF )
+		{
+			object->number_of_leaf_pages += 1;
+		}
+		object->number_of_pages  += 1;
+		object->fill_level_total += fill_level;
+		object->last_page_number  = page_number;
+	}
+	return( 1 );
+}
+
+/* Prints the page layout to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int page_layout_fprint(
+     page_layout_t *page_layout,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	page_layout_object_t *object = NULL;
+	static char *function        = "page_layout_fprint";
+	int fill_level_index         = 0;
+	int object_index             = 0;
+	int page_type                = 0;
+
+	if( page_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "Page layout:\n" );
+
+	fprintf(
+	 stream,
+	 "\tNumber of pages:\t%" PRIu32 "\n",
+	 page_layout->number_of_pages );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "\tPage types:\n" );
+
+	for( page_type = 0;
+	     page_type < PAGE_LAYOUT_NUMBER_OF_PAGE_TYPES;
+	     page_type++ )
+	{
+		fprintf(
+		 stream,
+		 "\t\t%-16s: %" PRIu32 "\n",
+		 page_layout_page_type_descriptions[ page_type ],
+		 page_layout->number_of_pages_per_type[ page_type ] );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "\tFill levels:\n" );
+
+	for( fill_level_index = 0;
+	     fill_level_index < PAGE_LAYOUT_NUMBER_OF_FILL_LEVELS - 1;
+	     fill_level_index++ )
+	{
+		fprintf(
+		 stream,
+		 "\t\t%3d%% - %3d%%     : %" PRIu32 "\n",
+		 fill_level_index * 10,
+		 ( fill_level_index * 10 ) + 9,
+		 page_layout->fill_level_histogram[ fill_level_index ] );
+	}
+	fprintf(
+	 stream,
+	 "\t\t%3d%%            : %" PRIu32 "\n",
+	 100,
+	 page_layout->fill_level_histogram[ PAGE_LAYOUT_NUMBER_OF_FILL_LEVELS - 1 ] );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "\tObjects:\n" );
+
+	fprintf(
+	 stream,
+	 "\t\tIdentifier\tPages\t\tExtents\t\tLeaf pages\tFill level\n" );
+
+	for( object_index = 0;
+	     object_index < page_layout->number_of_objects;
+	     object_index++ )
+	{
+		object = &( page_layout->objects[ object_index ] );
+
+		fprintf(
+		 stream,
+		 "\t\t%-10" PRIu32 "\t%-10" PRIu32 "\t%-10" PRIu32 "\t%-10" PRIu32 "\t%" PRIu64 "%%\n",
+		 object->object_identifier,
+		 object->number_of_pages,
+		 object->number_of_extents,
+		 object->number_of_leaf_pages,
+		 object->fill_level_total / object->number_of_pages );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Writes the page map to a file
+ * Returns 1 if successful or -1 on error
+ */
+int page_layout_write_map(
+     page_layout_t *page_layout,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "page_layout_write_map";
+	size_t write_count    = 0;
+
+	if( page_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               stream,
+	               page_layout->page_map,
+	               page_layout->page_map_size );
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	if( write_count != page_layout->page_map_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,155 @@
+/*
+ * Page layout functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PAGE_LAYOUT_H )
+#define _PAGE_LAYOUT_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a page map entry
+ * consisting of a 32-bit little-endian father data page (FDP) object identifier,
+ * an 8-bit page type and an 8-bit fill level in percent
+ */
+#define PAGE_LAYOUT_MAP_ENTRY_SIZE		6
+
+#define PAGE_LAYOUT_NUMBER_OF_PAGE_TYPES	7
+
+/* The fill levels are counted in buckets of 10 percent
+ */
+#define PAGE_LAYOUT_NUMBER_OF_FILL_LEVELS	11
+
+typedef struct page_layout_object page_layout_object_t;
+
+struct page_layout_object
+{
+	/* The father data page (FDP) object identifier
+	 */
+	uint32_t object_identifier;
+
+	/* The number of pages
+	 */
+	uint32_t number_of_pages;
+
+	/* The number of extents, which are runs of consecutive pages
+	 */
+	uint32_t number_of_extents;
+
+	/* The number of leaf pages
+	 */
+	uint32_t number_of_leaf_pages;
+
+	/* The sum of the fill levels of the pages
+	 */
+	uint64_t fill_level_total;
+
+	/* The last page number
+	 */
+	uint32_t last_page_number;
+};
+
+typedef struct page_layout page_layout_t;
+
+struct page_layout
+{
+	/* The number of pages
+	 */
+	uint32_t number_of_pages;
+
+	/* The page map
+	 */
+	uint8_t *page_map;
+
+	/* The page map size
+	 */
+	size_t page_map_size;
+
+	/* The number of pages per page type
+	 */
+	uint32_t number_of_pages_per_type[ PAGE_LAYOUT_NUMBER_OF_PAGE_TYPES ];
+
+	/* The fill level histogram
+	 */
+	uint32_t fill_level_histogram[ PAGE_LAYOUT_NUMBER_OF_FILL_LEVELS ];
+
+	/* The objects sorted by object identifier
+	 */
+	page_layout_object_t *objects;
+
+	/* The number of objects
+	 */
+	int number_of_objects;
+
+	/* The maximum number of objects
+	 */
+	int maximum_number_of_objects;
+};
+
+int page_layout_initialize(
+     page_layout_t **page_layout,
+     uint32_t number_of_pages,
+     libcerror_error_t **error );
+
+int page_layout_free(
+     page_layout_t **page_layout,
+     libcerror_error_t **error );
+
+int page_layout_set_page(
+     page_layout_t *page_layout,
+     uint32_t page_number,
+     uint32_t object_identifier,
+     uint8_t page_type,
+     uint8_t fill_level,
+     libcerror_error_t **error );
+
+int page_layout_get_object(
+     page_layout_t *page_layout,
+     uint32_t object_identifier,
+     page_layout_object_t **object,
+     libcerror_error_t **error );
+
+int page_layout_analyze(
+     page_layout_t *page_layout,
+     libcerror_error_t **error );
+
+int page_layout_fprint(
+     page_layout_t *page_layout,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int page_layout_write_map(
+     page_layout_t *page_layout,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PAGE_LAYOUT_H ) */
+
@@ -0,0 +1,2132 @@
+/*
+ * Page scanner functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcfile.h"
+#include "esedbtools_libcthreads.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_system_string.h"
+#include "page_scanner.h"
+
+const uint32_t page_scanner_page_sizes[ PAGE_SCANNER_NUMBER_OF_PAGE_SIZES ] = {
+	2048, 4096, 8192, 16384, 32768 };
+
+const uint8_t page_scanner_file_signature[ 4 ] = { 0xef, 0xcd, 0xab, 0x89 };
+
+/* Creates a page scanner
+ * Make sure the value page_scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int page_scanner_initialize(
+     page_scanner_t **page_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "page_scanner_initialize";
+
+	if( page_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*page_scanner = memory_allocate_structure(
+	                 page_scanner_t );
+
+	if( *page_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *page_scanner,
+	     0,
+	     sizeof( page_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page scanner.",
+		 function );
+
+		memory_free(
+		 *page_scanner );
+
+		*page_scanner = NULL;
+
+		return( -1 );
+	}
+	( *page_scanner )->alignment          = 512;
+	( *page_scanner )->number_of_threads  = 1;
+	( *page_scanner )->file_header_offset = -1;
+
+	return( 1 );
+}
+
+/* Frees a page scanner
+ * Returns 1 if successful or -1 on error
+ */
+int page_scanner_free(
+     page_scanner_t **page_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "page_scanner_free";
+
+	if( page_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_scanner != NULL )
+	{
+		if( ( *page_scanner )->pages != NULL )
+		{
+			memory_free(
+			 ( *page_scanner )->pages );
+		}
+		memory_free(
+		 *page_scanner );
+
+		*page_scanner = NULL;
+	}
+	return( 1 );
+}
+
+/* Signals the page scanner to abort
+ * Returns 1 if successful or -1 on error
+ */
+int page_scanner_signal_abort(
+     page_scanner_t *page_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "page_scanner_signal_abort";
+
+	if( page_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page scanner.",
+		 function );
+
+		return( -1 );
+	}
+	page_scanner->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the page size to scan for
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int page_scanner_set_page_size(
+     page_scanner_t *page_scanner,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "page_scanner_set_page_size";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+	int page_size_index   = 0;
+
+	if( page_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( esedbtools_system_string_copy_to_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to determine page size.",
+		 function );
+
+		return( -1 );
+	}
+	for( page_size_index = 0;
+	     page_size_index < PAGE_SCANNER_NUMBER_OF_PAGE_SIZES;
+	     page_size_index++ )
+	{
+		if( value_64bit == (uint64_t) page_scanner_page_sizes[ page_size_index ] )
+		{
+			page_scanner->page_size = (uint32_t) value_64bit;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Sets the alignment of the pages in the source
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int page_scanner_set_alignment(
+     page_scanner_t *page_scanner,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "page_scanner_set_alignment";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( page_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( esedbtools_system_string_copy_to_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to determine alignment.",
+		 function );
+
+		return( -1 );
+	}
+	/* The alignment should be a power of 2 from 512 to 32768
+	 */
+	if( ( value_64bit < 512 )
+	 || ( value_64bit > 32768 )
+	 || ( ( value_64bit & ( value_64bit - 1 ) ) != 0 ) )
+	{
+		return( 0 );
+	}
+	page_scanner->alignment = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Sets the number of threads used to scan the source
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int page_scanner_set_number_of_threads(
+     page_scanner_t *page_scanner,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "page_scanner_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( page_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( esedbtools_system_string_copy_to_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to determine number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) PAGE_SCANNER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+	page_scanner->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Determines if data contains a file header
+ * The file header is recognized by its signature, format version, page size and checksum
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int page_scanner_check_file_header(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *page_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "page_scanner_check_file_header";
+	size_t data_offset                 = 0;
+	uint32_t calculated_xor32_checksum = 0;
+	uint32_t format_version            = 0;
+	uint32_t safe_page_size            = 0;
+	uint32_t stored_xor32_checksum     = 0;
+	uint32_t value_32bit               = 0;
+	int page_size_index                = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < PAGE_SCANNER_FILE_HEADER_SIZE )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     &( data[ 4 ] ),
+	     page_scanner_file_signature,
+	     4 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 format_version );
+
+	if( format_version != 0x620 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 236 ] ),
+	 safe_page_size );
+
+	for( page_size_index = 0;
+	     page_size_index < PAGE_SCANNER_NUMBER_OF_PAGE_SIZES;
+	     page_size_index++ )
+	{
+		if( safe_page_size == page_scanner_page_sizes[ page_size_index ] )
+		{
+			break;
+		}
+	}
+	if( page_size_index >= PAGE_SCANNER_NUMBER_OF_PAGE_SIZES )
+	{
+		return( 0 );
+	}
+	calculated_xor32_checksum = 0x89abcdef;
+
+	for( data_offset = 4;
+	     data_offset < PAGE_SCANNER_FILE_HEADER_SIZE;
+	     data_offset += 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 value_32bit );
+
+		calculated_xor32_checksum ^= value_32bit;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 data,
+	 stored_xor32_checksum );
+
+	if( stored_xor32_checksum != calculated_xor32_checksum )
+	{
+		return( 0 );
+	}
+	*page_size = safe_page_size;
+
+	return( 1 );
+}
+
+/* Appends a page to the pages of a range
+ * Returns 1 if successful or -1 on error
+ */
+int page_scanner_range_append_page(
+     page_scanner_range_t *range,
+     off64_t offset,
+     uint32_t page_size,
+     uint32_t page_number,
+     uint32_t object_identifier,
+     uint32_t page_flags,
+     libcerror_error_t **error )
+{
+	page_scanner_page_t *page   = NULL;
+	void *reallocation          = NULL;
+	static char *function       = "page_scanner_range_append_page";
+	int maximum_number_of_pages = 0;
+
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range.",
+		 function );
+
+		return( -1 );
+	}
+	if( range->number_of_pages >= range->maximum_number_of_pages )
+	{
+		if( range->maximum_number_of_pages == 0 )
+		{
+			maximum_number_of_pages = 1024;
+		}
+		else
+		{
+			maximum_number_of_pages = range->maximum_number_of_pages * 2;
+		}
+		if( ( maximum_number_of_pages <= range->maximum_number_of_pages )
+		 || ( (size_t) maximum_number_of_pages > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( page_scanner_page_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of pages value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                range->pages,
+		                sizeof( page_scanner_page_t ) * maximum_number_of_pages );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize pages.",
+			 function );
+
+			return( -1 );
+		}
+		range->pages                   = (page_scanner_page_t *) reallocation;
+		range->maximum_number_of_pages = maximum_number_of_pages;
+	}
+	page = &( range->pages[ range->number_of_pages ] );
+
+	page->offset            = offset;
+	page->page_size         = page_size;
+	page->page_number       = page_number;
+	page->object_identifier = object_identifier;
+	page->page_flags        = page_flags;
+
+	range->number_of_pages += 1;
+
+	return( 1 );
+}
+
+/* Scans a range of the source for pages and a file header
+ * Every range opens its own source file, hence ranges can be scanned concurrently.
+ * Pages are expected at offsets that are a multiple of the alignment, after a page
+ * is found the scan continues after the page
+ * Returns 1 if successful or -1 on error
+ */
+int page_scanner_scan_range(
+     page_scanner_t *page_scanner,
+     page_scanner_range_t *range,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *source_file = NULL;
+	uint8_t *buffer              = NULL;
+	static char *function        = "page_scanner_scan_range";
+	size_t buffer_offset         = 0;
+	size_t read_size             = 0;
+	size_t scan_size             = 0;
+	size_t skip_size             = 0;
+	ssize_t read_count           = 0;
+	off64_t read_offset          = 0;
+	uint32_t object_identifier   = 0;
+	uint32_t page_flags          = 0;
+	uint32_t page_number         = 0;
+	uint32_t page_size           = 0;
+	int page_size_index          = 0;
+	int result                   = 0;
+
+	if( page_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_scanner->source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page scanner - missing source.",
+		 function );
+
+		return( -1 );
+	}
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range->start_offset < 0 )
+	 || ( range->start_offset > range->end_offset )
+	 || ( (size64_t) range->end_offset > page_scanner->source_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The buffer is extended by the maximum page size so that pages
+	 * that start at the end of the scanned data can be checked
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * ( PAGE_SCANNER_READ_SIZE + 32768 ) );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          source_file,
+	          page_scanner->source,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          source_file,
+	          page_scanner->source,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 page_scanner->source );
+
+		goto on_error;
+	}
+	read_offset = range->start_offset;
+
+	while( read_offset < range->end_offset )
+	{
+		if( page_scanner->abort != 0 )
+		{
+			break;
+		}
+		read_size = PAGE_SCANNER_READ_SIZE + 32768;
+
+		if( (size64_t) read_size > ( page_scanner->source_size - (size64_t) read_offset ) )
+		{
+			read_size = (size_t) ( page_scanner->source_size - (size64_t) read_offset );
+		}
+		scan_size = PAGE_SCANNER_READ_SIZE;
+
+		if( (off64_t) scan_size > ( range->end_offset - read_offset ) )
+		{
+			scan_size = (size_t) ( range->end_offset - read_offset );
+		}
+		if( libcfile_file_seek_offset(
+		     source_file,
+		     read_offset,
+		     SEEK_SET,
+		     error ) != read_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			goto on_error;
+		}
+		read_count = libcfile_file_read_buffer(
+		              source_file,
+		              buffer,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			goto on_error;
+		}
+		buffer_offset = 0;
+
+		while( buffer_offset < scan_size )
+		{
+			skip_size = (size_t) page_scanner->alignment;
+
+			result = page_scanner_check_file_header(
+			          &( buffer[ buffer_offset ] ),
+			          read_size - buffer_offset,
+			          &page_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to check file header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 read_offset + buffer_offset,
+				 read_offset + buffer_offset );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( range->file_header_offset == -1 )
+				{
+					range->file_header_offset    = read_offset + buffer_offset;
+					range->file_header_page_size = page_size;
+				}
+			}
+			else
+			{
+				/* The smaller page sizes are checked first since pages of the larger
+				 * sizes with an extended page header are not recognized by a checksum
+				 */
+				for( page_size_index = 0;
+				     page_size_index < PAGE_SCANNER_NUMBER_OF_PAGE_SIZES;
+				     page_size_index++ )
+				{
+					page_size = page_scanner_page_sizes[ page_size_index ];
+
+					if( (size_t) page_size > ( read_size - buffer_offset ) )
+					{
+						break;
+					}
+					if( ( page_scanner->page_size != 0 )
+					 && ( page_scanner->page_size != page_size ) )
+					{
+						continue;
+					}
+					result = libesedb_check_page_data(
+					          &( buffer[ buffer_offset ] ),
+					          (size_t) page_size,
+					          &page_number,
+					          &object_identifier,
+					          &page_flags,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to check page data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+						 function,
+						 read_offset + buffer_offset,
+						 read_offset + buffer_offset );
+
+						goto on_error;
+					}
+					else if( result != 0 )
+					{
+						if( page_scanner_range_append_page(
+						     range,
+						     read_offset + buffer_offset,
+						     page_size,
+						     page_number,
+						     object_identifier,
+						     page_flags,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+							 "%s: unable to append page.",
+							 function );
+
+							goto on_error;
+						}
+						break;
+					}
+				}
+			}
+			if( ( result != 0 )
+			 && ( (size_t) page_size > skip_size ) )
+			{
+				skip_size = (size_t) page_size;
+			}
+			buffer_offset += skip_size;
+		}
+		read_offset += (off64_t) buffer_offset;
+	}
+	if( libcfile_file_close(
+	     source_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Scans a range of the source
+ * This function is the callback of the scan thread pool.
+ * The result and error are stored in the range
+ * Returns 1 if successful or -1 on error
+ */
+int page_scanner_range_job(
+     page_scanner_range_t *range,
+     page_scanner_t *page_scanner )
+{
+	static char *function = "page_scanner_range_job";
+
+	if( range == NULL )
+	{
+		return( -1 );
+	}
+	if( page_scanner_scan_range(
+	     page_scanner,
+	     range,
+	     &( range->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( range->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan range: %" PRIi64 " - %" PRIi64 ".",
+		 function,
+		 range->start_offset,
+		 range->end_offset );
+
+		range->result = -1;
+
+		return( -1 );
+	}
+	range->result = 1;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Frees the pages and errors of the ranges
+ */
+void page_scanner_ranges_free(
+      page_scanner_range_t *ranges,
+      int number_of_ranges )
+{
+	int range_index = 0;
+
+	if( ranges == NULL )
+	{
+		return;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( ranges[ range_index ].pages != NULL )
+		{
+			memory_free(
+			 ranges[ range_index ].pages );
+		}
+		if( ranges[ range_index ].error != NULL )
+		{
+			libcerror_error_free(
+			 &( ranges[ range_index ].error ) );
+		}
+	}
+	memory_free(
+	 ranges );
+}
+
+/* Scans the source for pages and a file header
+ * The source is divided into ranges, one per thread, the pages found
+ * in the ranges are combined in order of offset
+ * Returns 1 if successful or -1 on error
+ */
+int page_scanner_scan(
+     page_scanner_t *page_scanner,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *source_file = NULL;
+	page_scanner_range_t *ranges = NULL;
+	static char *function        = "page_scanner_scan";
+	size64_t range_size          = 0;
+	off64_t range_offset         = 0;
+	int maximum_number_of_pages  = 0;
+	int number_of_pages          = 0;
+	int number_of_ranges         = 1;
+	int page_index               = 0;
+	int page_size_index          = 0;
+	int range_index              = 0;
+	int result                   = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+
+	if( page_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_scanner->pages != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page scanner - pages value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          source_file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          source_file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 source );
+
+		goto on_error;
+	}
+	if( libcfile_file_get_size(
+	     source_file,
+	     &( page_scanner->source_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     source_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source file.",
+		 function );
+
+		goto on_error;
+	}
+	page_scanner->source = source;
+
+	if( page_scanner->source_size == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Only sources of multiple reads are divided over the threads
+	 */
+	if( page_scanner->source_size >= ( (size64_t) page_scanner->number_of_threads * PAGE_SCANNER_READ_SIZE ) )
+	{
+		number_of_ranges = page_scanner->number_of_threads;
+	}
+#endif
+	/* The ranges start at a multiple of the alignment
+	 */
+	range_size  = page_scanner->source_size / (size64_t) number_of_ranges;
+	range_size -= range_size % page_scanner->alignment;
+
+	ranges = (page_scanner_range_t *) memory_allocate(
+	                                   sizeof( page_scanner_range_t ) * number_of_ranges );
+
+	if( ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ranges,
+	     0,
+	     sizeof( page_scanner_range_t ) * number_of_ranges ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear ranges.",
+		 function );
+
+		memory_free(
+		 ranges );
+
+		ranges = NULL;
+
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		ranges[ range_index ].start_offset       = range_offset;
+		ranges[ range_index ].file_header_offset = -1;
+
+		/* The last range also contains the remainder of the source
+		 */
+		if( range_index == ( number_of_ranges - 1 ) )
+		{
+			ranges[ range_index ].end_offset = (off64_t) page_scanner->source_size;
+		}
+		else
+		{
+			ranges[ range_index ].end_offset = range_offset + (off64_t) range_size;
+		}
+		range_offset += (off64_t) range_size;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_ranges > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     page_scanner->number_of_threads,
+		     number_of_ranges,
+		     (int (*)(intptr_t *, void *)) &page_scanner_range_job,
+		     (void *) page_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( ranges[ range_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push range: %d onto thread pool queue.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( ( ranges[ range_index ].result == -1 )
+			 || ( ( ranges[ range_index ].result == 0 )
+			  && ( page_scanner->abort == 0 ) ) )
+			{
+				/* Move the error of the range to the caller
+				 */
+				if( error != NULL )
+				{
+					*error                      = ranges[ range_index ].error;
+					ranges[ range_index ].error = NULL;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	if( page_scanner_scan_range(
+	     page_scanner,
+	     &( ranges[ 0 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan source.",
+		 function );
+
+		goto on_error;
+	}
+	/* Combine the pages of the ranges
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( ranges[ range_index ].number_of_pages > ( INT_MAX - maximum_number_of_pages ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of pages value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		maximum_number_of_pages += ranges[ range_index ].number_of_pages;
+
+		if( ( page_scanner->file_header_offset == -1 )
+		 && ( ranges[ range_index ].file_header_offset != -1 ) )
+		{
+			page_scanner->file_header_offset    = ranges[ range_index ].file_header_offset;
+			page_scanner->file_header_page_size = ranges[ range_index ].file_header_page_size;
+		}
+	}
+	if( maximum_number_of_pages > 0 )
+	{
+		if( (size_t) maximum_number_of_pages > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( page_scanner_page_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of pages value exceeds maximum allocation size.",
+			 function );
+
+			goto on_error;
+		}
+		page_scanner->pages = (page_scanner_page_t *) memory_allocate(
+		                                               sizeof( page_scanner_page_t ) * maximum_number_of_pages );
+
+		if( page_scanner->pages == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create pages.",
+			 function );
+
+			goto on_error;
+		}
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( ranges[ range_index ].number_of_pages == 0 )
+			{
+				continue;
+			}
+			if( memory_copy(
+			     &( page_scanner->pages[ page_scanner->number_of_pages ] ),
+			     ranges[ range_index ].pages,
+			     sizeof( page_scanner_page_t ) * ranges[ range_index ].number_of_pages ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy pages of range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			page_scanner->number_of_pages += ranges[ range_index ].number_of_pages;
+		}
+	}
+	page_scanner_ranges_free(
+	 ranges,
+	 number_of_ranges );
+
+	ranges = NULL;
+
+	for( page_index = 0;
+	     page_index < page_scanner->number_of_pages;
+	     page_index++ )
+	{
+		for( page_size_index = 0;
+		     page_size_index < PAGE_SCANNER_NUMBER_OF_PAGE_SIZES;
+		     page_size_index++ )
+		{
+			if( page_scanner->pages[ page_index ].page_size == page_scanner_page_sizes[ page_size_index ] )
+			{
+				page_scanner->number_of_pages_per_page_size[ page_size_index ] += 1;
+
+				break;
+			}
+		}
+	}
+	/* The page size of the file header takes precedence over the most common page size
+	 */
+	if( page_scanner->file_header_offset != -1 )
+	{
+		page_scanner->database_page_size = page_scanner->file_header_page_size;
+	}
+	else
+	{
+		for( page_size_index = 0;
+		     page_size_index < PAGE_SCANNER_NUMBER_OF_PAGE_SIZES;
+		     page_size_index++ )
+		{
+			if( ( page_scanner->number_of_pages_per_page_size[ page_size_index ] > 0 )
+			 && ( ( page_scanner->database_page_size == 0 )
+			  || ( page_scanner->number_of_pages_per_page_size[ page_size_index ] > number_of_pages ) ) )
+			{
+				page_scanner->database_page_size = page_scanner_page_sizes[ page_size_index ];
+				number_of_pages                  = page_scanner->number_of_pages_per_page_size[ page_size_index ];
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( ranges != NULL )
+	{
+		page_scanner_ranges_free(
+		 ranges,
+		 number_of_ranges );
+	}
+	if( page_scanner->pages != NULL )
+	{
+		memory_free(
+		 page_scanner->pages );
+
+		page_scanner->pages = NULL;
+	}
+	page_scanner->number_of_pages = 0;
+
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares two pages by page size, father data page (FDP) object identifier, page number and offset
+ * Returns -1 if the first page is less than the second, 0 if equal or 1 if greater
+ */
+int page_scanner_page_compare_by_object(
+     const void *first_page,
+     const void *second_page )
+{
+	const page_scanner_page_t *first  = (const page_scanner_page_t *) first_page;
+	const page_scanner_page_t *second = (const page_scanner_page_t *) second_page;
+
+	if( first->page_size != second->page_size )
+	{
+		return( ( first->page_size < second->page_size ) ? -1 : 1 );
+	}
+	if( first->object_identifier != second->object_identifier )
+	{
+		return( ( first->object_identifier < second->object_identifier ) ? -1 : 1 );
+	}
+	if( first->page_number != second->page_number )
+	{
+		return( ( first->page_number < second->page_number ) ? -1 : 1 );
+	}
+	if( first->offset != second->offset )
+	{
+		return( ( first->offset < second->offset ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Compares two pages by page size, page number and offset
+ * Returns -1 if the first page is less than the second, 0 if equal or 1 if greater
+ */
+int page_scanner_page_compare_by_page_number(
+     const void *first_page,
+     const void *second_page )
+{
+	const page_scanner_page_t *first  = (const page_scanner_page_t *) first_page;
+	const page_scanner_page_t *second = (const page_scanner_page_t *) second_page;
+
+	if( first->page_size != second->page_size )
+	{
+		return( ( first->page_size < second->page_size ) ? -1 : 1 );
+	}
+	if( first->page_number != second->page_number )
+	{
+		return( ( first->page_number < second->page_number ) ? -1 : 1 );
+	}
+	if( first->offset != second->offset )
+	{
+		return( ( first->offset < second->offset ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Prints the scan results to a stream
+ * The pages of the database page size are grouped per father data page (FDP) object identifier
+ * Returns 1 if successful or -1 on error
+ */
+int page_scanner_fprint(
+     page_scanner_t *page_scanner,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	page_scanner_page_t *page  = NULL;
+	static char *function      = "page_scanner_fprint";
+	uint32_t first_page_number = 0;
+	uint32_t last_page_number  = 0;
+	uint32_t number_of_pages   = 0;
+	uint32_t object_identifier = 0;
+	int page_index             = 0;
+	int page_size_index        = 0;
+
+	if( page_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "Page scan:\n" );
+
+	fprintf(
+	 stream,
+	 "\tSource size:\t\t%" PRIu64 " bytes\n",
+	 page_scanner->source_size );
+
+	fprintf(
+	 stream,
+	 "\tAlignment:\t\t%" PRIu32 " bytes\n",
+	 page_scanner->alignment );
+
+	if( page_scanner->file_header_offset == -1 )
+	{
+		fprintf(
+		 stream,
+		 "\tFile header:\t\tN/A\n" );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "\tFile header:\t\tat offset: %" PRIi64 " (0x%08" PRIx64 ") with page size: %" PRIu32 "\n",
+		 page_scanner->file_header_offset,
+		 page_scanner->file_header_offset,
+		 page_scanner->file_header_page_size );
+	}
+	fprintf(
+	 stream,
+	 "\tNumber of pages:\t%d\n",
+	 page_scanner->number_of_pages );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "\tPage sizes:\n" );
+
+	for( page_size_index = 0;
+	     page_size_index < PAGE_SCANNER_NUMBER_OF_PAGE_SIZES;
+	     page_size_index++ )
+	{
+		fprintf(
+		 stream,
+		 "\t\t%-16" PRIu32 ": %d\n",
+		 page_scanner_page_sizes[ page_size_index ],
+		 page_scanner->number_of_pages_per_page_size[ page_size_index ] );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	if( page_scanner->number_of_pages == 0 )
+	{
+		return( 1 );
+	}
+	fprintf(
+	 stream,
+	 "\tDatabase page size:\t%" PRIu32 "\n",
+	 page_scanner->database_page_size );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	qsort(
+	 page_scanner->pages,
+	 (size_t) page_scanner->number_of_pages,
+	 sizeof( page_scanner_page_t ),
+	 &page_scanner_page_compare_by_object );
+
+	fprintf(
+	 stream,
+	 "\tObjects:\n" );
+
+	fprintf(
+	 stream,
+	 "\t\tIdentifier\tPages\t\tFirst page\tLast page\n" );
+
+	for( page_index = 0;
+	     page_index <= page_scanner->number_of_pages;
+	     page_index++ )
+	{
+		if( page_index < page_scanner->number_of_pages )
+		{
+			page = &( page_scanner->pages[ page_index ] );
+
+			if( page->page_size != page_scanner->database_page_size )
+			{
+				continue;
+			}
+		}
+		else
+		{
+			page = NULL;
+		}
+		if( ( number_of_pages > 0 )
+		 && ( ( page == NULL )
+		  || ( page->object_identifier != object_identifier ) ) )
+		{
+			fprintf(
+			 stream,
+			 "\t\t%-10" PRIu32 "\t%-10" PRIu32 "\t%-10" PRIu32 "\t%" PRIu32 "\n",
+			 object_identifier,
+			 number_of_pages,
+			 first_page_number,
+			 last_page_number );
+
+			number_of_pages = 0;
+		}
+		if( page == NULL )
+		{
+			break;
+		}
+		if( number_of_pages == 0 )
+		{
+			object_identifier = page->object_identifier;
+			first_page_number = page->page_number;
+		}
+		last_page_number = page->page_number;
+
+		number_of_pages++;
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Writes the database page size pages to a rebuilt database image
+ * Every page is written at the offset of its page number, which is ( page number + 1 ) * page size.
+ * The file header is written as the first two pages. If no file header was found a file header
+ * is created. Pages that were not found are filled with 0-byte values and of pages that were found
+ * multiple times the one at the lowest offset is used
+ * Returns 1 if successful or -1 on error
+ */
+int page_scanner_write_image(
+     page_scanner_t *page_scanner,
+     const system_character_t *target,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *source_file       = NULL;
+	FILE *stream                       = NULL;
+	page_scanner_page_t *page          = NULL;
+	uint8_t *page_data                 = NULL;
+	static char *function              = "page_scanner_write_image";
+	size_t data_offset                 = 0;
+	size_t write_count                 = 0;
+	ssize_t read_count                 = 0;
+	uint32_t calculated_xor32_checksum = 0;
+	uint32_t format_revision           = 0;
+	uint32_t last_page_number          = 0;
+	uint32_t value_32bit               = 0;
+	int page_index                     = 0;
+	int result                         = 0;
+
+	if( page_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_scanner->source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page scanner - missing source.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_scanner->database_page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page scanner - missing database page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target.",
+		 function );
+
+		return( -1 );
+	}
+	page_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * page_scanner->database_page_size );
+
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          source_file,
+	          page_scanner->source,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          source_file,
+	          page_scanner->source,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 page_scanner->source );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          target,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          target,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 target );
+
+		goto on_error;
+	}
+	if( page_scanner->file_header_offset != -1 )
+	{
+		if( libcfile_file_seek_offset(
+		     source_file,
+		     page_scanner->file_header_offset,
+		     SEEK_SET,
+		     error ) != page_scanner->file_header_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file header offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 page_scanner->file_header_offset,
+			 page_scanner->file_header_offset );
+
+			goto on_error;
+		}
+		read_count = libcfile_file_read_buffer(
+		              source_file,
+		              page_data,
+		              (size_t) page_scanner->database_page_size,
+		              error );
+
+		if( read_count != (ssize_t) page_scanner->database_page_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file header.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		/* Without a file header the format revision is derived from the pages,
+		 * format revisions before 0x11 only support page sizes of 4096 and 8192
+		 */
+		if( ( page_scanner->database_page_size == 4096 )
+		 || ( page_scanner->database_page_size == 8192 ) )
+		{
+			format_revision = 0x09;
+
+			for( page_index = 0;
+			     page_index < page_scanner->number_of_pages;
+			     page_index++ )
+			{
+				page = &( page_scanner->pages[ page_index ] );
+
+				if( ( page->page_size == page_scanner->database_page_size )
+				 && ( ( page->page_flags & PAGE_SCANNER_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 ) )
+				{
+					format_revision = 0x0c;
+
+					break;
+				}
+			}
+		}
+		else
+		{
+			format_revision = 0x11;
+		}
+		if( memory_set(
+		     page_data,
+		     0,
+		     (size_t) page_scanner->database_page_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear page data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( page_data[ 4 ] ),
+		     page_scanner_file_signature,
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy file signature.",
+			 function );
+
+			goto on_error;
+		}
+		/* The format version, the database state of a clean shutdown,
+		 * the format revision and the page size
+		 */
+		byte_stream_copy_from_uint32_little_endian(
+		 &( page_data[ 8 ] ),
+		 0x620 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( page_data[ 52 ] ),
+		 3 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( page_data[ 232 ] ),
+		 format_revision );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( page_data[ 236 ] ),
+		 page_scanner->database_page_size );
+
+		calculated_xor32_checksum = 0x89abcdef;
+
+		for( data_offset = 4;
+		     data_offset < PAGE_SCANNER_FILE_HEADER_SIZE;
+		     data_offset += 4 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( page_data[ data_offset ] ),
+			 value_32bit );
+
+			calculated_xor32_checksum ^= value_32bit;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 page_data,
+		 calculated_xor32_checksum );
+	}
+	/* The file header is followed by its backup
+	 */
+	for( page_index = 0;
+	     page_index < 2;
+	     page_index++ )
+	{
+		write_count = file_stream_write(
+		               stream,
+		               page_data,
+		               (size_t) page_scanner->database_page_size );
+
+		if( write_count != (size_t) page_scanner->database_page_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write file header.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	qsort(
+	 page_scanner->pages,
+	 (size_t) page_scanner->number_of_pages,
+	 sizeof( page_scanner_page_t ),
+	 &page_scanner_page_compare_by_page_number );
+
+	for( page_index = 0;
+	     page_index < page_scanner->number_of_pages;
+	     page_index++ )
+	{
+		if( page_scanner->abort != 0 )
+		{
+			break;
+		}
+		page = &( page_scanner->pages[ page_index ] );
+
+		if( ( page->page_size != page_scanner->database_page_size )
+		 || ( page->page_number <= last_page_number ) )
+		{
+			continue;
+		}
+		if( memory_set(
+		     page_data,
+		     0,
+		     (size_t) page_scanner->database_page_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear page data.",
+			 function );
+
+			goto on_error;
+		}
+		while( ( last_page_number + 1 ) < page->page_number )
+		{
+			write_count = file_stream_write(
+			               stream,
+			               page_data,
+			               (size_t) page_scanner->database_page_size );
+
+			if( write_count != (size_t) page_scanner->database_page_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write empty page: %" PRIu32 ".",
+				 function,
+				 last_page_number + 1 );
+
+				goto on_error;
+			}
+			last_page_number++;
+		}
+		if( libcfile_file_seek_offset(
+		     source_file,
+		     page->offset,
+		     SEEK_SET,
+		     error ) != page->offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek page offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 page->offset,
+			 page->offset );
+
+			goto on_error;
+		}
+		read_count = libcfile_file_read_buffer(
+		              source_file,
+		              page_data,
+		              (size_t) page_scanner->database_page_size,
+		              error );
+
+		if( read_count != (ssize_t) page_scanner->database_page_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page: %" PRIu32 ".",
+			 function,
+			 page->page_number );
+
+			goto on_error;
+		}
+		write_count = file_stream_write(
+		               stream,
+		               page_data,
+		               (size_t) page_scanner->database_page_size );
+
+		if( write_count != (size_t) page_scanner->database_page_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write page: %" PRIu32 ".",
+			 function,
+			 page->page_number );
+
+			goto on_error;
+		}
+		last_page_number = page->page_number;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close: %" PRIs_SYSTEM ".",
+		 function,
+		 target );
+
+		stream = NULL;
+
+		goto on_error;
+	}
+	stream = NULL;
+
+	if( libcfile_file_close(
+	     source_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 page_data );
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	if( page_data != NULL )
+	{
+		memory_free(
+		 page_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,264 @@
+/*
+ * Page scanner functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PAGE_SCANNER_H )
+#define _PAGE_SCANNER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define PAGE_SCANNER_NUMBER_OF_PAGE_SIZES		5
+
+#define PAGE_SCANNER_MAXIMUM_NUMBER_OF_THREADS		32
+
+/* The size of the data that is scanned per read, the data of a read
+ * is extended by the maximum page size to detect pages that cross the end
+ */
+#define PAGE_SCANNER_READ_SIZE				( 1024 * 1024 )
+
+/* The size of the file header data that is covered by its checksum
+ */
+#define PAGE_SCANNER_FILE_HEADER_SIZE			668
+
+/* The page flag that indicates the page uses the new record format and ECC-32 checksum
+ */
+#define PAGE_SCANNER_PAGE_FLAG_IS_NEW_RECORD_FORMAT	0x00002000UL
+
+typedef struct page_scanner_page page_scanner_page_t;
+
+struct page_scanner_page
+{
+	/* The offset of the page in the source
+	 */
+	off64_t offset;
+
+	/* The page size
+	 */
+	uint32_t page_size;
+
+	/* The page number
+	 */
+	uint32_t page_number;
+
+	/* The father data page (FDP) object identifier
+	 */
+	uint32_t object_identifier;
+
+	/* The page flags
+	 */
+	uint32_t page_flags;
+};
+
+typedef struct page_scanner_range page_scanner_range_t;
+
+struct page_scanner_range
+{
+	/* The start offset of the range
+	 */
+	off64_t start_offset;
+
+	/* The end offset of the range
+	 */
+	off64_t end_offset;
+
+	/* The pages found in the range
+	 */
+	page_scanner_page_t *pages;
+
+	/* The number of pages
+	 */
+	int number_of_pages;
+
+	/* The maximum number of pages
+	 */
+	int maximum_number_of_pages;
+
+	/* The offset of the first file header found in the range or -1 if none
+	 */
+	off64_t file_header_offset;
+
+	/* The page size of the file header
+	 */
+	uint32_t file_header_page_size;
+
+	/* The result of the scan of the range
+	 * 0 if the scan did not run, 1 if successful or -1 on error
+	 */
+	int result;
+
+	/* The error of the scan of the range
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct page_scanner page_scanner_t;
+
+struct page_scanner
+{
+	/* The source filename
+	 */
+	const system_character_t *source;
+
+	/* The source size
+	 */
+	size64_t source_size;
+
+	/* The page size to scan for or 0 to scan for all supported page sizes
+	 */
+	uint32_t page_size;
+
+	/* The alignment of the pages in the source
+	 */
+	uint32_t alignment;
+
+	/* The number of threads used to scan the source
+	 */
+	int number_of_threads;
+
+	/* The pages found in the source
+	 */
+	page_scanner_page_t *pages;
+
+	/* The number of pages
+	 */
+	int number_of_pages;
+
+	/* The number of pages per page size
+	 */
+	int number_of_pages_per_page_size[ PAGE_SCANNER_NUMBER_OF_PAGE_SIZES ];
+
+	/* The offset of the file header or -1 if not found
+	 */
+	off64_t file_header_offset;
+
+	/* The page size of the file header
+	 */
+	uint32_t file_header_page_size;
+
+	/* The page size of the database, which is that of the file header
+	 * or otherwise the most common page size
+	 */
+	uint32_t database_page_size;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int page_scanner_initialize(
+     page_scanner_t **page_scanner,
+     libcerror_error_t **error );
+
+int page_scanner_free(
+     page_scanner_t **page_scanner,
+     libcerror_error_t **error );
+
+int page_scanner_signal_abort(
+     page_scanner_t *page_scanner,
+     libcerror_error_t **error );
+
+int page_scanner_set_page_size(
+     page_scanner_t *page_scanner,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int page_scanner_set_alignment(
+     page_scanner_t *page_scanner,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int page_scanner_set_number_of_threads(
+     page_scanner_t *page_scanner,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int page_scanner_check_file_header(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *page_size,
+     libcerror_error_t **error );
+
+int page_scanner_range_append_page(
+     page_scanner_range_t *range,
+     off64_t offset,
+     uint32_t page_size,
+     uint32_t page_number,
+     uint32_t object_identifier,
+     uint32_t page_flags,
+     libcerror_error_t **error );
+
+int page_scanner_scan_range(
+     page_scanner_t *page_scanner,
+     page_scanner_range_t *range,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int page_scanner_range_job(
+     page_scanner_range_t *range,
+     page_scanner_t *page_scanner );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+void page_scanner_ranges_free(
+      page_scanner_range_t *ranges,
+      int number_of_ranges );
+
+int page_scanner_scan(
+     page_scanner_t *page_scanner,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+int page_scanner_page_compare_by_object(
+     const void *first_page,
+     const void *second_page );
+
+int page_scanner_page_compare_by_page_number(
+     const void *first_page,
+     const void *second_page );
+
+int page_scanner_fprint(
+     page_scanner_t *page_scanner,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int page_scanner_write_image(
+     page_scanner_t *page_scanner,
+     const system_character_t *target,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PAGE_SCANNER_H ) */
+
@@ -0,0 +1,559 @@
+/*
+ * Process status functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <time.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+#include "process_status.h"
+
+/* Creates a process status
+ * Make sure the value process_status is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int process_status_initialize(
+     process_status_t **process_status,
+     FILE *output_stream,
+     uint8_t print_status_information,
+     libcerror_error_t **error )
+{
+	static char *function = "process_status_initialize";
+
+	if( process_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process status.",
+		 function );
+
+		return( -1 );
+	}
+	if( *process_status != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid process status value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*process_status = memory_allocate_structure(
+	                   process_status_t );
+
+	if( *process_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *process_status,
+	     0,
+	     sizeof( process_status_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear process status.",
+		 function );
+
+		goto on_error;
+	}
+	( *process_status )->output_stream            = output_stream;
+	( *process_status )->print_status_information = print_status_information;
+
+	return( 1 );
+
+on_error:
+	if( *process_status != NULL )
+	{
+		memory_free(
+		 *process_status );
+
+		*process_status = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a process status
+ * Returns 1 if successful or -1 on error
+ */
+int process_status_free(
+     process_status_t **process_status,
+     libcerror_error_t **error )
+{
+	static char *function = "process_status_free";
+
+	if( process_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process status.",
+		 function );
+
+		return( -1 );
+	}
+	if( *process_status != NULL )
+	{
+		memory_free(
+		 *process_status );
+
+		*process_status = NULL;
+	}
+	return( 1 );
+}
+
+/* Starts the process status of a table
+ * The statistics of the input file are reported relative to the start
+ * Returns 1 if successful or -1 on error
+ */
+int process_status_start(
+     process_status_t *process_status,
+     libesedb_file_t *input_file,
+     const system_character_t *table_name,
+     int number_of_records,
+     int first_record_index,
+     off64_t start_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "process_status_start";
+
+	if( process_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process status.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     process_status->start_statistics,
+	     0,
+	     sizeof( uint64_t ) * LIBESEDB_NUMBER_OF_STATISTICS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear start statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_file != NULL )
+	{
+		if( libesedb_file_get_statistics(
+		     input_file,
+		     process_status->start_statistics,
+		     LIBESEDB_NUMBER_OF_STATISTICS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve statistics of input file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	process_status->input_file         = input_file;
+	process_status->table_name         = table_name;
+	process_status->number_of_records  = number_of_records;
+	process_status->first_record_index = first_record_index;
+	process_status->start_offset       = start_offset;
+	process_status->start_timestamp    = time( NULL );
+	process_status->last_timestamp     = process_status->start_timestamp;
+
+	if( ( process_status->print_status_information != 0 )
+	 && ( process_status->output_stream != NULL ) )
+	{
+		if( first_record_index > 0 )
+		{
+			fprintf(
+			 process_status->output_stream,
+			 "Exporting table: %" PRIs_SYSTEM " with %d records from record: %d.\n",
+			 table_name,
+			 number_of_records,
+			 first_record_index );
+		}
+		else
+		{
+			fprintf(
+			 process_status->output_stream,
+			 "Exporting table: %" PRIs_SYSTEM " with %d records.\n",
+			 table_name,
+			 number_of_records );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the statistics of the input file since the start of the process status
+ * The statistics are indexed by the LIBESEDB_STATISTIC definitions
+ * and statistics must contain at least LIBESEDB_NUMBER_OF_STATISTICS values
+ * Returns 1 if successful or -1 on error
+ */
+int process_status_get_statistics(
+     process_status_t *process_status,
+     uint64_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "process_status_get_statistics";
+	int statistic_index   = 0;
+
+	if( process_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process status.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     statistics,
+	     0,
+	     sizeof( uint64_t ) * LIBESEDB_NUMBER_OF_STATISTICS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( process_status->input_file == NULL )
+	{
+		return( 1 );
+	}
+	if( libesedb_file_get_statistics(
+	     process_status->input_file,
+	     statistics,
+	     LIBESEDB_NUMBER_OF_STATISTICS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics of input file.",
+		 function );
+
+		return( -1 );
+	}
+	/* The statistics of the input file could have been reset since the start
+	 */
+	for( statistic_index = 0;
+	     statistic_index < LIBESEDB_NUMBER_OF_STATISTICS;
+	     statistic_index++ )
+	{
+		if( statistic_index == LIBESEDB_STATISTIC_PAGES_CACHE_MAXIMUM_SIZE )
+		{
+			continue;
+		}
+		if( statistics[ statistic_index ] >= process_status->start_statistics[ statistic_index ] )
+		{
+			statistics[ statistic_index ] -= process_status->start_statistics[ statistic_index ];
+		}
+	}
+	return( 1 );
+}
+
+/* Updates the process status
+ * The status is printed at most once every PROCESS_STATUS_UPDATE_INTERVAL seconds
+ * Returns 1 if successful or -1 on error
+ */
+int process_status_update(
+     process_status_t *process_status,
+     int record_index,
+     libcerror_error_t **error )
+{
+	uint64_t statistics[ LIBESEDB_NUMBER_OF_STATISTICS ];
+
+	static char *function       = "process_status_update";
+	time_t current_timestamp    = 0;
+	uint64_t bytes_per_second   = 0;
+	uint64_t cache_lookups      = 0;
+	uint64_t records_per_second = 0;
+	int64_t number_of_seconds   = 0;
+	int64_t remaining_seconds   = 0;
+	int cache_hit_percentage    = 0;
+	int number_of_records       = 0;
+	int percentage              = 0;
+
+	if( process_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process status.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( process_status->print_status_information == 0 )
+	 || ( process_status->output_stream == NULL ) )
+	{
+		return( 1 );
+	}
+	current_timestamp = time( NULL );
+
+	if( ( current_timestamp - process_status->last_timestamp ) < PROCESS_STATUS_UPDATE_INTERVAL )
+	{
+		return( 1 );
+	}
+	process_status->last_timestamp = current_timestamp;
+
+	/* The statistics are only retrieved when the status is printed
+	 */
+	if( process_status_get_statistics(
+	     process_status,
+	     statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds = (int64_t) ( current_timestamp - process_status->start_timestamp );
+	number_of_records = record_index - process_status->first_record_index;
+
+	if( number_of_seconds > 0 )
+	{
+		records_per_second = (uint64_t) number_of_records / (uint64_t) number_of_seconds;
+		bytes_per_second   = statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGE_BYTES_READ ] / (uint64_t) number_of_seconds;
+	}
+	cache_lookups = statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_HITS ]
+	              + statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_MISSES ];
+
+	if( cache_lookups > 0 )
+	{
+		cache_hit_percentage = (int) ( ( statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_HITS ] * 100 ) / cache_lookups );
+	}
+	if( process_status->number_of_records > 0 )
+	{
+		percentage = (int) ( ( (int64_t) record_index * 100 ) / process_status->number_of_records );
+	}
+	/* The estimated time of completion is based on the average rate since the start
+	 */
+	if( number_of_records > 0 )
+	{
+		remaining_seconds = ( (int64_t) ( process_status->number_of_records - record_index ) * number_of_seconds ) / number_of_records;
+	}
+	fprintf(
+	 process_status->output_stream,
+	 "Status: exported %d of %d records (%d%%) of table: %" PRIs_SYSTEM "\n"
+	 "        %" PRIu64 " records/second with %" PRIu64 ".%" PRIu64 " MiB/second read, %" PRIu64 " pages read, %d%% page cache hits\n"
+	 "        and %" PRIu64 " bytes decompressed, completion in %02" PRIi64 ":%02d:%02d\n",
+	 record_index,
+	 process_status->number_of_records,
+	 percentage,
+	 process_status->table_name,
+	 records_per_second,
+	 bytes_per_second / ( 1024 * 1024 ),
+	 ( ( bytes_per_second % ( 1024 * 1024 ) ) * 10 ) / ( 1024 * 1024 ),
+	 statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGES_READ ],
+	 cache_hit_percentage,
+	 statistics[ LIBESEDB_STATISTIC_NUMBER_OF_7BIT_DECOMPRESSED_BYTES ] + statistics[ LIBESEDB_STATISTIC_NUMBER_OF_LZXPRESS_DECOMPRESSED_BYTES ],
+	 remaining_seconds / 3600,
+	 (int) ( ( remaining_seconds / 60 ) % 60 ),
+	 (int) ( remaining_seconds % 60 ) );
+
+	return( 1 );
+}
+
+/* Stops the process status and prints a summary of the table
+ * Returns 1 if successful or -1 on error
+ */
+int process_status_stop(
+     process_status_t *process_status,
+     int record_index,
+     off64_t output_offset,
+     int status,
+     libcerror_error_t **error )
+{
+	uint64_t statistics[ LIBESEDB_NUMBER_OF_STATISTICS ];
+
+	const char *status_string   = NULL;
+	static char *function       = "process_status_stop";
+	time_t current_timestamp    = 0;
+	uint64_t bytes_per_second   = 0;
+	uint64_t cache_lookups      = 0;
+	uint64_t records_per_second = 0;
+	int64_t number_of_seconds   = 0;
+	int cache_hit_percentage    = 0;
+	int number_of_records       = 0;
+
+	if( process_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process status.",
+		 function );
+
+		return( -1 );
+	}
+	if( status == PROCESS_STATUS_ABORTED )
+	{
+		status_string = "aborted";
+	}
+	else if( status == PROCESS_STATUS_COMPLETED )
+	{
+		status_string = "completed";
+	}
+	else if( status == PROCESS_STATUS_FAILED )
+	{
+		status_string = "failed";
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported status.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( process_status->print_status_information == 0 )
+	 || ( process_status->output_stream == NULL )
+	 || ( process_status->table_name == NULL ) )
+	{
+		return( 1 );
+	}
+	if( process_status_get_statistics(
+	     process_status,
+	     statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	current_timestamp = time( NULL );
+
+	number_of_seconds = (int64_t) ( current_timestamp - process_status->start_timestamp );
+	number_of_records = record_index - process_status->first_record_index;
+
+	if( output_offset < process_status->start_offset )
+	{
+		output_offset = process_status->start_offset;
+	}
+	if( number_of_seconds > 0 )
+	{
+		records_per_second = (uint64_t) number_of_records / (uint64_t) number_of_seconds;
+		bytes_per_second   = statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGE_BYTES_READ ] / (uint64_t) number_of_seconds;
+	}
+	else
+	{
+		records_per_second = (uint64_t) number_of_records;
+		bytes_per_second   = statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGE_BYTES_READ ];
+	}
+	cache_lookups = statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_HITS ]
+	              + statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_MISSES ];
+
+	if( cache_lookups > 0 )
+	{
+		cache_hit_percentage = (int) ( ( statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_HITS ] * 100 ) / cache_lookups );
+	}
+	fprintf(
+	 process_status->output_stream,
+	 "Export of table: %" PRIs_SYSTEM " %s in %02" PRIi64 ":%02d:%02d with %d records (%" PRIu64 " records/second) and %" PRIi64 " bytes written.\n"
+	 "Read %" PRIu64 " pages (%" PRIu64 ".%" PRIu64 " MiB/second) with %d%% page cache hits and decompressed %" PRIu64 " bytes.\n",
+	 process_status->table_name,
+	 status_string,
+	 number_of_seconds / 3600,
+	 (int) ( ( number_of_seconds / 60 ) % 60 ),
+	 (int) ( number_of_seconds % 60 ),
+	 number_of_records,
+	 records_per_second,
+	 (int64_t) ( output_offset - process_status->start_offset ),
+	 statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGES_READ ],
+	 bytes_per_second / ( 1024 * 1024 ),
+	 ( ( bytes_per_second % ( 1024 * 1024 ) ) * 10 ) / ( 1024 * 1024 ),
+	 cache_hit_percentage,
+	 statistics[ LIBESEDB_STATISTIC_NUMBER_OF_7BIT_DECOMPRESSED_BYTES ] + statistics[ LIBESEDB_STATISTIC_NUMBER_OF_LZXPRESS_DECOMPRESSED_BYTES ] );
+
+	return( 1 );
+}
@@ -0,0 +1,135 @@
+/*
+ * Process status functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PROCESS_STATUS_H )
+#define _PROCESS_STATUS_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include <time.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of seconds between status updates
+ */
+#define PROCESS_STATUS_UPDATE_INTERVAL		5
+
+enum PROCESS_STATUS
+{
+	PROCESS_STATUS_ABORTED			= (int) 'a',
+	PROCESS_STATUS_COMPLETED		= (int) 'c',
+	PROCESS_STATUS_FAILED			= (int) 'f'
+};
+
+typedef struct process_status process_status_t;
+
+struct process_status
+{
+	/* The status output stream
+	 */
+	FILE *output_stream;
+
+	/* Value to indicate if the status information should be printed
+	 */
+	uint8_t print_status_information;
+
+	/* The input file of which the statistics are reported
+	 */
+	libesedb_file_t *input_file;
+
+	/* The name of the table that is processed
+	 */
+	const system_character_t *table_name;
+
+	/* The number of records of the table
+	 */
+	int number_of_records;
+
+	/* The index of the first record that is processed
+	 */
+	int first_record_index;
+
+	/* The output offset at the start
+	 */
+	off64_t start_offset;
+
+	/* The statistics of the input file at the start
+	 */
+	uint64_t start_statistics[ LIBESEDB_NUMBER_OF_STATISTICS ];
+
+	/* The start timestamp
+	 */
+	time_t start_timestamp;
+
+	/* The last status update timestamp
+	 */
+	time_t last_timestamp;
+};
+
+int process_status_initialize(
+     process_status_t **process_status,
+     FILE *output_stream,
+     uint8_t print_status_information,
+     libcerror_error_t **error );
+
+int process_status_free(
+     process_status_t **process_status,
+     libcerror_error_t **error );
+
+int process_status_start(
+     process_status_t *process_status,
+     libesedb_file_t *input_file,
+     const system_character_t *table_name,
+     int number_of_records,
+     int first_record_index,
+     off64_t start_offset,
+     libcerror_error_t **error );
+
+int process_status_get_statistics(
+     process_status_t *process_status,
+     uint64_t *statistics,
+     libcerror_error_t **error );
+
+int process_status_update(
+     process_status_t *process_status,
+     int record_index,
+     libcerror_error_t **error );
+
+int process_status_stop(
+     process_status_t *process_status,
+     int record_index,
+     off64_t output_offset,
+     int status,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PROCESS_STATUS_H ) */
+
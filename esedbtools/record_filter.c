@@ -0,0 +1,1591 @@
+/*
+ * Record filter
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_system_string.h"
+#include "record_filter.h"
+
+#define record_filter_is_whitespace( character ) \
+	( ( ( character ) == (system_character_t) ' ' ) || ( ( character ) == (system_character_t) '\t' ) )
+
+#define record_filter_is_operator( character ) \
+	( ( ( character ) == (system_character_t) '=' ) || ( ( character ) == (system_character_t) '!' ) \
+	 || ( ( character ) == (system_character_t) '<' ) || ( ( character ) == (system_character_t) '>' ) )
+
+/* Creates a record filter
+ * Make sure the value record_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int record_filter_initialize(
+     record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "record_filter_initialize";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*record_filter = memory_allocate_structure(
+	                  record_filter_t );
+
+	if( *record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_filter,
+	     0,
+	     sizeof( record_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record filter.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_filter )->condition_value_entry = -1;
+
+	return( 1 );
+
+on_error:
+	if( *record_filter != NULL )
+	{
+		memory_free(
+		 *record_filter );
+
+		*record_filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record filter
+ * Returns 1 if successful or -1 on error
+ */
+int record_filter_free(
+     record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "record_filter_free";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		if( ( *record_filter )->value_entries != NULL )
+		{
+			memory_free(
+			 ( *record_filter )->value_entries );
+		}
+		if( ( *record_filter )->condition_value_string != NULL )
+		{
+			memory_free(
+			 ( *record_filter )->condition_value_string );
+		}
+		if( ( *record_filter )->value_string != NULL )
+		{
+			memory_free(
+			 ( *record_filter )->value_string );
+		}
+		memory_free(
+		 *record_filter );
+
+		*record_filter = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the entry and type of a column of a table by its name
+ * The column is looked up by its exact name first, otherwise the name is compared case insensitive
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int record_filter_get_column_by_name(
+     libesedb_table_t *table,
+     const system_character_t *column_name,
+     size_t column_name_length,
+     int *column_entry,
+     uint32_t *column_type,
+     libcerror_error_t **error )
+{
+	system_character_t name[ 256 ];
+
+	libesedb_column_t *column  = NULL;
+	static char *function      = "record_filter_get_column_by_name";
+	size_t name_size           = 0;
+	uint32_t column_identifier = 0;
+	uint32_t identifier        = 0;
+	int column_iterator        = 0;
+	int exact_match            = 0;
+	int number_of_columns      = 0;
+	int result                 = 0;
+
+	if( column_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column name.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column type.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name hash table of the table is used to look up a column with the exact name
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	exact_match = libesedb_table_get_column_by_utf16_name(
+	               table,
+	               (uint16_t *) column_name,
+	               column_name_length,
+	               &column,
+	               0,
+	               error );
+#else
+	exact_match = libesedb_table_get_column_by_utf8_name(
+	               table,
+	               (uint8_t *) column_name,
+	               column_name_length,
+	               &column,
+	               0,
+	               error );
+#endif
+	if( exact_match == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column by name.",
+		 function );
+
+		goto on_error;
+	}
+	else if( exact_match != 0 )
+	{
+		if( libesedb_column_get_identifier(
+		     column,
+		     &column_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_column_free(
+		     &column,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_table_get_number_of_columns(
+	     table,
+	     &number_of_columns,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of columns.",
+		 function );
+
+		goto on_error;
+	}
+	/* The record value entries correspond with the columns including those of the template table
+	 * if the column was found by its exact name only its identifier needs to be compared
+	 */
+	for( column_iterator = 0;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
+	{
+		if( libesedb_table_get_column(
+		     table,
+		     column_iterator,
+		     &column,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 column_iterator );
+
+			goto on_error;
+		}
+		if( exact_match != 0 )
+		{
+			if( libesedb_column_get_identifier(
+			     column,
+			     &identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column: %d identifier.",
+				 function,
+				 column_iterator );
+
+				goto on_error;
+			}
+			result = (int) ( identifier == column_identifier );
+		}
+		else
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libesedb_column_get_utf16_name_size(
+			          column,
+			          &name_size,
+			          error );
+#else
+			result = libesedb_column_get_utf8_name_size(
+			          column,
+			          &name_size,
+			          error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the size of the column name.",
+				 function );
+
+				goto on_error;
+			}
+			result = 0;
+
+			if( ( name_size == ( column_name_length + 1 ) )
+			 && ( name_size <= 256 ) )
+			{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libesedb_column_get_utf16_name(
+				          column,
+				          (uint16_t *) name,
+				          name_size,
+				          error );
+#else
+				result = libesedb_column_get_utf8_name(
+				          column,
+				          (uint8_t *) name,
+				          name_size,
+				          error );
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve the column name.",
+					 function );
+
+					goto on_error;
+				}
+				if( system_string_compare_no_case(
+				     name,
+				     column_name,
+				     column_name_length ) != 0 )
+				{
+					result = 0;
+				}
+			}
+		}
+		if( result == 1 )
+		{
+			if( libesedb_column_get_type(
+			     column,
+			     column_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column: %d type.",
+				 function,
+				 column_iterator );
+
+				goto on_error;
+			}
+			*column_entry = column_iterator;
+		}
+		if( libesedb_column_free(
+		     &column,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == 1 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the selected columns from a comma separated list of column names
+ * Returns 1 if successful or -1 on error
+ */
+int record_filter_set_columns(
+     record_filter_t *record_filter,
+     libesedb_table_t *table,
+     const system_character_t *column_names,
+     size_t column_names_length,
+     libcerror_error_t **error )
+{
+	system_character_t *column_name   = NULL;
+	system_character_t *names_string  = NULL;
+	static char *function             = "record_filter_set_columns";
+	size_t column_name_length         = 0;
+	size_t string_index               = 0;
+	uint32_t column_type              = 0;
+	int column_entry                  = 0;
+	int number_of_column_names        = 1;
+	int result                        = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_filter->value_entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record filter - value entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column names.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_names_length == 0 )
+	 || ( column_names_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column names length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Create a copy of the column names so that every name can be terminated
+	 */
+	names_string = system_string_allocate(
+	                column_names_length + 1 );
+
+	if( names_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column names string.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     names_string,
+	     column_names,
+	     column_names_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy column names string.",
+		 function );
+
+		goto on_error;
+	}
+	names_string[ column_names_length ] = 0;
+
+	for( string_index = 0;
+	     string_index < column_names_length;
+	     string_index++ )
+	{
+		if( names_string[ string_index ] == (system_character_t) ',' )
+		{
+			names_string[ string_index ] = 0;
+
+			number_of_column_names++;
+		}
+	}
+	if( number_of_column_names > ( INT32_MAX / (int) sizeof( int ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of column names value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	record_filter->value_entries = (int *) memory_allocate(
+	                                        sizeof( int ) * number_of_column_names );
+
+	if( record_filter->value_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value entries.",
+		 function );
+
+		goto on_error;
+	}
+	record_filter->number_of_value_entries = 0;
+
+	column_name = names_string;
+
+	while( column_name <= &( names_string[ column_names_length ] ) )
+	{
+		/* Ignore surrounding white space
+		 */
+		while( record_filter_is_whitespace( *column_name ) )
+		{
+			column_name++;
+		}
+		column_name_length = system_string_length(
+		                      column_name );
+
+		while( ( column_name_length > 0 )
+		    && record_filter_is_whitespace( column_name[ column_name_length - 1 ] ) )
+		{
+			column_name_length--;
+		}
+		if( column_name_length == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_MISSING,
+			 "%s: missing column name: %d.",
+			 function,
+			 record_filter->number_of_value_entries );
+
+			goto on_error;
+		}
+		result = record_filter_get_column_by_name(
+		          table,
+		          column_name,
+		          column_name_length,
+		          &column_entry,
+		          &column_type,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %" PRIs_SYSTEM ".",
+			 function,
+			 column_name );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: no such column: %" PRIs_SYSTEM " in table.",
+			 function,
+			 column_name );
+
+			goto on_error;
+		}
+		record_filter->value_entries[ record_filter->number_of_value_entries ] = column_entry;
+
+		record_filter->number_of_value_entries += 1;
+
+		column_name += system_string_length(
+		                column_name ) + 1;
+	}
+	memory_free(
+	 names_string );
+
+	return( 1 );
+
+on_error:
+	if( record_filter->value_entries != NULL )
+	{
+		memory_free(
+		 record_filter->value_entries );
+
+		record_filter->value_entries = NULL;
+	}
+	record_filter->number_of_value_entries = 0;
+
+	if( names_string != NULL )
+	{
+		memory_free(
+		 names_string );
+	}
+	return( -1 );
+}
+
+/* Parses a condition of the form: column_name operator value
+ * where operator is one of: =, ==, !=, <>, <, <=, >, >=
+ * and the value optionally is enclosed in single or double quotes
+ * Returns 1 if successful, 0 if the condition is not supported or -1 on error
+ */
+int record_filter_parse_condition(
+     const system_character_t *condition,
+     size_t condition_length,
+     size_t *column_name_offset,
+     size_t *column_name_length,
+     uint8_t *condition_operator,
+     size_t *value_offset,
+     size_t *value_length,
+     libcerror_error_t **error )
+{
+	static char *function              = "record_filter_parse_condition";
+	size_t string_index                = 0;
+	size_t value_end_index             = 0;
+	system_character_t first_character = 0;
+	system_character_t last_character  = 0;
+
+	if( condition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition.",
+		 function );
+
+		return( -1 );
+	}
+	if( condition_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid condition length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_name_offset == NULL )
+	 || ( column_name_length == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column name offset or length.",
+		 function );
+
+		return( -1 );
+	}
+	if( condition_operator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid condition operator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_offset == NULL )
+	 || ( value_length == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value offset or length.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( string_index < condition_length )
+	    && record_filter_is_whitespace( condition[ string_index ] ) )
+	{
+		string_index++;
+	}
+	*column_name_offset = string_index;
+
+	while( ( string_index < condition_length )
+	    && ( record_filter_is_whitespace( condition[ string_index ] ) == 0 )
+	    && ( record_filter_is_operator( condition[ string_index ] ) == 0 ) )
+	{
+		string_index++;
+	}
+	*column_name_length = string_index - *column_name_offset;
+
+	while( ( string_index < condition_length )
+	    && record_filter_is_whitespace( condition[ string_index ] ) )
+	{
+		string_index++;
+	}
+	if( ( *column_name_length == 0 )
+	 || ( string_index >= condition_length ) )
+	{
+		return( 0 );
+	}
+	first_character = condition[ string_index++ ];
+	last_character  = 0;
+
+	if( ( string_index < condition_length )
+	 && record_filter_is_operator( condition[ string_index ] ) )
+	{
+		last_character = condition[ string_index++ ];
+	}
+	switch( first_character )
+	{
+		case (system_character_t) '=':
+			if( ( last_character != 0 )
+			 && ( last_character != (system_character_t) '=' ) )
+			{
+				return( 0 );
+			}
+			*condition_operator = RECORD_FILTER_OPERATOR_EQUAL;
+			break;
+
+		case (system_character_t) '!':
+			if( last_character != (system_character_t) '=' )
+			{
+				return( 0 );
+			}
+			*condition_operator = RECORD_FILTER_OPERATOR_NOT_EQUAL;
+			break;
+
+		case (system_character_t) '<':
+			if( last_character == 0 )
+			{
+				*condition_operator = RECORD_FILTER_OPERATOR_LESS;
+			}
+			else if( last_character == (system_character_t) '=' )
+			{
+				*condition_operator = RECORD_FILTER_OPERATOR_LESS_EQUAL;
+			}
+			else if( last_character == (system_character_t) '>' )
+			{
+				*condition_operator = RECORD_FILTER_OPERATOR_NOT_EQUAL;
+			}
+			else
+			{
+				return( 0 );
+			}
+			break;
+
+		case (system_character_t) '>':
+			if( last_character == 0 )
+			{
+				*condition_operator = RECORD_FILTER_OPERATOR_GREATER;
+			}
+			else if( last_character == (system_character_t) '=' )
+			{
+				*condition_operator = RECORD_FILTER_OPERATOR_GREATER_EQUAL;
+			}
+			else
+			{
+				return( 0 );
+			}
+			break;
+
+		default:
+			return( 0 );
+	}
+	while( ( string_index < condition_length )
+	    && record_filter_is_whitespace( condition[ string_index ] ) )
+	{
+		string_index++;
+	}
+	value_end_index = condition_length;
+
+	while( ( value_end_index > string_index )
+	    && record_filter_is_whitespace( condition[ value_end_index - 1 ] ) )
+	{
+		value_end_index--;
+	}
+	if( ( value_end_index - string_index ) >= 2 )
+	{
+		first_character = condition[ string_index ];
+		last_character  = condition[ value_end_index - 1 ];
+
+		if( ( first_character == last_character )
+		 && ( ( first_character == (system_character_t) '"' )
+		  ||  ( first_character == (system_character_t) '\'' ) ) )
+		{
+			string_index++;
+			value_end_index--;
+		}
+	}
+	*value_offset = string_index;
+	*value_length = value_end_index - string_index;
+
+	return( 1 );
+}
+
+/* Sets the condition that records need to match
+ * Returns 1 if successful or -1 on error
+ */
+int record_filter_set_condition(
+     record_filter_t *record_filter,
+     libesedb_table_t *table,
+     const system_character_t *condition,
+     size_t condition_length,
+     libcerror_error_t **error )
+{
+	const system_character_t *value_string = NULL;
+	static char *function                  = "record_filter_set_condition";
+	size_t column_name_length              = 0;
+	size_t column_name_offset              = 0;
+	size_t value_length                    = 0;
+	size_t value_offset                    = 0;
+	uint64_t value_64bit                   = 0;
+	int result                             = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_filter->condition_value_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record filter - condition value string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = record_filter_parse_condition(
+	          condition,
+	          condition_length,
+	          &column_name_offset,
+	          &column_name_length,
+	          &( record_filter->condition_operator ),
+	          &value_offset,
+	          &value_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse condition.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported condition.",
+		 function );
+
+		goto on_error;
+	}
+	result = record_filter_get_column_by_name(
+	          table,
+	          &( condition[ column_name_offset ] ),
+	          column_name_length,
+	          &( record_filter->condition_value_entry ),
+	          &( record_filter->condition_column_type ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve condition column.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: no such condition column in table.",
+		 function );
+
+		goto on_error;
+	}
+	record_filter->condition_value_string = system_string_allocate(
+	                                         value_length + 1 );
+
+	if( record_filter->condition_value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create condition value string.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_length > 0 )
+	{
+		if( system_string_copy(
+		     record_filter->condition_value_string,
+		     &( condition[ value_offset ] ),
+		     value_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy condition value string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	record_filter->condition_value_string[ value_length ] = 0;
+	record_filter->condition_value_string_length          = value_length;
+
+	switch( record_filter->condition_column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			/* Integer and date and time (FILETIME) values are compared as signed 64-bit integers
+			 */
+			value_string = record_filter->condition_value_string;
+
+			if( *value_string == (system_character_t) '-' )
+			{
+				value_string++;
+			}
+			if( ( *value_string == 0 )
+			 || ( esedbtools_system_string_copy_to_64_bit_in_decimal(
+			       value_string,
+			       system_string_length( value_string ) + 1,
+			       &value_64bit,
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported condition value: %" PRIs_SYSTEM " for integer column.",
+				 function,
+				 record_filter->condition_value_string );
+
+				goto on_error;
+			}
+			if( value_64bit > (uint64_t) INT64_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: condition value: %" PRIs_SYSTEM " out of bounds.",
+				 function,
+				 record_filter->condition_value_string );
+
+				goto on_error;
+			}
+			record_filter->condition_value_64bit = (int64_t) value_64bit;
+
+			if( value_string != record_filter->condition_value_string )
+			{
+				record_filter->condition_value_64bit *= -1;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported condition column type: %" PRIu32 ".",
+			 function,
+			 record_filter->condition_column_type );
+
+			goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_filter->condition_value_string != NULL )
+	{
+		memory_free(
+		 record_filter->condition_value_string );
+
+		record_filter->condition_value_string = NULL;
+	}
+	record_filter->condition_value_entry = -1;
+
+	return( -1 );
+}
+
+/* Retrieves the string value of the condition column of a record in the value string
+ * Returns 1 if successful, 0 if the value is not set or -1 on error
+ */
+int record_filter_get_string_value(
+     record_filter_t *record_filter,
+     libesedb_record_t *record,
+     size_t *value_string_length,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_t *long_value = NULL;
+	void *reallocation                = NULL;
+	static char *function             = "record_filter_get_string_value";
+	size_t value_string_size          = 0;
+	uint8_t value_data_flags          = 0;
+	int result                        = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_value_data_flags(
+	     record,
+	     record_filter->condition_value_entry,
+	     &value_data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 record_filter->condition_value_entry );
+
+		goto on_error;
+	}
+	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	{
+		if( libesedb_record_get_long_value(
+		     record,
+		     record_filter->condition_value_entry,
+		     &long_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve long value: %d.",
+			 function,
+			 record_filter->condition_value_entry );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libesedb_long_value_get_utf16_string_size(
+		          long_value,
+		          &value_string_size,
+		          error );
+#else
+		result = libesedb_long_value_get_utf8_string_size(
+		          long_value,
+		          &value_string_size,
+		          error );
+#endif
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libesedb_record_get_value_utf16_string_size(
+		          record,
+		          record_filter->condition_value_entry,
+		          &value_string_size,
+		          error );
+#else
+		result = libesedb_record_get_value_utf8_string_size(
+		          record,
+		          record_filter->condition_value_entry,
+		          &value_string_size,
+		          error );
+#endif
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d string size.",
+		 function,
+		 record_filter->condition_value_entry );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( value_string_size > 0 ) )
+	{
+		if( value_string_size > record_filter->value_string_size )
+		{
+			if( value_string_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid value string size value exceeds maximum allocation size.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = memory_reallocate(
+			                record_filter->value_string,
+			                sizeof( system_character_t ) * value_string_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize value string.",
+				 function );
+
+				goto on_error;
+			}
+			record_filter->value_string      = (system_character_t *) reallocation;
+			record_filter->value_string_size = value_string_size;
+		}
+		if( long_value != NULL )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libesedb_long_value_get_utf16_string(
+			          long_value,
+			          (uint16_t *) record_filter->value_string,
+			          value_string_size,
+			          error );
+#else
+			result = libesedb_long_value_get_utf8_string(
+			          long_value,
+			          (uint8_t *) record_filter->value_string,
+			          value_string_size,
+			          error );
+#endif
+		}
+		else
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libesedb_record_get_value_utf16_string(
+			          record,
+			          record_filter->condition_value_entry,
+			          (uint16_t *) record_filter->value_string,
+			          value_string_size,
+			          error );
+#else
+			result = libesedb_record_get_value_utf8_string(
+			          record,
+			          record_filter->condition_value_entry,
+			          (uint8_t *) record_filter->value_string,
+			          value_string_size,
+			          error );
+#endif
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d string.",
+			 function,
+			 record_filter->condition_value_entry );
+
+			goto on_error;
+		}
+		*value_string_length = 0;
+
+		while( ( *value_string_length < value_string_size )
+		    && ( record_filter->value_string[ *value_string_length ] != 0 ) )
+		{
+			*value_string_length += 1;
+		}
+	}
+	if( long_value != NULL )
+	{
+		if( libesedb_long_value_free(
+		     &long_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free long value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( value_string_size == 0 )
+	{
+		return( 0 );
+	}
+	return( result );
+
+on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if a record matches the condition
+ * Values that are not set or that consist of multiple values never match
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int record_filter_match_record(
+     record_filter_t *record_filter,
+     libesedb_record_t *record,
+     libcerror_error_t **error )
+{
+	static char *function      = "record_filter_match_record";
+	size_t compare_length      = 0;
+	size_t value_string_length = 0;
+	int64_t record_value_64bit = 0;
+	uint64_t value_64bit       = 0;
+	uint32_t value_32bit       = 0;
+	uint16_t value_16bit       = 0;
+	uint8_t value_8bit         = 0;
+	int number_of_values       = 0;
+	int compare_result         = 0;
+	int result                 = 0;
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_filter->condition_value_entry < 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_filter->condition_value_entry >= number_of_values )
+	{
+		return( 0 );
+	}
+	switch( record_filter->condition_column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			result = libesedb_record_get_value_boolean(
+			          record,
+			          record_filter->condition_value_entry,
+			          &value_8bit,
+			          error );
+
+			record_value_64bit = (int64_t) value_8bit;
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			result = libesedb_record_get_value_8bit(
+			          record,
+			          record_filter->condition_value_entry,
+			          &value_8bit,
+			          error );
+
+			record_value_64bit = (int64_t) value_8bit;
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			result = libesedb_record_get_value_16bit(
+			          record,
+			          record_filter->condition_value_entry,
+			          &value_16bit,
+			          error );
+
+			record_value_64bit = (int64_t) ( (int16_t) value_16bit );
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			result = libesedb_record_get_value_16bit(
+			          record,
+			          record_filter->condition_value_entry,
+			          &value_16bit,
+			          error );
+
+			record_value_64bit = (int64_t) value_16bit;
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			result = libesedb_record_get_value_32bit(
+			          record,
+			          record_filter->condition_value_entry,
+			          &value_32bit,
+			          error );
+
+			record_value_64bit = (int64_t) ( (int32_t) value_32bit );
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			result = libesedb_record_get_value_32bit(
+			          record,
+			          record_filter->condition_value_entry,
+			          &value_32bit,
+			          error );
+
+			record_value_64bit = (int64_t) value_32bit;
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			result = libesedb_record_get_value_64bit(
+			          record,
+			          record_filter->condition_value_entry,
+			          &value_64bit,
+			          error );
+
+			record_value_64bit = (int64_t) value_64bit;
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			result = libesedb_record_get_value_filetime(
+			          record,
+			          record_filter->condition_value_entry,
+			          &value_64bit,
+			          error );
+
+			if( value_64bit > (uint64_t) INT64_MAX )
+			{
+				value_64bit = (uint64_t) INT64_MAX;
+			}
+			record_value_64bit = (int64_t) value_64bit;
+
+			break;
+
+		default:
+			result = record_filter_get_string_value(
+			          record_filter,
+			          record,
+			          &value_string_length,
+			          error );
+
+			break;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 record_filter->condition_value_entry );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	switch( record_filter->condition_column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			compare_length = value_string_length;
+
+			if( compare_length > record_filter->condition_value_string_length )
+			{
+				compare_length = record_filter->condition_value_string_length;
+			}
+			compare_result = 0;
+
+			if( compare_length > 0 )
+			{
+				compare_result = system_string_compare(
+				                  record_filter->value_string,
+				                  record_filter->condition_value_string,
+				                  compare_length );
+			}
+			if( compare_result == 0 )
+			{
+				if( value_string_length < record_filter->condition_value_string_length )
+				{
+					compare_result = -1;
+				}
+				else if( value_string_length > record_filter->condition_value_string_length )
+				{
+					compare_result = 1;
+				}
+			}
+			break;
+
+		default:
+			if( record_value_64bit < record_filter->condition_value_64bit )
+			{
+				compare_result = -1;
+			}
+			else if( record_value_64bit > record_filter->condition_value_64bit )
+			{
+				compare_result = 1;
+			}
+			else
+			{
+				compare_result = 0;
+			}
+			break;
+	}
+	switch( record_filter->condition_operator )
+	{
+		case RECORD_FILTER_OPERATOR_EQUAL:
+			result = (int) ( compare_result == 0 );
+			break;
+
+		case RECORD_FILTER_OPERATOR_NOT_EQUAL:
+			result = (int) ( compare_result != 0 );
+			break;
+
+		case RECORD_FILTER_OPERATOR_LESS:
+			result = (int) ( compare_result < 0 );
+			break;
+
+		case RECORD_FILTER_OPERATOR_LESS_EQUAL:
+			result = (int) ( compare_result <= 0 );
+			break;
+
+		case RECORD_FILTER_OPERATOR_GREATER:
+			result = (int) ( compare_result > 0 );
+			break;
+
+		case RECORD_FILTER_OPERATOR_GREATER_EQUAL:
+			result = (int) ( compare_result >= 0 );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported condition operator: %" PRIu8 ".",
+			 function,
+			 record_filter->condition_operator );
+
+			return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,149 @@
+/*
+ * Record filter
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RECORD_FILTER_H )
+#define _RECORD_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum RECORD_FILTER_OPERATORS
+{
+	RECORD_FILTER_OPERATOR_EQUAL		= 1,
+	RECORD_FILTER_OPERATOR_NOT_EQUAL	= 2,
+	RECORD_FILTER_OPERATOR_LESS		= 3,
+	RECORD_FILTER_OPERATOR_LESS_EQUAL	= 4,
+	RECORD_FILTER_OPERATOR_GREATER		= 5,
+	RECORD_FILTER_OPERATOR_GREATER_EQUAL	= 6
+};
+
+typedef struct record_filter record_filter_t;
+
+struct record_filter
+{
+	/* The record value entries of the selected columns
+	 * or NULL if all columns are selected
+	 */
+	int *value_entries;
+
+	/* The number of record value entries
+	 */
+	int number_of_value_entries;
+
+	/* The record value entry of the condition column
+	 * or -1 if no condition is set
+	 */
+	int condition_value_entry;
+
+	/* The (ESE) column type of the condition column
+	 */
+	uint32_t condition_column_type;
+
+	/* The condition operator
+	 */
+	uint8_t condition_operator;
+
+	/* The condition value string
+	 */
+	system_character_t *condition_value_string;
+
+	/* The condition value string length
+	 */
+	size_t condition_value_string_length;
+
+	/* The condition value as a 64-bit integer
+	 */
+	int64_t condition_value_64bit;
+
+	/* The value string
+	 * used to retrieve string values without allocating memory per record
+	 */
+	system_character_t *value_string;
+
+	/* The value string size
+	 */
+	size_t value_string_size;
+};
+
+int record_filter_initialize(
+     record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+int record_filter_free(
+     record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+int record_filter_get_column_by_name(
+     libesedb_table_t *table,
+     const system_character_t *column_name,
+     size_t column_name_length,
+     int *column_entry,
+     uint32_t *column_type,
+     libcerror_error_t **error );
+
+int record_filter_set_columns(
+     record_filter_t *record_filter,
+     libesedb_table_t *table,
+     const system_character_t *column_names,
+     size_t column_names_length,
+     libcerror_error_t **error );
+
+int record_filter_parse_condition(
+     const system_character_t *condition,
+     size_t condition_length,
+     size_t *column_name_offset,
+     size_t *column_name_length,
+     uint8_t *condition_operator,
+     size_t *value_offset,
+     size_t *value_length,
+     libcerror_error_t **error );
+
+int record_filter_set_condition(
+     record_filter_t *record_filter,
+     libesedb_table_t *table,
+     const system_character_t *condition,
+     size_t condition_length,
+     libcerror_error_t **error );
+
+int record_filter_get_string_value(
+     record_filter_t *record_filter,
+     libesedb_record_t *record,
+     size_t *value_string_length,
+     libcerror_error_t **error );
+
+int record_filter_match_record(
+     record_filter_t *record_filter,
+     libesedb_record_t *record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RECORD_FILTER_H ) */
+
@@ -0,0 +1,2444 @@
+/*
+ * Record writer
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcnotify.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_libfdatetime.h"
+#include "esedbtools_libfguid.h"
+#include "log_handle.h"
+#include "output_buffer.h"
+#include "record_writer.h"
+
+/* Creates a record writer
+ * Make sure the value record_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_initialize(
+     record_writer_t **record_writer,
+     int format,
+     libcerror_error_t **error )
+{
+	static char *function = "record_writer_initialize";
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != RECORD_WRITER_FORMAT_CSV )
+	 && ( format != RECORD_WRITER_FORMAT_JSONL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	*record_writer = memory_allocate_structure(
+	                  record_writer_t );
+
+	if( *record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_writer,
+	     0,
+	     sizeof( record_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record writer.",
+		 function );
+
+		memory_free(
+		 *record_writer );
+
+		*record_writer = NULL;
+
+		return( -1 );
+	}
+	if( libfdatetime_filetime_initialize(
+	     &( ( *record_writer )->filetime ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filetime.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_initialize(
+	     &( ( *record_writer )->guid ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create GUID.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_writer )->format = format;
+
+	return( 1 );
+
+on_error:
+	if( *record_writer != NULL )
+	{
+		if( ( *record_writer )->filetime != NULL )
+		{
+			libfdatetime_filetime_free(
+			 &( ( *record_writer )->filetime ),
+			 NULL );
+		}
+		memory_free(
+		 *record_writer );
+
+		*record_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record writer
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_free(
+     record_writer_t **record_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "record_writer_free";
+	int result            = 1;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_writer != NULL )
+	{
+		if( ( *record_writer )->column_names_data != NULL )
+		{
+			memory_free(
+			 ( *record_writer )->column_names_data );
+		}
+		if( ( *record_writer )->column_name_offsets != NULL )
+		{
+			memory_free(
+			 ( *record_writer )->column_name_offsets );
+		}
+		if( ( *record_writer )->value_entries != NULL )
+		{
+			memory_free(
+			 ( *record_writer )->value_entries );
+		}
+		if( ( *record_writer )->value_data != NULL )
+		{
+			memory_free(
+			 ( *record_writer )->value_data );
+		}
+		if( libfdatetime_filetime_free(
+		     &( ( *record_writer )->filetime ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free filetime.",
+			 function );
+
+			result = -1;
+		}
+		if( libfguid_identifier_free(
+		     &( ( *record_writer )->guid ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free GUID.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *record_writer );
+
+		*record_writer = NULL;
+	}
+	return( result );
+}
+
+/* Resizes data to at least the required data size
+ * The data is only reallocated if it is too small
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_resize_data(
+     uint8_t **data,
+     size_t *data_size,
+     size_t required_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "record_writer_resize_data";
+	void *reallocation    = NULL;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid required data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_data_size <= *data_size )
+	{
+		return( 1 );
+	}
+	reallocation = memory_reallocate(
+	                *data,
+	                sizeof( uint8_t ) * required_data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = (uint8_t *) reallocation;
+	*data_size = required_data_size;
+
+	return( 1 );
+}
+
+/* Sets the column names of the record writer from the columns of a table
+ * If value entries are provided only the columns of these record value entries are written
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_set_column_names_from_table(
+     record_writer_t *record_writer,
+     libesedb_table_t *table,
+     const int *value_entries,
+     int number_of_value_entries,
+     libcerror_error_t **error )
+{
+	libesedb_column_t *column    = NULL;
+	static char *function        = "record_writer_set_column_names_from_table";
+	size_t column_name_offset    = 0;
+	size_t column_name_size      = 0;
+	int column_entry             = 0;
+	int column_iterator          = 0;
+	int number_of_columns        = 0;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_writer->column_name_offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record writer - column name offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_get_number_of_columns(
+	     table,
+	     &number_of_columns,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of columns.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only the columns of the selected record value entries are written
+	 */
+	if( value_entries != NULL )
+	{
+		if( ( number_of_value_entries <= 0 )
+		 || ( number_of_value_entries > ( INT32_MAX / (int) sizeof( size_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of value entries value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		record_writer->value_entries = (int *) memory_allocate(
+		                                        sizeof( int ) * number_of_value_entries );
+
+		if( record_writer->value_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     record_writer->value_entries,
+		     value_entries,
+		     sizeof( int ) * number_of_value_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value entries.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_columns = number_of_value_entries;
+	}
+	record_writer->column_name_offsets = (size_t *) memory_allocate(
+	                                                 sizeof( size_t ) * ( number_of_columns + 1 ) );
+
+	if( record_writer->column_name_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column name offsets.",
+		 function );
+
+		goto on_error;
+	}
+	record_writer->column_name_offsets[ 0 ] = 0;
+
+	for( column_iterator = 0;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
+	{
+		if( value_entries != NULL )
+		{
+			column_entry = value_entries[ column_iterator ];
+		}
+		else
+		{
+			column_entry = column_iterator;
+		}
+		if( libesedb_table_get_column(
+		     table,
+		     column_entry,
+		     &column,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_utf8_name_size(
+		     column,
+		     &column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the size of the column name.",
+			 function );
+
+			goto on_error;
+		}
+		if( column_name_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column name.",
+			 function );
+
+			goto on_error;
+		}
+		column_name_offset = record_writer->column_name_offsets[ column_iterator ];
+
+		if( record_writer_resize_data(
+		     &( record_writer->column_names_data ),
+		     &( record_writer->column_names_data_size ),
+		     column_name_offset + column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize column names data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_utf8_name(
+		     column,
+		     &( record_writer->column_names_data[ column_name_offset ] ),
+		     column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the column name.",
+			 function );
+
+			goto on_error;
+		}
+		/* The end-of-string character is overwritten by the next column name
+		 */
+		record_writer->column_name_offsets[ column_iterator + 1 ] = column_name_offset + column_name_size - 1;
+
+		if( libesedb_column_free(
+		     &column,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	record_writer->number_of_column_names = number_of_columns;
+
+	return( 1 );
+
+on_error:
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( record_writer->column_name_offsets != NULL )
+	{
+		memory_free(
+		 record_writer->column_name_offsets );
+
+		record_writer->column_name_offsets = NULL;
+	}
+	if( record_writer->value_entries != NULL )
+	{
+		memory_free(
+		 record_writer->value_entries );
+
+		record_writer->value_entries = NULL;
+	}
+	return( -1 );
+}
+
+/* Sets the column names of the record writer from the values of a record
+ * This is used for records that are not read from a table, such as index records
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_set_column_names_from_record(
+     record_writer_t *record_writer,
+     libesedb_record_t *record,
+     libcerror_error_t **error )
+{
+	static char *function     = "record_writer_set_column_names_from_record";
+	size_t column_name_offset = 0;
+	size_t column_name_size   = 0;
+	int number_of_values      = 0;
+	int value_iterator        = 0;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_writer->column_name_offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record writer - column name offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		goto on_error;
+	}
+	record_writer->column_name_offsets = (size_t *) memory_allocate(
+	                                                 sizeof( size_t ) * ( number_of_values + 1 ) );
+
+	if( record_writer->column_name_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column name offsets.",
+		 function );
+
+		goto on_error;
+	}
+	record_writer->column_name_offsets[ 0 ] = 0;
+
+	for( value_iterator = 0;
+	     value_iterator < number_of_values;
+	     value_iterator++ )
+	{
+		if( libesedb_record_get_utf8_column_name_size(
+		     record,
+		     value_iterator,
+		     &column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the size of the column name of value: %d.",
+			 function,
+			 value_iterator );
+
+			goto on_error;
+		}
+		if( column_name_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column name of value: %d.",
+			 function,
+			 value_iterator );
+
+			goto on_error;
+		}
+		column_name_offset = record_writer->column_name_offsets[ value_iterator ];
+
+		if( record_writer_resize_data(
+		     &( record_writer->column_names_data ),
+		     &( record_writer->column_names_data_size ),
+		     column_name_offset + column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize column names data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_record_get_utf8_column_name(
+		     record,
+		     value_iterator,
+		     &( record_writer->column_names_data[ column_name_offset ] ),
+		     column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the column name of value: %d.",
+			 function,
+			 value_iterator );
+
+			goto on_error;
+		}
+		record_writer->column_name_offsets[ value_iterator + 1 ] = column_name_offset + column_name_size - 1;
+	}
+	record_writer->number_of_column_names = number_of_values;
+
+	return( 1 );
+
+on_error:
+	if( record_writer->column_name_offsets != NULL )
+	{
+		memory_free(
+		 record_writer->column_name_offsets );
+
+		record_writer->column_name_offsets = NULL;
+	}
+	return( -1 );
+}
+
+/* Writes a value that is not set
+ * JSON Lines uses null and CSV an empty field
+ */
+void record_writer_write_null(
+      record_writer_t *record_writer,
+      output_buffer_t *output_buffer )
+{
+	if( record_writer == NULL )
+	{
+		return;
+	}
+	if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+	{
+		output_buffer_write_string(
+		 output_buffer,
+		 "null" );
+	}
+}
+
+/* Writes an UTF-8 encoded string as a quoted and escaped string
+ * The string is terminated by the string size or the first end-of-string character
+ * If is_multi_value is set a CSV string is written without quotes since
+ * the multi value as a whole is quoted
+ */
+void record_writer_write_string(
+      record_writer_t *record_writer,
+      output_buffer_t *output_buffer,
+      const uint8_t *string,
+      size_t string_size,
+      uint8_t is_multi_value )
+{
+	char escaped_character[ 6 ] = { '\\', 'u', '0', '0', '0', '0' };
+
+	static char *hexadecimal_digits = "0123456789abcdef";
+	size_t run_start_index          = 0;
+	size_t string_index             = 0;
+	uint8_t byte_value              = 0;
+
+	if( ( record_writer == NULL )
+	 || ( string == NULL ) )
+	{
+		return;
+	}
+	if( ( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+	 || ( is_multi_value == 0 ) )
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 '"' );
+	}
+	/* Runs of characters that do not need to be escaped are written as a whole
+	 */
+	for( string_index = 0;
+	     string_index < string_size;
+	     string_index++ )
+	{
+		byte_value = string[ string_index ];
+
+		if( byte_value == 0 )
+		{
+			break;
+		}
+		if( record_writer->format == RECORD_WRITER_FORMAT_CSV )
+		{
+			if( byte_value != (uint8_t) '"' )
+			{
+				continue;
+			}
+			output_buffer_write_data(
+			 output_buffer,
+			 (char *) &( string[ run_start_index ] ),
+			 string_index - run_start_index );
+
+			output_buffer_write_string(
+			 output_buffer,
+			 "\"\"" );
+		}
+		else
+		{
+			if( ( byte_value >= 0x20 )
+			 && ( byte_value != (uint8_t) '"' )
+			 && ( byte_value != (uint8_t) '\\' ) )
+			{
+				continue;
+			}
+			output_buffer_write_data(
+			 output_buffer,
+			 (char *) &( string[ run_start_index ] ),
+			 string_index - run_start_index );
+
+			switch( byte_value )
+			{
+				case (uint8_t) '"':
+					output_buffer_write_string(
+					 output_buffer,
+					 "\\\"" );
+					break;
+
+				case (uint8_t) '\\':
+					output_buffer_write_string(
+					 output_buffer,
+					 "\\\\" );
+					break;
+
+				case (uint8_t) '\b':
+					output_buffer_write_string(
+					 output_buffer,
+					 "\\b" );
+					break;
+
+				case (uint8_t) '\f':
+					output_buffer_write_string(
+					 output_buffer,
+					 "\\f" );
+					break;
+
+				case (uint8_t) '\n':
+					output_buffer_write_string(
+					 output_buffer,
+					 "\\n" );
+					break;
+
+				case (uint8_t) '\r':
+					output_buffer_write_string(
+					 output_buffer,
+					 "\\r" );
+					break;
+
+				case (uint8_t) '\t':
+					output_buffer_write_string(
+					 output_buffer,
+					 "\\t" );
+					break;
+
+				default:
+					escaped_character[ 4 ] = hexadecimal_digits[ byte_value >> 4 ];
+					escaped_character[ 5 ] = hexadecimal_digits[ byte_value & 0x0f ];
+
+					output_buffer_write_data(
+					 output_buffer,
+					 escaped_character,
+					 6 );
+					break;
+			}
+		}
+		run_start_index = string_index + 1;
+	}
+	output_buffer_write_data(
+	 output_buffer,
+	 (char *) &( string[ run_start_index ] ),
+	 string_index - run_start_index );
+
+	if( ( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+	 || ( is_multi_value == 0 ) )
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 '"' );
+	}
+}
+
+/* Writes a string that contains no characters that need to be escaped
+ * JSON Lines quotes the string and CSV writes it as-is
+ */
+void record_writer_write_plain_string(
+      record_writer_t *record_writer,
+      output_buffer_t *output_buffer,
+      const char *string,
+      size_t string_length )
+{
+	if( ( record_writer == NULL )
+	 || ( string == NULL ) )
+	{
+		return;
+	}
+	if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 '"' );
+	}
+	output_buffer_write_data(
+	 output_buffer,
+	 string,
+	 string_length );
+
+	if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 '"' );
+	}
+}
+
+/* Writes a floating point value as a number
+ * The value is written with enough significant digits to be read back without loss
+ */
+void record_writer_write_floating_point(
+      record_writer_t *record_writer,
+      output_buffer_t *output_buffer,
+      double value_double,
+      uint8_t is_single_precision )
+{
+	if( record_writer == NULL )
+	{
+		return;
+	}
+	/* NaN and infinity cannot be represented as a number,
+	 * for these values value - value is not 0
+	 */
+	if( ( value_double - value_double ) != 0.0 )
+	{
+		record_writer_write_null(
+		 record_writer,
+		 output_buffer );
+	}
+	else if( is_single_precision != 0 )
+	{
+		output_buffer_printf(
+		 output_buffer,
+		 "%.9g",
+		 value_double );
+	}
+	else
+	{
+		output_buffer_printf(
+		 output_buffer,
+		 "%.17g",
+		 value_double );
+	}
+}
+
+/* Writes data as a base64 encoded string
+ */
+void record_writer_write_base64_data(
+      record_writer_t *record_writer,
+      output_buffer_t *output_buffer,
+      const uint8_t *data,
+      size_t data_size )
+{
+	char base64_string[ 64 ];
+
+	static char *base64_characters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	size_t base64_string_index     = 0;
+	uint32_t base64_triplet        = 0;
+
+	if( record_writer == NULL )
+	{
+		return;
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		return;
+	}
+	if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 '"' );
+	}
+	while( data_size >= 3 )
+	{
+		base64_triplet = ( (uint32_t) data[ 0 ] << 16 )
+		               | ( (uint32_t) data[ 1 ] << 8 )
+		               | (uint32_t) data[ 2 ];
+
+		base64_string[ base64_string_index++ ] = base64_characters[ ( base64_triplet >> 18 ) & 0x3f ];
+		base64_string[ base64_string_index++ ] = base64_characters[ ( base64_triplet >> 12 ) & 0x3f ];
+		base64_string[ base64_string_index++ ] = base64_characters[ ( base64_triplet >> 6 ) & 0x3f ];
+		base64_string[ base64_string_index++ ] = base64_characters[ base64_triplet & 0x3f ];
+
+		if( base64_string_index >= 64 )
+		{
+			output_buffer_write_data(
+			 output_buffer,
+			 base64_string,
+			 base64_string_index );
+
+			base64_string_index = 0;
+		}
+		data      += 3;
+		data_size -= 3;
+	}
+	if( data_size > 0 )
+	{
+		base64_triplet = (uint32_t) data[ 0 ] << 16;
+
+		if( data_size == 2 )
+		{
+			base64_triplet |= (uint32_t) data[ 1 ] << 8;
+		}
+		base64_string[ base64_string_index++ ] = base64_characters[ ( base64_triplet >> 18 ) & 0x3f ];
+		base64_string[ base64_string_index++ ] = base64_characters[ ( base64_triplet >> 12 ) & 0x3f ];
+
+		if( data_size == 2 )
+		{
+			base64_string[ base64_string_index++ ] = base64_characters[ ( base64_triplet >> 6 ) & 0x3f ];
+		}
+		else
+		{
+			base64_string[ base64_string_index++ ] = '=';
+		}
+		base64_string[ base64_string_index++ ] = '=';
+	}
+	output_buffer_write_data(
+	 output_buffer,
+	 base64_string,
+	 base64_string_index );
+
+	if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 '"' );
+	}
+}
+
+/* Writes a FILETIME value as an ISO 8601 date and time string
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_write_filetime(
+     record_writer_t *record_writer,
+     output_buffer_t *output_buffer,
+     uint64_t value_64bit,
+     uint8_t is_multi_value,
+     libcerror_error_t **error )
+{
+	uint8_t filetime_string[ 48 ];
+
+	static char *function = "record_writer_write_filetime";
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_filetime_copy_from_64bit(
+	     record_writer->filetime,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filetime from 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_filetime_copy_to_utf8_string(
+	     record_writer->filetime,
+	     filetime_string,
+	     48,
+	     LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filetime to string.",
+		 function );
+
+		return( -1 );
+	}
+	record_writer_write_string(
+	 record_writer,
+	 output_buffer,
+	 filetime_string,
+	 48,
+	 is_multi_value );
+
+	return( 1 );
+}
+
+/* Writes GUID data as a lower case GUID string
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_write_guid(
+     record_writer_t *record_writer,
+     output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	char guid_string[ 48 ];
+
+	static char *function = "record_writer_write_guid";
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfguid_identifier_copy_from_byte_stream(
+	     record_writer->guid,
+	     data,
+	     data_size,
+	     LIBFGUID_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to GUID.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfguid_identifier_copy_to_utf8_string(
+	     record_writer->guid,
+	     (uint8_t *) guid_string,
+	     48,
+	     LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID to string.",
+		 function );
+
+		return( -1 );
+	}
+	record_writer_write_plain_string(
+	 record_writer,
+	 output_buffer,
+	 guid_string,
+	 narrow_string_length(
+	  guid_string ) );
+
+	return( 1 );
+}
+
+/* Writes the header
+ * Only CSV has a header, which contains the column names
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_write_header(
+     record_writer_t *record_writer,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function     = "record_writer_write_header";
+	size_t column_name_offset = 0;
+	int column_name_index     = 0;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_writer->format != RECORD_WRITER_FORMAT_CSV )
+	{
+		return( 1 );
+	}
+	for( column_name_index = 0;
+	     column_name_index < record_writer->number_of_column_names;
+	     column_name_index++ )
+	{
+		if( column_name_index > 0 )
+		{
+			output_buffer_write_character(
+			 output_buffer,
+			 ',' );
+		}
+		column_name_offset = record_writer->column_name_offsets[ column_name_index ];
+
+		record_writer_write_string(
+		 record_writer,
+		 output_buffer,
+		 &( record_writer->column_names_data[ column_name_offset ] ),
+		 record_writer->column_name_offsets[ column_name_index + 1 ] - column_name_offset,
+		 0 );
+	}
+	output_buffer_write_string(
+	 output_buffer,
+	 "\r\n" );
+
+	return( 1 );
+}
+
+/* Writes the values in a record
+ * JSON Lines writes the record as an object on a single line
+ * CSV writes the record as a line of comma separated fields
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_write_record(
+     record_writer_t *record_writer,
+     libesedb_record_t *record,
+     output_buffer_t *output_buffer,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function     = "record_writer_write_record";
+	size_t column_name_offset = 0;
+	uint32_t column_type      = 0;
+	uint8_t value_data_flags  = 0;
+	int column_iterator       = 0;
+	int number_of_columns     = 0;
+	int number_of_values      = 0;
+	int record_value_entry    = 0;
+	int result                = 0;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 '{' );
+	}
+	if( record_writer->value_entries != NULL )
+	{
+		number_of_columns = record_writer->number_of_column_names;
+	}
+	else
+	{
+		number_of_columns = number_of_values;
+	}
+	for( column_iterator = 0;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
+	{
+		if( record_writer->value_entries != NULL )
+		{
+			record_value_entry = record_writer->value_entries[ column_iterator ];
+		}
+		else
+		{
+			record_value_entry = column_iterator;
+		}
+		if( column_iterator > 0 )
+		{
+			output_buffer_write_character(
+			 output_buffer,
+			 ',' );
+		}
+		if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+		{
+			if( column_iterator < record_writer->number_of_column_names )
+			{
+				column_name_offset = record_writer->column_name_offsets[ column_iterator ];
+
+				record_writer_write_string(
+				 record_writer,
+				 output_buffer,
+				 &( record_writer->column_names_data[ column_name_offset ] ),
+				 record_writer->column_name_offsets[ column_iterator + 1 ] - column_name_offset,
+				 0 );
+			}
+			else
+			{
+				/* Fall back to the value index as name if the column name is not known
+				 */
+				output_buffer_write_character(
+				 output_buffer,
+				 '"' );
+
+				output_buffer_write_unsigned_decimal(
+				 output_buffer,
+				 (uint64_t) record_value_entry );
+
+				output_buffer_write_character(
+				 output_buffer,
+				 '"' );
+			}
+			output_buffer_write_character(
+			 output_buffer,
+			 ':' );
+		}
+		if( record_value_entry >= number_of_values )
+		{
+			record_writer_write_null(
+			 record_writer,
+			 output_buffer );
+
+			continue;
+		}
+		if( libesedb_record_get_column_type(
+		     record,
+		     record_value_entry,
+		     &column_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column type of value: %d.",
+			 function,
+			 record_value_entry );
+
+			return( -1 );
+		}
+		if( libesedb_record_get_value_data_flags(
+		     record,
+		     record_value_entry,
+		     &value_data_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d data flags.",
+			 function,
+			 record_value_entry );
+
+			return( -1 );
+		}
+		result = 1;
+
+		if( ( value_data_flags & ~( LIBESEDB_VALUE_FLAG_VARIABLE_SIZE ) ) == 0 )
+		{
+			result = record_writer_write_basic_record_value(
+			          record_writer,
+			          record,
+			          record_value_entry,
+			          column_type,
+			          output_buffer,
+			          error );
+		}
+		else if( ( ( value_data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+		      && ( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 ) )
+		{
+			/* Only text and binary data values are decompressed
+			 */
+			switch( column_type )
+			{
+				case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+				case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+				case LIBESEDB_COLUMN_TYPE_TEXT:
+				case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+					result = record_writer_write_basic_record_value(
+					          record_writer,
+					          record,
+					          record_value_entry,
+					          column_type,
+					          output_buffer,
+					          error );
+					break;
+
+				default:
+					record_writer_write_null(
+					 record_writer,
+					 output_buffer );
+					break;
+			}
+		}
+		else if( ( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+		      && ( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 ) )
+		{
+			result = record_writer_write_long_record_value(
+			          record_writer,
+			          record,
+			          record_value_entry,
+			          column_type,
+			          output_buffer,
+			          log_handle,
+			          error );
+		}
+/* TODO handle 0x10 flags */
+		else if( ( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+		      && ( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) == 0 )
+		      && ( ( value_data_flags & 0x10 ) == 0 ) )
+		{
+			result = record_writer_write_multi_record_value(
+			          record_writer,
+			          record,
+			          record_value_entry,
+			          column_type,
+			          output_buffer,
+			          error );
+		}
+		else
+		{
+			record_writer_write_null(
+			 record_writer,
+			 output_buffer );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to write record value: %d.",
+			 function,
+			 record_value_entry );
+
+			return( -1 );
+		}
+	}
+	if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+	{
+		output_buffer_write_string(
+		 output_buffer,
+		 "}\n" );
+	}
+	else
+	{
+		output_buffer_write_string(
+		 output_buffer,
+		 "\r\n" );
+	}
+	return( 1 );
+}
+
+/* Writes a basic record value
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_write_basic_record_value(
+     record_writer_t *record_writer,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint32_t column_type,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function  = "record_writer_write_basic_record_value";
+	size_t value_data_size = 0;
+	double value_double    = 0.0;
+	float value_float      = 0.0;
+	uint64_t value_64bit   = 0;
+	uint32_t value_32bit   = 0;
+	uint16_t value_16bit   = 0;
+	uint8_t value_8bit     = 0;
+	int result             = 0;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			result = libesedb_record_get_value_boolean(
+				  record,
+				  record_value_entry,
+				  &value_8bit,
+				  error );
+
+			if( result == 1 )
+			{
+				if( value_8bit == 0 )
+				{
+					output_buffer_write_string(
+					 output_buffer,
+					 "false" );
+				}
+				else
+				{
+					output_buffer_write_string(
+					 output_buffer,
+					 "true" );
+				}
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			result = libesedb_record_get_value_8bit(
+				  record,
+				  record_value_entry,
+				  &value_8bit,
+				  error );
+
+			if( result == 1 )
+			{
+				output_buffer_write_unsigned_decimal(
+				 output_buffer,
+				 (uint64_t) value_8bit );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			result = libesedb_record_get_value_16bit(
+				  record,
+				  record_value_entry,
+				  &value_16bit,
+				  error );
+
+			if( result == 1 )
+			{
+				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+				{
+					output_buffer_write_signed_decimal(
+					 output_buffer,
+					 (int16_t) value_16bit );
+				}
+				else
+				{
+					output_buffer_write_unsigned_decimal(
+					 output_buffer,
+					 (uint64_t) value_16bit );
+				}
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			result = libesedb_record_get_value_32bit(
+				  record,
+				  record_value_entry,
+				  &value_32bit,
+				  error );
+
+			if( result == 1 )
+			{
+				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+				{
+					output_buffer_write_signed_decimal(
+					 output_buffer,
+					 (int32_t) value_32bit );
+				}
+				else
+				{
+					output_buffer_write_unsigned_decimal(
+					 output_buffer,
+					 (uint64_t) value_32bit );
+				}
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			result = libesedb_record_get_value_64bit(
+				  record,
+				  record_value_entry,
+				  &value_64bit,
+				  error );
+
+			if( result == 1 )
+			{
+				output_buffer_write_signed_decimal(
+				 output_buffer,
+				 (int64_t) value_64bit );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			result = libesedb_record_get_value_floating_point_32bit(
+				  record,
+				  record_value_entry,
+				  &value_float,
+				  error );
+
+			if( result == 1 )
+			{
+				record_writer_write_floating_point(
+				 record_writer,
+				 output_buffer,
+				 (double) value_float,
+				 1 );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			result = libesedb_record_get_value_floating_point_64bit(
+				  record,
+				  record_value_entry,
+				  &value_double,
+				  error );
+
+			if( result == 1 )
+			{
+				record_writer_write_floating_point(
+				 record_writer,
+				 output_buffer,
+				 value_double,
+				 0 );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			result = libesedb_record_get_value_filetime(
+				  record,
+				  record_value_entry,
+				  &value_64bit,
+				  error );
+
+			if( result == 1 )
+			{
+				result = record_writer_write_filetime(
+				          record_writer,
+				          output_buffer,
+				          value_64bit,
+				          0,
+				          error );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			result = libesedb_record_get_value_utf8_string_size(
+				  record,
+				  record_value_entry,
+				  &value_data_size,
+				  error );
+
+			if( ( result == 1 )
+			 && ( value_data_size > 0 ) )
+			{
+				result = record_writer_resize_data(
+				          &( record_writer->value_data ),
+				          &( record_writer->value_data_size ),
+				          value_data_size,
+				          error );
+
+				if( result == 1 )
+				{
+					result = libesedb_record_get_value_utf8_string(
+						  record,
+						  record_value_entry,
+						  record_writer->value_data,
+						  value_data_size,
+						  error );
+				}
+				if( result == 1 )
+				{
+					record_writer_write_string(
+					 record_writer,
+					 output_buffer,
+					 record_writer->value_data,
+					 value_data_size,
+					 0 );
+				}
+			}
+			else if( result == 1 )
+			{
+				result = 0;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+		case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+			result = libesedb_record_get_value_binary_data_size(
+				  record,
+				  record_value_entry,
+				  &value_data_size,
+				  error );
+
+			if( ( result == 1 )
+			 && ( value_data_size > 0 ) )
+			{
+				result = record_writer_resize_data(
+				          &( record_writer->value_data ),
+				          &( record_writer->value_data_size ),
+				          value_data_size,
+				          error );
+
+				if( result == 1 )
+				{
+					result = libesedb_record_get_value_binary_data(
+						  record,
+						  record_value_entry,
+						  record_writer->value_data,
+						  value_data_size,
+						  error );
+				}
+			}
+			if( result == 1 )
+			{
+				record_writer_write_base64_data(
+				 record_writer,
+				 output_buffer,
+				 record_writer->value_data,
+				 value_data_size );
+			}
+			break;
+
+		default:
+			result = libesedb_record_get_value_data_size(
+				  record,
+				  record_value_entry,
+				  &value_data_size,
+				  error );
+
+			if( ( result == 1 )
+			 && ( value_data_size > 0 ) )
+			{
+				result = record_writer_resize_data(
+				          &( record_writer->value_data ),
+				          &( record_writer->value_data_size ),
+				          value_data_size,
+				          error );
+
+				if( result == 1 )
+				{
+					result = libesedb_record_get_value_data(
+						  record,
+						  record_value_entry,
+						  record_writer->value_data,
+						  value_data_size,
+						  error );
+				}
+				if( result == 1 )
+				{
+					if( ( column_type == LIBESEDB_COLUMN_TYPE_GUID )
+					 && ( value_data_size == 16 ) )
+					{
+						result = record_writer_write_guid(
+						          record_writer,
+						          output_buffer,
+						          record_writer->value_data,
+						          value_data_size,
+						          error );
+					}
+					else
+					{
+						record_writer_write_base64_data(
+						 record_writer,
+						 output_buffer,
+						 record_writer->value_data,
+						 value_data_size );
+					}
+				}
+			}
+			else if( result == 1 )
+			{
+				result = 0;
+			}
+			break;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d of column type: %" PRIu32 ".",
+		 function,
+		 record_value_entry,
+		 column_type );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		record_writer_write_null(
+		 record_writer,
+		 output_buffer );
+	}
+	return( 1 );
+}
+
+/* Writes a long record value
+ * A long value that cannot be read is logged and written as a value that is not set
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_write_long_record_value(
+     record_writer_t *record_writer,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint32_t column_type,
+     output_buffer_t *output_buffer,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_t *long_value = NULL;
+	static char *function             = "record_writer_write_long_record_value";
+	size64_t long_value_data_size     = 0;
+	size_t value_data_size            = 0;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_long_value(
+	     record,
+	     record_value_entry,
+	     &long_value,
+	     error ) != 1 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Unable to retrieve long value of record entry: %d.\n",
+		 record_value_entry );
+
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to retrieve long value of record entry: %d.\n",
+			 function,
+			 record_value_entry );
+		}
+		libcerror_error_free(
+		 error );
+
+		record_writer_write_null(
+		 record_writer,
+		 output_buffer );
+
+		return( 1 );
+	}
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			if( libesedb_long_value_get_utf8_string_size(
+			     long_value,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size of long value string: %d.",
+				 function,
+				 record_value_entry );
+
+				goto on_error;
+			}
+			break;
+
+		default:
+			if( libesedb_long_value_get_data_size(
+			     long_value,
+			     &long_value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size of long value data: %d.",
+				 function,
+				 record_value_entry );
+
+				goto on_error;
+			}
+			if( long_value_data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid long value data size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			value_data_size = (size_t) long_value_data_size;
+
+			break;
+	}
+	if( value_data_size > 0 )
+	{
+		if( record_writer_resize_data(
+		     &( record_writer->value_data ),
+		     &( record_writer->value_data_size ),
+		     value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			if( value_data_size == 0 )
+			{
+				record_writer_write_null(
+				 record_writer,
+				 output_buffer );
+
+				break;
+			}
+			if( libesedb_long_value_get_utf8_string(
+			     long_value,
+			     record_writer->value_data,
+			     value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve long value string: %d.",
+				 function,
+				 record_value_entry );
+
+				goto on_error;
+			}
+			record_writer_write_string(
+			 record_writer,
+			 output_buffer,
+			 record_writer->value_data,
+			 value_data_size,
+			 0 );
+
+			break;
+
+		default:
+			if( value_data_size > 0 )
+			{
+				if( libesedb_long_value_get_data(
+				     long_value,
+				     record_writer->value_data,
+				     value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve long value data: %d.",
+					 function,
+					 record_value_entry );
+
+					goto on_error;
+				}
+			}
+			record_writer_write_base64_data(
+			 record_writer,
+			 output_buffer,
+			 record_writer->value_data,
+			 value_data_size );
+
+			break;
+	}
+	if( libesedb_long_value_free(
+	     &long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free long value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes a multi record value
+ * JSON Lines writes the values as an array and CSV as a single quoted field
+ * of values separated by "; "
+ * Returns 1 if successful or -1 on error
+ */
+int record_writer_write_multi_record_value(
+     record_writer_t *record_writer,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint32_t column_type,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	libesedb_multi_value_t *multi_value = NULL;
+	static char *function               = "record_writer_write_multi_record_value";
+	size_t value_data_size              = 0;
+	double value_double                 = 0.0;
+	float value_float                   = 0.0;
+	uint64_t value_64bit                = 0;
+	uint32_t value_32bit                = 0;
+	uint16_t value_16bit                = 0;
+	uint8_t value_8bit                  = 0;
+	int multi_value_iterator            = 0;
+	int number_of_multi_values          = 0;
+	int result                          = 0;
+
+	if( record_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_multi_value(
+	     record,
+	     record_value_entry,
+	     &multi_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve multi value of record entry: %d.",
+		 function,
+		 record_value_entry );
+
+		goto on_error;
+	}
+	if( libesedb_multi_value_get_number_of_values(
+	     multi_value,
+	     &number_of_multi_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of multi values.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 '[' );
+	}
+	else
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 '"' );
+	}
+	for( multi_value_iterator = 0;
+	     multi_value_iterator < number_of_multi_values;
+	     multi_value_iterator++ )
+	{
+		if( multi_value_iterator > 0 )
+		{
+			if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+			{
+				output_buffer_write_character(
+				 output_buffer,
+				 ',' );
+			}
+			else
+			{
+				output_buffer_write_string(
+				 output_buffer,
+				 "; " );
+			}
+		}
+		switch( column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				result = libesedb_multi_value_get_value_8bit(
+					  multi_value,
+					  multi_value_iterator,
+					  &value_8bit,
+					  error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED )
+				{
+					output_buffer_write_unsigned_decimal(
+					 output_buffer,
+					 (uint64_t) value_8bit );
+				}
+				else if( value_8bit == 0 )
+				{
+					output_buffer_write_string(
+					 output_buffer,
+					 "false" );
+				}
+				else
+				{
+					output_buffer_write_string(
+					 output_buffer,
+					 "true" );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				result = libesedb_multi_value_get_value_16bit(
+					  multi_value,
+					  multi_value_iterator,
+					  &value_16bit,
+					  error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+				{
+					output_buffer_write_signed_decimal(
+					 output_buffer,
+					 (int16_t) value_16bit );
+				}
+				else
+				{
+					output_buffer_write_unsigned_decimal(
+					 output_buffer,
+					 (uint64_t) value_16bit );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+				result = libesedb_multi_value_get_value_32bit(
+					  multi_value,
+					  multi_value_iterator,
+					  &value_32bit,
+					  error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+				{
+					output_buffer_write_signed_decimal(
+					 output_buffer,
+					 (int32_t) value_32bit );
+				}
+				else
+				{
+					output_buffer_write_unsigned_decimal(
+					 output_buffer,
+					 (uint64_t) value_32bit );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				result = libesedb_multi_value_get_value_64bit(
+					  multi_value,
+					  multi_value_iterator,
+					  &value_64bit,
+					  error );
+
+				if( result == 1 )
+				{
+					output_buffer_write_signed_decimal(
+					 output_buffer,
+					 (int64_t) value_64bit );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				result = libesedb_multi_value_get_value_floating_point_32bit(
+					  multi_value,
+					  multi_value_iterator,
+					  &value_float,
+					  error );
+
+				if( result == 1 )
+				{
+					record_writer_write_floating_point(
+					 record_writer,
+					 output_buffer,
+					 (double) value_float,
+					 1 );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+				result = libesedb_multi_value_get_value_floating_point_64bit(
+					  multi_value,
+					  multi_value_iterator,
+					  &value_double,
+					  error );
+
+				if( result == 1 )
+				{
+					record_writer_write_floating_point(
+					 record_writer,
+					 output_buffer,
+					 value_double,
+					 0 );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+				result = libesedb_multi_value_get_value_filetime(
+					  multi_value,
+					  multi_value_iterator,
+					  &value_64bit,
+					  error );
+
+				if( result == 1 )
+				{
+					result = record_writer_write_filetime(
+					          record_writer,
+					          output_buffer,
+					          value_64bit,
+					          1,
+					          error );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_TEXT:
+			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+				result = libesedb_multi_value_get_value_utf8_string_size(
+					  multi_value,
+					  multi_value_iterator,
+					  &value_data_size,
+					  error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				if( value_data_size == 0 )
+				{
+					record_writer_write_null(
+					 record_writer,
+					 output_buffer );
+
+					break;
+				}
+				result = record_writer_resize_data(
+				          &( record_writer->value_data ),
+				          &( record_writer->value_data_size ),
+				          value_data_size,
+				          error );
+
+				if( result == 1 )
+				{
+					result = libesedb_multi_value_get_value_utf8_string(
+						  multi_value,
+						  multi_value_iterator,
+						  record_writer->value_data,
+						  value_data_size,
+						  error );
+				}
+				if( result == 1 )
+				{
+					record_writer_write_string(
+					 record_writer,
+					 output_buffer,
+					 record_writer->value_data,
+					 value_data_size,
+					 1 );
+				}
+				break;
+
+			default:
+				result = libesedb_multi_value_get_value_data_size(
+					  multi_value,
+					  multi_value_iterator,
+					  &value_data_size,
+					  error );
+
+				if( ( result == 1 )
+				 && ( value_data_size > 0 ) )
+				{
+					result = record_writer_resize_data(
+					          &( record_writer->value_data ),
+					          &( record_writer->value_data_size ),
+					          value_data_size,
+					          error );
+
+					if( result == 1 )
+					{
+						result = libesedb_multi_value_get_value_data(
+							  multi_value,
+							  multi_value_iterator,
+							  record_writer->value_data,
+							  value_data_size,
+							  error );
+					}
+				}
+				if( result != 1 )
+				{
+					break;
+				}
+				if( ( column_type == LIBESEDB_COLUMN_TYPE_GUID )
+				 && ( value_data_size == 16 ) )
+				{
+					result = record_writer_write_guid(
+					          record_writer,
+					          output_buffer,
+					          record_writer->value_data,
+					          value_data_size,
+					          error );
+				}
+				else
+				{
+					record_writer_write_base64_data(
+					 record_writer,
+					 output_buffer,
+					 record_writer->value_data,
+					 value_data_size );
+				}
+				break;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve multi value: %d of record entry: %d.",
+			 function,
+			 multi_value_iterator,
+			 record_value_entry );
+
+			goto on_error;
+		}
+	}
+	if( record_writer->format == RECORD_WRITER_FORMAT_JSONL )
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 ']' );
+	}
+	else
+	{
+		output_buffer_write_character(
+		 output_buffer,
+		 '"' );
+	}
+	if( libesedb_multi_value_free(
+	     &multi_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free multi value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( multi_value != NULL )
+	{
+		libesedb_multi_value_free(
+		 &multi_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,206 @@
+/*
+ * Record writer
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RECORD_WRITER_H )
+#define _RECORD_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_libfdatetime.h"
+#include "esedbtools_libfguid.h"
+#include "log_handle.h"
+#include "output_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum RECORD_WRITER_FORMATS
+{
+	RECORD_WRITER_FORMAT_CSV	= (int) 'c',
+	RECORD_WRITER_FORMAT_JSONL	= (int) 'j'
+};
+
+typedef struct record_writer record_writer_t;
+
+struct record_writer
+{
+	/* The format
+	 */
+	int format;
+
+	/* The column names data
+	 * contains the UTF-8 encoded column names without end-of-string characters
+	 */
+	uint8_t *column_names_data;
+
+	/* The column names data size
+	 */
+	size_t column_names_data_size;
+
+	/* The column name offsets
+	 * contains the number of column names + 1 offsets into the column names data
+	 */
+	size_t *column_name_offsets;
+
+	/* The number of column names
+	 */
+	int number_of_column_names;
+
+	/* The record value entries of the columns
+	 * or NULL if the column names correspond with all the record values
+	 */
+	int *value_entries;
+
+	/* The value data
+	 * used to retrieve string and binary data values without allocating memory per record
+	 */
+	uint8_t *value_data;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+
+	/* The filetime
+	 */
+	libfdatetime_filetime_t *filetime;
+
+	/* The GUID
+	 */
+	libfguid_identifier_t *guid;
+};
+
+int record_writer_initialize(
+     record_writer_t **record_writer,
+     int format,
+     libcerror_error_t **error );
+
+int record_writer_free(
+     record_writer_t **record_writer,
+     libcerror_error_t **error );
+
+int record_writer_resize_data(
+     uint8_t **data,
+     size_t *data_size,
+     size_t required_data_size,
+     libcerror_error_t **error );
+
+int record_writer_set_column_names_from_table(
+     record_writer_t *record_writer,
+     libesedb_table_t *table,
+     const int *value_entries,
+     int number_of_value_entries,
+     libcerror_error_t **error );
+
+int record_writer_set_column_names_from_record(
+     record_writer_t *record_writer,
+     libesedb_record_t *record,
+     libcerror_error_t **error );
+
+void record_writer_write_null(
+      record_writer_t *record_writer,
+      output_buffer_t *output_buffer );
+
+void record_writer_write_string(
+      record_writer_t *record_writer,
+      output_buffer_t *output_buffer,
+      const uint8_t *string,
+      size_t string_size,
+      uint8_t is_multi_value );
+
+void record_writer_write_plain_string(
+      record_writer_t *record_writer,
+      output_buffer_t *output_buffer,
+      const char *string,
+      size_t string_length );
+
+void record_writer_write_floating_point(
+      record_writer_t *record_writer,
+      output_buffer_t *output_buffer,
+      double value_double,
+      uint8_t is_single_precision );
+
+void record_writer_write_base64_data(
+      record_writer_t *record_writer,
+      output_buffer_t *output_buffer,
+      const uint8_t *data,
+      size_t data_size );
+
+int record_writer_write_filetime(
+     record_writer_t *record_writer,
+     output_buffer_t *output_buffer,
+     uint64_t value_64bit,
+     uint8_t is_multi_value,
+     libcerror_error_t **error );
+
+int record_writer_write_guid(
+     record_writer_t *record_writer,
+     output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int record_writer_write_header(
+     record_writer_t *record_writer,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int record_writer_write_record(
+     record_writer_t *record_writer,
+     libesedb_record_t *record,
+     output_buffer_t *output_buffer,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int record_writer_write_basic_record_value(
+     record_writer_t *record_writer,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint32_t column_type,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int record_writer_write_long_record_value(
+     record_writer_t *record_writer,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint32_t column_type,
+     output_buffer_t *output_buffer,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int record_writer_write_multi_record_value(
+     record_writer_t *record_writer,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint32_t column_type,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RECORD_WRITER_H ) */
+
@@ -0,0 +1,2026 @@
+/*
+ * SQLite database writer
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcnotify.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_libfdatetime.h"
+#include "esedbtools_libfguid.h"
+#include "log_handle.h"
+#include "record_writer.h"
+#include "sqlite_writer.h"
+
+#if defined( HAVE_SQLITE3 )
+
+/* Creates a SQLite writer
+ * Make sure the value sqlite_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_initialize(
+     sqlite_writer_t **sqlite_writer,
+     int maximum_number_of_rows,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_initialize";
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sqlite_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid SQLite writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_rows <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of rows value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*sqlite_writer = memory_allocate_structure(
+	                  sqlite_writer_t );
+
+	if( *sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create SQLite writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sqlite_writer,
+	     0,
+	     sizeof( sqlite_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear SQLite writer.",
+		 function );
+
+		memory_free(
+		 *sqlite_writer );
+
+		*sqlite_writer = NULL;
+
+		return( -1 );
+	}
+	if( libfdatetime_filetime_initialize(
+	     &( ( *sqlite_writer )->filetime ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filetime.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_initialize(
+	     &( ( *sqlite_writer )->guid ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create GUID.",
+		 function );
+
+		goto on_error;
+	}
+	( *sqlite_writer )->maximum_number_of_rows = maximum_number_of_rows;
+
+	return( 1 );
+
+on_error:
+	if( *sqlite_writer != NULL )
+	{
+		if( ( *sqlite_writer )->filetime != NULL )
+		{
+			libfdatetime_filetime_free(
+			 &( ( *sqlite_writer )->filetime ),
+			 NULL );
+		}
+		memory_free(
+		 *sqlite_writer );
+
+		*sqlite_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a SQLite writer
+ * A database that is still open is closed without committing the current transaction
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_free(
+     sqlite_writer_t **sqlite_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_free";
+	int result            = 1;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sqlite_writer != NULL )
+	{
+		if( ( *sqlite_writer )->insert_statement != NULL )
+		{
+			sqlite3_finalize(
+			 ( *sqlite_writer )->insert_statement );
+		}
+		if( ( *sqlite_writer )->database != NULL )
+		{
+			sqlite3_close(
+			 ( *sqlite_writer )->database );
+		}
+		if( ( *sqlite_writer )->columns != NULL )
+		{
+			memory_free(
+			 ( *sqlite_writer )->columns );
+		}
+		if( ( *sqlite_writer )->statement_data != NULL )
+		{
+			memory_free(
+			 ( *sqlite_writer )->statement_data );
+		}
+		if( ( *sqlite_writer )->value_data != NULL )
+		{
+			memory_free(
+			 ( *sqlite_writer )->value_data );
+		}
+		if( libfdatetime_filetime_free(
+		     &( ( *sqlite_writer )->filetime ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free filetime.",
+			 function );
+
+			result = -1;
+		}
+		if( libfguid_identifier_free(
+		     &( ( *sqlite_writer )->guid ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free GUID.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *sqlite_writer );
+
+		*sqlite_writer = NULL;
+	}
+	return( result );
+}
+
+/* Opens (creates) the SQLite database
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_open(
+     sqlite_writer_t *sqlite_writer,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_open";
+	int result            = 0;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->database != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid SQLite writer - database value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = sqlite3_open16(
+	          (const void *) filename,
+	          &( sqlite_writer->database ) );
+#else
+	result = sqlite3_open_v2(
+	          filename,
+	          &( sqlite_writer->database ),
+	          SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE,
+	          NULL );
+#endif
+	if( result != SQLITE_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open database: %" PRIs_SYSTEM " with error: %s.",
+		 function,
+		 filename,
+		 sqlite3_errstr( result ) );
+
+		goto on_error;
+	}
+	/* The database is created by the export, hence there is no previous
+	 * content to protect and the rollback journal and syncing are disabled
+	 */
+	if( sqlite_writer_execute(
+	     sqlite_writer,
+	     "PRAGMA journal_mode = OFF",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set journal mode.",
+		 function );
+
+		goto on_error;
+	}
+	if( sqlite_writer_execute(
+	     sqlite_writer,
+	     "PRAGMA synchronous = OFF",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set synchronous mode.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sqlite_writer->database != NULL )
+	{
+		sqlite3_close(
+		 sqlite_writer->database );
+
+		sqlite_writer->database = NULL;
+	}
+	return( -1 );
+}
+
+/* Closes the SQLite database
+ * Returns 0 if successful or -1 on error
+ */
+int sqlite_writer_close(
+     sqlite_writer_t *sqlite_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_close";
+	int result            = 0;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid SQLite writer - missing database.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->insert_statement != NULL )
+	{
+		sqlite3_finalize(
+		 sqlite_writer->insert_statement );
+
+		sqlite_writer->insert_statement = NULL;
+	}
+	result = sqlite3_close(
+	          sqlite_writer->database );
+
+	if( result != SQLITE_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close database with error: %s.",
+		 function,
+		 sqlite3_errstr( result ) );
+
+		return( -1 );
+	}
+	sqlite_writer->database = NULL;
+
+	return( 0 );
+}
+
+/* Executes a SQL statement that does not return data
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_execute(
+     sqlite_writer_t *sqlite_writer,
+     const char *statement,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_execute";
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid SQLite writer - missing database.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite3_exec(
+	     sqlite_writer->database,
+	     statement,
+	     NULL,
+	     NULL,
+	     NULL ) != SQLITE_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to execute statement: %s with error: %s.",
+		 function,
+		 statement,
+		 sqlite3_errmsg( sqlite_writer->database ) );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a string to the statement data
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_append_statement(
+     sqlite_writer_t *sqlite_writer,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_append_statement";
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) ( SSIZE_MAX - sqlite_writer->statement_data_offset - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_writer_resize_data(
+	     &( sqlite_writer->statement_data ),
+	     &( sqlite_writer->statement_data_size ),
+	     sqlite_writer->statement_data_offset + string_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize statement data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( sqlite_writer->statement_data[ sqlite_writer->statement_data_offset ] ),
+	     string,
+	     string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		return( -1 );
+	}
+	sqlite_writer->statement_data_offset += string_length;
+
+	sqlite_writer->statement_data[ sqlite_writer->statement_data_offset ] = 0;
+
+	return( 1 );
+}
+
+/* Appends an identifier, such as a table or column name, to the statement data
+ * The identifier is enclosed in double quotes and embedded double quotes are escaped
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_append_identifier(
+     sqlite_writer_t *sqlite_writer,
+     const uint8_t *identifier,
+     size_t identifier_length,
+     libcerror_error_t **error )
+{
+	static char *function   = "sqlite_writer_append_identifier";
+	size_t identifier_index = 0;
+	size_t segment_index    = 0;
+
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer_append_statement(
+	     sqlite_writer,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( identifier_index = 0;
+	     identifier_index < identifier_length;
+	     identifier_index++ )
+	{
+		if( identifier[ identifier_index ] != (uint8_t) '"' )
+		{
+			continue;
+		}
+		/* Append the segment including the double quote followed by another double quote
+		 */
+		if( sqlite_writer_append_statement(
+		     sqlite_writer,
+		     &( identifier[ segment_index ] ),
+		     identifier_index + 1 - segment_index,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( sqlite_writer_append_statement(
+		     sqlite_writer,
+		     (uint8_t *) "\"",
+		     1,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		segment_index = identifier_index + 1;
+	}
+	if( sqlite_writer_append_statement(
+	     sqlite_writer,
+	     &( identifier[ segment_index ] ),
+	     identifier_length - segment_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( sqlite_writer_append_statement(
+	     sqlite_writer,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append identifier to statement.",
+	 function );
+
+	return( -1 );
+}
+
+/* Retrieves the SQLite column type name of an (ESE) column type
+ * Returns the column type name
+ */
+const char *sqlite_writer_get_column_type_name(
+             uint32_t column_type )
+{
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			return( "INTEGER" );
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			return( "REAL" );
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+		case LIBESEDB_COLUMN_TYPE_GUID:
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			return( "TEXT" );
+
+		default:
+			break;
+	}
+	return( "BLOB" );
+}
+
+/* Creates a table in the database from the columns of an (ESE) table
+ * and prepares the statement to insert the records of the table
+ * If value entries are provided only the columns of these record value entries are created
+ * Returns 1 if successful, 0 if the table has no columns or -1 on error
+ */
+int sqlite_writer_create_table(
+     sqlite_writer_t *sqlite_writer,
+     libesedb_table_t *table,
+     const int *value_entries,
+     int number_of_value_entries,
+     libcerror_error_t **error )
+{
+	uint8_t name[ 256 ];
+	uint8_t table_name[ 256 ];
+
+	libesedb_column_t *column = NULL;
+	const char *type_name     = NULL;
+	static char *function     = "sqlite_writer_create_table";
+	size_t name_size          = 0;
+	size_t table_name_size    = 0;
+	uint32_t column_type      = 0;
+	int column_entry          = 0;
+	int column_iterator       = 0;
+	int number_of_columns     = 0;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->insert_statement != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid SQLite writer - insert statement value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_get_number_of_columns(
+	     table,
+	     &number_of_columns,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_entries != NULL )
+	{
+		number_of_columns = number_of_value_entries;
+	}
+	if( number_of_columns <= 0 )
+	{
+		return( 0 );
+	}
+	if( sqlite_writer->columns != NULL )
+	{
+		memory_free(
+		 sqlite_writer->columns );
+
+		sqlite_writer->columns           = NULL;
+		sqlite_writer->number_of_columns = 0;
+	}
+	sqlite_writer->columns = (sqlite_writer_column_t *) memory_allocate(
+	                                                     sizeof( sqlite_writer_column_t ) * number_of_columns );
+
+	if( sqlite_writer->columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_table_get_utf8_name_size(
+	     table,
+	     &table_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the size of the table name.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( table_name_size < 2 )
+	 || ( table_name_size > 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table name size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_table_get_utf8_name(
+	     table,
+	     table_name,
+	     table_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the table name.",
+		 function );
+
+		goto on_error;
+	}
+	sqlite_writer->statement_data_offset = 0;
+
+	if( sqlite_writer_append_statement(
+	     sqlite_writer,
+	     (uint8_t *) "CREATE TABLE ",
+	     13,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append create table statement.",
+		 function );
+
+		goto on_error;
+	}
+	if( sqlite_writer_append_identifier(
+	     sqlite_writer,
+	     table_name,
+	     table_name_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append table name.",
+		 function );
+
+		goto on_error;
+	}
+	if( sqlite_writer_append_statement(
+	     sqlite_writer,
+	     (uint8_t *) " ( ",
+	     3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append create table statement.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_iterator = 0;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
+	{
+		if( value_entries != NULL )
+		{
+			column_entry = value_entries[ column_iterator ];
+		}
+		else
+		{
+			column_entry = column_iterator;
+		}
+		if( libesedb_table_get_column(
+		     table,
+		     column_entry,
+		     &column,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_type(
+		     column,
+		     &column_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d type.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_utf8_name_size(
+		     column,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the size of the column name.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( name_size < 2 )
+		 || ( name_size > 256 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid column name size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_utf8_name(
+		     column,
+		     name,
+		     name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the column name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_column_free(
+		     &column,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column.",
+			 function );
+
+			goto on_error;
+		}
+		sqlite_writer->columns[ column_iterator ].record_value_entry = column_entry;
+		sqlite_writer->columns[ column_iterator ].column_type        = column_type;
+
+		if( column_iterator > 0 )
+		{
+			if( sqlite_writer_append_statement(
+			     sqlite_writer,
+			     (uint8_t *) ", ",
+			     2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append column separator.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( sqlite_writer_append_identifier(
+		     sqlite_writer,
+		     name,
+		     name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append column: %d name.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		type_name = sqlite_writer_get_column_type_name(
+		             column_type );
+
+		if( ( sqlite_writer_append_statement(
+		       sqlite_writer,
+		       (uint8_t *) " ",
+		       1,
+		       error ) != 1 )
+		 || ( sqlite_writer_append_statement(
+		       sqlite_writer,
+		       (uint8_t *) type_name,
+		       narrow_string_length(
+		        type_name ),
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append column: %d type.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+	}
+	sqlite_writer->number_of_columns = number_of_columns;
+
+	if( sqlite_writer_append_statement(
+	     sqlite_writer,
+	     (uint8_t *) " )",
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append create table statement.",
+		 function );
+
+		goto on_error;
+	}
+	if( sqlite_writer_execute(
+	     sqlite_writer,
+	     (char *) sqlite_writer->statement_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table.",
+		 function );
+
+		goto on_error;
+	}
+	sqlite_writer->statement_data_offset = 0;
+
+	if( ( sqlite_writer_append_statement(
+	       sqlite_writer,
+	       (uint8_t *) "INSERT INTO ",
+	       12,
+	       error ) != 1 )
+	 || ( sqlite_writer_append_identifier(
+	       sqlite_writer,
+	       table_name,
+	       table_name_size - 1,
+	       error ) != 1 )
+	 || ( sqlite_writer_append_statement(
+	       sqlite_writer,
+	       (uint8_t *) " VALUES ( ?",
+	       11,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append insert statement.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_iterator = 1;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
+	{
+		if( sqlite_writer_append_statement(
+		     sqlite_writer,
+		     (uint8_t *) ", ?",
+		     3,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append insert statement.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( sqlite_writer_append_statement(
+	     sqlite_writer,
+	     (uint8_t *) " )",
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append insert statement.",
+		 function );
+
+		goto on_error;
+	}
+	if( sqlite3_prepare_v2(
+	     sqlite_writer->database,
+	     (char *) sqlite_writer->statement_data,
+	     -1,
+	     &( sqlite_writer->insert_statement ),
+	     NULL ) != SQLITE_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to prepare insert statement with error: %s.",
+		 function,
+		 sqlite3_errmsg( sqlite_writer->database ) );
+
+		goto on_error;
+	}
+	if( sqlite_writer_execute(
+	     sqlite_writer,
+	     "BEGIN",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to begin transaction.",
+		 function );
+
+		goto on_error;
+	}
+	sqlite_writer->number_of_rows = 0;
+
+	return( 1 );
+
+on_error:
+	if( sqlite_writer->insert_statement != NULL )
+	{
+		sqlite3_finalize(
+		 sqlite_writer->insert_statement );
+
+		sqlite_writer->insert_statement = NULL;
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Binds a record value to a parameter of the insert statement
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_bind_value(
+     sqlite_writer_t *sqlite_writer,
+     int column_index,
+     libesedb_record_t *record,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	uint8_t filetime_string[ 48 ];
+	char guid_string[ 48 ];
+
+	sqlite_writer_column_t *column = NULL;
+	static char *function          = "sqlite_writer_bind_value";
+	size_t value_data_size         = 0;
+	double value_double            = 0.0;
+	float value_float              = 0.0;
+	uint64_t value_64bit           = 0;
+	uint32_t value_32bit           = 0;
+	uint16_t value_16bit           = 0;
+	uint8_t value_8bit             = 0;
+	uint8_t value_data_flags       = 0;
+	int result                     = 0;
+	int sqlite_result              = SQLITE_OK;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_index < 0 )
+	 || ( column_index >= sqlite_writer->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	column = &( sqlite_writer->columns[ column_index ] );
+
+	if( libesedb_record_get_value_data_flags(
+	     record,
+	     column->record_value_entry,
+	     &value_data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 column->record_value_entry );
+
+		return( -1 );
+	}
+	/* Multi values have no equivalent in a SQLite column and are stored as NULL
+	 */
+	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+	{
+		result = 0;
+	}
+	else if( ( column->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	      || ( column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT )
+	      || ( column->column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		result = sqlite_writer_bind_data_value(
+		          sqlite_writer,
+		          column_index,
+		          record,
+		          value_data_flags,
+		          log_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to bind value: %d data.",
+			 function,
+			 column->record_value_entry );
+
+			return( -1 );
+		}
+	}
+	else if( ( value_data_flags & ~( LIBESEDB_VALUE_FLAG_VARIABLE_SIZE ) ) == 0 )
+	{
+		switch( column->column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+				result = libesedb_record_get_value_boolean(
+					  record,
+					  column->record_value_entry,
+					  &value_8bit,
+					  error );
+
+				if( result == 1 )
+				{
+					sqlite_result = sqlite3_bind_int64(
+					                 sqlite_writer->insert_statement,
+					                 column_index + 1,
+					                 (sqlite3_int64) ( value_8bit != 0 ) );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				result = libesedb_record_get_value_8bit(
+					  record,
+					  column->record_value_entry,
+					  &value_8bit,
+					  error );
+
+				if( result == 1 )
+				{
+					sqlite_result = sqlite3_bind_int64(
+					                 sqlite_writer->insert_statement,
+					                 column_index + 1,
+					                 (sqlite3_int64) value_8bit );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				result = libesedb_record_get_value_16bit(
+					  record,
+					  column->record_value_entry,
+					  &value_16bit,
+					  error );
+
+				if( result == 1 )
+				{
+					if( column->column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+					{
+						value_64bit = (uint64_t) (int64_t) (int16_t) value_16bit;
+					}
+					else
+					{
+						value_64bit = (uint64_t) value_16bit;
+					}
+					sqlite_result = sqlite3_bind_int64(
+					                 sqlite_writer->insert_statement,
+					                 column_index + 1,
+					                 (sqlite3_int64) value_64bit );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+				result = libesedb_record_get_value_32bit(
+					  record,
+					  column->record_value_entry,
+					  &value_32bit,
+					  error );
+
+				if( result == 1 )
+				{
+					if( column->column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+					{
+						value_64bit = (uint64_t) (int64_t) (int32_t) value_32bit;
+					}
+					else
+					{
+						value_64bit = (uint64_t) value_32bit;
+					}
+					sqlite_result = sqlite3_bind_int64(
+					                 sqlite_writer->insert_statement,
+					                 column_index + 1,
+					                 (sqlite3_int64) value_64bit );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				result = libesedb_record_get_value_64bit(
+					  record,
+					  column->record_value_entry,
+					  &value_64bit,
+					  error );
+
+				if( result == 1 )
+				{
+					sqlite_result = sqlite3_bind_int64(
+					                 sqlite_writer->insert_statement,
+					                 column_index + 1,
+					                 (sqlite3_int64) value_64bit );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				result = libesedb_record_get_value_floating_point_32bit(
+					  record,
+					  column->record_value_entry,
+					  &value_float,
+					  error );
+
+				if( result == 1 )
+				{
+					sqlite_result = sqlite3_bind_double(
+					                 sqlite_writer->insert_statement,
+					                 column_index + 1,
+					                 (double) value_float );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+				result = libesedb_record_get_value_floating_point_64bit(
+					  record,
+					  column->record_value_entry,
+					  &value_double,
+					  error );
+
+				if( result == 1 )
+				{
+					sqlite_result = sqlite3_bind_double(
+					                 sqlite_writer->insert_statement,
+					                 column_index + 1,
+					                 value_double );
+				}
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+				result = libesedb_record_get_value_filetime(
+					  record,
+					  column->record_value_entry,
+					  &value_64bit,
+					  error );
+
+				if( result == 1 )
+				{
+					result = libfdatetime_filetime_copy_from_64bit(
+					          sqlite_writer->filetime,
+					          value_64bit,
+					          error );
+				}
+				if( result == 1 )
+				{
+					/* The ISO 8601 representation can be used by the SQLite date and time functions
+					 */
+					result = libfdatetime_filetime_copy_to_utf8_string(
+					          sqlite_writer->filetime,
+					          filetime_string,
+					          48,
+					          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBFDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+					          error );
+				}
+				if( result == 1 )
+				{
+					sqlite_result = sqlite3_bind_text(
+					                 sqlite_writer->insert_statement,
+					                 column_index + 1,
+					                 (char *) filetime_string,
+					                 -1,
+					                 SQLITE_TRANSIENT );
+				}
+				break;
+
+			default:
+				result = libesedb_record_get_value_data_size(
+					  record,
+					  column->record_value_entry,
+					  &value_data_size,
+					  error );
+
+				if( ( result == 1 )
+				 && ( value_data_size == 0 ) )
+				{
+					result = 0;
+				}
+				if( result == 1 )
+				{
+					result = record_writer_resize_data(
+					          &( sqlite_writer->value_data ),
+					          &( sqlite_writer->value_data_size ),
+					          value_data_size,
+					          error );
+				}
+				if( result == 1 )
+				{
+					result = libesedb_record_get_value_data(
+						  record,
+						  column->record_value_entry,
+						  sqlite_writer->value_data,
+						  value_data_size,
+						  error );
+				}
+				if( result != 1 )
+				{
+					break;
+				}
+				if( ( column->column_type == LIBESEDB_COLUMN_TYPE_GUID )
+				 && ( value_data_size == 16 ) )
+				{
+					result = libfguid_identifier_copy_from_byte_stream(
+					          sqlite_writer->guid,
+					          sqlite_writer->value_data,
+					          value_data_size,
+					          LIBFGUID_ENDIAN_LITTLE,
+					          error );
+
+					if( result == 1 )
+					{
+						result = libfguid_identifier_copy_to_utf8_string(
+						          sqlite_writer->guid,
+						          (uint8_t *) guid_string,
+						          48,
+						          LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+						          error );
+					}
+					if( result == 1 )
+					{
+						sqlite_result = sqlite3_bind_text(
+						                 sqlite_writer->insert_statement,
+						                 column_index + 1,
+						                 guid_string,
+						                 -1,
+						                 SQLITE_TRANSIENT );
+					}
+				}
+				else
+				{
+					sqlite_result = sqlite3_bind_blob(
+					                 sqlite_writer->insert_statement,
+					                 column_index + 1,
+					                 sqlite_writer->value_data,
+					                 (int) value_data_size,
+					                 SQLITE_TRANSIENT );
+				}
+				break;
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d of column type: %" PRIu32 ".",
+			 function,
+			 column->record_value_entry,
+			 column->column_type );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		sqlite_result = sqlite3_bind_null(
+		                 sqlite_writer->insert_statement,
+		                 column_index + 1 );
+	}
+	if( sqlite_result != SQLITE_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to bind value: %d with error: %s.",
+		 function,
+		 column->record_value_entry,
+		 sqlite3_errmsg( sqlite_writer->database ) );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Binds a string or binary data record value to a parameter of the insert statement
+ * A long value that cannot be read is logged and considered not set
+ * Returns 1 if successful, 0 if the value is not set or -1 on error
+ */
+int sqlite_writer_bind_data_value(
+     sqlite_writer_t *sqlite_writer,
+     int column_index,
+     libesedb_record_t *record,
+     uint8_t value_data_flags,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_t *long_value = NULL;
+	sqlite_writer_column_t *column    = NULL;
+	static char *function             = "sqlite_writer_bind_data_value";
+	size64_t long_value_data_size     = 0;
+	size_t string_length              = 0;
+	size_t value_data_size            = 0;
+	int is_text                       = 0;
+	int result                        = 0;
+	int sqlite_result                 = 0;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_index < 0 )
+	 || ( column_index >= sqlite_writer->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	column = &( sqlite_writer->columns[ column_index ] );
+
+	is_text = (int) ( ( column->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	               || ( column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) );
+
+	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	{
+		if( libesedb_record_get_long_value(
+		     record,
+		     column->record_value_entry,
+		     &long_value,
+		     error ) != 1 )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "Unable to retrieve long value of record entry: %d.\n",
+			 column->record_value_entry );
+
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to retrieve long value of record entry: %d.\n",
+				 function,
+				 column->record_value_entry );
+			}
+			libcerror_error_free(
+			 error );
+
+			return( 0 );
+		}
+		if( is_text != 0 )
+		{
+			result = libesedb_long_value_get_utf8_string_size(
+			          long_value,
+			          &value_data_size,
+			          error );
+		}
+		else
+		{
+			result = libesedb_long_value_get_data_size(
+			          long_value,
+			          &long_value_data_size,
+			          error );
+
+			if( long_value_data_size > (size64_t) INT32_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid long value data size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			value_data_size = (size_t) long_value_data_size;
+		}
+	}
+	else if( is_text != 0 )
+	{
+		result = libesedb_record_get_value_utf8_string_size(
+		          record,
+		          column->record_value_entry,
+		          &value_data_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_record_get_value_binary_data_size(
+		          record,
+		          column->record_value_entry,
+		          &value_data_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data size.",
+		 function,
+		 column->record_value_entry );
+
+		goto on_error;
+	}
+	if( value_data_size > (size_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result == 1 )
+	 && ( value_data_size > 0 ) )
+	{
+		result = record_writer_resize_data(
+		          &( sqlite_writer->value_data ),
+		          &( sqlite_writer->value_data_size ),
+		          value_data_size,
+		          error );
+
+		if( result == 1 )
+		{
+			if( long_value != NULL )
+			{
+				if( is_text != 0 )
+				{
+					result = libesedb_long_value_get_utf8_string(
+					          long_value,
+					          sqlite_writer->value_data,
+					          value_data_size,
+					          error );
+				}
+				else
+				{
+					result = libesedb_long_value_get_data(
+					          long_value,
+					          sqlite_writer->value_data,
+					          value_data_size,
+					          error );
+				}
+			}
+			else if( is_text != 0 )
+			{
+				result = libesedb_record_get_value_utf8_string(
+				          record,
+				          column->record_value_entry,
+				          sqlite_writer->value_data,
+				          value_data_size,
+				          error );
+			}
+			else
+			{
+				result = libesedb_record_get_value_binary_data(
+				          record,
+				          column->record_value_entry,
+				          sqlite_writer->value_data,
+				          value_data_size,
+				          error );
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d data.",
+			 function,
+			 column->record_value_entry );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		result = 0;
+	}
+	if( long_value != NULL )
+	{
+		if( libesedb_long_value_free(
+		     &long_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free long value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( is_text != 0 )
+	{
+		/* Strings are stored without the end-of-string character
+		 */
+		string_length = 0;
+
+		while( ( string_length < value_data_size )
+		    && ( sqlite_writer->value_data[ string_length ] != 0 ) )
+		{
+			string_length++;
+		}
+		sqlite_result = sqlite3_bind_text(
+		                 sqlite_writer->insert_statement,
+		                 column_index + 1,
+		                 (char *) sqlite_writer->value_data,
+		                 (int) string_length,
+		                 SQLITE_TRANSIENT );
+	}
+	else
+	{
+		sqlite_result = sqlite3_bind_blob(
+		                 sqlite_writer->insert_statement,
+		                 column_index + 1,
+		                 sqlite_writer->value_data,
+		                 (int) value_data_size,
+		                 SQLITE_TRANSIENT );
+	}
+	if( sqlite_result != SQLITE_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to bind value: %d with error: %s.",
+		 function,
+		 column->record_value_entry,
+		 sqlite3_errmsg( sqlite_writer->database ) );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Inserts a record into the current table
+ * The current transaction is committed when it contains the maximum number of rows
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_insert_record(
+     sqlite_writer_t *sqlite_writer,
+     libesedb_record_t *record,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_insert_record";
+	int column_index      = 0;
+	int number_of_values  = 0;
+	int result            = 0;
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->insert_statement == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid SQLite writer - missing insert statement.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < sqlite_writer->number_of_columns;
+	     column_index++ )
+	{
+		/* Columns without a corresponding value are stored as NULL
+		 */
+		if( sqlite_writer->columns[ column_index ].record_value_entry >= number_of_values )
+		{
+			if( sqlite3_bind_null(
+			     sqlite_writer->insert_statement,
+			     column_index + 1 ) != SQLITE_OK )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to bind column: %d with error: %s.",
+				 function,
+				 column_index,
+				 sqlite3_errmsg( sqlite_writer->database ) );
+
+				return( -1 );
+			}
+		}
+		else if( sqlite_writer_bind_value(
+		          sqlite_writer,
+		          column_index,
+		          record,
+		          log_handle,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to bind column: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+	}
+	result = sqlite3_step(
+	          sqlite_writer->insert_statement );
+
+	if( result != SQLITE_DONE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to insert record with error: %s.",
+		 function,
+		 sqlite3_errmsg( sqlite_writer->database ) );
+
+		sqlite3_reset(
+		 sqlite_writer->insert_statement );
+
+		return( -1 );
+	}
+	sqlite3_reset(
+	 sqlite_writer->insert_statement );
+
+	sqlite_writer->number_of_rows += 1;
+
+	if( sqlite_writer->number_of_rows >= sqlite_writer->maximum_number_of_rows )
+	{
+		if( sqlite_writer_execute(
+		     sqlite_writer,
+		     "COMMIT",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to commit transaction.",
+			 function );
+
+			return( -1 );
+		}
+		if( sqlite_writer_execute(
+		     sqlite_writer,
+		     "BEGIN",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to begin transaction.",
+			 function );
+
+			return( -1 );
+		}
+		sqlite_writer->number_of_rows = 0;
+	}
+	return( 1 );
+}
+
+/* Finishes the current table
+ * Commits the current transaction and releases the insert statement
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_writer_finish_table(
+     sqlite_writer_t *sqlite_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_writer_finish_table";
+
+	if( sqlite_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SQLite writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sqlite_writer->insert_statement == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid SQLite writer - missing insert statement.",
+		 function );
+
+		return( -1 );
+	}
+	sqlite3_finalize(
+	 sqlite_writer->insert_statement );
+
+	sqlite_writer->insert_statement = NULL;
+
+	if( sqlite_writer_execute(
+	     sqlite_writer,
+	     "COMMIT",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to commit transaction.",
+		 function );
+
+		return( -1 );
+	}
+	sqlite_writer->number_of_rows = 0;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_SQLITE3 ) */
+
@@ -0,0 +1,193 @@
+/*
+ * SQLite database writer
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SQLITE_WRITER_H )
+#define _SQLITE_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_SQLITE3 )
+#include <sqlite3.h>
+#endif
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+#include "esedbtools_libfdatetime.h"
+#include "esedbtools_libfguid.h"
+#include "log_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_SQLITE3 )
+
+typedef struct sqlite_writer_column sqlite_writer_column_t;
+
+struct sqlite_writer_column
+{
+	/* The record value entry
+	 */
+	int record_value_entry;
+
+	/* The (ESE) column type
+	 */
+	uint32_t column_type;
+};
+
+typedef struct sqlite_writer sqlite_writer_t;
+
+struct sqlite_writer
+{
+	/* The SQLite database
+	 */
+	sqlite3 *database;
+
+	/* The insert statement of the current table
+	 */
+	sqlite3_stmt *insert_statement;
+
+	/* The columns of the current table
+	 */
+	sqlite_writer_column_t *columns;
+
+	/* The number of columns of the current table
+	 */
+	int number_of_columns;
+
+	/* The maximum number of rows in a transaction
+	 */
+	int maximum_number_of_rows;
+
+	/* The number of rows in the current transaction
+	 */
+	int number_of_rows;
+
+	/* The SQL statement data
+	 * contains an UTF-8 encoded SQL statement with end-of-string character
+	 */
+	uint8_t *statement_data;
+
+	/* The statement data size
+	 */
+	size_t statement_data_size;
+
+	/* The statement data offset
+	 */
+	size_t statement_data_offset;
+
+	/* The value data
+	 * used to retrieve string and binary data values without allocating memory per record
+	 */
+	uint8_t *value_data;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+
+	/* The filetime
+	 */
+	libfdatetime_filetime_t *filetime;
+
+	/* The GUID
+	 */
+	libfguid_identifier_t *guid;
+};
+
+int sqlite_writer_initialize(
+     sqlite_writer_t **sqlite_writer,
+     int maximum_number_of_rows,
+     libcerror_error_t **error );
+
+int sqlite_writer_free(
+     sqlite_writer_t **sqlite_writer,
+     libcerror_error_t **error );
+
+int sqlite_writer_open(
+     sqlite_writer_t *sqlite_writer,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int sqlite_writer_close(
+     sqlite_writer_t *sqlite_writer,
+     libcerror_error_t **error );
+
+int sqlite_writer_execute(
+     sqlite_writer_t *sqlite_writer,
+     const char *statement,
+     libcerror_error_t **error );
+
+int sqlite_writer_append_statement(
+     sqlite_writer_t *sqlite_writer,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int sqlite_writer_append_identifier(
+     sqlite_writer_t *sqlite_writer,
+     const uint8_t *identifier,
+     size_t identifier_length,
+     libcerror_error_t **error );
+
+const char *sqlite_writer_get_column_type_name(
+             uint32_t column_type );
+
+int sqlite_writer_create_table(
+     sqlite_writer_t *sqlite_writer,
+     libesedb_table_t *table,
+     const int *value_entries,
+     int number_of_value_entries,
+     libcerror_error_t **error );
+
+int sqlite_writer_bind_value(
+     sqlite_writer_t *sqlite_writer,
+     int column_index,
+     libesedb_record_t *record,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int sqlite_writer_bind_data_value(
+     sqlite_writer_t *sqlite_writer,
+     int column_index,
+     libesedb_record_t *record,
+     uint8_t value_data_flags,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int sqlite_writer_insert_record(
+     sqlite_writer_t *sqlite_writer,
+     libesedb_record_t *record,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int sqlite_writer_finish_table(
+     sqlite_writer_t *sqlite_writer,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_SQLITE3 ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SQLITE_WRITER_H ) */
+
@@ -35,6 +35,7 @@
 #include "esedbtools_libuna.h"
 #include "export.h"
 #include "export_handle.h"
+#include "output_buffer.h"
 #include "srumdb.h"
 
 enum SRUMDB_KNOWN_COLUMN_TYPES
@@ -49,7 +50,7 @@ enum SRUMDB_KNOWN_COLUMN_TYPES
  */
 int srumdb_export_record_guid(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -75,13 +76,13 @@ int srumdb_export_record_guid(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -221,7 +222,7 @@ int srumdb_export_record_guid(
 				  record,
 				  value_iterator,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == SRUMDB_KNOWN_COLUMN_TYPE_FLOATINGTIME )
@@ -230,7 +231,7 @@ int srumdb_export_record_guid(
 				  record,
 				  value_iterator,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == SRUMDB_KNOWN_COLUMN_TYPE_UNDEFINED )
@@ -238,7 +239,7 @@ int srumdb_export_record_guid(
 			result = export_handle_export_record_value(
 				  record,
 				  value_iterator,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -256,15 +257,15 @@ int srumdb_export_record_guid(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
@@ -29,6 +29,7 @@
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libesedb.h"
 #include "log_handle.h"
+#include "output_buffer.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -36,7 +37,7 @@ extern "C" {
 
 int srumdb_export_record_guid(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
@@ -35,6 +35,7 @@
 #include "esedbtools_libuna.h"
 #include "export.h"
 #include "export_handle.h"
+#include "output_buffer.h"
 #include "webcache.h"
 
 enum WEBCACHE_KNOWN_COLUMN_TYPES
@@ -48,7 +49,7 @@ enum WEBCACHE_KNOWN_COLUMN_TYPES
  */
 int webcache_export_record_container(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -74,13 +75,13 @@ int webcache_export_record_container(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -241,7 +242,7 @@ int webcache_export_record_container(
 				  record,
 				  value_iterator,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == WEBCACHE_KNOWN_COLUMN_TYPE_UNDEFINED )
@@ -249,7 +250,7 @@ int webcache_export_record_container(
 			result = export_handle_export_record_value(
 				  record,
 				  value_iterator,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -267,15 +268,15 @@ int webcache_export_record_container(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
@@ -286,7 +287,7 @@ int webcache_export_record_container(
  */
 int webcache_export_record_containers(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -312,13 +313,13 @@ int webcache_export_record_containers(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -473,7 +474,7 @@ int webcache_export_record_containers(
 				  record,
 				  value_iterator,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == WEBCACHE_KNOWN_COLUMN_TYPE_UNDEFINED )
@@ -481,7 +482,7 @@ int webcache_export_record_containers(
 			result = export_handle_export_record_value(
 				  record,
 				  value_iterator,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -499,15 +500,15 @@ int webcache_export_record_containers(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
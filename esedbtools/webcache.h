@@ -29,6 +29,7 @@
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libesedb.h"
 #include "log_handle.h"
+#include "output_buffer.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -36,13 +37,13 @@ extern "C" {
 
 int webcache_export_record_container(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int webcache_export_record_containers(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
@@ -36,6 +36,7 @@
 #include "esedbtools_libuna.h"
 #include "export.h"
 #include "export_handle.h"
+#include "output_buffer.h"
 #include "windows_search.h"
 #include "windows_search_compression.h"
 
@@ -144,7 +145,7 @@ int windows_search_export_compressed_string_value(
      uint8_t *value_data,
      size_t value_data_size,
      int ascii_codepage,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	system_character_t *value_string    = NULL;
@@ -184,13 +185,13 @@ int windows_search_export_compressed_string_value(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -537,7 +538,7 @@ int windows_search_export_compressed_string_value(
 			export_text(
 			 value_string,
 			 value_string_size,
-			 record_file_stream );
+			 record_output_buffer );
 
 			memory_free(
 			 value_string );
@@ -611,7 +612,7 @@ int windows_search_export_compressed_string_value(
 		export_narrow_text(
 		 (char *) narrow_value_string,
 		 value_string_size,
-		 record_file_stream );
+		 record_output_buffer );
 
 		memory_free(
 		 narrow_value_string );
@@ -623,7 +624,7 @@ int windows_search_export_compressed_string_value(
 		export_narrow_text(
 		 (char *) &( decoded_value_data[ 1 ] ),
 		 decoded_value_data_size - 1,
-		 record_file_stream );
+		 record_output_buffer );
 
 		memory_free(
 		 decoded_value_data );
@@ -656,7 +657,7 @@ int windows_search_export_record_value_32bit(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	uint8_t *value_data      = NULL;
@@ -690,13 +691,13 @@ int windows_search_export_record_value_32bit(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -823,10 +824,9 @@ int windows_search_export_record_value_32bit(
 				 value_data,
 				 value_32bit );
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIu32 "",
-			 value_32bit );
+			output_buffer_write_unsigned_decimal(
+			 record_output_buffer,
+			 (uint64_t) value_32bit );
 		}
 	}
 	else
@@ -834,7 +834,7 @@ int windows_search_export_record_value_32bit(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -858,7 +858,7 @@ int windows_search_export_record_value_64bit(
      int record_value_entry,
      uint8_t byte_order,
      uint8_t format,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	uint8_t *value_data      = NULL;
@@ -905,13 +905,13 @@ int windows_search_export_record_value_64bit(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -1033,8 +1033,8 @@ int windows_search_export_record_value_64bit(
 			     "********",
 			     8 ) == 0 )
 			{
-				fprintf(
-				 record_file_stream,
+				output_buffer_write_string(
+				 record_output_buffer,
 				 "********" );
 			}
 			else
@@ -1053,9 +1053,8 @@ int windows_search_export_record_value_64bit(
 				}
 				if( format == WINDOWS_SEARCH_FORMAT_DECIMAL )
 				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIu64 "",
+					output_buffer_write_unsigned_decimal(
+					 record_output_buffer,
 					 value_64bit );
 				}
 				else if( format == WINDOWS_SEARCH_FORMAT_HEXADECIMAL )
@@ -1063,7 +1062,7 @@ int windows_search_export_record_value_64bit(
 					export_binary_data(
 					 value_data,
 					 value_data_size,
-					 record_file_stream );
+					 record_output_buffer );
 				}
 			}
 		}
@@ -1073,7 +1072,7 @@ int windows_search_export_record_value_64bit(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -1096,7 +1095,7 @@ int windows_search_export_record_value_filetime(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	system_character_t filetime_string[ 32 ];
@@ -1120,13 +1119,13 @@ int windows_search_export_record_value_filetime(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -1309,9 +1308,8 @@ int windows_search_export_record_value_filetime(
 
 				goto on_error;
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIs_SYSTEM "",
+			output_buffer_write_system_string(
+			 record_output_buffer,
 			 filetime_string );
 		}
 	}
@@ -1320,7 +1318,7 @@ int windows_search_export_record_value_filetime(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -1349,7 +1347,7 @@ int windows_search_export_record_value_compressed_string(
      libesedb_record_t *record,
      int record_value_entry,
      int ascii_codepage,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -1379,13 +1377,13 @@ int windows_search_export_record_value_compressed_string(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -1493,7 +1491,7 @@ int windows_search_export_record_value_compressed_string(
 			     value_data,
 			     value_data_size,
 			     ascii_codepage,
-			     record_file_stream,
+			     record_output_buffer,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1572,7 +1570,7 @@ int windows_search_export_record_value_compressed_string(
 				     long_value_data,
 				     long_value_data_size,
 				     ascii_codepage,
-				     record_file_stream,
+				     record_output_buffer,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -1699,7 +1697,7 @@ int windows_search_export_record_value_compressed_string(
 				     multi_value_data,
 				     multi_value_data_size,
 				     ascii_codepage,
-				     record_file_stream,
+				     record_output_buffer,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -1720,8 +1718,8 @@ int windows_search_export_record_value_compressed_string(
 
 				if( multi_value_iterator < ( number_of_multi_values - 1 ) )
 				{
-					fprintf(
-					 record_file_stream,
+					output_buffer_write_string(
+					 record_output_buffer,
 					 "; " );
 				}
 			}
@@ -1746,7 +1744,7 @@ int windows_search_export_record_value_compressed_string(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	if( value_data != NULL )
 	{
@@ -1793,7 +1791,7 @@ int windows_search_export_record_value_utf16_string(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	system_character_t *value_string = NULL;
@@ -1816,13 +1814,13 @@ int windows_search_export_record_value_utf16_string(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -2002,7 +2000,7 @@ int windows_search_export_record_value_utf16_string(
 			export_text(
 			 value_string,
 			 value_string_size,
-			 record_file_stream );
+			 record_output_buffer );
 
 			memory_free(
 			 value_string );
@@ -2013,7 +2011,7 @@ int windows_search_export_record_value_utf16_string(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -2035,7 +2033,7 @@ on_error:
 int windows_search_export_record_systemindex_0a(
      libesedb_record_t *record,
      int ascii_codepage,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2062,13 +2060,13 @@ int windows_search_export_record_systemindex_0a(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -2861,7 +2859,7 @@ int windows_search_export_record_systemindex_0a(
 				  record,
 				  value_iterator,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
@@ -2871,7 +2869,7 @@ int windows_search_export_record_systemindex_0a(
 				  value_iterator,
 				  byte_order,
 				  format,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME )
@@ -2880,7 +2878,7 @@ int windows_search_export_record_systemindex_0a(
 				  record,
 				  value_iterator,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED )
@@ -2889,7 +2887,7 @@ int windows_search_export_record_systemindex_0a(
 				  record,
 				  value_iterator,
 				  ascii_codepage,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -2898,7 +2896,7 @@ int windows_search_export_record_systemindex_0a(
 			result = export_handle_export_record_value(
 				  record,
 				  value_iterator,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -2916,15 +2914,15 @@ int windows_search_export_record_systemindex_0a(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
@@ -2935,7 +2933,7 @@ int windows_search_export_record_systemindex_0a(
  */
 int windows_search_export_record_systemindex_gthr(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2961,13 +2959,13 @@ int windows_search_export_record_systemindex_gthr(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -3117,7 +3115,7 @@ int windows_search_export_record_systemindex_gthr(
 				  record,
 				  value_iterator,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_UTF16_LITTLE_ENDIAN )
@@ -3126,7 +3124,7 @@ int windows_search_export_record_systemindex_gthr(
 				  record,
 				  value_iterator,
 				  LIBUNA_ENDIAN_LITTLE,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED )
@@ -3134,7 +3132,7 @@ int windows_search_export_record_systemindex_gthr(
 			result = export_handle_export_record_value(
 				  record,
 				  value_iterator,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -3152,15 +3150,15 @@ int windows_search_export_record_systemindex_gthr(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
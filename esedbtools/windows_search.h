@@ -29,6 +29,7 @@
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libesedb.h"
 #include "log_handle.h"
+#include "output_buffer.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -45,14 +46,14 @@ int windows_search_export_compressed_string_value(
      uint8_t *value_data,
      size_t value_data_size,
      int ascii_codepage,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int windows_search_export_record_value_32bit(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int windows_search_export_record_value_64bit(
@@ -60,21 +61,21 @@ int windows_search_export_record_value_64bit(
      int record_value_entry,
      uint8_t byte_order,
      uint8_t format,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int windows_search_export_record_value_filetime(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int windows_search_export_record_value_compressed_string(
      libesedb_record_t *record,
      int record_value_entry,
      int ascii_codepage,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
@@ -82,19 +83,19 @@ int windows_search_export_record_value_utf16_string(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error );
 
 int windows_search_export_record_systemindex_0a(
      libesedb_record_t *record,
      int ascii_codepage,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int windows_search_export_record_systemindex_gthr(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
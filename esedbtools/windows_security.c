@@ -34,6 +34,7 @@
 #include "esedbtools_libuna.h"
 #include "export.h"
 #include "export_handle.h"
+#include "output_buffer.h"
 #include "windows_security.h"
 
 enum WINDOWS_SECURITY_KNOWN_COLUMN_TYPES
@@ -50,7 +51,7 @@ int windows_security_export_record_value_filetime(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	system_character_t filetime_string[ 32 ];
@@ -74,13 +75,13 @@ int windows_security_export_record_value_filetime(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -263,9 +264,8 @@ int windows_security_export_record_value_filetime(
 
 				goto on_error;
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIs_SYSTEM "",
+			output_buffer_write_system_string(
+			 record_output_buffer,
 			 filetime_string );
 		}
 	}
@@ -274,7 +274,7 @@ int windows_security_export_record_value_filetime(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -303,7 +303,7 @@ int windows_security_export_record_value_utf16_string(
      libesedb_record_t *record,
      int record_value_entry,
      uint8_t byte_order,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      libcerror_error_t **error )
 {
 	system_character_t *value_string = NULL;
@@ -326,13 +326,13 @@ int windows_security_export_record_value_utf16_string(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -512,7 +512,7 @@ int windows_security_export_record_value_utf16_string(
 			export_text(
 			 value_string,
 			 value_string_size,
-			 record_file_stream );
+			 record_output_buffer );
 
 			memory_free(
 			 value_string );
@@ -523,7 +523,7 @@ int windows_security_export_record_value_utf16_string(
 		export_binary_data(
 		 value_data,
 		 value_data_size,
-		 record_file_stream );
+		 record_output_buffer );
 	}
 	memory_free(
 	 value_data );
@@ -544,7 +544,7 @@ on_error:
  */
 int windows_security_export_record_smtblversion(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -570,13 +570,13 @@ int windows_security_export_record_smtblversion(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -727,7 +727,7 @@ int windows_security_export_record_smtblversion(
 				  record,
 				  value_iterator,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == WINDOWS_SECURITY_KNOWN_COLUMN_TYPE_STRING_UTF16_LITTLE_ENDIAN )
@@ -736,7 +736,7 @@ int windows_security_export_record_smtblversion(
 				  record,
 				  value_iterator,
 				  LIBUNA_ENDIAN_LITTLE,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == WINDOWS_SECURITY_KNOWN_COLUMN_TYPE_UNDEFINED )
@@ -744,7 +744,7 @@ int windows_security_export_record_smtblversion(
 			result = export_handle_export_record_value(
 				  record,
 				  value_iterator,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -762,15 +762,15 @@ int windows_security_export_record_smtblversion(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
@@ -781,7 +781,7 @@ int windows_security_export_record_smtblversion(
  */
 int windows_security_export_record_smtblsection(
      libesedb_record_t *record,
-     FILE *record_file_stream,
+     output_buffer_t *record_output_buffer,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -807,13 +807,13 @@ int windows_security_export_record_smtblsection(
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( record_output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid record output buffer.",
 		 function );
 
 		return( -1 );
@@ -944,7 +944,7 @@ int windows_security_export_record_smtblsection(
 				  record,
 				  value_iterator,
 				  byte_order,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == WINDOWS_SECURITY_KNOWN_COLUMN_TYPE_STRING_UTF16_LITTLE_ENDIAN )
@@ -953,7 +953,7 @@ int windows_security_export_record_smtblsection(
 				  record,
 				  value_iterator,
 				  LIBUNA_ENDIAN_LITTLE,
-				  record_file_stream,
+				  record_output_buffer,
 				  error );
 		}
 		else if( known_column_type == WINDOWS_SECURITY_KNOWN_COLUMN_TYPE_UNDEFINED )
@@ -961,7 +961,7 @@ int windows_security_export_record_smtblsection(
 			result = export_handle_export_record_value(
 				  record,
 				  value_iterator,
-				  record_file_stream,
+				  record_output_buffer,
 				  log_handle,
 				  error );
 		}
@@ -979,15 +979,15 @@ int windows_security_export_record_smtblsection(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\n' );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			output_buffer_write_character(
+			 record_output_buffer,
+			 '\t' );
 		}
 	}
 	return( 1 );
@@ -205,7 +205,11 @@ enum LIBESEDB_MEMORY_ERROR
 
 	/* The memory failed to be set
 	 */
-	LIBESEDB_MEMORY_ERROR_SET_FAILED		= 3
+	LIBESEDB_MEMORY_ERROR_SET_FAILED		= 3,
+
+	/* The memory limit was exceeded
+	 */
+	LIBESEDB_MEMORY_ERROR_LIMIT_EXCEEDED		= 4
 };
 
 /* The output error codes
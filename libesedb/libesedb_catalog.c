@@ -28,6 +28,7 @@
 #include "libesedb_definitions.h"
 #include "libesedb_catalog.h"
 #include "libesedb_catalog_definition.h"
+#include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
@@ -35,6 +36,7 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libuna.h"
+#include "libesedb_name_hash_table.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 
@@ -141,11 +143,31 @@ int libesedb_catalog_initialize(
 
 		goto on_error;
 	}
+	if( libesedb_name_hash_table_initialize(
+	     &( ( *catalog )->table_definition_name_hash_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table definition name hash table.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
 	if( *catalog != NULL )
 	{
+		if( ( *catalog )->table_definition_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *catalog )->table_definition_array ),
+			 NULL,
+			 NULL );
+		}
 		if( ( *catalog )->page_tree != NULL )
 		{
 			libesedb_page_tree_free(
@@ -183,6 +205,41 @@ int libesedb_catalog_free(
 	}
 	if( *catalog != NULL )
 	{
+		if( ( ( *catalog )->page_tree != NULL )
+		 && ( ( *catalog )->page_tree->io_handle != NULL )
+		 && ( ( *catalog )->memory_size != 0 ) )
+		{
+			if( libesedb_io_handle_remove_memory_usage(
+			     ( *catalog )->page_tree->io_handle,
+			     ( *catalog )->memory_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to remove catalog size from memory usage.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The table definition name hash table only references the table definitions
+		 * and must be freed before the table definition array
+		 */
+		if( libesedb_name_hash_table_free(
+		     &( ( *catalog )->table_definition_name_hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table definition name hash table.",
+			 function );
+
+			result = -1;
+		}
 		if( libesedb_page_tree_free(
 		     &( ( *catalog )->page_tree ),
 		     error ) != 1 )
@@ -305,6 +362,24 @@ int libesedb_catalog_read_value_data(
 
 		goto on_error;
 	}
+	/* The size of the catalog definition is estimated by the size of its data
+	 */
+	if( libesedb_io_handle_add_memory_usage(
+	     catalog->page_tree->io_handle,
+	     (size64_t) sizeof( libesedb_catalog_definition_t ) + data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add catalog definition size to memory usage.",
+		 function );
+
+		goto on_error;
+	}
+	catalog->memory_size += (size64_t) sizeof( libesedb_catalog_definition_t ) + data_size;
+
 	if( ( catalog_definition->type != LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
 	 && ( *table_definition == NULL ) )
 	{
@@ -377,6 +452,23 @@ int libesedb_catalog_read_value_data(
 
 				goto on_error;
 			}
+			/* If there are multiple table definitions with the same name the first one is used
+			 */
+			if( libesedb_name_hash_table_insert_value(
+			     catalog->table_definition_name_hash_table,
+			     ( *table_definition )->table_catalog_definition,
+			     (intptr_t *) *table_definition,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert table definition into name hash table.",
+				 function );
+
+				goto on_error;
+			}
 			break;
 
 		case LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN:
@@ -500,6 +592,7 @@ on_error:
 int libesedb_catalog_read_values_from_leaf_page(
      libesedb_catalog_t *catalog,
      libesedb_page_t *page,
+     uint8_t read_flags,
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error )
 {
@@ -507,6 +600,7 @@ int libesedb_catalog_read_values_from_leaf_page(
 	libesedb_page_value_t *page_value           = NULL;
 	static char *function                       = "libesedb_catalog_read_values_from_leaf_page";
 	uint32_t page_flags                         = 0;
+	uint16_t catalog_definition_type            = 0;
 	uint16_t number_of_page_values              = 0;
 	uint16_t page_value_index                   = 0;
 
@@ -640,21 +734,50 @@ int libesedb_catalog_read_values_from_leaf_page(
 
 			goto on_error;
 		}
-		if( libesedb_catalog_read_value_data(
-		     catalog,
-		     page_tree_value->data,
-		     page_tree_value->data_size,
-		     table_definition,
-		     error ) != 1 )
+		if( ( read_flags & LIBESEDB_CATALOG_READ_FLAG_TABLES_ONLY ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read catalog value.",
-			 function );
+			if( libesedb_catalog_definition_read_type_from_data(
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     &catalog_definition_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog definition type.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+		}
+		if( ( ( read_flags & LIBESEDB_CATALOG_READ_FLAG_TABLES_ONLY ) == 0 )
+		 || ( catalog_definition_type == LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE ) )
+		{
+			if( libesedb_catalog_read_value_data(
+			     catalog,
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog value.",
+				 function );
+
+				goto on_error;
+			}
+			/* The other catalog definitions of the table are read when the table definition is first used
+			 */
+			if( ( read_flags & LIBESEDB_CATALOG_READ_FLAG_TABLES_ONLY ) != 0 )
+			{
+				( *table_definition )->catalog_leaf_page_number = page->page_number;
+				( *table_definition )->catalog_page_value_index = page_value_index;
+			}
 		}
 		if( libesedb_page_tree_value_free(
 		     &page_tree_value,
@@ -683,11 +806,13 @@ on_error:
 }
 
 /* Reads the catalog
+ * If LIBESEDB_CATALOG_READ_FLAG_TABLES_ONLY is set only the table catalog definitions are read
  * Returns 1 if successful or -1 on error
  */
 int libesedb_catalog_read_file_io_handle(
      libesedb_catalog_t *catalog,
      libbfio_handle_t *file_io_handle,
+     uint8_t read_flags,
      libcerror_error_t **error )
 {
 	libesedb_page_t *page                         = NULL;
@@ -761,6 +886,8 @@ int libesedb_catalog_read_file_io_handle(
 
 			return( -1 );
 		}
+		catalog->page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 		if( libfdata_vector_get_element_value_by_index(
 		     catalog->page_tree->pages_vector,
 		     (intptr_t *) file_io_handle,
@@ -783,6 +910,7 @@ int libesedb_catalog_read_file_io_handle(
 		if( libesedb_catalog_read_values_from_leaf_page(
 		     catalog,
 		     page,
+		     read_flags,
 		     &table_definition,
 		     error ) != 1 )
 		{
@@ -816,6 +944,311 @@ int libesedb_catalog_read_file_io_handle(
 	return( 1 );
 }
 
+/* Reads the column, index, long value and callback catalog definitions of a table definition
+ * that was read with LIBESEDB_CATALOG_READ_FLAG_TABLES_ONLY
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_table_definition_file_io_handle(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page                       = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_catalog_read_table_definition_file_io_handle";
+	uint32_t leaf_page_number                   = 0;
+	uint16_t catalog_definition_type            = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
+	int recursion_depth                         = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	/* A partially read table definition is not read again since
+	 * the catalog definitions that were read would be appended twice
+	 */
+	if( table_definition->catalog_read_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_INVALID,
+		 "%s: invalid table definition - unable to read catalog definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->catalog_leaf_page_number == 0 )
+	{
+		return( 1 );
+	}
+	leaf_page_number = table_definition->catalog_leaf_page_number;
+	page_value_index = table_definition->catalog_page_value_index + 1;
+
+	while( leaf_page_number != 0 )
+	{
+		if( recursion_depth > LIBESEDB_MAXIMUM_LEAF_PAGE_RECURSION_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid recursion depth value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+#if ( SIZEOF_INT <= 4 )
+		if( leaf_page_number > (uint32_t) INT_MAX )
+#else
+		if( leaf_page_number > (unsigned int) INT_MAX )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid leaf page number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		catalog->page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
+		if( libfdata_vector_get_element_value_by_index(
+		     catalog->page_tree->pages_vector,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) catalog->page_tree->pages_cache,
+		     (int) leaf_page_number - 1,
+		     (intptr_t **) &page,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		while( page_value_index < number_of_page_values )
+		{
+			if( libesedb_page_get_value_by_index(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			page_value_index++;
+
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			if( libesedb_page_tree_value_initialize(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create page tree value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_value_read_data(
+			     page_tree_value,
+			     page_value->data,
+			     (size_t) page_value->size,
+			     page_value->flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page tree value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_catalog_definition_read_type_from_data(
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     &catalog_definition_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog definition type.",
+				 function );
+
+				goto on_error;
+			}
+			/* The catalog definitions of a table end at the next table catalog definition
+			 */
+			if( catalog_definition_type == LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+			{
+				if( libesedb_page_tree_value_free(
+				     &page_tree_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free page tree value.",
+					 function );
+
+					goto on_error;
+				}
+				table_definition->catalog_leaf_page_number = 0;
+				table_definition->catalog_page_value_index = 0;
+
+				return( 1 );
+			}
+			if( libesedb_catalog_read_value_data(
+			     catalog,
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     &table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_value_free(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page tree value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libesedb_page_get_next_page_number(
+		     page,
+		     &leaf_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next page number from page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		page_value_index = 1;
+
+		recursion_depth++;
+	}
+	table_definition->catalog_leaf_page_number = 0;
+	table_definition->catalog_page_value_index = 0;
+
+	return( 1 );
+
+on_error:
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	table_definition->catalog_read_failed = 1;
+
+	return( -1 );
+}
+
 /* Retrieves the number of table definitions
  * Returns 1 if successful or -1 on error
  */
@@ -907,8 +1340,6 @@ int libesedb_catalog_get_table_definition_by_name(
 {
 	libesedb_table_definition_t *safe_table_definition = NULL;
 	static char *function                              = "libesedb_catalog_get_table_definition_by_name";
-	int entry_index                                    = 0;
-	int number_of_entries                              = 0;
 	int result                                         = 0;
 
 	if( catalog == NULL )
@@ -958,76 +1389,25 @@ int libesedb_catalog_get_table_definition_by_name(
 	}
 	*table_definition = NULL;
 
-	if( libcdata_array_get_number_of_entries(
-	     catalog->table_definition_array,
-	     &number_of_entries,
-	     error ) != 1 )
+	result = libesedb_name_hash_table_get_value_by_name(
+	          catalog->table_definition_name_hash_table,
+	          table_name,
+	          table_name_size,
+	          (intptr_t **) &safe_table_definition,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in table definition array.",
+		 "%s: unable to retrieve table definition by name from name hash table.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
-	{
-		if( libcdata_array_get_entry_by_index(
-		     catalog->table_definition_array,
-		     entry_index,
-		     (intptr_t **) &safe_table_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d from table definition array.",
-			 function,
-			 entry_index );
-
-			return( -1 );
-		}
-		if( safe_table_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table definition: %d.",
-			 function,
-			 entry_index );
-
-			return( -1 );
-		}
-		result = libesedb_catalog_definition_compare_name(
-			  safe_table_definition->table_catalog_definition,
-			  table_name,
-			  table_name_size,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: unable to compare table name with table catalog definition: %d name.",
-			 function,
-			 entry_index );
-
-			return( -1 );
-		}
-		else if( result == 1 )
-		{
-			break;
-		}
-	}
-	if( result != 0 )
+	else if( result != 0 )
 	{
 		*table_definition = safe_table_definition;
 	}
@@ -1046,8 +1426,6 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 {
 	libesedb_table_definition_t *safe_table_definition = NULL;
 	static char *function                              = "libesedb_catalog_get_table_definition_by_utf8_name";
-	int entry_index                                    = 0;
-	int number_of_entries                              = 0;
 	int result                                         = 0;
 
 	if( catalog == NULL )
@@ -1097,78 +1475,25 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 	}
 	*table_definition = NULL;
 
-	if( libcdata_array_get_number_of_entries(
-	     catalog->table_definition_array,
-	     &number_of_entries,
-	     error ) != 1 )
+	result = libesedb_name_hash_table_get_value_by_utf8_name(
+	          catalog->table_definition_name_hash_table,
+	          utf8_string,
+	          utf8_string_length,
+	          (intptr_t **) &safe_table_definition,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in table definition array.",
+		 "%s: unable to retrieve table definition by UTF-8 name from name hash table.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
-	{
-		if( libcdata_array_get_entry_by_index(
-		     catalog->table_definition_array,
-		     entry_index,
-		     (intptr_t **) &safe_table_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d from table definition array.",
-			 function,
-			 entry_index );
-
-			return( -1 );
-		}
-		if( safe_table_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table definition: %d.",
-			 function,
-			 entry_index );
-
-			return( -1 );
-		}
-		result = libesedb_catalog_definition_compare_name_with_utf8_string(
-			  safe_table_definition->table_catalog_definition,
-			  utf8_string,
-			  utf8_string_length,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: unable to compare UTF-8 string with table catalog definition: %d name.",
-			 function,
-			 entry_index );
-
-			return( -1 );
-		}
-		else if( result == LIBUNA_COMPARE_EQUAL )
-		{
-			result = 1;
-
-			break;
-		}
-	}
-	if( result != 0 )
+	else if( result != 0 )
 	{
 		*table_definition = safe_table_definition;
 	}
@@ -1187,8 +1512,6 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 {
 	libesedb_table_definition_t *safe_table_definition = NULL;
 	static char *function                              = "libesedb_catalog_get_table_definition_by_utf16_name";
-	int entry_index                                    = 0;
-	int number_of_entries                              = 0;
 	int result                                         = 0;
 
 	if( catalog == NULL )
@@ -1238,78 +1561,25 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 	}
 	*table_definition = NULL;
 
-	if( libcdata_array_get_number_of_entries(
-	     catalog->table_definition_array,
-	     &number_of_entries,
-	     error ) != 1 )
+	result = libesedb_name_hash_table_get_value_by_utf16_name(
+	          catalog->table_definition_name_hash_table,
+	          utf16_string,
+	          utf16_string_length,
+	          (intptr_t **) &safe_table_definition,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in table definition array.",
+		 "%s: unable to retrieve table definition by UTF-16 name from name hash table.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
-	{
-		if( libcdata_array_get_entry_by_index(
-		     catalog->table_definition_array,
-		     entry_index,
-		     (intptr_t **) &safe_table_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d from table definition array.",
-			 function,
-			 entry_index );
-
-			return( -1 );
-		}
-		if( safe_table_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table definition: %d.",
-			 function,
-			 entry_index );
-
-			return( -1 );
-		}
-		result = libesedb_catalog_definition_compare_name_with_utf16_string(
-			  safe_table_definition->table_catalog_definition,
-			  utf16_string,
-			  utf16_string_length,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: unable to compare UTF-16 string with table catalog definition: %d name.",
-			 function,
-			 entry_index );
-
-			return( -1 );
-		}
-		else if( result == LIBUNA_COMPARE_EQUAL )
-		{
-			result = 1;
-
-			break;
-		}
-	}
-	if( result != 0 )
+	else if( result != 0 )
 	{
 		*table_definition = safe_table_definition;
 	}
@@ -31,6 +31,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_name_hash_table.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 
@@ -49,6 +50,14 @@ struct libesedb_catalog
 	/* The table definition array
 	 */
 	libcdata_array_t *table_definition_array;
+
+	/* The table definition name hash table
+	 */
+	libesedb_name_hash_table_t *table_definition_name_hash_table;
+
+	/* The size of the catalog definitions that is accounted for in the memory usage
+	 */
+	size64_t memory_size;
 };
 
 int libesedb_catalog_initialize(
@@ -73,12 +82,20 @@ int libesedb_catalog_read_value_data(
 int libesedb_catalog_read_values_from_leaf_page(
      libesedb_catalog_t *catalog,
      libesedb_page_t *page,
+     uint8_t read_flags,
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error );
 
 int libesedb_catalog_read_file_io_handle(
      libesedb_catalog_t *catalog,
      libbfio_handle_t *file_io_handle,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
+int libesedb_catalog_read_table_definition_file_io_handle(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_table_definition_t *table_definition,
      libcerror_error_t **error );
 
 int libesedb_catalog_get_number_of_table_definitions(
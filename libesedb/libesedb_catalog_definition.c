@@ -1244,6 +1244,84 @@ int libesedb_catalog_definition_read_data(
 	return( 1 );
 }
 
+/* Reads the catalog definition type without reading the rest of the catalog definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_definition_read_type_from_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t *type,
+     libcerror_error_t **error )
+{
+	static char *function             = "libesedb_catalog_definition_read_type_from_data";
+	uint8_t last_fixed_size_data_type = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < ( sizeof( esedb_data_definition_header_t ) + 6 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: data too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	last_fixed_size_data_type = ( (esedb_data_definition_header_t *) data )->last_fixed_size_data_type;
+
+	/* The type is stored in the second fixed size data type
+	 */
+	if( last_fixed_size_data_type < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: last fixed size data type too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_data_definition_t *) &( data[ sizeof( esedb_data_definition_header_t ) ] ) )->type,
+	 *type );
+
+	return( 1 );
+}
+
 /* Retrieves the catalog definition identifier
  * Returns 1 if successful or -1 on error
  */
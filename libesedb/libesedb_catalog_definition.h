@@ -116,6 +116,12 @@ int libesedb_catalog_definition_read_data(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libesedb_catalog_definition_read_type_from_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t *type,
+     libcerror_error_t **error );
+
 int libesedb_catalog_definition_get_identifier(
      libesedb_catalog_definition_t *catalog_definition,
      uint32_t *identifier,
@@ -38,6 +38,7 @@
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_page.h"
+#include "libesedb_record_layout.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_value_data_handle.h"
 
@@ -146,6 +147,85 @@ int libesedb_data_definition_free(
 	return( 1 );
 }
 
+/* Clones a data definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_clone(
+     libesedb_data_definition_t **destination_data_definition,
+     libesedb_data_definition_t *source_data_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_data_definition_clone";
+
+	if( destination_data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_data_definition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination data definition value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_data_definition == NULL )
+	{
+		*destination_data_definition = NULL;
+
+		return( 1 );
+	}
+	*destination_data_definition = memory_allocate_structure(
+	                                libesedb_data_definition_t );
+
+	if( *destination_data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination data definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_data_definition,
+	     source_data_definition,
+	     sizeof( libesedb_data_definition_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination data definition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_data_definition != NULL )
+	{
+		memory_free(
+		 *destination_data_definition );
+
+		*destination_data_definition = NULL;
+	}
+	return( -1 );
+}
+
 /* Reads the data
  * Returns 1 if successful or -1 on error
  */
@@ -209,6 +289,8 @@ int libesedb_data_definition_read_data(
 
 		return( -1 );
 	}
+	io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 	if( libfdata_vector_get_element_value_at_offset(
 	     pages_vector,
 	     (intptr_t *) file_io_handle,
@@ -319,24 +401,19 @@ int libesedb_data_definition_read_record(
 	libesedb_catalog_definition_t *column_catalog_definition = NULL;
 	libesedb_page_t *page                                    = NULL;
 	libesedb_page_value_t *page_value                        = NULL;
+	libesedb_record_layout_t *record_layout                  = NULL;
+	libesedb_record_layout_column_t *record_layout_column    = NULL;
 	libfvalue_data_handle_t *value_data_handle               = NULL;
 	libfvalue_value_t *record_value                          = NULL;
 	uint8_t *record_data                                     = NULL;
-	uint8_t *tagged_data_type_offset_data                    = NULL;
 	static char *function                                    = "libesedb_data_definition_read_record";
 	size_t record_data_size                                  = 0;
 	size_t remaining_definition_data_size                    = 0;
 	off64_t element_data_offset                              = 0;
 	uint16_t data_offset                                     = 0;
 	uint16_t fixed_size_data_type_value_offset               = 0;
-	uint16_t masked_previous_tagged_data_type_offset         = 0;
-	uint16_t masked_tagged_data_type_offset                  = 0;
-	uint16_t previous_tagged_data_type_offset                = 0;
 	uint16_t previous_variable_size_data_type_size           = 0;
 	uint16_t tagged_data_type_identifier                     = 0;
-	uint16_t tagged_data_type_offset                         = 0;
-	uint16_t tagged_data_type_offset_bitmask                 = 0x3fff;
-	uint16_t tagged_data_type_offset_data_size               = 0;
 	uint16_t tagged_data_type_size                           = 0;
 	uint16_t tagged_data_type_value_offset                   = 0;
 	uint16_t tagged_data_types_offset                        = 0;
@@ -348,14 +425,10 @@ int libesedb_data_definition_read_record(
 	uint8_t last_fixed_size_data_type                        = 0;
 	uint8_t last_variable_size_data_type                     = 0;
 	uint8_t number_of_variable_size_data_types               = 0;
-	uint8_t record_value_type                                = 0;
 	uint8_t tagged_data_types_format                         = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX;
-	int column_catalog_definition_index                      = 0;
+	int column_index                                         = 0;
+	int default_encoding                                     = 0;
 	int encoding                                             = 0;
-	int number_of_column_catalog_definitions                 = 0;
-	int number_of_table_column_catalog_definitions           = 0;
-	int number_of_template_table_column_catalog_definitions  = 0;
-	int record_value_codepage                                = 0;
 
 	if( data_definition == NULL )
 	{
@@ -412,6 +485,8 @@ int libesedb_data_definition_read_record(
 
 		return( -1 );
 	}
+	io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 	if( libfdata_vector_get_element_value_at_offset(
 	     pages_vector,
 	     (intptr_t *) file_io_handle,
@@ -495,7 +570,7 @@ int libesedb_data_definition_read_record(
 		 "%s: invalid data definition - data offset value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	record_data      = &( page_value->data[ data_offset ] );
 	record_data_size = page_value->size - data_offset;
@@ -516,11 +591,6 @@ int libesedb_data_definition_read_record(
 	{
 		tagged_data_types_format = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_LINEAR;
 	}
-	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-	 && ( io_handle->page_size >= 16384 ) )
-	{
-		tagged_data_type_offset_bitmask = 0x7fff;
-	}
 	last_fixed_size_data_type    = ( (esedb_data_definition_header_t *) record_data )->last_fixed_size_data_type;
 	last_variable_size_data_type = ( (esedb_data_definition_header_t *) record_data )->last_variable_size_data_type;
 
@@ -547,57 +617,24 @@ int libesedb_data_definition_read_record(
 		 variable_size_data_types_offset );
 	}
 #endif
-	if( template_table_definition != NULL )
-	{
-		if( libesedb_table_definition_get_number_of_column_catalog_definitions(
-		     template_table_definition,
-		     &number_of_template_table_column_catalog_definitions,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of template table column catalog definitions.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( libesedb_table_definition_get_number_of_column_catalog_definitions(
+	if( libesedb_table_definition_get_record_layout(
 	     table_definition,
-	     &number_of_table_column_catalog_definitions,
+	     template_table_definition,
+	     &record_layout,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of table column catalog definitions.",
+		 "%s: unable to retrieve record layout.",
 		 function );
 
 		goto on_error;
 	}
-	number_of_column_catalog_definitions = number_of_table_column_catalog_definitions;
-
-	if( template_table_definition != NULL )
-	{
-		if( number_of_table_column_catalog_definitions > number_of_template_table_column_catalog_definitions )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid number of table column catalog definitions value exceeds number in template table.",
-			 function );
-
-			goto on_error;
-		}
-		number_of_column_catalog_definitions += number_of_template_table_column_catalog_definitions;
-	}
 	if( libcdata_array_resize(
 	     values_array,
-	     number_of_column_catalog_definitions,
+	     record_layout->number_of_columns,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
 	     error ) != 1 )
 	{
@@ -614,94 +651,47 @@ int libesedb_data_definition_read_record(
 	{
 		number_of_variable_size_data_types = last_variable_size_data_type - 127;
 	}
+	if( ( (size_t) variable_size_data_types_offset < sizeof( esedb_data_definition_header_t ) )
+	 || ( ( (size_t) variable_size_data_types_offset + ( (size_t) number_of_variable_size_data_types * 2 ) ) > record_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid variable size data types offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	default_encoding = io_handle->ascii_codepage;
+
+	/* Codepage 1200 in the ESE database format is not strict UTF-16 little-endian
+	 * it can be used for ASCII strings as well.
+	 */
+	if( default_encoding == 1200 )
+	{
+		default_encoding = LIBFVALUE_CODEPAGE_1200_MIXED;
+	}
 	fixed_size_data_type_value_offset    = (uint16_t) sizeof( esedb_data_definition_header_t );
 	current_variable_size_data_type      = 127;
 	variable_size_data_type_offset       = variable_size_data_types_offset;
 	variable_size_data_type_value_offset = variable_size_data_types_offset + ( number_of_variable_size_data_types * 2 );
 
-	for( column_catalog_definition_index = 0;
-	     column_catalog_definition_index < number_of_column_catalog_definitions;
-	     column_catalog_definition_index++ )
+	for( column_index = 0;
+	     column_index < record_layout->number_of_columns;
+	     column_index++ )
 	{
-		if( ( template_table_definition != NULL )
-		 && ( column_catalog_definition_index < number_of_template_table_column_catalog_definitions ) )
-		{
-			if( libesedb_table_definition_get_column_catalog_definition_by_index(
-			     template_table_definition,
-			     column_catalog_definition_index,
-			     &column_catalog_definition,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve column catalog definition: %d from template table.",
-				 function,
-				 column_catalog_definition_index );
-
-				goto on_error;
-			}
-		}
-		else
-		{
-			if( libesedb_table_definition_get_column_catalog_definition_by_index(
-			     table_definition,
-			     column_catalog_definition_index,
-			     &column_catalog_definition,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve column catalog definition: %d from table.",
-				 function,
-				 column_catalog_definition_index );
-
-				goto on_error;
-			}
-		}
-		if( column_catalog_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing column catalog definition: %d.",
-			 function,
-			 column_catalog_definition_index );
+		record_layout_column      = &( record_layout->columns[ column_index ] );
+		column_catalog_definition = record_layout_column->column_catalog_definition;
 
-			goto on_error;
-		}
-		if( column_catalog_definition->type != LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN )
+		/* In the index format the tagged data types are read when the corresponding value is requested
+		 */
+		if( ( tagged_data_types_format == LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX )
+		 && ( record_layout_column->identifier > 255 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported column catalog definition type: %" PRIu16 " for list element: %d.",
-			 function,
-			 column_catalog_definition->type,
-			 column_catalog_definition_index );
-
-			goto on_error;
+			continue;
 		}
-		if( ( template_table_definition != NULL )
-		 && ( column_catalog_definition_index == number_of_template_table_column_catalog_definitions ) )
-		{
-			if( column_catalog_definition->identifier != 256 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: only tagged data types supported in tables using a template table.",
-				 function );
 
-				goto on_error;
-			}
-		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -722,86 +712,6 @@ int libesedb_data_definition_read_record(
 			  column_catalog_definition->column_type ) );
 		}
 #endif
-/* TODO refactor to value type */
-
-		switch( column_catalog_definition->column_type )
-		{
-			case LIBESEDB_COLUMN_TYPE_NULL:
-				/* JET_coltypNil seems to be able to contain data */
-				record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_CURRENCY:
-			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_GUID:
-				record_value_type = LIBFVALUE_VALUE_TYPE_GUID;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
-			case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_TEXT:
-			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
-/* TODO handle this value type */
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
-				break;
-
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported column type: %" PRIu32 ".",
-				 function,
-				 column_catalog_definition->column_type );
-
-				goto on_error;
-		}
 		if( libfvalue_data_handle_initialize(
 		     &value_data_handle,
 		     (int (*)(libfvalue_data_handle_t *, const uint8_t *, size_t, int, uint32_t, libcerror_error_t **)) &libesedb_value_data_handle_read_value_entries,
@@ -816,52 +726,50 @@ int libesedb_data_definition_read_record(
 
 			goto on_error;
 		}
-		if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
-		 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
-		{
-			record_value_codepage = (int) column_catalog_definition->codepage;
+		encoding = record_layout_column->encoding;
 
-			/* If the codepage is not set use the default codepage
-			 */
-			if( record_value_codepage == 0 )
-			{
-				record_value_codepage = io_handle->ascii_codepage;
-			}
-			/* Codepage 1200 in the ESE database format is not strict UTF-16 little-endian
-			 * it can be used for ASCII strings as well.
-			 */
-			if( record_value_codepage == 1200 )
-			{
-				record_value_codepage = LIBFVALUE_CODEPAGE_1200_MIXED;
-			}
-			encoding = record_value_codepage;
-		}
-		else
+		/* If the codepage is not set use the default codepage
+		 */
+		if( encoding == 0 )
 		{
-			encoding = LIBFVALUE_ENDIAN_LITTLE;
+			encoding = default_encoding;
 		}
-		if( column_catalog_definition->identifier <= 127 )
+		if( record_layout_column->identifier <= 127 )
 		{
-			if( column_catalog_definition->identifier <= last_fixed_size_data_type )
+			if( record_layout_column->identifier <= last_fixed_size_data_type )
 			{
+				fixed_size_data_type_value_offset = record_layout_column->data_offset;
+
+				if( ( (size_t) fixed_size_data_type_value_offset + (size_t) record_layout_column->data_size ) > record_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid fixed size data type: %" PRIu32 " value out of bounds.",
+					 function,
+					 record_layout_column->identifier );
+
+					goto on_error;
+				}
 #if defined( HAVE_DEBUG_OUTPUT )
 				if( libcnotify_verbose != 0 )
 				{
 					libcnotify_printf(
-					 "%s: (%03" PRIu32 ") fixed size data type size\t\t: %" PRIu32 "\n",
+					 "%s: (%03" PRIu32 ") fixed size data type size\t\t: %" PRIu16 "\n",
 					 function,
-					 column_catalog_definition->identifier,
-					 column_catalog_definition->size );
+					 record_layout_column->identifier,
+					 record_layout_column->data_size );
 					libcnotify_print_data(
 					 &( record_data[ fixed_size_data_type_value_offset ] ),
-					 column_catalog_definition->size,
+					 record_layout_column->data_size,
 					 0 );
 				}
 #endif
 				if( libfvalue_data_handle_set_data(
 				     value_data_handle,
 				     &( record_data[ fixed_size_data_type_value_offset ] ),
-				     column_catalog_definition->size,
+				     record_layout_column->data_size,
 				     encoding,
 				     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
 				     error ) != 1 )
@@ -875,24 +783,24 @@ int libesedb_data_definition_read_record(
 
 					goto on_error;
 				}
-				if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
+				fixed_size_data_type_value_offset += record_layout_column->data_size;
+			}
+		}
+		else if( current_variable_size_data_type < last_variable_size_data_type )
+		{
+			while( current_variable_size_data_type < column_catalog_definition->identifier )
+			{
+				if( ( (size_t) variable_size_data_type_offset + 2 ) > record_data_size )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-					 "%s: invalid common catalog definition size value exceeds maximum.",
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid variable size data type offset value out of bounds.",
 					 function );
 
 					goto on_error;
 				}
-				fixed_size_data_type_value_offset += (uint16_t) column_catalog_definition->size;
-			}
-		}
-		else if( current_variable_size_data_type < last_variable_size_data_type )
-		{
-			while( current_variable_size_data_type < column_catalog_definition->identifier )
-			{
 				byte_stream_copy_to_uint16_little_endian(
 				 &( record_data[ variable_size_data_type_offset ] ),
 				 variable_size_data_type_size );
@@ -918,6 +826,19 @@ int libesedb_data_definition_read_record(
 					 */
 					if( ( variable_size_data_type_size & 0x8000 ) == 0 )
 					{
+						if( ( variable_size_data_type_size < previous_variable_size_data_type_size )
+						 || ( ( (size_t) variable_size_data_type_value_offset + (size_t) ( variable_size_data_type_size - previous_variable_size_data_type_size ) ) > record_data_size ) )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid variable size data type: %" PRIu32 " size value out of bounds.",
+							 function,
+							 column_catalog_definition->identifier );
+
+							goto on_error;
+						}
 #if defined( HAVE_DEBUG_OUTPUT )
 						if( libcnotify_verbose != 0 )
 						{
@@ -973,23 +894,43 @@ int libesedb_data_definition_read_record(
 			{
 				if( tagged_data_types_offset == 0 )
 				{
+					if( (size_t) variable_size_data_type_value_offset > record_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid tagged data types offset value out of bounds.",
+						 function );
+
+						goto on_error;
+					}
 					tagged_data_types_offset       = variable_size_data_type_value_offset;
 					tagged_data_type_value_offset  = variable_size_data_type_value_offset;
 					remaining_definition_data_size = record_data_size - (size_t) tagged_data_types_offset;
 
-					byte_stream_copy_to_uint16_little_endian(
-					 &( record_data[ tagged_data_type_value_offset ] ),
-					 tagged_data_type_identifier );
+					/* A record without tagged data types has no tagged data type header
+					 */
+					if( remaining_definition_data_size < 4 )
+					{
+						remaining_definition_data_size = 0;
+					}
+					else
+					{
+						byte_stream_copy_to_uint16_little_endian(
+						 &( record_data[ tagged_data_type_value_offset ] ),
+						 tagged_data_type_identifier );
 
-					tagged_data_type_value_offset += 2;
+						tagged_data_type_value_offset += 2;
 
-					byte_stream_copy_to_uint16_little_endian(
-					 &( record_data[ tagged_data_type_value_offset ] ),
-					 tagged_data_type_size );
+						byte_stream_copy_to_uint16_little_endian(
+						 &( record_data[ tagged_data_type_value_offset ] ),
+						 tagged_data_type_size );
 
-					tagged_data_type_value_offset += 2;
+						tagged_data_type_value_offset += 2;
 
-					remaining_definition_data_size -= 4;
+						remaining_definition_data_size -= 4;
+					}
 				}
 				if( ( remaining_definition_data_size > 0 )
 				 && ( column_catalog_definition->identifier == tagged_data_type_identifier ) )
@@ -1111,6 +1052,18 @@ int libesedb_data_definition_read_record(
 
 							goto on_error;
 						}
+						if( ( (size_t) tagged_data_type_value_offset + (size_t) tagged_data_type_size ) > record_data_size )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid tagged data type: %" PRIu32 " size value out of bounds.",
+							 function,
+							 column_catalog_definition->identifier );
+
+							goto on_error;
+						}
 						if( libfvalue_data_handle_set_data(
 						     value_data_handle,
 						     &( record_data[ tagged_data_type_value_offset ] ),
@@ -1132,12 +1085,13 @@ int libesedb_data_definition_read_record(
 					}
 					if( remaining_definition_data_size > 0 )
 					{
-						if( tagged_data_type_value_offset >= record_data_size )
+						if( ( remaining_definition_data_size < 4 )
+						 || ( ( (size_t) tagged_data_type_value_offset + 4 ) > record_data_size ) )
 						{
 							libcerror_error_set(
 							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
 							 "%s: invalid tagged data type offset value out of bounds.",
 							 function );
 
@@ -1159,312 +1113,736 @@ int libesedb_data_definition_read_record(
 					}
 				}
 			}
-			else if( tagged_data_types_format == LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX )
-			{
-				if( tagged_data_types_offset == 0 )
-				{
-					tagged_data_types_offset       = variable_size_data_type_value_offset;
-					tagged_data_type_offset_data   = &( record_data[ tagged_data_types_offset ] );
-					remaining_definition_data_size = record_data_size - (size_t) tagged_data_types_offset;
-
-					if( remaining_definition_data_size > 0 )
-					{
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_identifier );
-
-						tagged_data_type_offset_data += 2;
-
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_offset );
+		}
+		if( libfvalue_value_type_initialize_with_data_handle(
+		     &record_value,
+		     record_layout_column->value_type,
+		     value_data_handle,
+		     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record value.",
+			 function );
 
-						tagged_data_type_offset_data += 2;
+			goto on_error;
+		}
+		value_data_handle = NULL;
 
-						if( tagged_data_type_offset == 0 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type offset value out of bounds.",
-							 function );
+		if( libcdata_array_set_entry_by_index(
+		     values_array,
+		     column_index,
+		     (intptr_t *) record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to set data type definition: %d.",
+			 function,
+			 column_index );
 
-							goto on_error;
-						}
-						tagged_data_type_offset_data_size = ( tagged_data_type_offset & 0x3fff ) - 4;
+			goto on_error;
+		}
+		record_value = NULL;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( fixed_size_data_type_value_offset < variable_size_data_types_offset )
+		{
+			libcnotify_printf(
+			 "%s: fixed size data types trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( record_data[ fixed_size_data_type_value_offset ] ),
+			 variable_size_data_types_offset - fixed_size_data_type_value_offset,
+			 0 );
+		}
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
 
-						remaining_definition_data_size -= 4;
+on_error:
+	if( record_value != NULL )
+	{
+		libfvalue_value_free(
+		 &record_value,
+		 NULL );
+	}
+	if( value_data_handle != NULL )
+	{
+		libfvalue_data_handle_free(
+		 &value_data_handle,
+		 NULL );
+	}
+	return( -1 );
+}
 
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: tagged data type offset data size\t\t: %" PRIu16 "\n",
-							 function,
-							 tagged_data_type_offset_data_size );
-							libcnotify_printf(
-							 "%s: tagged data type offset data:\n",
-							 function );
-							libcnotify_print_data(
-							 tagged_data_type_offset_data,
-							 tagged_data_type_offset_data_size + 4,
-							 0 );
-						}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-					}
-				}
-				if( ( remaining_definition_data_size > 0 )
-				 && ( column_catalog_definition->identifier == tagged_data_type_identifier ) )
-				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type identifier\t\t: %" PRIu16 "\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_identifier );
+/* Retrieves the tagged data types offset
+ * The offset is relative to the start of the record data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_get_tagged_data_types_offset(
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint16_t *tagged_data_types_offset,
+     libcerror_error_t **error )
+{
+	static char *function                      = "libesedb_data_definition_get_tagged_data_types_offset";
+	size_t safe_tagged_data_types_offset       = 0;
+	size_t variable_size_data_type_offset      = 0;
+	uint16_t last_variable_size_data_type_size = 0;
+	uint16_t variable_size_data_type_size      = 0;
+	uint16_t variable_size_data_types_offset   = 0;
+	uint8_t last_variable_size_data_type       = 0;
+	uint8_t number_of_variable_size_data_types = 0;
+	uint8_t variable_size_data_type_index      = 0;
+
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
 
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type offset\t\t: 0x%04" PRIx16 " (%" PRIu16 ")\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_offset,
-						 tagged_data_type_offset & tagged_data_type_offset_bitmask );
-					}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		return( -1 );
+	}
+	if( ( record_data_size < sizeof( esedb_data_definition_header_t ) )
+	 || ( record_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
 
-					previous_tagged_data_type_offset = tagged_data_type_offset;
+		return( -1 );
+	}
+	if( tagged_data_types_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data types offset.",
+		 function );
 
-					if( tagged_data_type_offset_data_size > 0 )
-					{
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_identifier );
+		return( -1 );
+	}
+	last_variable_size_data_type = ( (esedb_data_definition_header_t *) record_data )->last_variable_size_data_type;
 
-						tagged_data_type_offset_data += 2;
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_data_definition_header_t *) record_data )->variable_size_data_types_offset,
+	 variable_size_data_types_offset );
 
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_offset );
+	if( last_variable_size_data_type > 127 )
+	{
+		number_of_variable_size_data_types = last_variable_size_data_type - 127;
+	}
+	variable_size_data_type_offset = (size_t) variable_size_data_types_offset;
+	safe_tagged_data_types_offset  = variable_size_data_type_offset + ( (size_t) number_of_variable_size_data_types * 2 );
 
-						tagged_data_type_offset_data += 2;
+	if( ( variable_size_data_type_offset < sizeof( esedb_data_definition_header_t ) )
+	 || ( safe_tagged_data_types_offset > record_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid variable size data types offset value out of bounds.",
+		 function );
 
-						tagged_data_type_offset_data_size -= 4;
-						remaining_definition_data_size    -= 4;
-					}
-					masked_previous_tagged_data_type_offset = previous_tagged_data_type_offset & tagged_data_type_offset_bitmask;
-					masked_tagged_data_type_offset          = tagged_data_type_offset & tagged_data_type_offset_bitmask;
+		return( -1 );
+	}
+	/* The variable size data type sizes contain the end offset of the data
+	 * where the MSB signifies that the variable size data type is empty
+	 */
+	for( variable_size_data_type_index = 0;
+	     variable_size_data_type_index < number_of_variable_size_data_types;
+	     variable_size_data_type_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( record_data[ variable_size_data_type_offset ] ),
+		 variable_size_data_type_size );
 
-					if( masked_previous_tagged_data_type_offset > masked_tagged_data_type_offset )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid tagged data type offset value exceeds next tagged data type offset.",
-						 function );
+		variable_size_data_type_offset += 2;
 
-						goto on_error;
-					}
-					if( masked_tagged_data_type_offset > masked_previous_tagged_data_type_offset )
-					{
-						tagged_data_type_size = masked_tagged_data_type_offset - masked_previous_tagged_data_type_offset;
-					}
-					else
-					{
-						tagged_data_type_size = (uint16_t) remaining_definition_data_size;
-					}
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type size\t\t: %" PRIu16 "\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_size );
-					}
-#endif
-					tagged_data_type_value_offset = tagged_data_types_offset + masked_previous_tagged_data_type_offset;
+		if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+		{
+			last_variable_size_data_type_size = variable_size_data_type_size;
+		}
+	}
+	safe_tagged_data_types_offset += (size_t) last_variable_size_data_type_size;
+
+	if( safe_tagged_data_types_offset > record_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data types offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*tagged_data_types_offset = (uint16_t) safe_tagged_data_types_offset;
+
+	return( 1 );
+}
+
+/* Retrieves a specific tagged data type from the tagged data types
+ * The tagged data types start with an array of identifier and offset pairs sorted by identifier,
+ * where the (masked) offset of the first pair contains the size of the array
+ * The tagged data type offset contains the offset relative to the start of the tagged data types
+ * including the offset flags
+ * Returns 1 if successful, 0 if no such tagged data type or -1 on error
+ */
+int libesedb_data_definition_get_tagged_data_type_by_identifier(
+     const uint8_t *tagged_data_types_data,
+     size_t tagged_data_types_data_size,
+     uint16_t tagged_data_type_offset_bitmask,
+     uint16_t column_identifier,
+     uint16_t *tagged_data_type_offset,
+     uint16_t *tagged_data_type_size,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libesedb_data_definition_get_tagged_data_type_by_identifier";
+	size_t next_tagged_data_type_offset          = 0;
+	size_t tagged_data_type_index_data_size      = 0;
+	uint16_t masked_next_tagged_data_type_offset = 0;
+	uint16_t masked_tagged_data_type_offset      = 0;
+	uint16_t safe_tagged_data_type_offset        = 0;
+	uint16_t tagged_data_type_identifier         = 0;
+	int entry_index                              = 0;
+	int lower_entry_index                        = 0;
+	int number_of_entries                        = 0;
+	int upper_entry_index                        = 0;
+
+	if( tagged_data_types_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data types data.",
+		 function );
+
+		return( -1 );
+	}
+	if( tagged_data_types_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid tagged data types data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( tagged_data_type_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data type offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( tagged_data_type_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tagged data type size.",
+		 function );
+
+		return( -1 );
+	}
+	if( tagged_data_types_data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( tagged_data_types_data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data types data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( tagged_data_types_data[ 2 ] ),
+	 safe_tagged_data_type_offset );
+
+	tagged_data_type_index_data_size = (size_t) ( safe_tagged_data_type_offset & tagged_data_type_offset_bitmask );
+
+	if( ( tagged_data_type_index_data_size < 4 )
+	 || ( tagged_data_type_index_data_size > tagged_data_types_data_size )
+	 || ( ( tagged_data_type_index_data_size % 4 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data type index data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = (int) ( tagged_data_type_index_data_size / 4 );
+	upper_entry_index = number_of_entries;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( tagged_data_types_data[ entry_index * 4 ] ),
+		 tagged_data_type_identifier );
+
+		if( tagged_data_type_identifier == column_identifier )
+		{
+			break;
+		}
+		if( tagged_data_type_identifier < column_identifier )
+		{
+			lower_entry_index = entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = entry_index;
+		}
+	}
+	if( lower_entry_index >= upper_entry_index )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( tagged_data_types_data[ ( entry_index * 4 ) + 2 ] ),
+	 safe_tagged_data_type_offset );
+
+	masked_tagged_data_type_offset = safe_tagged_data_type_offset & tagged_data_type_offset_bitmask;
+
+	if( ( entry_index + 1 ) < number_of_entries )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( tagged_data_types_data[ ( entry_index * 4 ) + 6 ] ),
+		 masked_next_tagged_data_type_offset );
+
+		masked_next_tagged_data_type_offset &= tagged_data_type_offset_bitmask;
+
+		next_tagged_data_type_offset = (size_t) masked_next_tagged_data_type_offset;
+	}
+	else
+	{
+		next_tagged_data_type_offset = tagged_data_types_data_size;
+	}
+	if( ( (size_t) masked_tagged_data_type_offset < tagged_data_type_index_data_size )
+	 || ( (size_t) masked_tagged_data_type_offset > next_tagged_data_type_offset )
+	 || ( next_tagged_data_type_offset > tagged_data_types_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data type: %" PRIu16 " offset value out of bounds.",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	*tagged_data_type_offset = safe_tagged_data_type_offset;
+	*tagged_data_type_size   = (uint16_t) ( next_tagged_data_type_offset - masked_tagged_data_type_offset );
+
+	return( 1 );
+}
+
+/* Reads a tagged value of the record
+ * Only the tagged data type of the column is read from the record data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_read_tagged_value(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     libesedb_record_layout_column_t *record_layout_column,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page                      = NULL;
+	libesedb_page_value_t *page_value          = NULL;
+	libfvalue_data_handle_t *value_data_handle = NULL;
+	uint8_t *record_data                       = NULL;
+	static char *function                      = "libesedb_data_definition_read_tagged_value";
+	size_t record_data_size                    = 0;
+	off64_t element_data_offset                = 0;
+	uint16_t data_offset                       = 0;
+	uint16_t tagged_data_type_offset           = 0;
+	uint16_t tagged_data_type_offset_bitmask   = 0x3fff;
+	uint16_t tagged_data_type_size             = 0;
+	uint16_t tagged_data_type_value_offset     = 0;
+	int encoding                               = 0;
+	int result                                 = 0;
+
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_layout_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout column.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_layout_column->identifier <= 255 )
+	 || ( record_layout_column->identifier > (uint32_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record layout column - identifier value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
+	if( libfdata_vector_get_element_value_at_offset(
+	     pages_vector,
+	     (intptr_t *) file_io_handle,
+	     (libfdata_cache_t *) pages_cache,
+	     data_definition->page_offset,
+	     &element_data_offset,
+	     (intptr_t **) &page,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 function,
+		 data_definition->page_number,
+		 data_definition->page_offset );
+
+		goto on_error;
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_value_by_index(
+	     page,
+	     data_definition->page_value_index,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 data_definition->page_value_index );
 
-					if( tagged_data_type_size > 0 )
-					{
-						if( tagged_data_type_size > remaining_definition_data_size )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type size value exceeds remaining data size.",
-							 function );
+		goto on_error;
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value: %" PRIu16 ".",
+		 function,
+		 data_definition->page_value_index );
 
-							goto on_error;
-						}
-						remaining_definition_data_size -= tagged_data_type_size;
+		goto on_error;
+	}
+	if( page_value->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value data.",
+		 function );
 
-						if( ( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-						  &&  ( io_handle->page_size >= 16384 ) )
-						 || ( ( previous_tagged_data_type_offset & 0x4000 ) != 0 ) )
-						{
-							if( tagged_data_type_value_offset >= record_data_size )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-								 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-								 "%s: invalid tagged data type offset value out of bounds.",
-								 function );
-
-								goto on_error;
-							}
-							if( libfvalue_data_handle_set_data_flags(
-							     value_data_handle,
-							     (uint32_t) record_data[ tagged_data_type_value_offset ],
-							     error ) != 1 )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-								 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-								 "%s: unable to set tagged data type flags in tagged data type definition.",
-								 function );
-
-								goto on_error;
-							}
-							tagged_data_type_value_offset += 1;
-							tagged_data_type_size         -= 1;
-						}
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: (%03" PRIu16 ") tagged data type:\n",
-							 function,
-							 column_catalog_definition->identifier );
+		goto on_error;
+	}
+	data_offset = data_definition->data_offset - page_value->offset;
 
-							if( tagged_data_type_value_offset < record_data_size )
-							{
-								libcnotify_print_data(
-								 &( record_data[ tagged_data_type_value_offset ] ),
-								 tagged_data_type_size,
-								 0 );
-							}
-							else
-							{
-								libcnotify_printf(
-								 "<NULL>\n\n" );
-							}
-						}
-#endif
-					}
-#if defined( HAVE_DEBUG_OUTPUT )
-					/* TODO are zero size tagged data type values handled correctly?
-					 */
-					else if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu32 ") tagged data type\t\t\t: <NULL>\n",
-						 function,
-						 column_catalog_definition->identifier );
-					}
-#endif
-					if( tagged_data_type_size > 0 )
-					{
-						if( tagged_data_type_value_offset >= record_data_size )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type offset value out of bounds.",
-							 function );
+	if( ( data_definition->data_offset < page_value->offset )
+	 || ( data_offset > page_value->size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data definition - data offset value out of bounds.",
+		 function );
 
-							goto on_error;
-						}
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     tagged_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in tagged data type definition.",
-							 function );
+		goto on_error;
+	}
+	record_data      = &( page_value->data[ data_offset ] );
+	record_data_size = page_value->size - data_offset;
 
-							goto on_error;
-						}
-					}
-				}
-			}
-		}
-		if( libfvalue_value_type_initialize_with_data_handle(
-		     &record_value,
-		     record_value_type,
-		     value_data_handle,
-		     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
+	if( data_definition->tagged_data_types_offset == 0 )
+	{
+		if( libesedb_data_definition_get_tagged_data_types_offset(
+		     record_data,
+		     record_data_size,
+		     &( data_definition->tagged_data_types_offset ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create record value.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve tagged data types offset.",
 			 function );
 
 			goto on_error;
 		}
-		value_data_handle = NULL;
+	}
+	if( (size_t) data_definition->tagged_data_types_offset > record_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data definition - tagged data types offset value out of bounds.",
+		 function );
 
-		if( libcdata_array_set_entry_by_index(
-		     values_array,
-		     column_catalog_definition_index,
-		     (intptr_t *) record_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to set data type definition: %d.",
-			 function,
-			 column_catalog_definition_index );
+		goto on_error;
+	}
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		tagged_data_type_offset_bitmask = 0x7fff;
+	}
+	encoding = record_layout_column->encoding;
 
-			goto on_error;
+	/* If the codepage is not set use the default codepage
+	 */
+	if( encoding == 0 )
+	{
+		encoding = io_handle->ascii_codepage;
+
+		/* Codepage 1200 in the ESE database format is not strict UTF-16 little-endian
+		 * it can be used for ASCII strings as well.
+		 */
+		if( encoding == 1200 )
+		{
+			encoding = LIBFVALUE_CODEPAGE_1200_MIXED;
 		}
-		record_value = NULL;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libfvalue_data_handle_initialize(
+	     &value_data_handle,
+	     (int (*)(libfvalue_data_handle_t *, const uint8_t *, size_t, int, uint32_t, libcerror_error_t **)) &libesedb_value_data_handle_read_value_entries,
+	     error ) != 1 )
 	{
-		if( fixed_size_data_type_value_offset < variable_size_data_types_offset )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value data handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          &( record_data[ data_definition->tagged_data_types_offset ] ),
+	          record_data_size - (size_t) data_definition->tagged_data_types_offset,
+	          tagged_data_type_offset_bitmask,
+	          (uint16_t) record_layout_column->identifier,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve tagged data type: %" PRIu32 ".",
+		 function,
+		 record_layout_column->identifier );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		tagged_data_type_value_offset = data_definition->tagged_data_types_offset
+		                              + ( tagged_data_type_offset & tagged_data_type_offset_bitmask );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
-			 "%s: fixed size data types trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( record_data[ fixed_size_data_type_value_offset ] ),
-			 variable_size_data_types_offset - fixed_size_data_type_value_offset,
-			 0 );
+			 "%s: (%03" PRIu32 ") tagged data type offset\t\t: 0x%04" PRIx16 " (%" PRIu16 ")\n",
+			 function,
+			 record_layout_column->identifier,
+			 tagged_data_type_offset,
+			 tagged_data_type_offset & tagged_data_type_offset_bitmask );
+
+			libcnotify_printf(
+			 "%s: (%03" PRIu32 ") tagged data type size\t\t: %" PRIu16 "\n",
+			 function,
+			 record_layout_column->identifier,
+			 tagged_data_type_size );
 		}
-		libcnotify_printf(
-		 "\n" );
-	}
 #endif
-	return( 1 );
+		if( tagged_data_type_size > 0 )
+		{
+			if( ( tagged_data_type_offset_bitmask == 0x7fff )
+			 || ( ( tagged_data_type_offset & 0x4000 ) != 0 ) )
+			{
+				if( libfvalue_data_handle_set_data_flags(
+				     value_data_handle,
+				     (uint32_t) record_data[ tagged_data_type_value_offset ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set tagged data type flags in tagged data type definition.",
+					 function );
 
-on_error:
-	if( record_value != NULL )
+					goto on_error;
+				}
+				tagged_data_type_value_offset += 1;
+				tagged_data_type_size         -= 1;
+			}
+		}
+		if( tagged_data_type_size > 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: (%03" PRIu32 ") tagged data type:\n",
+				 function,
+				 record_layout_column->identifier );
+				libcnotify_print_data(
+				 &( record_data[ tagged_data_type_value_offset ] ),
+				 tagged_data_type_size,
+				 0 );
+			}
+#endif
+			if( libfvalue_data_handle_set_data(
+			     value_data_handle,
+			     &( record_data[ tagged_data_type_value_offset ] ),
+			     tagged_data_type_size,
+			     encoding,
+			     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data in tagged data type definition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libfvalue_value_type_initialize_with_data_handle(
+	     record_value,
+	     record_layout_column->value_type,
+	     value_data_handle,
+	     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
+	     error ) != 1 )
 	{
-		libfvalue_value_free(
-		 &record_value,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record value.",
+		 function );
+
+		goto on_error;
 	}
+	return( 1 );
+
+on_error:
 	if( value_data_handle != NULL )
 	{
 		libfvalue_data_handle_free(
@@ -1697,6 +2075,8 @@ int libesedb_data_definition_read_long_value_segment(
 
 		return( -1 );
 	}
+	io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 	if( libfdata_vector_get_element_value_at_offset(
 	     pages_vector,
 	     (intptr_t *) file_io_handle,
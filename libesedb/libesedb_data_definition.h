@@ -31,6 +31,8 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
+#include "libesedb_record_layout.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
@@ -60,6 +62,16 @@ struct libesedb_data_definition
 	/* The data size
 	 */
 	uint16_t data_size;
+
+	/* The tagged data types offset relative to the start of the record data
+	 * or 0 if not determined
+	 */
+	uint16_t tagged_data_types_offset;
+
+	/* The carve confidence
+	 * or LIBESEDB_CARVE_CONFIDENCE_NONE if the data was not carved
+	 */
+	uint8_t carve_confidence;
 };
 
 int libesedb_data_definition_initialize(
@@ -70,6 +82,11 @@ int libesedb_data_definition_free(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error );
 
+int libesedb_data_definition_clone(
+     libesedb_data_definition_t **destination_data_definition,
+     libesedb_data_definition_t *source_data_definition,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_data(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
@@ -92,6 +109,31 @@ int libesedb_data_definition_read_record(
      uint8_t *record_flags,
      libcerror_error_t **error );
 
+int libesedb_data_definition_get_tagged_data_types_offset(
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint16_t *tagged_data_types_offset,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_get_tagged_data_type_by_identifier(
+     const uint8_t *tagged_data_types_data,
+     size_t tagged_data_types_data_size,
+     uint16_t tagged_data_type_offset_bitmask,
+     uint16_t column_identifier,
+     uint16_t *tagged_data_type_offset,
+     uint16_t *tagged_data_type_size,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_read_tagged_value(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     libesedb_record_layout_column_t *record_layout_column,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
@@ -24,9 +24,12 @@
 #include <types.h>
 
 #include "libesedb_data_segment.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_unused.h"
 
@@ -146,6 +149,7 @@ int libesedb_data_segment_free(
      libcerror_error_t **error )
 {
 	static char *function = "libesedb_data_segment_free";
+	int result            = 1;
 
 	if( data_segment == NULL )
 	{
@@ -162,6 +166,23 @@ int libesedb_data_segment_free(
 	{
 		if( ( *data_segment )->data != NULL )
 		{
+			if( ( *data_segment )->io_handle != NULL )
+			{
+				if( libesedb_io_handle_remove_memory_usage(
+				     ( *data_segment )->io_handle,
+				     (size64_t) ( *data_segment )->data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to remove data size from memory usage.",
+					 function );
+
+					result = -1;
+				}
+			}
 			memory_free(
 			 ( *data_segment )->data );
 		}
@@ -170,7 +191,7 @@ int libesedb_data_segment_free(
 
 		*data_segment = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the data size
@@ -284,10 +305,11 @@ int libesedb_data_segment_get_data(
 
 /* Reads a data segment
  * Callback for the data segments list
+ * The IO handle is optional and used to maintain the statistics and memory usage
  * Returns 1 if successful or -1 on error
  */
 int libesedb_data_segment_read_element_data(
-     intptr_t *data_handle LIBESEDB_ATTRIBUTE_UNUSED,
+     libesedb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfdata_list_element_t *element,
      libfdata_cache_t *cache,
@@ -301,8 +323,10 @@ int libesedb_data_segment_read_element_data(
 	libesedb_data_segment_t *data_segment = NULL;
 	static char *function                 = "libesedb_data_segment_read_element_data";
 	ssize_t read_count                    = 0;
+	int number_of_cache_values            = 0;
+	int previous_number_of_cache_values   = 0;
+	int result                            = 0;
 
-	LIBESEDB_UNREFERENCED_PARAMETER( data_handle )
 	LIBESEDB_UNREFERENCED_PARAMETER( element_file_index )
 	LIBESEDB_UNREFERENCED_PARAMETER( element_flags )
 	LIBESEDB_UNREFERENCED_PARAMETER( read_flags )
@@ -344,6 +368,72 @@ int libesedb_data_segment_read_element_data(
 
 		goto on_error;
 	}
+	if( io_handle != NULL )
+	{
+		result = libesedb_io_handle_check_memory_limit(
+		          io_handle,
+		          element_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if data segment is within memory limit.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* Shrink the cache to make room for the data segment
+			 */
+			if( libfcache_cache_get_number_of_cache_values(
+			     (libfcache_cache_t *) cache,
+			     &previous_number_of_cache_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of cache values.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfcache_cache_clear(
+			     (libfcache_cache_t *) cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear cache.",
+				 function );
+
+				goto on_error;
+			}
+			io_handle->statistics[ LIBESEDB_STATISTIC_DATA_SEGMENTS_CACHE_EVICTIONS ] += (uint64_t) previous_number_of_cache_values;
+		}
+		if( libesedb_io_handle_add_memory_usage(
+		     io_handle,
+		     element_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add data segment size to memory usage.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libesedb_data_segment_initialize(
 	     &data_segment,
 	     (size_t) element_size,
@@ -356,8 +446,19 @@ int libesedb_data_segment_read_element_data(
 		 "%s: unable to create data segment.",
 		 function );
 
+		if( io_handle != NULL )
+		{
+			libesedb_io_handle_remove_memory_usage(
+			 io_handle,
+			 element_size,
+			 NULL );
+		}
 		goto on_error;
 	}
+	/* The data size is removed from the memory usage when the data segment is freed
+	 */
+	data_segment->io_handle = io_handle;
+
 	read_count = libbfio_handle_read_buffer(
 		      file_io_handle,
 		      data_segment->data,
@@ -376,6 +477,20 @@ int libesedb_data_segment_read_element_data(
 
 		goto on_error;
 	}
+	if( libfcache_cache_get_number_of_cache_values(
+	     (libfcache_cache_t *) cache,
+	     &previous_number_of_cache_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache values.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfdata_list_element_set_element_value(
 	     element,
 	     (intptr_t *) file_io_handle,
@@ -394,6 +509,32 @@ int libesedb_data_segment_read_element_data(
 
 		goto on_error;
 	}
+	if( io_handle != NULL )
+	{
+		if( libfcache_cache_get_number_of_cache_values(
+		     (libfcache_cache_t *) cache,
+		     &number_of_cache_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of cache values.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->statistics[ LIBESEDB_STATISTIC_DATA_SEGMENTS_CACHE_MISSES ]        += 1;
+		io_handle->statistics[ LIBESEDB_STATISTIC_NUMBER_OF_DATA_SEGMENT_BYTES_READ ] += (uint64_t) read_count;
+
+		/* If the number of cache values did not increase the data segment replaced another data segment
+		 */
+		if( number_of_cache_values <= previous_number_of_cache_values )
+		{
+			io_handle->statistics[ LIBESEDB_STATISTIC_DATA_SEGMENTS_CACHE_EVICTIONS ] += 1;
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfdata.h"
@@ -44,6 +45,10 @@ struct libesedb_data_segment
 	/* The (segment) data size
 	 */
 	size_t data_size;
+
+	/* The IO handle that maintains the memory usage of the data
+	 */
+	libesedb_io_handle_t *io_handle;
 };
 
 int libesedb_data_segment_initialize(
@@ -67,7 +72,7 @@ int libesedb_data_segment_get_data(
      libcerror_error_t **error );
 
 int libesedb_data_segment_read_element_data(
-     intptr_t *data_handle,
+     libesedb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfdata_list_element_t *element,
      libfdata_cache_t *cache,
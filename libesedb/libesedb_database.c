@@ -482,6 +482,8 @@ int libesedb_database_read_file_io_handle(
 
 			return( -1 );
 		}
+		database->page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 		if( libfdata_vector_get_element_value_by_index(
 		     database->page_tree->pages_vector,
 		     (intptr_t *) file_io_handle,
@@ -28,6 +28,12 @@
 
 #if !defined( HAVE_LOCAL_LIBESEDB )
 #include <libesedb/error.h>
+
+#else
+/* The error codes in <libesedb/error.h> that are not defined by libcerror
+ * are copied here for local use of libesedb
+ */
+#define LIBESEDB_MEMORY_ERROR_LIMIT_EXCEEDED		4
 #endif
 
 #include "libesedb_extern.h"
@@ -41,6 +41,7 @@
 #include "libesedb_page.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
+#include "libesedb_table_state.h"
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -532,6 +533,170 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+/* Opens a file from a buffer
+ * The data is referenced and not copied, it must remain valid until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_open_memory(
+     libesedb_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_open_memory";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBESEDB_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBESEDB_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file header and long value data are read by means of a memory range
+	 * the pages are referenced directly in the data
+	 */
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->memory_data      = data;
+	internal_file->io_handle->memory_data_size = (size64_t) data_size;
+
+	if( libesedb_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from memory.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	if( internal_file->io_handle != NULL )
+	{
+		internal_file->io_handle->memory_data      = NULL;
+		internal_file->io_handle->memory_data_size = 0;
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Opens a file using a Basic File IO (bfio) handle
  * Returns 1 if successful or -1 on error
  */
@@ -597,6 +762,14 @@ int libesedb_file_open_file_io_handle(
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
 	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_LAZY_CATALOG ) != 0 )
+	{
+		internal_file->catalog_read_flags = LIBESEDB_CATALOG_READ_FLAG_TABLES_ONLY;
+	}
+	else
+	{
+		internal_file->catalog_read_flags = 0;
+	}
 	file_io_handle_is_open = libbfio_handle_is_open(
 	                          file_io_handle,
 	                          error );
@@ -792,6 +965,19 @@ int libesedb_file_close(
 
 		result = -1;
 	}
+	if( libfcache_cache_free(
+	     &( internal_file->table_states_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table states cache.",
+		 function );
+
+		result = -1;
+	}
 	if( libesedb_database_free(
 	     &( internal_file->database ),
 	     error ) != 1 )
@@ -926,6 +1112,17 @@ int libesedb_file_open_read(
 
 		return( -1 );
 	}
+	if( internal_file->table_states_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - table states cache already set.",
+		 function );
+
+		return( -1 );
+	}
 	internal_file->io_handle->abort = 0;
 
 	if( libbfio_handle_get_size(
@@ -1270,6 +1467,20 @@ int libesedb_file_open_read(
 
 		goto on_error;
 	}
+	if( libfcache_cache_initialize(
+	     &( internal_file->table_states_cache ),
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_STATES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table states cache.",
+		 function );
+
+		goto on_error;
+	}
 	if( internal_file->io_handle->file_type == LIBESEDB_FILE_TYPE_DATABASE )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1336,6 +1547,7 @@ int libesedb_file_open_read(
 		if( libesedb_catalog_read_file_io_handle(
 		     internal_file->catalog,
 		     file_io_handle,
+		     internal_file->catalog_read_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1347,43 +1559,49 @@ int libesedb_file_open_read(
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		/* The backup catalog is not used when the table definitions are read on demand
+		 */
+		if( ( internal_file->catalog_read_flags & LIBESEDB_CATALOG_READ_FLAG_TABLES_ONLY ) == 0 )
 		{
-			libcnotify_printf(
-			 "Reading the backup catalog:\n" );
-		}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading the backup catalog:\n" );
+			}
 #endif
-		if( libesedb_catalog_initialize(
-		     &( internal_file->backup_catalog ),
-		     internal_file->io_handle,
-		     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
-		     internal_file->pages_vector,
-		     internal_file->pages_cache,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create backup catalog.",
-			 function );
+			if( libesedb_catalog_initialize(
+			     &( internal_file->backup_catalog ),
+			     internal_file->io_handle,
+			     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
+			     internal_file->pages_vector,
+			     internal_file->pages_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create backup catalog.",
+				 function );
 
-			goto on_error;
-		}
-		if( libesedb_catalog_read_file_io_handle(
-		     internal_file->backup_catalog,
-		     file_io_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read backup catalog.",
-			 function );
+				goto on_error;
+			}
+			if( libesedb_catalog_read_file_io_handle(
+			     internal_file->backup_catalog,
+			     file_io_handle,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read backup catalog.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 /* TODO compare contents of catalogs ? */
 	}
@@ -1410,6 +1628,12 @@ on_error:
 		 &( internal_file->database ),
 		 NULL );
 	}
+	if( internal_file->table_states_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->table_states_cache ),
+		 NULL );
+	}
 	if( internal_file->pages_cache != NULL )
 	{
 		libfcache_cache_free(
@@ -1433,18 +1657,28 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the file type
+/* Retrieves the table state of a specific table definition
+ * The table state is shared by the tables of the same table definition and kept
+ * in the table states cache so that the pages cache and page trees can be reused
  * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_type(
-     libesedb_file_t *file,
-     uint32_t *type,
+int libesedb_file_get_table_state(
+     libesedb_internal_file_t *internal_file,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_table_state_t **table_state,
      libcerror_error_t **error )
 {
-	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_type";
+	libesedb_table_state_t *safe_table_state = NULL;
+	libfcache_cache_value_t *cache_value     = NULL;
+	static char *function                    = "libesedb_file_get_table_state";
+	off64_t cache_value_offset               = 0;
+	int64_t cache_value_timestamp            = 0;
+	uint32_t identifier                      = 0;
+	int cache_entry_index                    = 0;
+	int cache_value_file_index               = -1;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1455,40 +1689,214 @@ int libesedb_file_get_type(
 
 		return( -1 );
 	}
-	internal_file = (libesedb_internal_file_t *) file;
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
 
-	if( internal_file->io_handle == NULL )
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid table definition - missing table catalog definition.",
 		 function );
 
 		return( -1 );
 	}
-	if( type == NULL )
+	if( table_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid type.",
+		 "%s: invalid table state.",
 		 function );
 
 		return( -1 );
 	}
-	*type = internal_file->io_handle->file_type;
+	/* The Father Data Page (FDP) object identifier uniquely identifies the table
+	 */
+	identifier        = table_definition->table_catalog_definition->identifier;
+	cache_entry_index = (int) ( identifier % LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_STATES );
 
-	return( 1 );
-}
+	internal_file->io_handle->statistics[ LIBESEDB_STATISTIC_TABLE_STATES_CACHE_LOOKUPS ] += 1;
 
-/* Retrieves the file (current) version
- * Returns 1 if successful or -1 on error
- */
-int libesedb_file_get_format_version(
-     libesedb_file_t *file,
+	if( libfcache_cache_get_value_by_index(
+	     internal_file->table_states_cache,
+	     cache_entry_index,
+	     &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d from table states cache.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( cache_value != NULL )
+	{
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &cache_value_file_index,
+		     &cache_value_offset,
+		     &cache_value_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value identifier.",
+			 function );
+
+			return( -1 );
+		}
+		if( cache_value_offset == (off64_t) identifier )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &safe_table_state,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve table state from cache value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( safe_table_state == NULL )
+	{
+		internal_file->io_handle->statistics[ LIBESEDB_STATISTIC_TABLE_STATES_CACHE_MISSES ] += 1;
+
+		/* The cache entry is occupied by the table state of another table
+		 */
+		if( cache_value != NULL )
+		{
+			internal_file->io_handle->statistics[ LIBESEDB_STATISTIC_TABLE_STATES_CACHE_EVICTIONS ] += 1;
+		}
+		if( libesedb_table_state_initialize(
+		     &safe_table_state,
+		     internal_file->io_handle,
+		     table_definition,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create table state.",
+			 function );
+
+			return( -1 );
+		}
+		/* The table states cache holds a reference to the table state that is freed
+		 * when the cache value is replaced or the cache is freed
+		 */
+		if( libfcache_cache_set_value_by_index(
+		     internal_file->table_states_cache,
+		     cache_entry_index,
+		     0,
+		     (off64_t) identifier,
+		     0,
+		     (intptr_t *) safe_table_state,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_table_state_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set table state in cache entry: %d.",
+			 function,
+			 cache_entry_index );
+
+			libesedb_table_state_free(
+			 &safe_table_state,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	*table_state = safe_table_state;
+
+	return( 1 );
+}
+
+/* Retrieves the file type
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_type(
+     libesedb_file_t *file,
+     uint32_t *type,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_type";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	*type = internal_file->io_handle->file_type;
+
+	return( 1 );
+}
+
+/* Retrieves the file (current) version
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_format_version(
+     libesedb_file_t *file,
      uint32_t *format_version,
      uint32_t *format_revision,
      libcerror_error_t **error )
@@ -1496,69 +1904,442 @@ int libesedb_file_get_format_version(
 	libesedb_internal_file_t *internal_file = NULL;
 	static char *function                   = "libesedb_file_get_format_version";
 
-	if( file == NULL )
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_revision == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format revision.",
+		 function );
+
+		return( -1 );
+	}
+	*format_version  = internal_file->io_handle->format_version;
+	*format_revision = internal_file->io_handle->format_revision;
+
+	return( 1 );
+}
+
+/* Retrieves the file creation format version
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_creation_format_version(
+     libesedb_file_t *file,
+     uint32_t *format_version,
+     uint32_t *format_revision,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_creation_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_revision == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format revision.",
+		 function );
+
+		return( -1 );
+	}
+	*format_version  = internal_file->io_handle->creation_format_version;
+	*format_revision = internal_file->io_handle->creation_format_revision;
+
+	return( 1 );
+}
+
+/* Retrieves the file page size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_page_size(
+     libesedb_file_t *file,
+     uint32_t *page_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_page_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page size.",
+		 function );
+
+		return( -1 );
+	}
+	*page_size = internal_file->io_handle->page_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_number_of_pages(
+     libesedb_file_t *file,
+     uint32_t *number_of_pages,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_number_of_pages";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_pages = internal_file->io_handle->last_page_number;
+
+	return( 1 );
+}
+
+/* Retrieves the information of a specific page
+ * The page is read directly from the file and is not stored in the page cache
+ * The page number is relative to the first page after the file header and its backup
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_page_information(
+     libesedb_file_t *file,
+     uint32_t page_number,
+     uint32_t *father_data_page_object_identifier,
+     uint8_t *page_type,
+     uint16_t *available_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	libesedb_page_t *page                   = NULL;
+	static char *function                   = "libesedb_file_get_page_information";
+	off64_t page_offset                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > internal_file->io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	page_offset = ( (off64_t) page_number + 1 ) * internal_file->io_handle->page_size;
+
+	if( libesedb_page_initialize(
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_read_file_io_handle(
+	     page,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     page_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_father_data_page_object_identifier(
+	     page,
+	     father_data_page_object_identifier,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve father data page object identifier.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_file = (libesedb_internal_file_t *) file;
+	if( libesedb_page_get_type(
+	     page,
+	     page_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page type.",
+		 function );
 
-	if( internal_file->io_handle == NULL )
+		goto on_error;
+	}
+	if( libesedb_page_get_available_data_size(
+	     page,
+	     available_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve available data size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( format_version == NULL )
+	if( libesedb_page_free(
+	     &page,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( format_revision == NULL )
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the runtime statistics
+ * The statistics are indexed by the LIBESEDB_STATISTIC definitions and accumulated
+ * since the file was opened or the statistics were last reset
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_statistics(
+     libesedb_file_t *file,
+     uint64_t *statistics,
+     int number_of_statistics,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_statistics";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format revision.",
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	*format_version  = internal_file->io_handle->format_version;
-	*format_revision = internal_file->io_handle->format_revision;
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( libesedb_io_handle_get_statistics(
+	     internal_file->io_handle,
+	     statistics,
+	     number_of_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
-/* Retrieves the file creation format version
+/* Resets the runtime statistics
  * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_creation_format_version(
+int libesedb_file_reset_statistics(
      libesedb_file_t *file,
-     uint32_t *format_version,
-     uint32_t *format_revision,
      libcerror_error_t **error )
 {
 	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_creation_format_version";
+	static char *function                   = "libesedb_file_reset_statistics";
 
 	if( file == NULL )
 	{
@@ -1573,55 +2354,84 @@ int libesedb_file_get_creation_format_version(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( libesedb_io_handle_reset_statistics(
+	     internal_file->io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset statistics.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_version == NULL )
+	return( 1 );
+}
+
+/* Sets the trace callback function
+ * A callback function of NULL disables tracing
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_trace_callback(
+     libesedb_file_t *file,
+     void (*callback_function)(
+            intptr_t *callback_data,
+            int event,
+            uint64_t identifier,
+            uint64_t start_timestamp,
+            uint64_t end_timestamp,
+            uint64_t size ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_trace_callback";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_revision == NULL )
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( libesedb_io_handle_set_trace_callback(
+	     internal_file->io_handle,
+	     callback_function,
+	     callback_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format revision.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set trace callback.",
 		 function );
 
 		return( -1 );
 	}
-	*format_version  = internal_file->io_handle->creation_format_version;
-	*format_revision = internal_file->io_handle->creation_format_revision;
-
 	return( 1 );
 }
 
-/* Retrieves the file page size
+/* Retrieves the memory usage
+ * The memory usage is the number of bytes held by the caches, the catalog,
+ * the leaf page descriptors and the records and long values that were not freed
  * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_page_size(
+int libesedb_file_get_memory_usage(
      libesedb_file_t *file,
-     uint32_t *page_size,
+     size64_t *memory_usage,
      libcerror_error_t **error )
 {
 	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_page_size";
+	static char *function                   = "libesedb_file_get_memory_usage";
 
 	if( file == NULL )
 	{
@@ -1636,30 +2446,62 @@ int libesedb_file_get_page_size(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( libesedb_io_handle_get_memory_usage(
+	     internal_file->io_handle,
+	     memory_usage,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory usage.",
 		 function );
 
 		return( -1 );
 	}
-	if( page_size == NULL )
+	return( 1 );
+}
+
+/* Sets the memory limit
+ * A memory limit of 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_memory_limit(
+     libesedb_file_t *file,
+     size64_t memory_limit,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_memory_limit";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page size.",
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	*page_size = internal_file->io_handle->page_size;
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( libesedb_io_handle_set_memory_limit(
+	     internal_file->io_handle,
+	     memory_limit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory limit.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -1734,6 +2576,7 @@ int libesedb_file_get_table(
 	libesedb_internal_file_t *internal_file                = NULL;
 	libesedb_table_definition_t *table_definition          = NULL;
 	libesedb_table_definition_t *template_table_definition = NULL;
+	libesedb_table_state_t *table_state                    = NULL;
 	static char *function                                  = "libesedb_file_get_table";
 
 	if( file == NULL )
@@ -1827,6 +2670,52 @@ int libesedb_file_get_table(
 
 			return( -1 );
 		}
+		if( libesedb_catalog_read_table_definition_file_io_handle(
+		     internal_file->catalog,
+		     internal_file->file_io_handle,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read template table definition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_catalog_read_table_definition_file_io_handle(
+	     internal_file->catalog,
+	     internal_file->file_io_handle,
+	     table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_get_table_state(
+	     internal_file,
+	     table_definition,
+	     template_table_definition,
+	     &table_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table state.",
+		 function );
+
+		return( -1 );
 	}
 	if( libesedb_table_initialize(
 	     table,
@@ -1834,6 +2723,7 @@ int libesedb_file_get_table(
 	     internal_file->io_handle,
 	     table_definition,
 	     template_table_definition,
+	     table_state,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1861,6 +2751,7 @@ int libesedb_file_get_table_by_utf8_name(
 	libesedb_internal_file_t *internal_file                = NULL;
 	libesedb_table_definition_t *table_definition          = NULL;
 	libesedb_table_definition_t *template_table_definition = NULL;
+	libesedb_table_state_t *table_state                    = NULL;
 	static char *function                                  = "libesedb_file_get_table_by_utf8_name";
 	int result                                             = 0;
 
@@ -1959,6 +2850,52 @@ int libesedb_file_get_table_by_utf8_name(
 
 				return( -1 );
 			}
+			if( libesedb_catalog_read_table_definition_file_io_handle(
+			     internal_file->catalog,
+			     internal_file->file_io_handle,
+			     template_table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read template table definition.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libesedb_catalog_read_table_definition_file_io_handle(
+		     internal_file->catalog,
+		     internal_file->file_io_handle,
+		     table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read table definition.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_file_get_table_state(
+		     internal_file,
+		     table_definition,
+		     template_table_definition,
+		     &table_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table state.",
+			 function );
+
+			return( -1 );
 		}
 		if( libesedb_table_initialize(
 		     table,
@@ -1966,6 +2903,7 @@ int libesedb_file_get_table_by_utf8_name(
 		     internal_file->io_handle,
 		     table_definition,
 		     template_table_definition,
+		     table_state,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1994,6 +2932,7 @@ int libesedb_file_get_table_by_utf16_name(
 	libesedb_internal_file_t *internal_file                = NULL;
 	libesedb_table_definition_t *table_definition          = NULL;
 	libesedb_table_definition_t *template_table_definition = NULL;
+	libesedb_table_state_t *table_state                    = NULL;
 	static char *function                                  = "libesedb_file_get_table_by_utf16_name";
 	int result                                             = 0;
 
@@ -2092,6 +3031,52 @@ int libesedb_file_get_table_by_utf16_name(
 
 				return( -1 );
 			}
+			if( libesedb_catalog_read_table_definition_file_io_handle(
+			     internal_file->catalog,
+			     internal_file->file_io_handle,
+			     template_table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read template table definition.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libesedb_catalog_read_table_definition_file_io_handle(
+		     internal_file->catalog,
+		     internal_file->file_io_handle,
+		     table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read table definition.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_file_get_table_state(
+		     internal_file,
+		     table_definition,
+		     template_table_definition,
+		     &table_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table state.",
+			 function );
+
+			return( -1 );
 		}
 		if( libesedb_table_initialize(
 		     table,
@@ -2099,6 +3084,7 @@ int libesedb_file_get_table_by_utf16_name(
 		     internal_file->io_handle,
 		     table_definition,
 		     template_table_definition,
+		     table_state,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -33,6 +33,8 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_table_state.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -77,6 +79,14 @@ struct libesedb_internal_file
 	/* The backup catalog
 	 */
 	libesedb_catalog_t *backup_catalog;
+
+	/* The table states cache
+	 */
+	libfcache_cache_t *table_states_cache;
+
+	/* The catalog read flags
+	 */
+	uint8_t catalog_read_flags;
 };
 
 LIBESEDB_EXTERN \
@@ -112,6 +122,14 @@ int libesedb_file_open_wide(
 
 #endif
 
+LIBESEDB_EXTERN \
+int libesedb_file_open_memory(
+     libesedb_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_open_file_io_handle(
      libesedb_file_t *file,
@@ -129,6 +147,13 @@ int libesedb_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libesedb_file_get_table_state(
+     libesedb_internal_file_t *internal_file,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_table_state_t **table_state,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_type(
      libesedb_file_t *file,
@@ -155,6 +180,58 @@ int libesedb_file_get_page_size(
      uint32_t *page_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_file_get_number_of_pages(
+     libesedb_file_t *file,
+     uint32_t *number_of_pages,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_page_information(
+     libesedb_file_t *file,
+     uint32_t page_number,
+     uint32_t *father_data_page_object_identifier,
+     uint8_t *page_type,
+     uint16_t *available_data_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_statistics(
+     libesedb_file_t *file,
+     uint64_t *statistics,
+     int number_of_statistics,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_reset_statistics(
+     libesedb_file_t *file,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_trace_callback(
+     libesedb_file_t *file,
+     void (*callback_function)(
+            intptr_t *callback_data,
+            int event,
+            uint64_t identifier,
+            uint64_t start_timestamp,
+            uint64_t end_timestamp,
+            uint64_t size ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_memory_usage(
+     libesedb_file_t *file,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_memory_limit(
+     libesedb_file_t *file,
+     size64_t memory_limit,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_number_of_tables(
      libesedb_file_t *file,
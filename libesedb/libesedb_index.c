@@ -535,6 +535,532 @@ int libesedb_index_get_number_of_records(
 	return( 1 );
 }
 
+/* Retrieves the key and bookmark of the record for the specific entry
+ * The key contains the (normalized) index key and the bookmark the (normalized) key
+ * of the record in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_record_key_and_bookmark(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     libesedb_page_tree_key_t **key,
+     libesedb_page_tree_key_t **bookmark,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition = NULL;
+	uint8_t *index_data                               = NULL;
+	static char *function                             = "libesedb_internal_index_get_record_key_and_bookmark";
+	size_t index_data_size                            = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_leaf_value_by_index(
+	     internal_index->index_page_tree,
+	     internal_index->file_io_handle,
+	     record_entry,
+	     &index_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from index values tree.",
+		 function,
+		 record_entry );
+
+		goto on_error;
+	}
+	if( key != NULL )
+	{
+		if( libesedb_page_tree_get_leaf_value_key(
+		     internal_index->index_page_tree,
+		     internal_index->file_io_handle,
+		     index_data_definition,
+		     key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key of leaf value: %d from index values tree.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+	}
+	if( bookmark != NULL )
+	{
+		/* The data of an index leaf value contains the key of the record in the table
+		 */
+		if( libesedb_data_definition_read_data(
+		     index_data_definition,
+		     internal_index->file_io_handle,
+		     internal_index->io_handle,
+		     internal_index->pages_vector,
+		     internal_index->pages_cache,
+		     &index_data,
+		     &index_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index data definition data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_key_initialize(
+		     bookmark,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create bookmark.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_key_set_data(
+		     *bookmark,
+		     index_data,
+		     index_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index data in bookmark.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_data_definition_free(
+	     &index_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index data definition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( bookmark != NULL )
+	 && ( *bookmark != NULL ) )
+	{
+		libesedb_page_tree_key_free(
+		 bookmark,
+		 NULL );
+	}
+	if( ( key != NULL )
+	 && ( *key != NULL ) )
+	{
+		libesedb_page_tree_key_free(
+		 key,
+		 NULL );
+	}
+	if( index_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &index_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the (normalized) index key of the record for the specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record_key_size(
+     libesedb_index_t *index,
+     int record_entry,
+     size_t *key_size,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_key_t *value = NULL;
+	static char *function           = "libesedb_index_get_record_key_size";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_get_record_key_and_bookmark(
+	     (libesedb_internal_index_t *) index,
+	     record_entry,
+	     &value,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key of record: %d.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	*key_size = value->data_size;
+
+	if( libesedb_page_tree_key_free(
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the (normalized) index key of the record for the specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record_key(
+     libesedb_index_t *index,
+     int record_entry,
+     uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_key_t *value = NULL;
+	static char *function           = "libesedb_index_get_record_key";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_get_record_key_and_bookmark(
+	     (libesedb_internal_index_t *) index,
+	     record_entry,
+	     &value,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key of record: %d.",
+		 function,
+		 record_entry );
+
+		goto on_error;
+	}
+	if( key_size < value->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( value->data_size > 0 )
+	{
+		if( memory_copy(
+		     key,
+		     value->data,
+		     value->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_page_tree_key_free(
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the bookmark of the record for the specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record_bookmark_size(
+     libesedb_index_t *index,
+     int record_entry,
+     size_t *bookmark_size,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_key_t *value = NULL;
+	static char *function           = "libesedb_index_get_record_bookmark_size";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( bookmark_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bookmark size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_get_record_key_and_bookmark(
+	     (libesedb_internal_index_t *) index,
+	     record_entry,
+	     NULL,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bookmark of record: %d.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	*bookmark_size = value->data_size;
+
+	if( libesedb_page_tree_key_free(
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bookmark.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the bookmark of the record for the specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record_bookmark(
+     libesedb_index_t *index,
+     int record_entry,
+     uint8_t *bookmark,
+     size_t bookmark_size,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_key_t *value = NULL;
+	static char *function           = "libesedb_index_get_record_bookmark";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( bookmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bookmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( bookmark_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid bookmark size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_index_get_record_key_and_bookmark(
+	     (libesedb_internal_index_t *) index,
+	     record_entry,
+	     NULL,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bookmark of record: %d.",
+		 function,
+		 record_entry );
+
+		goto on_error;
+	}
+	if( bookmark_size < value->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid bookmark size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( value->data_size > 0 )
+	{
+		if( memory_copy(
+		     bookmark,
+		     value->data,
+		     value->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy bookmark.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_page_tree_key_free(
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bookmark.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &value,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Retrieves a specific record
  * Returns 1 if successful or -1 on error
  */
@@ -33,6 +33,7 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_page_tree_key.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -151,6 +152,43 @@ int libesedb_index_get_number_of_records(
      int *number_of_records,
      libcerror_error_t **error );
 
+int libesedb_internal_index_get_record_key_and_bookmark(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     libesedb_page_tree_key_t **key,
+     libesedb_page_tree_key_t **bookmark,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_record_key_size(
+     libesedb_index_t *index,
+     int record_entry,
+     size_t *key_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_record_key(
+     libesedb_index_t *index,
+     int record_entry,
+     uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_record_bookmark_size(
+     libesedb_index_t *index,
+     int record_entry,
+     size_t *bookmark_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_record_bookmark(
+     libesedb_index_t *index,
+     int record_entry,
+     uint8_t *bookmark,
+     size_t bookmark_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_index_get_record(
      libesedb_index_t *index,
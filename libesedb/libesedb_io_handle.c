@@ -24,14 +24,20 @@
 #include <memory.h>
 #include <types.h>
 
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
 #include "libesedb_checksum.h"
 #include "libesedb_codepage.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
+#include "libesedb_error.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
 #include "libesedb_unused.h"
@@ -151,7 +157,17 @@ int libesedb_io_handle_clear(
      libesedb_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_io_handle_clear";
+	void (*trace_callback_function)(
+	       intptr_t *callback_data,
+	       int event,
+	       uint64_t identifier,
+	       uint64_t start_timestamp,
+	       uint64_t end_timestamp,
+	       uint64_t size );
+
+	intptr_t *trace_callback_data = NULL;
+	static char *function         = "libesedb_io_handle_clear";
+	size64_t memory_limit         = 0;
 
 	if( io_handle == NULL )
 	{
@@ -164,6 +180,12 @@ int libesedb_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The trace callback and memory limit are retained so that they apply to the next open
+	 */
+	trace_callback_function = io_handle->trace_callback_function;
+	trace_callback_data     = io_handle->trace_callback_data;
+	memory_limit            = io_handle->memory_limit;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -178,8 +200,408 @@ int libesedb_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+	io_handle->ascii_codepage          = LIBESEDB_CODEPAGE_WINDOWS_1252;
+	io_handle->trace_callback_function = trace_callback_function;
+	io_handle->trace_callback_data     = trace_callback_data;
+	io_handle->memory_limit            = memory_limit;
+
+	return( 1 );
+}
+
+/* Retrieves the statistics
+ * The statistics are stored in an array indexed by LIBESEDB_STATISTIC_
+ * where number_of_statistics values are retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_get_statistics(
+     libesedb_io_handle_t *io_handle,
+     uint64_t *statistics,
+     int number_of_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_get_statistics";
+	int statistic_index   = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_statistics < 0 )
+	 || ( number_of_statistics > LIBESEDB_NUMBER_OF_STATISTICS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of statistics value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( statistic_index = 0;
+	     statistic_index < number_of_statistics;
+	     statistic_index++ )
+	{
+		statistics[ statistic_index ] = io_handle->statistics[ statistic_index ];
+
+		/* The hits of the caches are determined from the number of cache lookups,
+		 * since every cache miss is a lookup as well, where the misses directly
+		 * follow the hits
+		 */
+		if( ( statistic_index == LIBESEDB_STATISTIC_PAGES_CACHE_HITS )
+		 || ( statistic_index == LIBESEDB_STATISTIC_DATA_SEGMENTS_CACHE_HITS )
+		 || ( statistic_index == LIBESEDB_STATISTIC_TABLE_STATES_CACHE_HITS ) )
+		{
+			if( statistics[ statistic_index ] > io_handle->statistics[ statistic_index + 1 ] )
+			{
+				statistics[ statistic_index ] -= io_handle->statistics[ statistic_index + 1 ];
+			}
+			else
+			{
+				statistics[ statistic_index ] = 0;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Resets the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_reset_statistics(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_reset_statistics";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     io_handle->statistics,
+	     0,
+	     sizeof( uint64_t ) * LIBESEDB_NUMBER_OF_STATISTICS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the trace callback function
+ * A callback function of NULL disables tracing
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_set_trace_callback(
+     libesedb_io_handle_t *io_handle,
+     void (*callback_function)(
+            intptr_t *callback_data,
+            int event,
+            uint64_t identifier,
+            uint64_t start_timestamp,
+            uint64_t end_timestamp,
+            uint64_t size ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_set_trace_callback";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->trace_callback_function = callback_function;
+	io_handle->trace_callback_data     = callback_data;
+
+	return( 1 );
+}
+
+/* Retrieves the timestamp of a trace event
+ * The timestamp is in nanoseconds of a monotonic clock with an unspecified start
+ * Returns the timestamp or 0 if tracing is disabled
+ */
+uint64_t libesedb_io_handle_get_trace_timestamp(
+          libesedb_io_handle_t *io_handle )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_value;
+#endif
+
+	if( ( io_handle == NULL )
+	 || ( io_handle->trace_callback_function == NULL ) )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	      + ( ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart ) );
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+#else
+	return( (uint64_t) time( NULL ) * 1000000000UL );
+#endif
+}
+
+/* Signals a trace event to the trace callback function
+ * The start timestamp should be retrieved with libesedb_io_handle_get_trace_timestamp
+ * before the operation that is traced
+ */
+void libesedb_io_handle_trace_event(
+      libesedb_io_handle_t *io_handle,
+      int event,
+      uint64_t identifier,
+      uint64_t start_timestamp,
+      uint64_t size )
+{
+	uint64_t end_timestamp = 0;
+
+	if( ( io_handle == NULL )
+	 || ( io_handle->trace_callback_function == NULL ) )
+	{
+		return;
+	}
+	end_timestamp = libesedb_io_handle_get_trace_timestamp(
+	                 io_handle );
+
+	io_handle->trace_callback_function(
+	 io_handle->trace_callback_data,
+	 event,
+	 identifier,
+	 start_timestamp,
+	 end_timestamp,
+	 size );
+}
+
+/* Retrieves the memory usage
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_get_memory_usage(
+     libesedb_io_handle_t *io_handle,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_get_memory_usage";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_usage = io_handle->memory_usage;
+
+	return( 1 );
+}
+
+/* Sets the memory limit
+ * A memory limit of 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_set_memory_limit(
+     libesedb_io_handle_t *io_handle,
+     size64_t memory_limit,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_set_memory_limit";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->memory_limit = memory_limit;
+
+	return( 1 );
+}
+
+/* Determines if an additional size can be held within the memory limit
+ * Returns 1 if the size can be held, 0 if not or -1 on error
+ */
+int libesedb_io_handle_check_memory_limit(
+     libesedb_io_handle_t *io_handle,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_check_memory_limit";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->memory_limit == 0 )
+	{
+		return( 1 );
+	}
+	if( ( size > io_handle->memory_limit )
+	 || ( io_handle->memory_usage > ( io_handle->memory_limit - size ) ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Adds a size to the memory usage
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_add_memory_usage(
+     libesedb_io_handle_t *io_handle,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_add_memory_usage";
+	int result            = 0;
+
+	result = libesedb_io_handle_check_memory_limit(
+	          io_handle,
+	          size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if size is within memory limit.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBESEDB_MEMORY_ERROR_LIMIT_EXCEEDED,
+		 "%s: memory limit of %" PRIu64 " bytes exceeded by allocation of %" PRIu64 " bytes with %" PRIu64 " bytes in use.",
+		 function,
+		 io_handle->memory_limit,
+		 size,
+		 io_handle->memory_usage );
+
+		return( -1 );
+	}
+	io_handle->memory_usage += size;
+
+	return( 1 );
+}
+
+/* Removes a size from the memory usage
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_remove_memory_usage(
+     libesedb_io_handle_t *io_handle,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_remove_memory_usage";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
+		return( -1 );
+	}
+	/* The memory usage is reset when the IO handle is cleared
+	 * while values that were accounted for can be freed afterwards
+	 */
+	if( size > io_handle->memory_usage )
+	{
+		io_handle->memory_usage = 0;
+	}
+	else
+	{
+		io_handle->memory_usage -= size;
+	}
 	return( 1 );
 }
 
@@ -239,14 +661,72 @@ int libesedb_io_handle_read_page(
      uint8_t read_flags LIBESEDB_ATTRIBUTE_UNUSED,
      libcerror_error_t **error )
 {
-	libesedb_page_t *page = NULL;
-	static char *function = "libesedb_io_handle_read_page";
+	libesedb_page_t *page               = NULL;
+	static char *function               = "libesedb_io_handle_read_page";
+	uint64_t cache_size                 = 0;
+	uint64_t trace_timestamp            = 0;
+	uint32_t page_number                = 0;
+	int number_of_cache_values          = 0;
+	int previous_number_of_cache_values = 0;
+	int result                          = 0;
 
 	LIBESEDB_UNREFERENCED_PARAMETER( element_file_index );
 	LIBESEDB_UNREFERENCED_PARAMETER( element_size );
 	LIBESEDB_UNREFERENCED_PARAMETER( element_flags );
 	LIBESEDB_UNREFERENCED_PARAMETER( read_flags );
 
+	trace_timestamp = libesedb_io_handle_get_trace_timestamp(
+	                   io_handle );
+
+	result = libesedb_io_handle_check_memory_limit(
+	          io_handle,
+	          (size64_t) io_handle->page_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if page is within memory limit.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* Shrink the cache to make room for the page
+		 */
+		if( libfcache_cache_get_number_of_cache_values(
+		     (libfcache_cache_t *) cache,
+		     &previous_number_of_cache_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of cache values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfcache_cache_clear(
+		     (libfcache_cache_t *) cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear cache.",
+			 function );
+
+			goto on_error;
+		}
+		io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_EVICTIONS ] += (uint64_t) previous_number_of_cache_values;
+	}
 	if( libesedb_page_initialize(
 	     &page,
 	     error ) != 1 )
@@ -276,6 +756,22 @@ int libesedb_io_handle_read_page(
 
 		goto on_error;
 	}
+	page_number = page->page_number;
+
+	if( libfcache_cache_get_number_of_cache_values(
+	     (libfcache_cache_t *) cache,
+	     &previous_number_of_cache_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache values.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfdata_vector_set_element_value_by_index(
 	     vector,
 	     (intptr_t *) file_io_handle,
@@ -295,6 +791,41 @@ int libesedb_io_handle_read_page(
 
 		goto on_error;
 	}
+	if( libfcache_cache_get_number_of_cache_values(
+	     (libfcache_cache_t *) cache,
+	     &number_of_cache_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache values.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_MISSES ] += 1;
+
+	/* If the number of cache values did not increase the page replaced another page
+	 */
+	if( number_of_cache_values <= previous_number_of_cache_values )
+	{
+		io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_EVICTIONS ] += 1;
+	}
+	cache_size = (uint64_t) number_of_cache_values * io_handle->page_size;
+
+	if( cache_size > io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_MAXIMUM_SIZE ] )
+	{
+		io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_MAXIMUM_SIZE ] = cache_size;
+	}
+	libesedb_io_handle_trace_event(
+	 io_handle,
+	 LIBESEDB_TRACE_EVENT_PAGES_CACHE_MISS,
+	 (uint64_t) page_number,
+	 trace_timestamp,
+	 (uint64_t) io_handle->page_size );
+
 	return( 1 );
 
 on_error:
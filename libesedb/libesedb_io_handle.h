@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_definitions.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfdata.h"
@@ -35,6 +36,12 @@ extern "C" {
 
 extern const uint8_t esedb_file_signature[ 4 ];
 
+/* The hits of the caches are maintained as the number of cache lookups
+ */
+#define LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS			LIBESEDB_STATISTIC_PAGES_CACHE_HITS
+#define LIBESEDB_STATISTIC_DATA_SEGMENTS_CACHE_LOOKUPS		LIBESEDB_STATISTIC_DATA_SEGMENTS_CACHE_HITS
+#define LIBESEDB_STATISTIC_TABLE_STATES_CACHE_LOOKUPS		LIBESEDB_STATISTIC_TABLE_STATES_CACHE_HITS
+
 typedef struct libesedb_io_handle libesedb_io_handle_t;
 
 struct libesedb_io_handle
@@ -82,6 +89,41 @@ struct libesedb_io_handle
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+	/* The statistics
+	 */
+	uint64_t statistics[ LIBESEDB_NUMBER_OF_STATISTICS ];
+
+	/* The trace callback function
+	 */
+	void (*trace_callback_function)(
+	       intptr_t *callback_data,
+	       int event,
+	       uint64_t identifier,
+	       uint64_t start_timestamp,
+	       uint64_t end_timestamp,
+	       uint64_t size );
+
+	/* The trace callback data
+	 */
+	intptr_t *trace_callback_data;
+
+	/* The memory usage
+	 */
+	size64_t memory_usage;
+
+	/* The memory limit, where 0 represents no limit
+	 */
+	size64_t memory_limit;
+
+	/* The memory data when the file was opened from a buffer
+	 * the data is owned by the caller
+	 */
+	const uint8_t *memory_data;
+
+	/* The memory data size
+	 */
+	size64_t memory_data_size;
 };
 
 int libesedb_io_handle_initialize(
@@ -96,6 +138,63 @@ int libesedb_io_handle_clear(
      libesedb_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libesedb_io_handle_get_statistics(
+     libesedb_io_handle_t *io_handle,
+     uint64_t *statistics,
+     int number_of_statistics,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_reset_statistics(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_set_trace_callback(
+     libesedb_io_handle_t *io_handle,
+     void (*callback_function)(
+            intptr_t *callback_data,
+            int event,
+            uint64_t identifier,
+            uint64_t start_timestamp,
+            uint64_t end_timestamp,
+            uint64_t size ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+uint64_t libesedb_io_handle_get_trace_timestamp(
+          libesedb_io_handle_t *io_handle );
+
+void libesedb_io_handle_trace_event(
+      libesedb_io_handle_t *io_handle,
+      int event,
+      uint64_t identifier,
+      uint64_t start_timestamp,
+      uint64_t size );
+
+int libesedb_io_handle_get_memory_usage(
+     libesedb_io_handle_t *io_handle,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_set_memory_limit(
+     libesedb_io_handle_t *io_handle,
+     size64_t memory_limit,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_check_memory_limit(
+     libesedb_io_handle_t *io_handle,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_add_memory_usage(
+     libesedb_io_handle_t *io_handle,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_remove_memory_usage(
+     libesedb_io_handle_t *io_handle,
+     size64_t size,
+     libcerror_error_t **error );
+
 int libesedb_io_handle_set_pages_data_range(
      libesedb_io_handle_t *io_handle,
      size64_t file_size,
@@ -235,6 +235,24 @@ int libesedb_long_value_free(
 				result = -1;
 			}
 		}
+		if( ( internal_long_value->io_handle != NULL )
+		 && ( internal_long_value->memory_size != 0 ) )
+		{
+			if( libesedb_io_handle_remove_memory_usage(
+			     internal_long_value->io_handle,
+			     internal_long_value->memory_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to remove record value size from memory usage.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_long_value );
 	}
@@ -377,6 +395,10 @@ int libesedb_long_value_get_data(
 	     data_segment_index < number_of_data_segments;
 	     data_segment_index++ )
 	{
+		if( internal_long_value->io_handle != NULL )
+		{
+			internal_long_value->io_handle->statistics[ LIBESEDB_STATISTIC_DATA_SEGMENTS_CACHE_LOOKUPS ] += 1;
+		}
 		if( libfdata_list_get_element_value_by_index(
 		     internal_long_value->data_segments_list,
 		     (intptr_t *) internal_long_value->file_io_handle,
@@ -510,6 +532,22 @@ int libesedb_long_value_get_record_value(
 
 			goto on_error;
 		}
+		if( libesedb_io_handle_add_memory_usage(
+		     internal_long_value->io_handle,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add data size to memory usage.",
+			 function );
+
+			goto on_error;
+		}
+		internal_long_value->memory_size = data_size;
+
 		data = (uint8_t *) memory_allocate(
 		                    (size_t) data_size );
 
@@ -542,6 +580,10 @@ int libesedb_long_value_get_record_value(
 		     data_segment_index < number_of_data_segments;
 		     data_segment_index++ )
 		{
+			if( internal_long_value->io_handle != NULL )
+			{
+				internal_long_value->io_handle->statistics[ LIBESEDB_STATISTIC_DATA_SEGMENTS_CACHE_LOOKUPS ] += 1;
+			}
 			if( libfdata_list_get_element_value_by_index(
 			     internal_long_value->data_segments_list,
 			     (intptr_t *) internal_long_value->file_io_handle,
@@ -672,6 +714,22 @@ int libesedb_long_value_get_record_value(
 
 					goto on_error;
 				}
+				if( libesedb_io_handle_add_memory_usage(
+				     internal_long_value->io_handle,
+				     data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add uncompressed data size to memory usage.",
+					 function );
+
+					goto on_error;
+				}
+				internal_long_value->memory_size += data_size;
+
 				data = (uint8_t *) memory_allocate(
 				                    sizeof( uint8_t ) * data_size );
 
@@ -707,6 +765,24 @@ int libesedb_long_value_get_record_value(
 
 				compressed_data = NULL;
 
+				if( libesedb_io_handle_remove_memory_usage(
+				     internal_long_value->io_handle,
+				     (size64_t) compressed_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to remove compressed data size from memory usage.",
+					 function );
+
+					goto on_error;
+				}
+				internal_long_value->memory_size -= compressed_data_size;
+
+				internal_long_value->io_handle->statistics[ LIBESEDB_STATISTIC_NUMBER_OF_LZXPRESS_DECOMPRESSED_BYTES ] += (uint64_t) data_size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 				if( libcnotify_verbose != 0 )
 				{
@@ -773,6 +849,15 @@ on_error:
 		 &( internal_long_value->record_value ),
 		 NULL );
 	}
+	if( internal_long_value->memory_size != 0 )
+	{
+		libesedb_io_handle_remove_memory_usage(
+		 internal_long_value->io_handle,
+		 internal_long_value->memory_size,
+		 NULL );
+
+		internal_long_value->memory_size = 0;
+	}
 	if( compressed_data != NULL )
 	{
 		memory_free(
@@ -853,6 +938,10 @@ int libesedb_long_value_get_data_segment_size(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
+	if( internal_long_value->io_handle != NULL )
+	{
+		internal_long_value->io_handle->statistics[ LIBESEDB_STATISTIC_DATA_SEGMENTS_CACHE_LOOKUPS ] += 1;
+	}
 	if( libfdata_list_get_element_value_by_index(
 	     internal_long_value->data_segments_list,
 	     (intptr_t *) internal_long_value->file_io_handle,
@@ -917,6 +1006,10 @@ int libesedb_long_value_get_data_segment(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
+	if( internal_long_value->io_handle != NULL )
+	{
+		internal_long_value->io_handle->statistics[ LIBESEDB_STATISTIC_DATA_SEGMENTS_CACHE_LOOKUPS ] += 1;
+	}
 	if( libfdata_list_get_element_value_by_index(
 	     internal_long_value->data_segments_list,
 	     (intptr_t *) internal_long_value->file_io_handle,
@@ -66,6 +66,10 @@ struct libesedb_internal_long_value
 	/* The record value
 	 */
 	libfvalue_value_t *record_value;
+
+	/* The size of the record value data that is accounted for in the memory usage
+	 */
+	size64_t memory_size;
 };
 
 int libesedb_long_value_initialize(
@@ -0,0 +1,898 @@
+/*
+ * Name hash table functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libuna.h"
+#include "libesedb_name_hash_table.h"
+
+/* The names are hashed per Unicode character, using FNV-1a, so that
+ * the byte stream, UTF-8 and UTF-16 representations of the same name
+ * result in the same hash
+ */
+#define LIBESEDB_NAME_HASH_TABLE_HASH_INITIAL_VALUE		0x811c9dc5UL
+#define LIBESEDB_NAME_HASH_TABLE_HASH_PRIME			0x01000193UL
+
+#define LIBESEDB_NAME_HASH_TABLE_MINIMUM_NUMBER_OF_SLOTS	16
+
+/* Creates a name hash table
+ * Make sure the value name_hash_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_initialize(
+     libesedb_name_hash_table_t **name_hash_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_name_hash_table_initialize";
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*name_hash_table = memory_allocate_structure(
+	                    libesedb_name_hash_table_t );
+
+	if( *name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *name_hash_table,
+	     0,
+	     sizeof( libesedb_name_hash_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name hash table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *name_hash_table != NULL )
+	{
+		memory_free(
+		 *name_hash_table );
+
+		*name_hash_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a name hash table
+ * The catalog definitions and values are not owned by the name hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_free(
+     libesedb_name_hash_table_t **name_hash_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_name_hash_table_free";
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_hash_table != NULL )
+	{
+		if( ( *name_hash_table )->entries != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->entries );
+		}
+		memory_free(
+		 *name_hash_table );
+
+		*name_hash_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of a name stored as a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_calculate_hash_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libesedb_name_hash_table_calculate_hash_from_byte_stream";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t byte_stream_index                     = 0;
+	uint32_t safe_hash                           = LIBESEDB_NAME_HASH_TABLE_HASH_INITIAL_VALUE;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( byte_stream_index < byte_stream_size )
+	{
+		/* The ASCII range maps 1:1 onto Unicode in every supported codepage
+		 */
+		if( byte_stream[ byte_stream_index ] < 0x80 )
+		{
+			unicode_character = byte_stream[ byte_stream_index++ ];
+		}
+		else if( libuna_unicode_character_copy_from_byte_stream(
+		          &unicode_character,
+		          byte_stream,
+		          byte_stream_size,
+		          &byte_stream_index,
+		          codepage,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_CONVERSION_FAILED,
+			 "%s: unable to copy Unicode character from byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		safe_hash ^= (uint32_t) unicode_character;
+		safe_hash *= LIBESEDB_NAME_HASH_TABLE_HASH_PRIME;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-8 encoded name
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_calculate_hash_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libesedb_name_hash_table_calculate_hash_from_utf8_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_hash                           = LIBESEDB_NAME_HASH_TABLE_HASH_INITIAL_VALUE;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( utf8_string[ utf8_string_index ] < 0x80 )
+		{
+			unicode_character = utf8_string[ utf8_string_index++ ];
+		}
+		else if( libuna_unicode_character_copy_from_utf8(
+		          &unicode_character,
+		          utf8_string,
+		          utf8_string_length,
+		          &utf8_string_index,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_CONVERSION_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		safe_hash ^= (uint32_t) unicode_character;
+		safe_hash *= LIBESEDB_NAME_HASH_TABLE_HASH_PRIME;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-16 encoded name
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_calculate_hash_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libesedb_name_hash_table_calculate_hash_from_utf16_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_hash                           = LIBESEDB_NAME_HASH_TABLE_HASH_INITIAL_VALUE;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_CONVERSION_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		safe_hash ^= (uint32_t) unicode_character;
+		safe_hash *= LIBESEDB_NAME_HASH_TABLE_HASH_PRIME;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Resizes the name hash table
+ * The number of slots must be a power of 2 and larger than the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_table_resize(
+     libesedb_name_hash_table_t *name_hash_table,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libesedb_name_hash_table_entry_t *entries = NULL;
+	static char *function                     = "libesedb_name_hash_table_resize";
+	size_t entries_size                       = 0;
+	int entry_index                           = 0;
+	int slot_index                            = 0;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots <= name_hash_table->number_of_entries )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entries_size = sizeof( libesedb_name_hash_table_entry_t ) * (size_t) number_of_slots;
+
+	if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid entries size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	entries = (libesedb_name_hash_table_entry_t *) memory_allocate(
+	                                                entries_size );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		memory_free(
+		 entries );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < name_hash_table->number_of_slots;
+	     entry_index++ )
+	{
+		if( name_hash_table->entries[ entry_index ].catalog_definition == NULL )
+		{
+			continue;
+		}
+		slot_index = (int) ( name_hash_table->entries[ entry_index ].hash & (uint32_t) ( number_of_slots - 1 ) );
+
+		while( entries[ slot_index ].catalog_definition != NULL )
+		{
+			slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+		}
+		entries[ slot_index ] = name_hash_table->entries[ entry_index ];
+	}
+	if( name_hash_table->entries != NULL )
+	{
+		memory_free(
+		 name_hash_table->entries );
+	}
+	name_hash_table->entries         = entries;
+	name_hash_table->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Inserts a value into the name hash table using the name of the catalog definition
+ * If the name is already present the existing value is kept
+ * Returns 1 if successful, 0 if the name already exists or is missing or -1 on error
+ */
+int libesedb_name_hash_table_insert_value(
+     libesedb_name_hash_table_t *name_hash_table,
+     libesedb_catalog_definition_t *catalog_definition,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *existing_catalog_definition = NULL;
+	static char *function                                      = "libesedb_name_hash_table_insert_value";
+	uint32_t hash                                              = 0;
+	int number_of_slots                                        = 0;
+	int slot_index                                             = 0;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	/* Catalog definitions without a name cannot be looked up by name
+	 */
+	if( catalog_definition->name == NULL )
+	{
+		return( 0 );
+	}
+	/* Keep the load factor below 3/4 so that probe sequences stay short
+	 */
+	if( ( ( name_hash_table->number_of_entries + 1 ) * 4 ) > ( name_hash_table->number_of_slots * 3 ) )
+	{
+		if( name_hash_table->number_of_slots == 0 )
+		{
+			number_of_slots = LIBESEDB_NAME_HASH_TABLE_MINIMUM_NUMBER_OF_SLOTS;
+		}
+		else if( name_hash_table->number_of_slots > ( INT_MAX / 8 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name hash table - number of slots value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_slots = name_hash_table->number_of_slots * 2;
+		}
+		if( libesedb_name_hash_table_resize(
+		     name_hash_table,
+		     number_of_slots,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize name hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	     catalog_definition->name,
+	     catalog_definition->name_size,
+	     LIBUNA_CODEPAGE_WINDOWS_1252,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	slot_index = (int) ( hash & (uint32_t) ( name_hash_table->number_of_slots - 1 ) );
+
+	while( name_hash_table->entries[ slot_index ].catalog_definition != NULL )
+	{
+		existing_catalog_definition = name_hash_table->entries[ slot_index ].catalog_definition;
+
+		if( ( name_hash_table->entries[ slot_index ].hash == hash )
+		 && ( existing_catalog_definition->name_size == catalog_definition->name_size )
+		 && ( memory_compare(
+		       existing_catalog_definition->name,
+		       catalog_definition->name,
+		       catalog_definition->name_size ) == 0 ) )
+		{
+			return( 0 );
+		}
+		slot_index = ( slot_index + 1 ) & ( name_hash_table->number_of_slots - 1 );
+	}
+	name_hash_table->entries[ slot_index ].hash               = hash;
+	name_hash_table->entries[ slot_index ].catalog_definition = catalog_definition;
+	name_hash_table->entries[ slot_index ].value              = value;
+
+	name_hash_table->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the value for the specific name
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_name_hash_table_get_value_by_name(
+     libesedb_name_hash_table_t *name_hash_table,
+     const uint8_t *name,
+     size_t name_size,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_name_hash_table_get_value_by_name";
+	uint32_t hash         = 0;
+	int result            = 0;
+	int slot_index        = 0;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	     name,
+	     name_size,
+	     LIBUNA_CODEPAGE_WINDOWS_1252,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash_table->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	slot_index = (int) ( hash & (uint32_t) ( name_hash_table->number_of_slots - 1 ) );
+
+	while( name_hash_table->entries[ slot_index ].catalog_definition != NULL )
+	{
+		if( name_hash_table->entries[ slot_index ].hash == hash )
+		{
+			result = libesedb_catalog_definition_compare_name(
+			          name_hash_table->entries[ slot_index ].catalog_definition,
+			          name,
+			          name_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare name with catalog definition name.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 1 )
+			{
+				*value = name_hash_table->entries[ slot_index ].value;
+
+				return( 1 );
+			}
+		}
+		slot_index = ( slot_index + 1 ) & ( name_hash_table->number_of_slots - 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the value for the specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_name_hash_table_get_value_by_utf8_name(
+     libesedb_name_hash_table_t *name_hash_table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_name_hash_table_get_value_by_utf8_name";
+	uint32_t hash         = 0;
+	int result            = 0;
+	int slot_index        = 0;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_name_hash_table_calculate_hash_from_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash_table->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	slot_index = (int) ( hash & (uint32_t) ( name_hash_table->number_of_slots - 1 ) );
+
+	while( name_hash_table->entries[ slot_index ].catalog_definition != NULL )
+	{
+		if( name_hash_table->entries[ slot_index ].hash == hash )
+		{
+			result = libesedb_catalog_definition_compare_name_with_utf8_string(
+			          name_hash_table->entries[ slot_index ].catalog_definition,
+			          utf8_string,
+			          utf8_string_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare UTF-8 string with catalog definition name.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*value = name_hash_table->entries[ slot_index ].value;
+
+				return( 1 );
+			}
+		}
+		slot_index = ( slot_index + 1 ) & ( name_hash_table->number_of_slots - 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the value for the specific UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_name_hash_table_get_value_by_utf16_name(
+     libesedb_name_hash_table_t *name_hash_table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_name_hash_table_get_value_by_utf16_name";
+	uint32_t hash         = 0;
+	int result            = 0;
+	int slot_index        = 0;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_name_hash_table_calculate_hash_from_utf16_string(
+	     utf16_string,
+	     utf16_string_length,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash_table->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	slot_index = (int) ( hash & (uint32_t) ( name_hash_table->number_of_slots - 1 ) );
+
+	while( name_hash_table->entries[ slot_index ].catalog_definition != NULL )
+	{
+		if( name_hash_table->entries[ slot_index ].hash == hash )
+		{
+			result = libesedb_catalog_definition_compare_name_with_utf16_string(
+			          name_hash_table->entries[ slot_index ].catalog_definition,
+			          utf16_string,
+			          utf16_string_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare UTF-16 string with catalog definition name.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*value = name_hash_table->entries[ slot_index ].value;
+
+				return( 1 );
+			}
+		}
+		slot_index = ( slot_index + 1 ) & ( name_hash_table->number_of_slots - 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,133 @@
+/*
+ * Name hash table functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_NAME_HASH_TABLE_H )
+#define _LIBESEDB_NAME_HASH_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_name_hash_table_entry libesedb_name_hash_table_entry_t;
+
+struct libesedb_name_hash_table_entry
+{
+	/* The hash of the name
+	 */
+	uint32_t hash;
+
+	/* The catalog definition that contains the name
+	 */
+	libesedb_catalog_definition_t *catalog_definition;
+
+	/* The value
+	 */
+	intptr_t *value;
+};
+
+typedef struct libesedb_name_hash_table libesedb_name_hash_table_t;
+
+struct libesedb_name_hash_table
+{
+	/* The entries
+	 */
+	libesedb_name_hash_table_entry_t *entries;
+
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libesedb_name_hash_table_initialize(
+     libesedb_name_hash_table_t **name_hash_table,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_free(
+     libesedb_name_hash_table_t **name_hash_table,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_calculate_hash_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_calculate_hash_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_calculate_hash_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_resize(
+     libesedb_name_hash_table_t *name_hash_table,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_insert_value(
+     libesedb_name_hash_table_t *name_hash_table,
+     libesedb_catalog_definition_t *catalog_definition,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_get_value_by_name(
+     libesedb_name_hash_table_t *name_hash_table,
+     const uint8_t *name,
+     size_t name_size,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_get_value_by_utf8_name(
+     libesedb_name_hash_table_t *name_hash_table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+int libesedb_name_hash_table_get_value_by_utf16_name(
+     libesedb_name_hash_table_t *name_hash_table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_NAME_HASH_TABLE_H ) */
+
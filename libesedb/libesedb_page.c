@@ -198,8 +198,26 @@ int libesedb_page_free(
 
 			result = -1;
 		}
-		if( ( *page )->data != NULL )
+		if( ( ( *page )->data != NULL )
+		 && ( ( *page )->data_is_reference == 0 ) )
 		{
+			if( ( *page )->io_handle != NULL )
+			{
+				if( libesedb_io_handle_remove_memory_usage(
+				     ( *page )->io_handle,
+				     (size64_t) ( *page )->data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to remove data size from memory usage.",
+					 function );
+
+					result = -1;
+				}
+			}
 			memory_free(
 			 ( *page )->data );
 		}
@@ -833,6 +851,7 @@ int libesedb_page_read_file_io_handle(
 {
 	static char *function              = "libesedb_page_read_file_io_handle";
 	ssize_t read_count                 = 0;
+	uint64_t trace_timestamp           = 0;
 	uint32_t calculated_ecc32_checksum = 0;
 	uint32_t calculated_xor32_checksum = 0;
 	int result                         = 0;
@@ -897,55 +916,120 @@ int libesedb_page_read_file_io_handle(
 		 page->offset );
 	}
 #endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     page->offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	trace_timestamp = libesedb_io_handle_get_trace_timestamp(
+	                   io_handle );
+
+	/* When the file was opened from a buffer the page data is referenced in place,
+	 * except for pages with an extended header since reading their values
+	 * clears the page tag flags in the data
+	 */
+	if( ( io_handle->memory_data != NULL )
+	 && ( ( io_handle->format_revision < LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	  || ( io_handle->page_size < 16384 ) ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek page offset: %" PRIi64 ".",
-		 function,
-		 page->offset );
+		if( ( page->offset < 0 )
+		 || ( (size64_t) page->offset > io_handle->memory_data_size )
+		 || ( (size64_t) io_handle->page_size > ( io_handle->memory_data_size - page->offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page offset: %" PRIi64 " value out of bounds.",
+			 function,
+			 page->offset );
 
-		goto on_error;
-	}
-	page->data = (uint8_t *) memory_allocate(
-	                          (size_t) io_handle->page_size );
+			goto on_error;
+		}
+		page->data              = (uint8_t *) &( io_handle->memory_data[ page->offset ] );
+		page->data_size         = (size_t) io_handle->page_size;
+		page->data_is_reference = 1;
+		page->io_handle         = io_handle;
 
-	if( page->data == NULL )
+		read_count = (ssize_t) page->data_size;
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page data.",
-		 function );
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     page->offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek page offset: %" PRIi64 ".",
+			 function,
+			 page->offset );
 
-		goto on_error;
-	}
-	page->data_size = (size_t) io_handle->page_size;
+			goto on_error;
+		}
+		if( libesedb_io_handle_add_memory_usage(
+		     io_handle,
+		     (size64_t) io_handle->page_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add page data size to memory usage.",
+			 function );
 
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              page->data,
-	              page->data_size,
-	              error );
+			goto on_error;
+		}
+		page->data = (uint8_t *) memory_allocate(
+		                          (size_t) io_handle->page_size );
 
-	if( read_count != (ssize_t) page->data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read page data.",
-		 function );
+		if( page->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page data.",
+			 function );
 
-		goto on_error;
+			libesedb_io_handle_remove_memory_usage(
+			 io_handle,
+			 (size64_t) io_handle->page_size,
+			 NULL );
+
+			goto on_error;
+		}
+		page->data_size = (size_t) io_handle->page_size;
+		page->io_handle = io_handle;
+
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              page->data,
+		              page->data_size,
+		              error );
+
+		if( read_count != (ssize_t) page->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page data.",
+			 function );
+
+			goto on_error;
+		}
 	}
+	io_handle->statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGES_READ ]     += 1;
+	io_handle->statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGE_BYTES_READ ] += (uint64_t) read_count;
+
+	libesedb_io_handle_trace_event(
+	 io_handle,
+	 LIBESEDB_TRACE_EVENT_PAGE_READ,
+	 (uint64_t) page->page_number,
+	 trace_timestamp,
+	 (uint64_t) read_count );
+
 	if( libesedb_page_header_read_data(
 	     page->header,
 	     io_handle,
@@ -984,6 +1068,8 @@ int libesedb_page_read_file_io_handle(
 	}
 	else if( result != 0 )
 	{
+		io_handle->statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGE_CHECKSUMS ] += 1;
+
 		if( page->header->xor32_checksum != calculated_xor32_checksum )
 		{
 #ifdef TODO
@@ -1053,13 +1139,20 @@ int libesedb_page_read_file_io_handle(
 	return( 1 );
 
 on_error:
-	if( page->data != NULL )
+	if( ( page->data != NULL )
+	 && ( page->data_is_reference == 0 ) )
 	{
+		libesedb_io_handle_remove_memory_usage(
+		 io_handle,
+		 (size64_t) page->data_size,
+		 NULL );
+
 		memory_free(
 		 page->data );
-
-		page->data = NULL;
 	}
+	page->data              = NULL;
+	page->data_is_reference = 0;
+
 	return( -1 );
 }
 
@@ -1524,6 +1617,44 @@ int libesedb_page_get_father_data_page_object_identifier(
 	return( 1 );
 }
 
+/* Retrieves the available data size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_get_available_data_size(
+     libesedb_page_t *page,
+     uint16_t *available_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_get_available_data_size";
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_header_get_available_data_size(
+	     page->header,
+	     available_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve available data size from header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the flags
  * Returns 1 if successful or -1 on error
  */
@@ -1562,6 +1693,87 @@ int libesedb_page_get_flags(
 	return( 1 );
 }
 
+/* Retrieves the page type
+ * The type is determined from the page flags, where the empty, space tree and
+ * long value flags take precedence over the root, parent and leaf flags
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_get_type(
+     libesedb_page_t *page,
+     uint8_t *page_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_get_type";
+	uint32_t page_flags   = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_header_get_flags(
+	     page->header,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve flags from header.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_flags == 0 )
+	 || ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 ) )
+	{
+		*page_type = LIBESEDB_PAGE_TYPE_EMPTY;
+	}
+	else if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_SPACE_TREE ) != 0 )
+	{
+		*page_type = LIBESEDB_PAGE_TYPE_SPACE_TREE;
+	}
+	else if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LONG_VALUE ) != 0 )
+	{
+		*page_type = LIBESEDB_PAGE_TYPE_LONG_VALUE;
+	}
+	else if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+	{
+		*page_type = LIBESEDB_PAGE_TYPE_ROOT;
+	}
+	else if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_PARENT ) != 0 )
+	{
+		*page_type = LIBESEDB_PAGE_TYPE_BRANCH;
+	}
+	else if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	{
+		*page_type = LIBESEDB_PAGE_TYPE_LEAF;
+	}
+	else
+	{
+		*page_type = LIBESEDB_PAGE_TYPE_UNKNOWN;
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of page values
  * Returns 1 if successful or -1 on error
  */
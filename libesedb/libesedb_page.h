@@ -60,9 +60,17 @@ struct libesedb_page
 	 */
 	size_t data_size;
 
+	/* Value to indicate the data references the memory data of the IO handle
+	 */
+	uint8_t data_is_reference;
+
 	/* The values array
 	 */
 	libcdata_array_t *values_array;
+
+	/* The IO handle that maintains the memory usage of the data
+	 */
+	libesedb_io_handle_t *io_handle;
 };
 
 int libesedb_page_initialize(
@@ -132,11 +140,21 @@ int libesedb_page_get_father_data_page_object_identifier(
      uint32_t *father_data_page_object_identifier,
      libcerror_error_t **error );
 
+int libesedb_page_get_available_data_size(
+     libesedb_page_t *page,
+     uint16_t *available_data_size,
+     libcerror_error_t **error );
+
 int libesedb_page_get_flags(
      libesedb_page_t *page,
      uint32_t *flags,
      libcerror_error_t **error );
 
+int libesedb_page_get_type(
+     libesedb_page_t *page,
+     uint8_t *page_type,
+     libcerror_error_t **error );
+
 int libesedb_page_get_number_of_values(
      libesedb_page_t *page,
      uint16_t *number_of_values,
@@ -146,15 +146,14 @@ int libesedb_page_header_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
-	static char *function        = "libesedb_page_header_read_data";
-	size_t data_offset           = 0;
-	size_t minimum_data_size     = 0;
-	uint16_t available_data_size = 0;
-	uint8_t has_extended_header  = 0;
+	static char *function       = "libesedb_page_header_read_data";
+	size_t data_offset          = 0;
+	size_t minimum_data_size    = 0;
+	uint8_t has_extended_header = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit         = 0;
-	uint16_t value_16bit         = 0;
+	uint64_t value_64bit        = 0;
+	uint16_t value_16bit        = 0;
 #endif
 
 	if( page_header == NULL )
@@ -224,7 +223,7 @@ int libesedb_page_header_read_data(
 #endif
 	byte_stream_copy_to_uint16_little_endian(
 	 ( (esedb_page_header_t *) data )->available_data_size,
-	 available_data_size );
+	 page_header->available_data_size );
 
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (esedb_page_header_t *) data )->previous_page,
@@ -332,9 +331,9 @@ int libesedb_page_header_read_data(
 		 page_header->father_data_page_object_identifier );
 
 		libcnotify_printf(
-		 "%s: available data size\t\t\t\t: %" PRIu32 "\n",
+		 "%s: available data size\t\t\t\t: %" PRIu16 "\n",
 		 function,
-		 available_data_size );
+		 page_header->available_data_size );
 
 		byte_stream_copy_to_uint16_little_endian(
 		 ( (esedb_page_header_t *) data )->available_uncommitted_data_size,
@@ -542,6 +541,43 @@ int libesedb_page_header_get_father_data_page_object_identifier(
 	return( 1 );
 }
 
+/* Retrieves the available data size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_header_get_available_data_size(
+     libesedb_page_header_t *page_header,
+     uint16_t *available_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_header_get_available_data_size";
+
+	if( page_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page header.",
+		 function );
+
+		return( -1 );
+	}
+	if( available_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid available data size.",
+		 function );
+
+		return( -1 );
+	}
+	*available_data_size = page_header->available_data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the flags
  * Returns 1 if successful or -1 on error
  */
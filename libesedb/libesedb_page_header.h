@@ -52,6 +52,10 @@ struct libesedb_page_header
 	 */
 	uint32_t father_data_page_object_identifier;
 
+	/* The available data size
+	 */
+	uint16_t available_data_size;
+
 	/* The (first) available page tag
 	 */
 	uint16_t available_page_tag;
@@ -103,6 +107,11 @@ int libesedb_page_header_get_father_data_page_object_identifier(
      uint32_t *father_data_page_object_identifier,
      libcerror_error_t **error );
 
+int libesedb_page_header_get_available_data_size(
+     libesedb_page_header_t *page_header,
+     uint16_t *available_data_size,
+     libcerror_error_t **error );
+
 int libesedb_page_header_get_flags(
      libesedb_page_header_t *page_header,
      uint32_t *flags,
@@ -40,6 +40,7 @@
 #include "libesedb_page_tree_value.h"
 #include "libesedb_root_page_header.h"
 #include "libesedb_space_tree.h"
+#include "libesedb_space_tree_value.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_unused.h"
 
@@ -188,8 +189,9 @@ int libesedb_page_tree_free(
      libesedb_page_tree_t **page_tree,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_page_tree_free";
-	int result            = 1;
+	static char *function               = "libesedb_page_tree_free";
+	int number_of_leaf_page_descriptors = 0;
+	int result                          = 1;
 
 	if( page_tree == NULL )
 	{
@@ -223,6 +225,38 @@ int libesedb_page_tree_free(
 				result = -1;
 			}
 		}
+		if( ( ( *page_tree )->io_handle != NULL )
+		 && ( ( *page_tree )->leaf_page_descriptors_tree != NULL ) )
+		{
+			if( libcdata_btree_get_number_of_values(
+			     ( *page_tree )->leaf_page_descriptors_tree,
+			     &number_of_leaf_page_descriptors,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of leaf page descriptors.",
+				 function );
+
+				result = -1;
+			}
+			else if( libesedb_io_handle_remove_memory_usage(
+			          ( *page_tree )->io_handle,
+			          (size64_t) number_of_leaf_page_descriptors * sizeof( libesedb_leaf_page_descriptor_t ),
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to remove leaf page descriptors size from memory usage.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_btree_free(
 		     &( ( *page_tree )->leaf_page_descriptors_tree ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_leaf_page_descriptor_free,
@@ -237,6 +271,23 @@ int libesedb_page_tree_free(
 
 			result = -1;
 		}
+		if( ( *page_tree )->owned_extents_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *page_tree )->owned_extents_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_space_tree_value_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free owned extents array.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *page_tree );
 
@@ -359,8 +410,10 @@ int libesedb_page_tree_read_space_trees(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libesedb_space_tree_t *space_tree = NULL;
-	static char *function             = "libesedb_page_tree_read_space_trees";
+	libesedb_space_tree_t *space_tree             = NULL;
+	libesedb_space_tree_value_t *space_tree_value = NULL;
+	static char *function                         = "libesedb_page_tree_read_space_trees";
+	int entry_index                               = 0;
 
 	if( page_tree == NULL )
 	{
@@ -384,9 +437,87 @@ int libesedb_page_tree_read_space_trees(
 
 		return( -1 );
 	}
-	/* Read the space tree pages
+	if( page_tree->owned_extents_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( page_tree->owned_extents_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_space_tree_value_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free owned extents array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	page_tree->number_of_owned_pages       = 0;
+	page_tree->number_of_owned_extents     = 0;
+	page_tree->number_of_available_pages   = 0;
+	page_tree->number_of_available_extents = 0;
+
+	/* A page tree without space trees owns a single extent
+	 * otherwise read the space tree pages
 	 */
-	if( page_tree->root_page_header->extent_space > 0 )
+	if( page_tree->root_page_header->extent_space == 0 )
+	{
+		page_tree->number_of_owned_pages   = page_tree->root_page_header->initial_number_of_pages;
+		page_tree->number_of_owned_extents = 1;
+
+		if( libcdata_array_initialize(
+		     &( page_tree->owned_extents_array ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create owned extents array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_space_tree_value_initialize(
+		     &space_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create space tree value.",
+			 function );
+
+			goto on_error;
+		}
+		space_tree_value->number_of_pages = page_tree->root_page_header->initial_number_of_pages;
+
+		if( space_tree_value->number_of_pages > 0 )
+		{
+			space_tree_value->last_page_number = page_tree->root_page_number + space_tree_value->number_of_pages - 1;
+		}
+		if( libcdata_array_append_entry(
+		     page_tree->owned_extents_array,
+		     &entry_index,
+		     (intptr_t *) space_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append space tree value to owned extents array.",
+			 function );
+
+			goto on_error;
+		}
+		space_tree_value = NULL;
+	}
+	else
 	{
 		if( page_tree->root_page_header->space_tree_page_number >= 0xff000000UL )
 		{
@@ -436,6 +567,14 @@ int libesedb_page_tree_read_space_trees(
 
 				goto on_error;
 			}
+			page_tree->number_of_owned_pages   = space_tree->number_of_pages;
+			page_tree->number_of_owned_extents = space_tree->number_of_extents;
+
+			/* Take over the owned extents from the space tree
+			 */
+			page_tree->owned_extents_array = space_tree->values_array;
+			space_tree->values_array       = NULL;
+
 			if( libesedb_space_tree_free(
 			     &space_tree,
 			     error ) != 1 )
@@ -483,6 +622,9 @@ int libesedb_page_tree_read_space_trees(
 
 				goto on_error;
 			}
+			page_tree->number_of_available_pages   = space_tree->number_of_pages;
+			page_tree->number_of_available_extents = space_tree->number_of_extents;
+
 			if( libesedb_space_tree_free(
 			     &space_tree,
 			     error ) != 1 )
@@ -501,12 +643,25 @@ int libesedb_page_tree_read_space_trees(
 	return( 1 );
 
 on_error:
+	if( space_tree_value != NULL )
+	{
+		libesedb_space_tree_value_free(
+		 &space_tree_value,
+		 NULL );
+	}
 	if( space_tree != NULL )
 	{
 		libesedb_space_tree_free(
 		 &space_tree,
 		 NULL );
 	}
+	if( page_tree->owned_extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &( page_tree->owned_extents_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_space_tree_value_free,
+		 NULL );
+	}
 	return( -1 );
 }
 
@@ -1052,6 +1207,8 @@ int libesedb_page_tree_get_first_leaf_page_number_from_page(
 		if( ( child_page_number > 0 )
 		 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
 		{
+			page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 			if( libfdata_vector_get_element_value_by_index(
 			     page_tree->pages_vector,
 			     (intptr_t *) file_io_handle,
@@ -1176,6 +1333,8 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 
 		return( -1 );
 	}
+	page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 	if( libfdata_vector_get_element_value_by_index(
 	     page_tree->pages_vector,
 	     (intptr_t *) file_io_handle,
@@ -1308,6 +1467,8 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 		}
 		last_leaf_page_number = safe_leaf_page_number;
 
+		page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 		if( libfdata_vector_get_element_value_by_index(
 		     page_tree->pages_vector,
 		     (intptr_t *) file_io_handle,
@@ -1598,6 +1759,8 @@ int libesedb_page_tree_get_number_of_leaf_values(
 
 				goto on_error;
 			}
+			page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 			if( libfdata_vector_get_element_value_by_index(
 			     page_tree->pages_vector,
 			     (intptr_t *) file_io_handle,
@@ -1670,6 +1833,21 @@ int libesedb_page_tree_get_number_of_leaf_values(
 			}
 			leaf_page_descriptor = NULL;
 
+			if( libesedb_io_handle_add_memory_usage(
+			     page_tree->io_handle,
+			     (size64_t) sizeof( libesedb_leaf_page_descriptor_t ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add leaf page descriptor size to memory usage.",
+				 function );
+
+				goto on_error;
+			}
+
 			if( libesedb_page_get_next_page_number(
 			     page,
 			     &leaf_page_number,
@@ -1704,17 +1882,17 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves a specific leaf value
- * This function creates a new data definition
+/* Retrieves the space statistics from a page
+ * Since all the leaf pages are at the same depth of the page tree only the first
+ * child page of a branch page is read, when it is a leaf page its sibling pages
+ * are counted as leaf pages without reading them
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tree_get_leaf_value_by_index_from_page(
+int libesedb_page_tree_get_space_statistics_from_page(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
      libesedb_page_t *page,
-     int leaf_value_index,
-     libesedb_data_definition_t **data_definition,
-     int *current_leaf_value_index,
+     uint64_t *statistics,
      int recursion_depth,
      libcerror_error_t **error )
 {
@@ -1722,12 +1900,15 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 	libesedb_page_tree_value_t *page_tree_value = NULL;
 	libesedb_page_value_t *page_value           = NULL;
 	libfcache_cache_t *child_page_cache         = NULL;
-	static char *function                       = "libesedb_page_tree_get_leaf_value_by_index_from_page";
+	static char *function                       = "libesedb_page_tree_get_space_statistics_from_page";
+	uint32_t child_page_flags                   = 0;
 	uint32_t child_page_number                  = 0;
 	uint32_t page_flags                         = 0;
-	uint16_t data_offset                        = 0;
+	uint16_t available_data_size                = 0;
 	uint16_t number_of_page_values              = 0;
 	uint16_t page_value_index                   = 0;
+	uint8_t child_pages_are_leaf_pages          = 0;
+	int number_of_leaf_values                   = 0;
 
 	if( page_tree == NULL )
 	{
@@ -1751,24 +1932,13 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 
 		return( -1 );
 	}
-	if( data_definition == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data definition.",
-		 function );
-
-		return( -1 );
-	}
-	if( current_leaf_value_index == NULL )
+	if( statistics == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current leaf value index.",
+		 "%s: invalid statistics.",
 		 function );
 
 		return( -1 );
@@ -1785,34 +1955,74 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 
 		return( -1 );
 	}
-	if( libesedb_page_get_number_of_values(
+	if( libesedb_page_get_flags(
 	     page,
-	     &number_of_page_values,
+	     &page_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of page values.",
+		 "%s: unable to retrieve page flags.",
 		 function );
 
 		goto on_error;
 	}
-	if( number_of_page_values == 0 )
+	statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_PAGES ] += 1;
+
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
 	{
+		if( libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
+		     page_tree,
+		     page,
+		     &number_of_leaf_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of leaf values from page: %" PRIu32 ".",
+			 function,
+			 page->page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_available_data_size(
+		     page,
+		     &available_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve available data size.",
+			 function );
+
+			goto on_error;
+		}
+		statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES ]          += 1;
+		statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_SAMPLED_LEAF_PAGES ]  += 1;
+		statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_SAMPLED_LEAF_VALUES ] += (uint64_t) number_of_leaf_values;
+
+		if( (uint32_t) available_data_size < page_tree->io_handle->page_size )
+		{
+			statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_SAMPLED_LEAF_BYTES ] += page_tree->io_handle->page_size - available_data_size;
+		}
 		return( 1 );
 	}
-	if( libesedb_page_get_flags(
+	if( libesedb_page_get_number_of_values(
 	     page,
-	     &page_flags,
+	     &number_of_page_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page flags.",
+		 "%s: unable to retrieve number of page values.",
 		 function );
 
 		goto on_error;
@@ -1866,43 +2076,16 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: page value: %03" PRIu16 " page tag flags\t\t: 0x%02" PRIx8 "",
-			 function,
-			 page_value_index,
-			 page_value->flags );
-			libesedb_debug_print_page_tag_flags(
-			 page_value->flags );
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
 		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
 		{
 			continue;
 		}
-		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		if( child_pages_are_leaf_pages != 0 )
 		{
-			if( *current_leaf_value_index == INT_MAX )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid current leaf value index value out of bounds.",
-				 function );
-
-				goto on_error;
-			}
-			if( *current_leaf_value_index < leaf_value_index )
-			{
-				*current_leaf_value_index += 1;
+			statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_PAGES ]      += 1;
+			statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES ] += 1;
 
-				continue;
-			}
+			continue;
 		}
 		if( libesedb_page_tree_value_initialize(
 		     &page_tree_value,
@@ -1934,186 +2117,125 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 
 			goto on_error;
 		}
-		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		if( page_tree_value->data_size < 4 )
 		{
-			if( libesedb_data_definition_initialize(
-			     data_definition,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create data definition.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page tree value: %" PRIu16 " data size value out of bounds.",
+			 function,
+			 page_value_index );
 
-				goto on_error;
-			}
-			data_offset = page_value->offset + 2 + page_tree_value->local_key_size;
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 page_tree_value->data,
+		 child_page_number );
 
-			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
-			{
-				data_offset += 2;
-			}
-			( *data_definition )->page_value_index = page_value_index;
-			( *data_definition )->page_offset      = page->offset - ( 2 * page_tree->io_handle->page_size );
-			( *data_definition )->page_number      = page->page_number;
-			( *data_definition )->data_offset      = data_offset;
-			( *data_definition )->data_size        = page_tree_value->data_size;
+		if( libesedb_page_tree_value_free(
+		     &page_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree value.",
+			 function );
 
-			*current_leaf_value_index += 1;
+			goto on_error;
 		}
-		else
-		{
-			if( page_tree_value->data_size < 4 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid page tree value: %" PRIu16 " data size value out of bounds.",
-				 function,
-				 page_value_index );
-
-				goto on_error;
-			}
-			byte_stream_copy_to_uint32_little_endian(
-			 page_tree_value->data,
-			 child_page_number );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: page value: %03" PRIu16 " child page number\t: %" PRIu32 "",
-				 function,
-				 page_value_index,
-				 child_page_number );
-
-				if( child_page_number == 0 )
-				{
-					libcnotify_printf(
-					 " (invalid page number)\n" );
-				}
-				else if( child_page_number > page_tree->io_handle->last_page_number )
-				{
-					libcnotify_printf(
-					 " (exceeds last page number: %" PRIu32 ")\n",
-					 page_tree->io_handle->last_page_number );
-				}
-				libcnotify_printf(
-				 "\n" );
-				libcnotify_printf(
-				 "\n" );
-			}
-#endif
 #if ( SIZEOF_INT <= 4 )
-			if( ( child_page_number < 1 )
-			 || ( child_page_number > (uint32_t) INT_MAX ) )
+		if( ( child_page_number < 1 )
+		 || ( child_page_number > (uint32_t) INT_MAX ) )
 #else
-			if( ( child_page_number < 1 )
-			 || ( (int) child_page_number > INT_MAX ) )
+		if( ( child_page_number < 1 )
+		 || ( (int) child_page_number > INT_MAX ) )
 #endif
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid child page number value out of bounds.",
-				 function );
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid child page number value out of bounds.",
+			 function );
 
-				goto on_error;
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( page_tree_value->data_size > 4 )
-				{
-					libcnotify_printf(
-					 "%s: page value: %03" PRIu16 " trailing data:\n",
-					 function,
-					 page_value_index );
-					libcnotify_print_data(
-					 &( page_tree_value->data[ 4 ] ),
-					 page_tree_value->data_size - 4,
-					 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-				}
-			}
-#endif
-			if( ( child_page_number > 0 )
-			 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
-			{
-				if( libfdata_vector_get_element_value_by_index(
-				     page_tree->pages_vector,
-				     (intptr_t *) file_io_handle,
-				     (libfdata_cache_t *) child_page_cache,
-				     (int) child_page_number - 1,
-				     (intptr_t **) &child_page,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve page: %" PRIu32 ".",
-					 function,
-					 child_page_number );
+			goto on_error;
+		}
+		if( child_page_number > page_tree->io_handle->last_page_number )
+		{
+			continue;
+		}
+		page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
 
-					goto on_error;
-				}
-				if( libesedb_page_validate_page(
-				     child_page,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: unsupported page.",
-					 function );
+		if( libfdata_vector_get_element_value_by_index(
+		     page_tree->pages_vector,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) child_page_cache,
+		     (int) child_page_number - 1,
+		     (intptr_t **) &child_page,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 child_page_number );
 
-					goto on_error;
-				}
-				if( libesedb_page_tree_get_leaf_value_by_index_from_page(
-				     page_tree,
-				     file_io_handle,
-				     child_page,
-				     leaf_value_index,
-				     data_definition,
-				     current_leaf_value_index,
-				     recursion_depth + 1,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve leaf value: %d from page: %" PRIu32 ".",
-					 function,
-					 leaf_value_index,
-					 child_page_number );
+			goto on_error;
+		}
+		if( libesedb_page_validate_page(
+		     child_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page.",
+			 function );
 
-					goto on_error;
-				}
-			}
+			goto on_error;
 		}
-		if( libesedb_page_tree_value_free(
-		     &page_tree_value,
+		if( libesedb_page_get_flags(
+		     child_page,
+		     &child_page_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free page tree value.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve child page flags.",
 			 function );
 
 			goto on_error;
 		}
-		if( *current_leaf_value_index > leaf_value_index )
+		if( ( child_page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
 		{
-			break;
+			child_pages_are_leaf_pages = 1;
+		}
+		if( libesedb_page_tree_get_space_statistics_from_page(
+		     page_tree,
+		     file_io_handle,
+		     child_page,
+		     statistics,
+		     recursion_depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve space statistics from page: %" PRIu32 ".",
+			 function,
+			 child_page_number );
+
+			goto on_error;
 		}
 	}
 	if( libfcache_cache_free(
@@ -2132,12 +2254,6 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 	return( 1 );
 
 on_error:
-	if( *data_definition != NULL )
-	{
-		libesedb_data_definition_free(
-		 data_definition,
-		 NULL );
-	}
 	if( page_tree_value != NULL )
 	{
 		libesedb_page_tree_value_free(
@@ -2153,27 +2269,26 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves a specific leaf value
- * This function creates a new data definition
+/* Retrieves the space statistics
+ * The statistics are indexed by the LIBESEDB_TABLE_STATISTIC definitions and determined
+ * from the space trees, the branch pages and a sample of the leaf pages
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tree_get_leaf_value_by_index(
+int libesedb_page_tree_get_space_statistics(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
-     int leaf_value_index,
-     libesedb_data_definition_t **data_definition,
+     uint64_t *statistics,
+     int number_of_statistics,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *upper_node                               = NULL;
-	libesedb_leaf_page_descriptor_t *existing_leaf_page_descriptor = NULL;
-	libesedb_leaf_page_descriptor_t *leaf_page_descriptor          = NULL;
-	libesedb_page_t *base_page                                     = NULL;
-	libfcache_cache_t *base_page_cache                             = NULL;
-	static char *function                                          = "libesedb_page_tree_get_leaf_value_by_index";
-	uint32_t base_page_number                                      = 0;
-	int current_leaf_value_index                                   = 0;
-	int number_of_leaf_values                                      = 0;
-	int result                                                     = 0;
+	uint64_t safe_statistics[ LIBESEDB_NUMBER_OF_TABLE_STATISTICS ];
+
+	libesedb_page_t *root_page         = NULL;
+	libfcache_cache_t *root_page_cache = NULL;
+	static char *function              = "libesedb_page_tree_get_space_statistics";
+	uint64_t number_of_sampled_pages   = 0;
+	uint32_t page_flags                = 0;
+	int statistic_index                = 0;
 
 	if( page_tree == NULL )
 	{
@@ -2186,155 +2301,112 @@ int libesedb_page_tree_get_leaf_value_by_index(
 
 		return( -1 );
 	}
-	if( leaf_value_index < 0 )
+	if( page_tree->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid leaf value index value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( data_definition == NULL )
+	if( statistics == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data definition.",
+		 "%s: invalid statistics.",
 		 function );
 
 		return( -1 );
 	}
-	if( page_tree->number_of_leaf_values == -1 )
+	if( ( number_of_statistics < 0 )
+	 || ( number_of_statistics > LIBESEDB_NUMBER_OF_TABLE_STATISTICS ) )
 	{
-		/* libesedb_page_tree_get_number_of_leaf_values is called to build the leaf_page_descriptors_tree
-		 */
-		if( libesedb_page_tree_get_number_of_leaf_values(
-		     page_tree,
-		     file_io_handle,
-		     &number_of_leaf_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of leaf values from page: %" PRIu32 ".",
-			 function,
-			 page_tree->root_page_number );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of statistics value out of bounds.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	base_page_number = page_tree->root_page_number;
+	if( memory_set(
+	     safe_statistics,
+	     0,
+	     sizeof( uint64_t ) * LIBESEDB_NUMBER_OF_TABLE_STATISTICS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
 
-	if( libesedb_leaf_page_descriptor_initialize(
-	     &leaf_page_descriptor,
+		return( -1 );
+	}
+        /* Use a local cache to prevent cache invalidation of the root page
+         * when reading the space trees and child pages.
+         */
+	if( libfcache_cache_initialize(
+	     &root_page_cache,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create leaf page descriptor.",
-		 function );
-
-		goto on_error;
-	}
-	leaf_page_descriptor->first_leaf_value_index = leaf_value_index;
-	leaf_page_descriptor->last_leaf_value_index  = leaf_value_index;
-
-	result = libcdata_btree_get_value_by_value(
-	          page_tree->leaf_page_descriptors_tree,
-	          (intptr_t *) leaf_page_descriptor,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_leaf_page_descriptor_compare,
-	          &upper_node,
-	          (intptr_t **) &existing_leaf_page_descriptor,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf page descriptor from tree.",
+		 "%s: unable to create root page cache.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
-	{
-		if( existing_leaf_page_descriptor == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing existing leaf page descriptor.",
-			 function );
-
-			goto on_error;
-		}
-		current_leaf_value_index = existing_leaf_page_descriptor->first_leaf_value_index;
-		base_page_number         = existing_leaf_page_descriptor->page_number;
-	}
-	if( libesedb_leaf_page_descriptor_free(
-	     &leaf_page_descriptor,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free leaf page descriptor.",
-		 function );
+	page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
 
-		goto on_error;
-	}
-        /* Use a local cache to prevent cache invalidation of the root page
-         * when reading child pages.
-         */
-	if( libfcache_cache_initialize(
-	     &base_page_cache,
-	     1,
+	if( libfdata_vector_get_element_value_by_index(
+	     page_tree->pages_vector,
+	     (intptr_t *) file_io_handle,
+	     (libfdata_cache_t *) root_page_cache,
+	     (int) page_tree->root_page_number - 1,
+	     (intptr_t **) &root_page,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create base page cache.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
 
 		goto on_error;
 	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) base_page_cache,
-	     (int) base_page_number - 1,
-	     (intptr_t **) &base_page,
-	     0,
+	if( libesedb_page_get_flags(
+	     root_page,
+	     &page_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 ".",
-		 function,
-		 base_page_number );
+		 "%s: unable to retrieve page flags.",
+		 function );
 
 		goto on_error;
 	}
-	if( base_page_number == page_tree->root_page_number )
+	/* Seen in temp.edb where is root flag is not set
+	 */
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
 	{
 		if( libesedb_page_validate_root_page(
-		     base_page,
+		     root_page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -2346,14 +2418,50 @@ int libesedb_page_tree_get_leaf_value_by_index(
 
 			goto on_error;
 		}
+		if( page_tree->root_page_header == NULL )
+		{
+			if( libesedb_page_tree_read_root_page_header(
+			     page_tree,
+			     root_page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read root page header.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( page_tree->root_page_header != NULL )
+		{
+			if( libesedb_page_tree_read_space_trees(
+			     page_tree,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read space trees.",
+				 function );
+
+				goto on_error;
+			}
+			safe_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_OWNED_PAGES ]       = page_tree->number_of_owned_pages;
+			safe_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_OWNED_EXTENTS ]     = page_tree->number_of_owned_extents;
+			safe_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_AVAILABLE_PAGES ]   = page_tree->number_of_available_pages;
+			safe_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_AVAILABLE_EXTENTS ] = page_tree->number_of_available_extents;
+		}
 	}
-	if( libesedb_page_tree_get_leaf_value_by_index_from_page(
+	if( libesedb_page_tree_get_space_statistics_from_page(
 	     page_tree,
 	     file_io_handle,
-	     base_page,
-	     leaf_value_index,
-	     data_definition,
-	     &current_leaf_value_index,
+	     root_page,
+	     safe_statistics,
 	     0,
 	     error ) != 1 )
 	{
@@ -2361,56 +2469,46 @@ int libesedb_page_tree_get_leaf_value_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value: %d from page: %" PRIu32 ".",
-		 function,
-		 leaf_value_index,
-		 base_page_number );
-
-		goto on_error;
-	}
-	if( current_leaf_value_index != ( leaf_value_index + 1 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current leaf value index value out of bounds.",
+		 "%s: unable to retrieve space statistics from root page.",
 		 function );
 
 		goto on_error;
 	}
 	if( libfcache_cache_free(
-	     &base_page_cache,
+	     &root_page_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free base page cache.",
+		 "%s: unable to free root page cache.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
+	/* The number of records and the fill factor are extrapolated from the sampled leaf pages
+	 */
+	number_of_sampled_pages = safe_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_SAMPLED_LEAF_PAGES ];
 
-on_error:
-	if( *data_definition != NULL )
+	if( number_of_sampled_pages > 0 )
 	{
-		libesedb_data_definition_free(
-		 data_definition,
-		 NULL );
+		safe_statistics[ LIBESEDB_TABLE_STATISTIC_ESTIMATED_NUMBER_OF_RECORDS ] = ( safe_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES ] * safe_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_SAMPLED_LEAF_VALUES ] ) / number_of_sampled_pages;
+		safe_statistics[ LIBESEDB_TABLE_STATISTIC_FILL_FACTOR ]                 = ( safe_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_SAMPLED_LEAF_BYTES ] * 100 ) / ( number_of_sampled_pages * page_tree->io_handle->page_size );
 	}
-	if( leaf_page_descriptor != NULL )
+	for( statistic_index = 0;
+	     statistic_index < number_of_statistics;
+	     statistic_index++ )
 	{
-		libesedb_leaf_page_descriptor_free(
-		 &leaf_page_descriptor,
-		 NULL );
+		statistics[ statistic_index ] = safe_statistics[ statistic_index ];
 	}
-	if( base_page_cache != NULL )
+	return( 1 );
+
+on_error:
+	if( root_page_cache != NULL )
 	{
 		libfcache_cache_free(
-		 &base_page_cache,
+		 &root_page_cache,
 		 NULL );
 	}
 	return( -1 );
@@ -2418,30 +2516,28 @@ on_error:
 
 /* Retrieves a specific leaf value
  * This function creates a new data definition
- * Returns 1 if successful, 0 if no such value or -1 on error
+ * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tree_get_leaf_value_by_key_from_page(
+int libesedb_page_tree_get_leaf_value_by_index_from_page(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
      libesedb_page_t *page,
-     libesedb_page_tree_key_t *leaf_value_key,
+     int leaf_value_index,
      libesedb_data_definition_t **data_definition,
+     int *current_leaf_value_index,
      int recursion_depth,
      libcerror_error_t **error )
 {
-	libesedb_page_tree_key_t *page_value_key    = NULL;
 	libesedb_page_t *child_page                 = NULL;
 	libesedb_page_tree_value_t *page_tree_value = NULL;
 	libesedb_page_value_t *page_value           = NULL;
 	libfcache_cache_t *child_page_cache         = NULL;
-	static char *function                       = "libesedb_page_tree_get_leaf_value_by_key_from_page";
+	static char *function                       = "libesedb_page_tree_get_leaf_value_by_index_from_page";
 	uint32_t child_page_number                  = 0;
 	uint32_t page_flags                         = 0;
 	uint16_t data_offset                        = 0;
 	uint16_t number_of_page_values              = 0;
 	uint16_t page_value_index                   = 0;
-	int compare_result                          = 0;
-	int result                                  = 0;
 
 	if( page_tree == NULL )
 	{
@@ -2476,6 +2572,17 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 
 		return( -1 );
 	}
+	if( current_leaf_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current leaf value index.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( recursion_depth < 0 )
 	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
 	{
@@ -2587,20 +2694,25 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 		{
 			continue;
 		}
-		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
 		{
-			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+			if( *current_leaf_value_index == INT_MAX )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported page - root flag is set and page value: %" PRIu16 " has common key.",
-				 function,
-				 page_value_index );
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid current leaf value index value out of bounds.",
+				 function );
 
 				goto on_error;
 			}
+			if( *current_leaf_value_index < leaf_value_index )
+			{
+				*current_leaf_value_index += 1;
+
+				continue;
+			}
 		}
 		if( libesedb_page_tree_value_initialize(
 		     &page_tree_value,
@@ -2632,75 +2744,36 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 
 			goto on_error;
 		}
-		if( libesedb_page_tree_get_key(
-		     page_tree,
-		     page_tree_value,
-		     page,
-		     page_flags,
-		     page_value_index,
-		     &page_value_key,
-		     error ) != 1 )
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve key of page value: %" PRIu16 ".",
-			 function,
-			 page_value_index );
-
-			goto on_error;
-		}
-		compare_result = libesedb_page_tree_key_compare(
-		                  leaf_value_key,
-		                  page_value_key,
-		                  error );
+			if( libesedb_data_definition_initialize(
+			     data_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data definition.",
+				 function );
 
-		if( compare_result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare page value: %" PRIu16 " and leaf value keys.",
-			 function,
-			 page_value_index );
+				goto on_error;
+			}
+			data_offset = page_value->offset + 2 + page_tree_value->local_key_size;
 
-			goto on_error;
-		}
-		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
-		{
-			if( compare_result == LIBFDATA_COMPARE_EQUAL )
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
 			{
-				if( libesedb_data_definition_initialize(
-				     data_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create data definition.",
-					 function );
-
-					goto on_error;
-				}
-				data_offset = page_value->offset + 2 + page_tree_value->local_key_size;
-
-				if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
-				{
-					data_offset += 2;
-				}
-				( *data_definition )->page_value_index = page_value_index;
-				( *data_definition )->page_offset      = page->offset - ( 2 * page_tree->io_handle->page_size );
-				( *data_definition )->page_number      = page->page_number;
-				( *data_definition )->data_offset      = data_offset;
-				( *data_definition )->data_size        = page_tree_value->data_size;
-
-				result = 1;
+				data_offset += 2;
 			}
+			( *data_definition )->page_value_index = page_value_index;
+			( *data_definition )->page_offset      = page->offset - ( 2 * page_tree->io_handle->page_size );
+			( *data_definition )->page_number      = page->page_number;
+			( *data_definition )->data_offset      = data_offset;
+			( *data_definition )->data_size        = page_tree_value->data_size;
+
+			*current_leaf_value_index += 1;
 		}
-		else if( compare_result != LIBFDATA_COMPARE_GREATER )
+		else
 		{
 			if( page_tree_value->data_size < 4 )
 			{
@@ -2780,6 +2853,8 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 			if( ( child_page_number > 0 )
 			 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
 			{
+				page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 				if( libfdata_vector_get_element_value_by_index(
 				     page_tree->pages_vector,
 				     (intptr_t *) file_io_handle,
@@ -2812,42 +2887,29 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 
 					goto on_error;
 				}
-				result = libesedb_page_tree_get_leaf_value_by_key_from_page(
-				          page_tree,
-				          file_io_handle,
-				          child_page,
-				          leaf_value_key,
-				          data_definition,
-				          recursion_depth + 1,
-				          error );
-
-				if( result == -1 )
+				if( libesedb_page_tree_get_leaf_value_by_index_from_page(
+				     page_tree,
+				     file_io_handle,
+				     child_page,
+				     leaf_value_index,
+				     data_definition,
+				     current_leaf_value_index,
+				     recursion_depth + 1,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve leaf value from page: %" PRIu32 ".",
+					 "%s: unable to retrieve leaf value: %d from page: %" PRIu32 ".",
 					 function,
+					 leaf_value_index,
 					 child_page_number );
 
 					goto on_error;
 				}
 			}
 		}
-		if( libesedb_page_tree_key_free(
-		     &page_value_key,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free page value key.",
-			 function );
-
-			goto on_error;
-		}
 		if( libesedb_page_tree_value_free(
 		     &page_tree_value,
 		     error ) != 1 )
@@ -2861,7 +2923,7 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 
 			goto on_error;
 		}
-		if( result != 0 )
+		if( *current_leaf_value_index > leaf_value_index )
 		{
 			break;
 		}
@@ -2879,7 +2941,7 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 
 		goto on_error;
 	}
-	return( result );
+	return( 1 );
 
 on_error:
 	if( *data_definition != NULL )
@@ -2888,12 +2950,6 @@ on_error:
 		 data_definition,
 		 NULL );
 	}
-	if( page_value_key != NULL )
-	{
-		libesedb_page_tree_key_free(
-		 &page_value_key,
-		 NULL );
-	}
 	if( page_tree_value != NULL )
 	{
 		libesedb_page_tree_value_free(
@@ -2911,19 +2967,26 @@ on_error:
 
 /* Retrieves a specific leaf value
  * This function creates a new data definition
- * Returns 1 if successful, 0 if no such value or -1 on error
+ * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tree_get_leaf_value_by_key(
+int libesedb_page_tree_get_leaf_value_by_index(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
-     libesedb_page_tree_key_t *leaf_value_key,
+     int leaf_value_index,
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error )
 {
-	libesedb_page_t *root_page         = NULL;
-	libfcache_cache_t *root_page_cache = NULL;
-	static char *function              = "libesedb_page_tree_get_leaf_value_by_key";
-	int result                         = 0;
+	libcdata_tree_node_t *upper_node                               = NULL;
+	libesedb_leaf_page_descriptor_t *existing_leaf_page_descriptor = NULL;
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor          = NULL;
+	libesedb_page_t *base_page                                     = NULL;
+	libfcache_cache_t *base_page_cache                             = NULL;
+	static char *function                                          = "libesedb_page_tree_get_leaf_value_by_index";
+	uint64_t trace_timestamp                                       = 0;
+	uint32_t base_page_number                                      = 0;
+	int current_leaf_value_index                                   = 0;
+	int number_of_leaf_values                                      = 0;
+	int result                                                     = 0;
 
 	if( page_tree == NULL )
 	{
@@ -2936,116 +2999,1791 @@ int libesedb_page_tree_get_leaf_value_by_key(
 
 		return( -1 );
 	}
-	/* Use a local cache to prevent cache invalidation of the root page
-	 * when reading child pages.
-	 */
-	if( libfcache_cache_initialize(
-	     &root_page_cache,
-	     1,
-	     error ) != 1 )
+	if( leaf_value_index < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create root page cache.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid leaf value index value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) root_page_cache,
-	     (int) page_tree->root_page_number - 1,
-	     (intptr_t **) &root_page,
-	     0,
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	trace_timestamp = libesedb_io_handle_get_trace_timestamp(
+	                   page_tree->io_handle );
+
+	if( page_tree->number_of_leaf_values == -1 )
+	{
+		/* libesedb_page_tree_get_number_of_leaf_values is called to build the leaf_page_descriptors_tree
+		 */
+		if( libesedb_page_tree_get_number_of_leaf_values(
+		     page_tree,
+		     file_io_handle,
+		     &number_of_leaf_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of leaf values from page: %" PRIu32 ".",
+			 function,
+			 page_tree->root_page_number );
+
+			goto on_error;
+		}
+	}
+	base_page_number = page_tree->root_page_number;
+
+	if( libesedb_leaf_page_descriptor_initialize(
+	     &leaf_page_descriptor,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 ".",
-		 function,
-		 page_tree->root_page_number );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create leaf page descriptor.",
+		 function );
 
 		goto on_error;
 	}
-	if( libesedb_page_validate_root_page(
-	     root_page,
-	     error ) != 1 )
+	leaf_page_descriptor->first_leaf_value_index = leaf_value_index;
+	leaf_page_descriptor->last_leaf_value_index  = leaf_value_index;
+
+	result = libcdata_btree_get_value_by_value(
+	          page_tree->leaf_page_descriptors_tree,
+	          (intptr_t *) leaf_page_descriptor,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_leaf_page_descriptor_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_leaf_page_descriptor,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported root page.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf page descriptor from tree.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( page_tree->root_page_header == NULL )
+	else if( result != 0 )
 	{
-		if( libesedb_page_tree_read_root_page_header(
-		     page_tree,
-		     root_page,
-		     error ) != 1 )
+		if( existing_leaf_page_descriptor == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read root page header.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing existing leaf page descriptor.",
 			 function );
 
 			goto on_error;
 		}
+		current_leaf_value_index = existing_leaf_page_descriptor->first_leaf_value_index;
+		base_page_number         = existing_leaf_page_descriptor->page_number;
 	}
-#endif
-	result = libesedb_page_tree_get_leaf_value_by_key_from_page(
-	          page_tree,
-	          file_io_handle,
-	          root_page,
-	          leaf_value_key,
-	          data_definition,
-	          0,
-	          error );
-
-	if( result == -1 )
+	if( libesedb_leaf_page_descriptor_free(
+	     &leaf_page_descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value from page: %" PRIu32 ".",
-		 function,
-		 page_tree->root_page_number );
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free leaf page descriptor.",
+		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_free(
-	     &root_page_cache,
+        /* Use a local cache to prevent cache invalidation of the root page
+         * when reading child pages.
+         */
+	if( libfcache_cache_initialize(
+	     &base_page_cache,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free root page cache.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create base page cache.",
 		 function );
 
 		goto on_error;
 	}
-	return( result );
+	page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
 
-on_error:
-	if( root_page_cache != NULL )
+	if( libfdata_vector_get_element_value_by_index(
+	     page_tree->pages_vector,
+	     (intptr_t *) file_io_handle,
+	     (libfdata_cache_t *) base_page_cache,
+	     (int) base_page_number - 1,
+	     (intptr_t **) &base_page,
+	     0,
+	     error ) != 1 )
 	{
-		libfcache_cache_free(
-		 &root_page_cache,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 base_page_number );
+
+		goto on_error;
+	}
+	if( base_page_number == page_tree->root_page_number )
+	{
+		if( libesedb_page_validate_root_page(
+		     base_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported root page.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_page_tree_get_leaf_value_by_index_from_page(
+	     page_tree,
+	     file_io_handle,
+	     base_page,
+	     leaf_value_index,
+	     data_definition,
+	     &current_leaf_value_index,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from page: %" PRIu32 ".",
+		 function,
+		 leaf_value_index,
+		 base_page_number );
+
+		goto on_error;
+	}
+	if( current_leaf_value_index != ( leaf_value_index + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current leaf value index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_free(
+	     &base_page_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free base page cache.",
+		 function );
+
+		goto on_error;
+	}
+	libesedb_io_handle_trace_event(
+	 page_tree->io_handle,
+	 LIBESEDB_TRACE_EVENT_PAGE_TREE_DESCENT,
+	 (uint64_t) page_tree->root_page_number,
+	 trace_timestamp,
+	 (uint64_t) ( *data_definition )->data_size );
+
+	return( 1 );
+
+on_error:
+	if( *data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 data_definition,
+		 NULL );
+	}
+	if( leaf_page_descriptor != NULL )
+	{
+		libesedb_leaf_page_descriptor_free(
+		 &leaf_page_descriptor,
+		 NULL );
+	}
+	if( base_page_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &base_page_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the key of a leaf value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_key(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_data_definition_t *data_definition,
+     libesedb_page_tree_key_t **key,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page                       = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_get_leaf_value_key";
+	off64_t element_data_offset                 = 0;
+	uint32_t page_flags                         = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key value already set.",
+		 function );
+
+		return( -1 );
+	}
+	page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
+	if( libfdata_vector_get_element_value_at_offset(
+	     page_tree->pages_vector,
+	     (intptr_t *) file_io_handle,
+	     (libfdata_cache_t *) page_tree->pages_cache,
+	     data_definition->page_offset,
+	     &element_data_offset,
+	     (intptr_t **) &page,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 function,
+		 data_definition->page_number,
+		 data_definition->page_offset );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_flags(
+	     page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_value_by_index(
+	     page,
+	     data_definition->page_value_index,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 data_definition->page_value_index );
+
+		goto on_error;
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value: %" PRIu16 ".",
+		 function,
+		 data_definition->page_value_index );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_value_initialize(
+	     &page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_value_read_data(
+	     page_tree_value,
+	     page_value->data,
+	     (size_t) page_value->size,
+	     page_value->flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page tree value: %" PRIu16 ".",
+		 function,
+		 data_definition->page_value_index );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_get_key(
+	     page_tree,
+	     page_tree_value,
+	     page,
+	     page_flags,
+	     data_definition->page_value_index,
+	     key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+		 function,
+		 data_definition->page_value_index );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_value_free(
+	     &page_tree_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 key,
+		 NULL );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific leaf value
+ * This function creates a new data definition
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_by_key_from_page(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     libesedb_page_tree_key_t *leaf_value_key,
+     libesedb_data_definition_t **data_definition,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_key_t *page_value_key    = NULL;
+	libesedb_page_t *child_page                 = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	libfcache_cache_t *child_page_cache         = NULL;
+	static char *function                       = "libesedb_page_tree_get_leaf_value_by_key_from_page";
+	uint32_t child_page_number                  = 0;
+	uint32_t page_flags                         = 0;
+	uint16_t data_offset                        = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
+	int compare_result                          = 0;
+	int result                                  = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_page_values == 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_page_get_flags(
+	     page,
+	     &page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page flags.",
+		 function );
+
+		goto on_error;
+	}
+        /* Use a local cache to prevent cache invalidation of the page
+         * when reading child pages.
+         */
+	if( libfcache_cache_initialize(
+	     &child_page_cache,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create child page cache.",
+		 function );
+
+		goto on_error;
+	}
+	for( page_value_index = 1;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		if( libesedb_page_get_value_by_index(
+		     page,
+		     page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: page value: %03" PRIu16 " page tag flags\t\t: 0x%02" PRIx8 "",
+			 function,
+			 page_value_index,
+			 page_value->flags );
+			libesedb_debug_print_page_tag_flags(
+			 page_value->flags );
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+		{
+			continue;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+		{
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported page - root flag is set and page value: %" PRIu16 " has common key.",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+		}
+		if( libesedb_page_tree_value_initialize(
+		     &page_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page tree value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_value_read_data(
+		     page_tree_value,
+		     page_value->data,
+		     (size_t) page_value->size,
+		     page_value->flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page tree value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_get_key(
+		     page_tree,
+		     page_tree_value,
+		     page,
+		     page_flags,
+		     page_value_index,
+		     &page_value_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		compare_result = libesedb_page_tree_key_compare(
+		                  leaf_value_key,
+		                  page_value_key,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare page value: %" PRIu16 " and leaf value keys.",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			if( compare_result == LIBFDATA_COMPARE_EQUAL )
+			{
+				if( libesedb_data_definition_initialize(
+				     data_definition,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create data definition.",
+					 function );
+
+					goto on_error;
+				}
+				data_offset = page_value->offset + 2 + page_tree_value->local_key_size;
+
+				if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+				{
+					data_offset += 2;
+				}
+				( *data_definition )->page_value_index = page_value_index;
+				( *data_definition )->page_offset      = page->offset - ( 2 * page_tree->io_handle->page_size );
+				( *data_definition )->page_number      = page->page_number;
+				( *data_definition )->data_offset      = data_offset;
+				( *data_definition )->data_size        = page_tree_value->data_size;
+
+				result = 1;
+			}
+		}
+		else if( compare_result != LIBFDATA_COMPARE_GREATER )
+		{
+			if( page_tree_value->data_size < 4 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid page tree value: %" PRIu16 " data size value out of bounds.",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 page_tree_value->data,
+			 child_page_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: page value: %03" PRIu16 " child page number\t: %" PRIu32 "",
+				 function,
+				 page_value_index,
+				 child_page_number );
+
+				if( child_page_number == 0 )
+				{
+					libcnotify_printf(
+					 " (invalid page number)\n" );
+				}
+				else if( child_page_number > page_tree->io_handle->last_page_number )
+				{
+					libcnotify_printf(
+					 " (exceeds last page number: %" PRIu32 ")\n",
+					 page_tree->io_handle->last_page_number );
+				}
+				libcnotify_printf(
+				 "\n" );
+				libcnotify_printf(
+				 "\n" );
+			}
+#endif
+#if ( SIZEOF_INT <= 4 )
+			if( ( child_page_number < 1 )
+			 || ( child_page_number > (uint32_t) INT_MAX ) )
+#else
+			if( ( child_page_number < 1 )
+			 || ( (int) child_page_number > INT_MAX ) )
+#endif
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid child page number value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( page_tree_value->data_size > 4 )
+				{
+					libcnotify_printf(
+					 "%s: page value: %03" PRIu16 " trailing data:\n",
+					 function,
+					 page_value_index );
+					libcnotify_print_data(
+					 &( page_tree_value->data[ 4 ] ),
+					 page_tree_value->data_size - 4,
+					 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+				}
+			}
+#endif
+			if( ( child_page_number > 0 )
+			 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
+			{
+				page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
+				if( libfdata_vector_get_element_value_by_index(
+				     page_tree->pages_vector,
+				     (intptr_t *) file_io_handle,
+				     (libfdata_cache_t *) child_page_cache,
+				     (int) child_page_number - 1,
+				     (intptr_t **) &child_page,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve page: %" PRIu32 ".",
+					 function,
+					 child_page_number );
+
+					goto on_error;
+				}
+				if( libesedb_page_validate_page(
+				     child_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported page.",
+					 function );
+
+					goto on_error;
+				}
+				result = libesedb_page_tree_get_leaf_value_by_key_from_page(
+				          page_tree,
+				          file_io_handle,
+				          child_page,
+				          leaf_value_key,
+				          data_definition,
+				          recursion_depth + 1,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve leaf value from page: %" PRIu32 ".",
+					 function,
+					 child_page_number );
+
+					goto on_error;
+				}
+			}
+		}
+		if( libesedb_page_tree_key_free(
+		     &page_value_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page value key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_value_free(
+		     &page_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree value.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 0 )
+		{
+			break;
+		}
+	}
+	if( libfcache_cache_free(
+	     &child_page_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free child page cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( *data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 data_definition,
+		 NULL );
+	}
+	if( page_value_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &page_value_key,
+		 NULL );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	if( child_page_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &child_page_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific leaf value
+ * This function creates a new data definition
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_by_key(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_tree_key_t *leaf_value_key,
+     libesedb_data_definition_t **data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *root_page         = NULL;
+	libfcache_cache_t *root_page_cache = NULL;
+	static char *function              = "libesedb_page_tree_get_leaf_value_by_key";
+	uint64_t trace_timestamp           = 0;
+	uint64_t trace_size                = 0;
+	int result                         = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	trace_timestamp = libesedb_io_handle_get_trace_timestamp(
+	                   page_tree->io_handle );
+
+	/* Use a local cache to prevent cache invalidation of the root page
+	 * when reading child pages.
+	 */
+	if( libfcache_cache_initialize(
+	     &root_page_cache,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create root page cache.",
+		 function );
+
+		goto on_error;
+	}
+	page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
+	if( libfdata_vector_get_element_value_by_index(
+	     page_tree->pages_vector,
+	     (intptr_t *) file_io_handle,
+	     (libfdata_cache_t *) root_page_cache,
+	     (int) page_tree->root_page_number - 1,
+	     (intptr_t **) &root_page,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_validate_root_page(
+	     root_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported root page.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( page_tree->root_page_header == NULL )
+	{
+		if( libesedb_page_tree_read_root_page_header(
+		     page_tree,
+		     root_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read root page header.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	result = libesedb_page_tree_get_leaf_value_by_key_from_page(
+	          page_tree,
+	          file_io_handle,
+	          root_page,
+	          leaf_value_key,
+	          data_definition,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value from page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
+
+		goto on_error;
+	}
+	if( libfcache_cache_free(
+	     &root_page_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root page cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		trace_size = (uint64_t) ( *data_definition )->data_size;
+	}
+	libesedb_io_handle_trace_event(
+	 page_tree->io_handle,
+	 LIBESEDB_TRACE_EVENT_PAGE_TREE_DESCENT,
+	 (uint64_t) page_tree->root_page_number,
+	 trace_timestamp,
+	 trace_size );
+
+	return( result );
+
+on_error:
+	if( root_page_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &root_page_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Carves leaf values from the pages of the page tree
+ * A page is scanned when it is a leaf page with the father data page (FDP) object identifier
+ * of the page tree. The defunct values of the leaf pages that are part of the page tree
+ * and the values of the leaf pages that were released from the page tree are stored as
+ * data definitions in the data definitions array. Pages that cannot be read are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_carve_leaf_values(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t first_page_number,
+     uint32_t number_of_pages,
+     libcdata_array_t *data_definitions_array,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *data_definition = NULL;
+	libesedb_page_t *leaf_page                  = NULL;
+	libesedb_page_t *page                       = NULL;
+	libesedb_page_t *root_page                  = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	libesedb_space_tree_value_t *extent         = NULL;
+	libfcache_cache_t *root_page_cache          = NULL;
+	uint8_t *leaf_pages_bitmap                  = NULL;
+	static char *function                       = "libesedb_page_tree_carve_leaf_values";
+	size_t leaf_pages_bitmap_size               = 0;
+	uint32_t extent_first_page_number           = 0;
+	uint32_t extent_last_page_number            = 0;
+	uint32_t father_data_page_object_identifier = 0;
+	uint32_t last_page_number                   = 0;
+	uint32_t leaf_page_number                   = 0;
+	uint32_t page_flags                         = 0;
+	uint32_t page_number                        = 0;
+	uint32_t range_last_page_number             = 0;
+	uint32_t unsupported_page_flags             = 0;
+	uint16_t data_offset                        = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
+	uint8_t carve_confidence                    = 0;
+	uint8_t is_live_page                        = 0;
+	int entry_index                             = 0;
+	int extent_index                            = 0;
+	int number_of_extents                       = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_page_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definitions_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definitions array.",
+		 function );
+
+		return( -1 );
+	}
+	last_page_number = page_tree->io_handle->last_page_number;
+
+	if( ( first_page_number > last_page_number )
+	 || ( number_of_pages == 0 ) )
+	{
+		return( 1 );
+	}
+	if( number_of_pages > ( last_page_number - first_page_number + 1 ) )
+	{
+		number_of_pages = last_page_number - first_page_number + 1;
+	}
+	range_last_page_number = first_page_number + number_of_pages - 1;
+
+	/* Determine the extents owned by the page tree from the space trees
+	 */
+	if( page_tree->owned_extents_array == NULL )
+	{
+		/* Use a local cache to prevent cache invalidation of the root page
+		 * when reading the space trees.
+		 */
+		if( libfcache_cache_initialize(
+		     &root_page_cache,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create root page cache.",
+			 function );
+
+			goto on_error;
+		}
+		page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
+		if( libfdata_vector_get_element_value_by_index(
+		     page_tree->pages_vector,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) root_page_cache,
+		     (int) page_tree->root_page_number - 1,
+		     (intptr_t **) &root_page,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_tree->root_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_flags(
+		     root_page,
+		     &page_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page flags.",
+			 function );
+
+			goto on_error;
+		}
+		/* Seen in temp.edb where is root flag is not set
+		 */
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+		{
+			if( libesedb_page_validate_root_page(
+			     root_page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported root page.",
+				 function );
+
+				goto on_error;
+			}
+			if( page_tree->root_page_header == NULL )
+			{
+				if( libesedb_page_tree_read_root_page_header(
+				     page_tree,
+				     root_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read root page header.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( page_tree->root_page_header != NULL )
+			{
+				if( libesedb_page_tree_read_space_trees(
+				     page_tree,
+				     file_io_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read space trees.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( libfcache_cache_free(
+		     &root_page_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free root page cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( page_tree->owned_extents_array != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     page_tree->owned_extents_array,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of owned extents.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Determine the leaf pages that are part of the page tree by following
+	 * the leaf page chain from the first leaf page
+	 */
+	leaf_pages_bitmap_size = (size_t) ( last_page_number / 8 ) + 1;
+
+	leaf_pages_bitmap = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * leaf_pages_bitmap_size );
+
+	if( leaf_pages_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create leaf pages bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     leaf_pages_bitmap,
+	     0,
+	     sizeof( uint8_t ) * leaf_pages_bitmap_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear leaf pages bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_get_get_first_leaf_page_number(
+	     page_tree,
+	     file_io_handle,
+	     &leaf_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf page number.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( leaf_page_number > 0 )
+	    && ( leaf_page_number <= last_page_number ) )
+	{
+		/* Stop when the leaf page chain contains a loop
+		 */
+		if( ( leaf_pages_bitmap[ leaf_page_number / 8 ] & ( 1 << ( leaf_page_number % 8 ) ) ) != 0 )
+		{
+			break;
+		}
+		leaf_pages_bitmap[ leaf_page_number / 8 ] |= (uint8_t) ( 1 << ( leaf_page_number % 8 ) );
+
+		page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
+		if( libfdata_vector_get_element_value_by_index(
+		     page_tree->pages_vector,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) page_tree->pages_cache,
+		     (int) leaf_page_number - 1,
+		     (intptr_t **) &leaf_page,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_next_page_number(
+		     leaf_page,
+		     &leaf_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next page number.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	unsupported_page_flags = LIBESEDB_PAGE_FLAG_IS_SPACE_TREE
+	                       | LIBESEDB_PAGE_FLAG_IS_INDEX
+	                       | LIBESEDB_PAGE_FLAG_IS_LONG_VALUE
+	                       | LIBESEDB_PAGE_FLAG_IS_SCRUBBED;
+
+	/* The pages are read directly from the file to prevent the scan from evicting
+	 * the pages of the page tree from the pages cache. Only the pages of the extents
+	 * owned by the page tree are scanned, if these are not known the entire range is scanned
+	 */
+	if( number_of_extents == 0 )
+	{
+		number_of_extents = 1;
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		extent_first_page_number = first_page_number;
+		extent_last_page_number  = range_last_page_number;
+
+		if( page_tree->owned_extents_array != NULL )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     page_tree->owned_extents_array,
+			     extent_index,
+			     (intptr_t **) &extent,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve owned extent: %d.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+			if( extent == NULL )
+			{
+				continue;
+			}
+			if( ( extent->last_page_number == 0 )
+			 || ( extent->number_of_pages == 0 ) )
+			{
+				continue;
+			}
+			if( extent->number_of_pages < extent->last_page_number )
+			{
+				extent_first_page_number = extent->last_page_number - extent->number_of_pages + 1;
+			}
+			else
+			{
+				extent_first_page_number = 1;
+			}
+			extent_last_page_number = extent->last_page_number;
+
+			if( extent_first_page_number < first_page_number )
+			{
+				extent_first_page_number = first_page_number;
+			}
+			if( extent_last_page_number > range_last_page_number )
+			{
+				extent_last_page_number = range_last_page_number;
+			}
+			if( extent_first_page_number > extent_last_page_number )
+			{
+				continue;
+			}
+		}
+		for( page_number = extent_first_page_number;
+		     page_number <= extent_last_page_number;
+		     page_number++ )
+		{
+			if( libesedb_page_initialize(
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create page.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_read_file_io_handle(
+			     page,
+			     page_tree->io_handle,
+			     file_io_handle,
+			     ( (off64_t) page_number + 1 ) * page_tree->io_handle->page_size,
+			     error ) != 1 )
+			{
+				libcerror_error_free(
+				 error );
+
+				if( libesedb_page_free(
+				     &page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free page.",
+					 function );
+
+					goto on_error;
+				}
+				continue;
+			}
+			if( libesedb_page_get_father_data_page_object_identifier(
+			     page,
+			     &father_data_page_object_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve father data page object identifier.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_get_flags(
+			     page,
+			     &page_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page flags.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_get_number_of_values(
+			     page,
+			     &number_of_page_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of page values.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( father_data_page_object_identifier != page_tree->object_identifier )
+			 || ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+			 || ( ( page_flags & unsupported_page_flags ) != 0 ) )
+			{
+				number_of_page_values = 0;
+			}
+			is_live_page = (uint8_t) ( ( leaf_pages_bitmap[ page_number / 8 ] & ( 1 << ( page_number % 8 ) ) ) != 0 );
+
+			/* Page value 0 contains the common page key
+			 */
+			for( page_value_index = 1;
+			     page_value_index < number_of_page_values;
+			     page_value_index++ )
+			{
+				if( libesedb_page_get_value_by_index(
+				     page,
+				     page_value_index,
+				     &page_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve page value: %" PRIu16 ".",
+					 function,
+					 page_value_index );
+
+					goto on_error;
+				}
+				if( page_value == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing page value: %" PRIu16 ".",
+					 function,
+					 page_value_index );
+
+					goto on_error;
+				}
+				if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+				{
+					if( is_live_page != 0 )
+					{
+						carve_confidence = LIBESEDB_CARVE_CONFIDENCE_HIGH;
+					}
+					else
+					{
+						carve_confidence = LIBESEDB_CARVE_CONFIDENCE_LOW;
+					}
+				}
+				else if( is_live_page == 0 )
+				{
+					carve_confidence = LIBESEDB_CARVE_CONFIDENCE_MEDIUM;
+				}
+				else
+				{
+					continue;
+				}
+				if( libesedb_page_tree_value_initialize(
+				     &page_tree_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create page tree value.",
+					 function );
+
+					goto on_error;
+				}
+				/* A value that cannot be read is not a record
+				 */
+				if( libesedb_page_tree_value_read_data(
+				     page_tree_value,
+				     page_value->data,
+				     (size_t) page_value->size,
+				     page_value->flags,
+				     error ) != 1 )
+				{
+					libcerror_error_free(
+					 error );
+				}
+				else
+				{
+					if( libesedb_data_definition_initialize(
+					     &data_definition,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to create data definition.",
+						 function );
+
+						goto on_error;
+					}
+					data_offset = page_value->offset + 2 + page_tree_value->local_key_size;
+
+					if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+					{
+						data_offset += 2;
+					}
+					data_definition->page_value_index = page_value_index;
+					data_definition->page_offset      = (off64_t) ( page_number - 1 ) * page_tree->io_handle->page_size;
+					data_definition->page_number      = page_number;
+					data_definition->data_offset      = data_offset;
+					data_definition->data_size        = page_tree_value->data_size;
+					data_definition->carve_confidence = carve_confidence;
+
+					if( libcdata_array_append_entry(
+					     data_definitions_array,
+					     &entry_index,
+					     (intptr_t *) data_definition,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append data definition to array.",
+						 function );
+
+						goto on_error;
+					}
+					data_definition = NULL;
+				}
+				if( libesedb_page_tree_value_free(
+				     &page_tree_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free page tree value.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libesedb_page_free(
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 leaf_pages_bitmap );
+
+	return( 1 );
+
+on_error:
+	if( root_page_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &root_page_cache,
+		 NULL );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( leaf_pages_bitmap != NULL )
+	{
+		memory_free(
+		 leaf_pages_bitmap );
 	}
 	return( -1 );
 }
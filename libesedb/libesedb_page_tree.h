@@ -86,6 +86,26 @@ struct libesedb_page_tree
 	/* The number of leaf values
 	 */
 	int number_of_leaf_values;
+
+	/* The number of owned pages
+	 */
+	uint64_t number_of_owned_pages;
+
+	/* The number of owned extents
+	 */
+	uint64_t number_of_owned_extents;
+
+	/* The owned extents array
+	 */
+	libcdata_array_t *owned_extents_array;
+
+	/* The number of available pages
+	 */
+	uint64_t number_of_available_pages;
+
+	/* The number of available extents
+	 */
+	uint64_t number_of_available_extents;
 };
 
 int libesedb_page_tree_initialize(
@@ -148,6 +168,21 @@ int libesedb_page_tree_get_number_of_leaf_values(
      int *number_of_leaf_values,
      libcerror_error_t **error );
 
+int libesedb_page_tree_get_space_statistics_from_page(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     uint64_t *statistics,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_space_statistics(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t *statistics,
+     int number_of_statistics,
+     libcerror_error_t **error );
+
 int libesedb_page_tree_get_leaf_value_by_index_from_page(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
@@ -165,6 +200,13 @@ int libesedb_page_tree_get_leaf_value_by_index(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error );
 
+int libesedb_page_tree_get_leaf_value_key(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_data_definition_t *data_definition,
+     libesedb_page_tree_key_t **key,
+     libcerror_error_t **error );
+
 int libesedb_page_tree_get_leaf_value_by_key_from_page(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
@@ -181,6 +223,14 @@ int libesedb_page_tree_get_leaf_value_by_key(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error );
 
+int libesedb_page_tree_carve_leaf_values(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t first_page_number,
+     uint32_t number_of_pages,
+     libcdata_array_t *data_definitions_array,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
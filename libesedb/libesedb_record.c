@@ -40,6 +40,7 @@
 #include "libesedb_page_tree.h"
 #include "libesedb_page_tree_key.h"
 #include "libesedb_record.h"
+#include "libesedb_record_layout.h"
 #include "libesedb_record_value.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
@@ -64,6 +65,7 @@ int libesedb_record_initialize(
 {
 	libesedb_internal_record_t *internal_record = NULL;
 	static char *function                       = "libesedb_record_initialize";
+	uint64_t trace_timestamp                    = 0;
 
 	if( record == NULL )
 	{
@@ -154,6 +156,9 @@ int libesedb_record_initialize(
 
 		goto on_error;
 	}
+	trace_timestamp = libesedb_io_handle_get_trace_timestamp(
+	                   io_handle );
+
 	if( libesedb_data_definition_read_record(
 	     data_definition,
 	     file_io_handle,
@@ -175,6 +180,31 @@ int libesedb_record_initialize(
 
 		goto on_error;
 	}
+	io_handle->statistics[ LIBESEDB_STATISTIC_NUMBER_OF_RECORDS ] += 1;
+
+	libesedb_io_handle_trace_event(
+	 io_handle,
+	 LIBESEDB_TRACE_EVENT_RECORD_DECODE,
+	 (uint64_t) data_definition->page_number,
+	 trace_timestamp,
+	 (uint64_t) data_definition->data_size );
+
+	if( libesedb_io_handle_add_memory_usage(
+	     io_handle,
+	     (size64_t) sizeof( libesedb_internal_record_t ) + data_definition->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add record size to memory usage.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record->memory_size = (size64_t) sizeof( libesedb_internal_record_t ) + data_definition->data_size;
+
 	internal_record->file_io_handle            = file_io_handle;
 	internal_record->io_handle                 = io_handle;
 	internal_record->table_definition          = table_definition;
@@ -197,7 +227,7 @@ on_error:
 		{
 			libcdata_array_free(
 			 &( internal_record->values_array ),
-			 NULL,
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
 			 NULL );
 		}
 		memory_free(
@@ -267,6 +297,24 @@ int libesedb_record_free(
 
 			result = -1;
 		}
+		if( ( internal_record->io_handle != NULL )
+		 && ( internal_record->memory_size != 0 ) )
+		{
+			if( libesedb_io_handle_remove_memory_usage(
+			     internal_record->io_handle,
+			     internal_record->memory_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to remove record size from memory usage.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_record );
 	}
@@ -314,6 +362,308 @@ int libesedb_record_get_number_of_values(
 	return( 1 );
 }
 
+/* Retrieves the number of the page that contains the record data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_page_number(
+     libesedb_record_t *record,
+     uint32_t *page_number,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "libesedb_record_get_page_number";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( internal_record->data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page number.",
+		 function );
+
+		return( -1 );
+	}
+	*page_number = internal_record->data_definition->page_number;
+
+	return( 1 );
+}
+
+/* Retrieves the offset of the record data relative to the start of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_data_offset(
+     libesedb_record_t *record,
+     off64_t *data_offset,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "libesedb_record_get_data_offset";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first 2 pages of the file contain the file header and its backup
+	 */
+	*data_offset = internal_record->data_definition->page_offset
+	             + ( 2 * internal_record->io_handle->page_size )
+	             + internal_record->data_definition->data_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the carve confidence
+ * The carve confidence is LIBESEDB_CARVE_CONFIDENCE_NONE for records that were not carved
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_carve_confidence(
+     libesedb_record_t *record,
+     uint8_t *carve_confidence,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "libesedb_record_get_carve_confidence";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( internal_record->data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_confidence == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve confidence.",
+		 function );
+
+		return( -1 );
+	}
+	*carve_confidence = internal_record->data_definition->carve_confidence;
+
+	return( 1 );
+}
+
+/* Retrieves the record value of a specific entry
+ * Tagged values that have not been read yet are read from the record data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	libesedb_record_layout_t *record_layout = NULL;
+	libfvalue_value_t *safe_record_value    = NULL;
+	static char *function                   = "libesedb_record_get_record_value";
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) &safe_record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		goto on_error;
+	}
+	if( safe_record_value == NULL )
+	{
+		if( libesedb_table_definition_get_record_layout(
+		     internal_record->table_definition,
+		     internal_record->template_table_definition,
+		     &record_layout,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record layout.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( value_entry < 0 )
+		 || ( value_entry >= record_layout->number_of_columns ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value entry: %d value out of bounds.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		if( libesedb_data_definition_read_tagged_value(
+		     internal_record->data_definition,
+		     internal_record->file_io_handle,
+		     internal_record->io_handle,
+		     internal_record->pages_vector,
+		     internal_record->pages_cache,
+		     &( record_layout->columns[ value_entry ] ),
+		     &safe_record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read tagged value: %d.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_record->values_array,
+		     value_entry,
+		     (intptr_t *) safe_record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value: %d in values array.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+	}
+	*record_value = safe_record_value;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_value != NULL )
+	{
+		libfvalue_value_free(
+		 &safe_record_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Retrieves a specific column catalog definition
  * Returns 1 if successful or -1 on error
  */
@@ -404,6 +754,109 @@ int libesedb_record_get_column_catalog_definition(
 	return( 1 );
 }
 
+/* Updates the decompression statistics of a record value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_update_decompression_statistics(
+     libesedb_internal_record_t *internal_record,
+     libfvalue_value_t *record_value,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_data           = NULL;
+	static char *function         = "libesedb_record_update_decompression_statistics";
+	size_t entry_data_size        = 0;
+	size_t uncompressed_data_size = 0;
+	uint32_t data_flags           = 0;
+	int encoding                  = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_data_flags(
+	     record_value,
+	     &data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) == 0 )
+	{
+		return( 1 );
+	}
+	if( libfvalue_value_get_entry_data(
+	     record_value,
+	     0,
+	     &entry_data,
+	     &entry_data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value entry data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_data == NULL )
+	 || ( entry_data_size == 0 ) )
+	{
+		return( 1 );
+	}
+	if( libesedb_compression_decompress_get_size(
+	     entry_data,
+	     entry_data_size,
+	     &uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_data[ 0 ] == 0x18 )
+	{
+		internal_record->io_handle->statistics[ LIBESEDB_STATISTIC_NUMBER_OF_LZXPRESS_DECOMPRESSED_BYTES ] += (uint64_t) uncompressed_data_size;
+	}
+	else
+	{
+		internal_record->io_handle->statistics[ LIBESEDB_STATISTIC_NUMBER_OF_7BIT_DECOMPRESSED_BYTES ] += (uint64_t) uncompressed_data_size;
+	}
+	return( 1 );
+}
+
 /* Retrieves the column identifier of the specific entry
  * Returns 1 if successful or -1 on error
  */
@@ -849,10 +1302,10 @@ int libesedb_record_get_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -940,10 +1393,10 @@ int libesedb_record_get_value_data_flags(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1002,10 +1455,10 @@ int libesedb_record_get_value_data_size(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1063,10 +1516,10 @@ int libesedb_record_get_value_data(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1168,10 +1621,10 @@ int libesedb_record_get_value_boolean(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1291,10 +1744,10 @@ int libesedb_record_get_value_8bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1415,10 +1868,10 @@ int libesedb_record_get_value_16bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1539,10 +1992,10 @@ int libesedb_record_get_value_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1664,10 +2117,10 @@ int libesedb_record_get_value_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1787,10 +2240,10 @@ int libesedb_record_get_value_filetime(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1912,10 +2365,10 @@ int libesedb_record_get_value_floating_point_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2035,10 +2488,10 @@ int libesedb_record_get_value_floating_point_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2160,10 +2613,10 @@ int libesedb_record_get_value_utf8_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2270,10 +2723,10 @@ int libesedb_record_get_value_utf8_string(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2304,6 +2757,23 @@ int libesedb_record_get_value_utf8_string(
 
 		return( -1 );
 	}
+	else if( result != 0 )
+	{
+		if( libesedb_record_update_decompression_statistics(
+		     internal_record,
+		     record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update decompression statistics.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( result );
 }
 
@@ -2379,10 +2849,10 @@ int libesedb_record_get_value_utf16_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2489,10 +2959,10 @@ int libesedb_record_get_value_utf16_string(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2523,6 +2993,23 @@ int libesedb_record_get_value_utf16_string(
 
 		return( -1 );
 	}
+	else if( result != 0 )
+	{
+		if( libesedb_record_update_decompression_statistics(
+		     internal_record,
+		     record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update decompression statistics.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( result );
 }
 
@@ -2602,10 +3089,10 @@ int libesedb_record_get_value_binary_data_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2776,10 +3263,10 @@ int libesedb_record_get_value_binary_data(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2850,6 +3337,26 @@ int libesedb_record_get_value_binary_data(
 			          binary_data,
 			          binary_data_size,
 			          error );
+
+			/* The binary data size is the size of the buffer not of the uncompressed data
+			 */
+			if( result == 1 )
+			{
+				if( libesedb_record_update_decompression_statistics(
+				     internal_record,
+				     record_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update decompression statistics.",
+					 function );
+
+					return( -1 );
+				}
+			}
 		}
 		else
 		{
@@ -2900,10 +3407,10 @@ int libesedb_record_is_long_value(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2960,10 +3467,10 @@ int libesedb_record_is_multi_value(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3010,6 +3517,8 @@ int libesedb_record_get_long_value_data_segments_list(
 	libesedb_data_definition_t *data_definition = NULL;
 	libesedb_page_tree_key_t *key               = NULL;
 	static char *function                       = "libesedb_record_get_long_value_data_segments_list";
+	uint64_t trace_timestamp                    = 0;
+	uint32_t long_value_identifier              = 0;
 	uint32_t long_value_segment_offset          = 0;
 	int result                                  = 0;
 
@@ -3058,6 +3567,9 @@ int libesedb_record_get_long_value_data_segments_list(
 
 		return( -1 );
 	}
+	trace_timestamp = libesedb_io_handle_get_trace_timestamp(
+	                   internal_record->io_handle );
+
 	if( libesedb_page_tree_key_initialize(
 	     &key,
 	     error ) != 1 )
@@ -3123,9 +3635,11 @@ int libesedb_record_get_long_value_data_segments_list(
 	{
 		return( 0 );
 	}
+	/* The IO handle is passed as data handle to maintain the statistics and memory usage
+	 */
 	if( libfdata_list_initialize(
 	     data_segments_list,
-	     NULL,
+	     (intptr_t *) internal_record->io_handle,
 	     NULL,
 	     NULL,
 	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_data_segment_read_element_data,
@@ -3142,6 +3656,8 @@ int libesedb_record_get_long_value_data_segments_list(
 
 		goto on_error;
 	}
+	internal_record->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 	if( libesedb_data_definition_read_long_value(
 	     data_definition,
 	     internal_record->file_io_handle,
@@ -3178,6 +3694,10 @@ int libesedb_record_get_long_value_data_segments_list(
 	long_value_segment_key[ 2 ] = long_value_key[ 1 ];
 	long_value_segment_key[ 3 ] = long_value_key[ 0 ];
 
+	byte_stream_copy_to_uint32_big_endian(
+	 long_value_segment_key,
+	 long_value_identifier );
+
 	do
 	{
 		byte_stream_copy_from_uint32_big_endian(
@@ -3285,6 +3805,13 @@ int libesedb_record_get_long_value_data_segments_list(
 	}
 	while( result == 1 );
 
+	libesedb_io_handle_trace_event(
+	 internal_record->io_handle,
+	 LIBESEDB_TRACE_EVENT_LONG_VALUE_RESOLVE,
+	 (uint64_t) long_value_identifier,
+	 trace_timestamp,
+	 (uint64_t) long_value_segment_offset );
+
 	return( 1 );
 
 on_error:
@@ -3380,10 +3907,10 @@ int libesedb_record_get_long_value(
 
 		goto on_error;
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3610,10 +4137,10 @@ int libesedb_record_get_multi_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -33,6 +33,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
@@ -92,6 +93,10 @@ struct libesedb_internal_record
 	/* The (record) flags 
 	 */
 	uint8_t flags;
+
+	/* The size of the record that is accounted for in the memory usage
+	 */
+	size64_t memory_size;
 };
 
 int libesedb_record_initialize(
@@ -119,12 +124,41 @@ int libesedb_record_get_number_of_values(
      int *number_of_values,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_page_number(
+     libesedb_record_t *record,
+     uint32_t *page_number,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_get_data_offset(
+     libesedb_record_t *record,
+     off64_t *data_offset,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_record_get_carve_confidence(
+     libesedb_record_t *record,
+     uint8_t *carve_confidence,
+     libcerror_error_t **error );
+
+int libesedb_record_get_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error );
+
 int libesedb_record_get_column_catalog_definition(
      libesedb_internal_record_t *internal_record,
      int value_entry,
      libesedb_catalog_definition_t **column_catalog_definition,
      libcerror_error_t **error );
 
+int libesedb_record_update_decompression_statistics(
+     libesedb_internal_record_t *internal_record,
+     libfvalue_value_t *record_value,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_column_identifier(
      libesedb_record_t *record,
@@ -0,0 +1,423 @@
+/*
+ * Record layout functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfvalue.h"
+#include "libesedb_record_layout.h"
+
+#include "esedb_page_values.h"
+
+/* Creates a record layout
+ * Make sure the value record_layout is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_layout_initialize(
+     libesedb_record_layout_t **record_layout,
+     int maximum_number_of_columns,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_layout_initialize";
+	size_t columns_size   = 0;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_layout != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record layout value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_columns < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of columns value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	columns_size = sizeof( libesedb_record_layout_column_t ) * (size_t) maximum_number_of_columns;
+
+	if( columns_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid columns size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*record_layout = memory_allocate_structure(
+	                  libesedb_record_layout_t );
+
+	if( *record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record layout.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_layout,
+	     0,
+	     sizeof( libesedb_record_layout_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record layout.",
+		 function );
+
+		memory_free(
+		 *record_layout );
+
+		*record_layout = NULL;
+
+		return( -1 );
+	}
+	if( maximum_number_of_columns > 0 )
+	{
+		( *record_layout )->columns = (libesedb_record_layout_column_t *) memory_allocate(
+		                                                                   columns_size );
+
+		if( ( *record_layout )->columns == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create columns.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *record_layout )->columns,
+		     0,
+		     columns_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear columns.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *record_layout )->maximum_number_of_columns = maximum_number_of_columns;
+
+	return( 1 );
+
+on_error:
+	if( *record_layout != NULL )
+	{
+		if( ( *record_layout )->columns != NULL )
+		{
+			memory_free(
+			 ( *record_layout )->columns );
+		}
+		memory_free(
+		 *record_layout );
+
+		*record_layout = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record layout
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_layout_free(
+     libesedb_record_layout_t **record_layout,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_layout_free";
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_layout != NULL )
+	{
+		/* The column catalog definitions are referenced and freed elsewhere
+		 */
+		if( ( *record_layout )->columns != NULL )
+		{
+			memory_free(
+			 ( *record_layout )->columns );
+		}
+		memory_free(
+		 *record_layout );
+
+		*record_layout = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a column to the record layout
+ * The columns must be appended in the order they are stored in the table definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_layout_append_column(
+     libesedb_record_layout_t *record_layout,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     libcerror_error_t **error )
+{
+	libesedb_record_layout_column_t *column = NULL;
+	static char *function                   = "libesedb_record_layout_append_column";
+	size_t data_offset                      = 0;
+	uint8_t value_type                      = 0;
+	int encoding                            = 0;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_layout->number_of_columns >= record_layout->maximum_number_of_columns )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record layout - number of columns value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition->type != LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column catalog definition type: %" PRIu16 ".",
+		 function,
+		 column_catalog_definition->type );
+
+		return( -1 );
+	}
+/* TODO refactor to value type */
+
+	switch( column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_NULL:
+			/* JET_coltypNil seems to be able to contain data */
+			value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			value_type = LIBFVALUE_VALUE_TYPE_GUID;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+		case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+			value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
+/* TODO handle this value type */
+			value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 column_catalog_definition->column_type );
+
+			return( -1 );
+	}
+	if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		/* If the codepage is not set the default codepage is determined when the record is read
+		 */
+		encoding = (int) column_catalog_definition->codepage;
+
+		/* Codepage 1200 in the ESE database format is not strict UTF-16 little-endian
+		 * it can be used for ASCII strings as well.
+		 */
+		if( encoding == 1200 )
+		{
+			encoding = LIBFVALUE_CODEPAGE_1200_MIXED;
+		}
+	}
+	else
+	{
+		encoding = LIBFVALUE_ENDIAN_LITTLE;
+	}
+	column = &( record_layout->columns[ record_layout->number_of_columns ] );
+
+	if( column_catalog_definition->identifier <= 127 )
+	{
+		if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid column catalog definition size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset = sizeof( esedb_data_definition_header_t ) + (size_t) record_layout->fixed_size_columns_data_size;
+
+		if( ( data_offset + column_catalog_definition->size ) > (size_t) UINT16_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid fixed size columns data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		column->data_offset = (uint16_t) data_offset;
+		column->data_size   = (uint16_t) column_catalog_definition->size;
+
+		record_layout->fixed_size_columns_data_size += column->data_size;
+		record_layout->number_of_fixed_size_columns += 1;
+	}
+	else if( column_catalog_definition->identifier <= 255 )
+	{
+		record_layout->number_of_variable_size_columns += 1;
+	}
+	else
+	{
+		record_layout->number_of_tagged_columns += 1;
+	}
+	column->column_catalog_definition = column_catalog_definition;
+	column->identifier                = column_catalog_definition->identifier;
+	column->value_type                = value_type;
+	column->encoding                  = encoding;
+
+	record_layout->number_of_columns += 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,117 @@
+/*
+ * Record layout functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_RECORD_LAYOUT_H )
+#define _LIBESEDB_RECORD_LAYOUT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_record_layout_column libesedb_record_layout_column_t;
+
+struct libesedb_record_layout_column
+{
+	/* The column catalog definition
+	 */
+	libesedb_catalog_definition_t *column_catalog_definition;
+
+	/* The column identifier
+	 */
+	uint32_t identifier;
+
+	/* The data offset of a fixed size column relative to the start of the record data
+	 */
+	uint16_t data_offset;
+
+	/* The data size of a fixed size column
+	 */
+	uint16_t data_size;
+
+	/* The value type
+	 */
+	uint8_t value_type;
+
+	/* The value encoding
+	 * where 0 represents the default (ASCII) codepage of the file
+	 */
+	int encoding;
+};
+
+typedef struct libesedb_record_layout libesedb_record_layout_t;
+
+struct libesedb_record_layout
+{
+	/* The columns
+	 */
+	libesedb_record_layout_column_t *columns;
+
+	/* The maximum number of columns
+	 */
+	int maximum_number_of_columns;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The number of fixed size columns
+	 */
+	int number_of_fixed_size_columns;
+
+	/* The number of variable size columns
+	 */
+	int number_of_variable_size_columns;
+
+	/* The number of tagged columns
+	 */
+	int number_of_tagged_columns;
+
+	/* The size of the fixed size columns data
+	 */
+	uint16_t fixed_size_columns_data_size;
+};
+
+int libesedb_record_layout_initialize(
+     libesedb_record_layout_t **record_layout,
+     int maximum_number_of_columns,
+     libcerror_error_t **error );
+
+int libesedb_record_layout_free(
+     libesedb_record_layout_t **record_layout,
+     libcerror_error_t **error );
+
+int libesedb_record_layout_append_column(
+     libesedb_record_layout_t *record_layout,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_RECORD_LAYOUT_H ) */
+
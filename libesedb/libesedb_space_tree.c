@@ -20,12 +20,14 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
 #include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
 #include "libesedb_libfcache.h"
@@ -33,6 +35,7 @@
 #include "libesedb_page.h"
 #include "libesedb_page_value.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_page_tree_key.h"
 #include "libesedb_page_tree_value.h"
 #include "libesedb_space_tree.h"
 #include "libesedb_space_tree_value.h"
@@ -127,11 +130,31 @@ int libesedb_space_tree_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( ( *space_tree )->values_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values array.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
 	if( *space_tree != NULL )
 	{
+		if( ( *space_tree )->page_tree != NULL )
+		{
+			libesedb_page_tree_free(
+			 &( ( *space_tree )->page_tree ),
+			 NULL );
+		}
 		memory_free(
 		 *space_tree );
 
@@ -176,6 +199,23 @@ int libesedb_space_tree_free(
 
 			result = -1;
 		}
+		if( ( *space_tree )->values_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *space_tree )->values_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_space_tree_value_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free values array.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *space_tree );
 
@@ -197,6 +237,7 @@ int libesedb_space_tree_read_values_from_page(
 {
 	libesedb_page_t *child_page                   = NULL;
 	libesedb_page_tree_value_t *page_tree_value   = NULL;
+	libesedb_page_tree_key_t *page_value_key      = NULL;
 	libesedb_page_value_t *page_value             = NULL;
 	libesedb_space_tree_value_t *space_tree_value = NULL;
 	libfcache_cache_t *child_page_cache           = NULL;
@@ -206,6 +247,7 @@ int libesedb_space_tree_read_values_from_page(
 	uint32_t total_number_of_pages                = 0;
 	uint16_t number_of_page_values                = 0;
 	uint16_t page_value_index                     = 0;
+	int value_entry_index                         = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint32_t father_data_page_object_identifier   = 0;
@@ -506,21 +548,70 @@ int libesedb_space_tree_read_values_from_page(
 
 				goto on_error;
 			}
-			total_number_of_pages += space_tree_value->number_of_pages;
+			if( libesedb_page_tree_get_key(
+			     space_tree->page_tree,
+			     page_tree_value,
+			     page,
+			     page_flags,
+			     page_value_index,
+			     &page_value_key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
 
-			if( libesedb_space_tree_value_free(
-			     &space_tree_value,
+				goto on_error;
+			}
+			/* The key contains the last page number of the extent
+			 * stored big-endian in the last 4 bytes
+			 */
+			if( ( page_value_key != NULL )
+			 && ( page_value_key->data != NULL )
+			 && ( page_value_key->data_size >= 4 ) )
+			{
+				byte_stream_copy_to_uint32_big_endian(
+				 &( page_value_key->data[ page_value_key->data_size - 4 ] ),
+				 space_tree_value->last_page_number );
+			}
+			if( libesedb_page_tree_key_free(
+			     &page_value_key,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free space tree value.",
+				 "%s: unable to free page value key.",
 				 function );
 
 				goto on_error;
 			}
+			total_number_of_pages += space_tree_value->number_of_pages;
+
+			space_tree->number_of_pages   += space_tree_value->number_of_pages;
+			space_tree->number_of_extents += 1;
+
+			if( libcdata_array_append_entry(
+			     space_tree->values_array,
+			     &value_entry_index,
+			     (intptr_t *) space_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append space tree value to array.",
+				 function );
+
+				goto on_error;
+			}
+			space_tree_value = NULL;
 		}
 		else
 		{
@@ -602,6 +693,8 @@ int libesedb_space_tree_read_values_from_page(
 			if( ( child_page_number > 0 )
 			 && ( child_page_number <= space_tree->page_tree->io_handle->last_page_number ) )
 			{
+				space_tree->page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 				if( libfdata_vector_get_element_value_by_index(
 				     space_tree->page_tree->pages_vector,
 				     (intptr_t *) file_io_handle,
@@ -696,6 +789,12 @@ int libesedb_space_tree_read_values_from_page(
 	return( 1 );
 
 on_error:
+	if( page_value_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &page_value_key,
+		 NULL );
+	}
 	if( page_tree_value != NULL )
 	{
 		libesedb_page_tree_value_free(
@@ -769,6 +868,8 @@ int libesedb_space_tree_read_file_io_handle(
 
 		goto on_error;
 	}
+	space_tree->page_tree->io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ] += 1;
+
 	if( libfdata_vector_get_element_value_by_index(
 	     space_tree->page_tree->pages_vector,
 	     (intptr_t *) file_io_handle,
@@ -817,6 +918,9 @@ int libesedb_space_tree_read_file_io_handle(
 		goto on_error;
 	}
 #endif
+	space_tree->number_of_pages   = 0;
+	space_tree->number_of_extents = 0;
+
 	if( libesedb_space_tree_read_values_from_page(
 	     space_tree,
 	     file_io_handle,
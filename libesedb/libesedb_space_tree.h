@@ -27,6 +27,7 @@
 
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
@@ -43,6 +44,18 @@ struct libesedb_space_tree
 	/* The page tree
 	 */
 	libesedb_page_tree_t *page_tree;
+
+	/* The number of pages in the extents
+	 */
+	uint64_t number_of_pages;
+
+	/* The number of extents
+	 */
+	uint64_t number_of_extents;
+
+	/* The (space tree) values array
+	 */
+	libcdata_array_t *values_array;
 };
 
 int libesedb_space_tree_initialize(
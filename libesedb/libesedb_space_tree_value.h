@@ -35,6 +35,10 @@ typedef struct libesedb_space_tree_value libesedb_space_tree_value_t;
 
 struct libesedb_space_tree_value
 {
+	/* The last page number of the extent
+	 */
+	uint32_t last_page_number;
+
 	/* The number of pages
 	 */
 	uint32_t number_of_pages;
@@ -20,19 +20,25 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 #include <wide_string.h>
 
+#include "libesedb_checksum.h"
 #include "libesedb_codepage.h"
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libclocale.h"
+#include "libesedb_page.h"
+#include "libesedb_page_header.h"
 #include "libesedb_support.h"
 
+#include "esedb_page.h"
+
 #if !defined( HAVE_LOCAL_LIBESEDB )
 
 /* Returns the library version
@@ -442,3 +448,374 @@ on_error:
 	return( -1 );
 }
 
+/* Determines if data contains an ESEDB page
+ * The size of the data is the page size, which should be 2048, 4096, 8192, 16384 or 32768
+ * The page is recognized by its checksum, except for pages with an extended page header,
+ * for which no checksum is calculated, these are recognized by their page header and tags
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libesedb_check_page_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *page_number,
+     uint32_t *father_data_page_object_identifier,
+     uint32_t *page_flags,
+     libcerror_error_t **error )
+{
+	libesedb_io_handle_t *io_handle    = NULL;
+	libesedb_page_t *page              = NULL;
+	uint8_t *page_data                 = NULL;
+	static char *function              = "libesedb_check_page_data";
+	uint64_t value_64bit               = 0;
+	uint32_t calculated_ecc32_checksum = 0;
+	uint32_t calculated_xor32_checksum = 0;
+	uint32_t format_revision           = 0;
+	uint32_t safe_page_flags           = 0;
+	uint32_t safe_page_number          = 0;
+	uint32_t stored_ecc32_checksum     = 0;
+	uint32_t stored_xor32_checksum     = 0;
+	uint32_t supported_page_flags      = 0;
+	int result                         = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size != 2048 )
+	 && ( data_size != 4096 )
+	 && ( data_size != 8192 )
+	 && ( data_size != 16384 )
+	 && ( data_size != 32768 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page number.",
+		 function );
+
+		return( -1 );
+	}
+	if( father_data_page_object_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid father data page object identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* Uninitialized pages have no checksum
+	 */
+	if( ( data[ 0 ] == 0 )
+	 && ( data[ 1 ] == 0 )
+	 && ( data[ 2 ] == 0 )
+	 && ( data[ 3 ] == 0 ) )
+	{
+		return( 0 );
+	}
+	/* Reject data with unsupported page flags before calculating the checksums
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_page_header_t *) data )->page_flags,
+	 safe_page_flags );
+
+	supported_page_flags = LIBESEDB_PAGE_FLAG_IS_ROOT
+	                     | LIBESEDB_PAGE_FLAG_IS_LEAF
+	                     | LIBESEDB_PAGE_FLAG_IS_PARENT
+	                     | LIBESEDB_PAGE_FLAG_IS_EMPTY
+	                     | LIBESEDB_PAGE_FLAG_IS_SPACE_TREE
+	                     | LIBESEDB_PAGE_FLAG_IS_INDEX
+	                     | LIBESEDB_PAGE_FLAG_IS_LONG_VALUE
+	                     | LIBESEDB_PAGE_FLAG_0x0400
+	                     | LIBESEDB_PAGE_FLAG_0x0800
+	                     | LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT
+	                     | LIBESEDB_PAGE_FLAG_IS_SCRUBBED
+	                     | LIBESEDB_PAGE_FLAG_0x8000
+	                     | LIBESEDB_PAGE_FLAG_0x10000;
+
+	if( ( ( safe_page_flags & ~( supported_page_flags ) ) != 0 )
+	 || ( ( safe_page_flags & ( LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF | LIBESEDB_PAGE_FLAG_IS_PARENT | LIBESEDB_PAGE_FLAG_IS_EMPTY ) ) == 0 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_page_header_t *) data )->xor_checksum,
+	 stored_xor32_checksum );
+
+	if( ( safe_page_flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_page_header_t *) data )->ecc_checksum,
+		 stored_ecc32_checksum );
+
+		/* The XOR-32 checksum uses the page number as its initial value
+		 * hence the page number can be derived from the stored XOR-32 checksum
+		 */
+		if( libesedb_checksum_calculate_little_endian_ecc32(
+		     &calculated_ecc32_checksum,
+		     &calculated_xor32_checksum,
+		     data,
+		     data_size,
+		     8,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to calculate ECC-32 and XOR-32 checksum.",
+			 function );
+
+			goto on_error;
+		}
+		if( stored_ecc32_checksum == calculated_ecc32_checksum )
+		{
+			safe_page_number = stored_xor32_checksum ^ calculated_xor32_checksum;
+			format_revision  = LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT;
+			result           = 1;
+		}
+	}
+	if( result == 0 )
+	{
+		if( libesedb_checksum_calculate_little_endian_xor32(
+		     &calculated_xor32_checksum,
+		     &( data[ 4 ] ),
+		     data_size - 4,
+		     0x89abcdef,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to calculate XOR-32 checksum.",
+			 function );
+
+			goto on_error;
+		}
+		if( stored_xor32_checksum == calculated_xor32_checksum )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (esedb_page_header_t *) data )->page_number,
+			 safe_page_number );
+
+			format_revision = 0;
+			result          = 1;
+		}
+	}
+	if( ( result == 0 )
+	 && ( data_size >= 16384 ) )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (esedb_extended_page_header_t *) &( data[ sizeof( esedb_page_header_t ) ] ) )->page_number,
+		 value_64bit );
+
+		if( value_64bit <= (uint64_t) UINT32_MAX )
+		{
+			safe_page_number = (uint32_t) value_64bit;
+			format_revision  = LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER;
+			result           = 1;
+		}
+	}
+	if( ( result == 0 )
+	 || ( safe_page_number == 0 ) )
+	{
+		return( 0 );
+	}
+	/* Make sure the page header and page tags can be read
+	 */
+	if( libesedb_io_handle_initialize(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->format_version  = 0x620;
+	io_handle->format_revision = format_revision;
+	io_handle->page_size       = (uint32_t) data_size;
+
+	if( libesedb_page_initialize(
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page.",
+		 function );
+
+		goto on_error;
+	}
+	page->page_number = safe_page_number;
+
+	/* Reading the page values of a page with an extended page header
+	 * modifies the page tag flags, hence a copy of the data is read
+	 */
+	if( format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	{
+		page->data = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * data_size );
+
+		if( page->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page data.",
+			 function );
+
+			goto on_error;
+		}
+		page->data_size = data_size;
+
+		if( memory_copy(
+		     page->data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy page data.",
+			 function );
+
+			goto on_error;
+		}
+		page_data = page->data;
+	}
+	else
+	{
+		page_data = (uint8_t *) data;
+	}
+	result = libesedb_page_header_read_data(
+	          page->header,
+	          io_handle,
+	          page_data,
+	          data_size,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libesedb_page_read_values(
+		          page,
+		          io_handle,
+		          page_data,
+		          data_size,
+		          page->header->data_size,
+		          error );
+	}
+	if( result == 1 )
+	{
+		if( ( safe_page_flags & LIBESEDB_PAGE_FLAG_IS_SPACE_TREE ) != 0 )
+		{
+			result = libesedb_page_validate_space_tree_page(
+			          page,
+			          error );
+		}
+		else
+		{
+			result = libesedb_page_validate_page(
+			          page,
+			          error );
+		}
+	}
+	if( result == 1 )
+	{
+		*page_number                        = safe_page_number;
+		*father_data_page_object_identifier = page->header->father_data_page_object_identifier;
+		*page_flags                         = safe_page_flags;
+	}
+	else
+	{
+		libcerror_error_free(
+		 error );
+
+		result = 0;
+	}
+	if( libesedb_page_free(
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_io_handle_free(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
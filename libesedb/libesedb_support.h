@@ -74,6 +74,15 @@ int libesedb_check_file_signature_file_io_handle(
      libbfio_handle_t *bfio_handle,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_check_page_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *page_number,
+     uint32_t *father_data_page_object_identifier,
+     uint32_t *page_flags,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
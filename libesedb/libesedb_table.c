@@ -33,13 +33,16 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_record.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
+#include "libesedb_table_state.h"
 #include "libesedb_types.h"
 
 /* Creates a table
+ * The table takes a reference to the table state
  * Make sure the value table is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
@@ -49,11 +52,11 @@ int libesedb_table_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libesedb_table_state_t *table_state,
      libcerror_error_t **error )
 {
 	libesedb_internal_table_t *internal_table = NULL;
 	static char *function                     = "libesedb_table_initialize";
-	int segment_index                         = 0;
 
 	if( table == NULL )
 	{
@@ -110,6 +113,17 @@ int libesedb_table_initialize(
 
 		return( -1 );
 	}
+	if( table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table state.",
+		 function );
+
+		return( -1 );
+	}
 	internal_table = memory_allocate_structure(
 	                  libesedb_internal_table_t );
 
@@ -122,7 +136,7 @@ int libesedb_table_initialize(
 		 "%s: unable to create table.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( memory_set(
 	     internal_table,
@@ -141,209 +155,17 @@ int libesedb_table_initialize(
 
 		return( -1 );
 	}
-	/* TODO add clone function ?
-	 */
-	if( libfdata_vector_initialize(
-	     &( internal_table->pages_vector ),
-	     (size64_t) io_handle->page_size,
-	     (intptr_t *) io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_append_segment(
-	     internal_table->pages_vector,
-	     &segment_index,
-	     0,
-	     io_handle->pages_data_offset,
-	     io_handle->pages_data_size,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfcache_cache_initialize(
-	     &( internal_table->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages cache.",
-		 function );
-
-		goto on_error;
-	}
-	if( libesedb_page_tree_initialize(
-	     &( internal_table->table_page_tree ),
-	     io_handle,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
-	     table_definition->table_catalog_definition->identifier,
-	     table_definition->table_catalog_definition->father_data_page_number,
-	     table_definition,
-	     template_table_definition,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create table page tree.",
-		 function );
-
-		goto on_error;
-	}
-	if( table_definition->long_value_catalog_definition != NULL )
-	{
-		/* TODO add clone function ?
-		 */
-		if( libfdata_vector_initialize(
-		     &( internal_table->long_values_pages_vector ),
-		     (size64_t) io_handle->page_size,
-		     (intptr_t *) io_handle,
-		     NULL,
-		     NULL,
-		     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-		     NULL,
-		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfdata_vector_append_segment(
-		     internal_table->long_values_pages_vector,
-		     &segment_index,
-		     0,
-		     io_handle->pages_data_offset,
-		     io_handle->pages_data_size,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append segment to long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfcache_cache_initialize(
-		     &( internal_table->long_values_pages_cache ),
-		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages cache.",
-			 function );
-
-			goto on_error;
-		}
-		if( libesedb_page_tree_initialize(
-		     &( internal_table->long_values_page_tree ),
-		     io_handle,
-		     internal_table->long_values_pages_vector,
-		     internal_table->long_values_pages_cache,
-		     table_definition->long_value_catalog_definition->identifier,
-		     table_definition->long_value_catalog_definition->father_data_page_number,
-		     table_definition,
-		     template_table_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long value page tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
 	internal_table->io_handle                 = io_handle;
 	internal_table->file_io_handle            = file_io_handle;
 	internal_table->table_definition          = table_definition;
 	internal_table->template_table_definition = template_table_definition;
+	internal_table->table_state               = table_state;
+
+	table_state->number_of_references += 1;
 
 	*table = (libesedb_table_t *) internal_table;
 
 	return( 1 );
-
-on_error:
-	if( internal_table != NULL )
-	{
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->long_values_pages_cache ),
-			 NULL );
-		}
-		if( internal_table->long_values_pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->long_values_pages_vector ),
-			 NULL );
-		}
-		if( internal_table->long_values_page_tree != NULL )
-		{
-			libesedb_page_tree_free(
-			 &( internal_table->long_values_page_tree ),
-			 NULL );
-		}
-		if( internal_table->table_page_tree != NULL )
-		{
-			libesedb_page_tree_free(
-			 &( internal_table->table_page_tree ),
-			 NULL );
-		}
-		if( internal_table->pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->pages_cache ),
-			 NULL );
-		}
-		if( internal_table->pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->pages_vector ),
-			 NULL );
-		}
-		memory_free(
-		 internal_table );
-	}
-	return( -1 );
 }
 
 /* Frees a table
@@ -376,89 +198,32 @@ int libesedb_table_free(
 		/* The io_handle, file_io_handle and table_definition references
 		 * are freed elsewhere
 		 */
-		if( libfdata_vector_free(
-		     &( internal_table->pages_vector ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages vector.",
-			 function );
-
-			result = -1;
-		}
-		if( libfcache_cache_free(
-		     &( internal_table->pages_cache ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages cache.",
-			 function );
-
-			result = -1;
-		}
-		if( internal_table->long_values_pages_vector != NULL )
-		{
-			if( libfdata_vector_free(
-			     &( internal_table->long_values_pages_vector ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages vector.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			if( libfcache_cache_free(
-			     &( internal_table->long_values_pages_cache ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages cache.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( internal_table->long_values_page_tree != NULL )
+		if( internal_table->carved_data_definitions_array != NULL )
 		{
-			if( libesedb_page_tree_free(
-			     &( internal_table->long_values_page_tree ),
+			if( libcdata_array_free(
+			     &( internal_table->carved_data_definitions_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_data_definition_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values page tree.",
+				 "%s: unable to free carved data definitions array.",
 				 function );
 
 				result = -1;
 			}
 		}
-		if( libesedb_page_tree_free(
-		     &( internal_table->table_page_tree ),
+		if( libesedb_table_state_free(
+		     &( internal_table->table_state ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free table page tree.",
+			 "%s: unable to free table state.",
 			 function );
 
 			result = -1;
@@ -1288,16 +1053,21 @@ int libesedb_table_get_column(
 	return( 1 );
 }
 
-/* Retrieves the number of indexes
- * Returns 1 if successful or -1 on error
+/* Retrieves the column for the specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such column or -1 on error
  */
-int libesedb_table_get_number_of_indexes(
+int libesedb_table_get_column_by_utf8_name(
      libesedb_table_t *table,
-     int *number_of_indexes,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
      libcerror_error_t **error )
 {
-	libesedb_internal_table_t *internal_table = NULL;
-	static char *function                     = "libesedb_table_get_number_of_indexes";
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_table_t *internal_table                = NULL;
+	static char *function                                    = "libesedb_table_get_column_by_utf8_name";
+	int result                                               = 0;
 
 	if( table == NULL )
 	{
@@ -1312,123 +1082,892 @@ int libesedb_table_get_number_of_indexes(
 	}
 	internal_table = (libesedb_internal_table_t *) table;
 
-	if( libesedb_table_definition_get_number_of_index_catalog_definitions(
-	     internal_table->table_definition,
-	     number_of_indexes,
-	     error ) != 1 )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of indexes.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific index
- * Returns 1 if successful or -1 on error
- */
-int libesedb_table_get_index(
-     libesedb_table_t *table,
-     int index_entry,
-     libesedb_index_t **index,
-     libcerror_error_t **error )
-{
-	libesedb_internal_table_t *internal_table               = NULL;
-	libesedb_catalog_definition_t *index_catalog_definition = NULL;
-	static char *function                                   = "libesedb_table_get_index";
-
-	if( table == NULL )
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	internal_table = (libesedb_internal_table_t *) table;
-
-	if( index == NULL )
+	if( column == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid index.",
+		 "%s: invalid column.",
 		 function );
 
 		return( -1 );
 	}
-	if( *index != NULL )
+	if( *column != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid index value already set.",
+		 "%s: invalid column value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_table_definition_get_index_catalog_definition_by_index(
-	     internal_table->table_definition,
-	     index_entry,
-	     &index_catalog_definition,
-	     error ) != 1 )
+	if( ( flags & ~( LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve index catalog definition.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_index_initialize(
-	     index,
-	     internal_table->file_io_handle,
-	     internal_table->io_handle,
-	     internal_table->table_definition,
-	     internal_table->template_table_definition,
-	     index_catalog_definition,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
-	     internal_table->long_values_pages_cache,
-	     internal_table->table_page_tree,
-	     internal_table->long_values_page_tree,
-	     error ) != 1 )
+	/* The template table columns precede the table columns
+	 */
+	if( ( ( flags & LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) == 0 )
+	 && ( internal_table->template_table_definition != NULL ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create index.",
-		 function );
+		result = libesedb_table_definition_get_column_catalog_definition_by_utf8_name(
+		          internal_table->template_table_definition,
+		          utf8_string,
+		          utf8_string_length,
+		          &column_catalog_definition,
+		          error );
 
-		return( -1 );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from template table.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	return( 1 );
-}
+	if( result == 0 )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_by_utf8_name(
+		          internal_table->table_definition,
+		          utf8_string,
+		          utf8_string_length,
+		          &column_catalog_definition,
+		          error );
 
-/* Retrieves the number of records in the table
- * Returns 1 if successful or -1 on error
- */
-int libesedb_table_get_number_of_records(
-     libesedb_table_t *table,
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( libesedb_column_initialize(
+	     column,
+	     internal_table->io_handle,
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the column for the specific UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_table_get_column_by_utf16_name(
+     libesedb_table_t *table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libesedb_internal_table_t *internal_table                = NULL;
+	static char *function                                    = "libesedb_table_get_column_by_utf16_name";
+	int result                                               = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* The template table columns precede the table columns
+	 */
+	if( ( ( flags & LIBESEDB_GET_COLUMN_FLAG_IGNORE_TEMPLATE_TABLE ) == 0 )
+	 && ( internal_table->template_table_definition != NULL ) )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_by_utf16_name(
+		          internal_table->template_table_definition,
+		          utf16_string,
+		          utf16_string_length,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from template table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		result = libesedb_table_definition_get_column_catalog_definition_by_utf16_name(
+		          internal_table->table_definition,
+		          utf16_string,
+		          utf16_string_length,
+		          &column_catalog_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( libesedb_column_initialize(
+	     column,
+	     internal_table->io_handle,
+	     column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of indexes
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_number_of_indexes(
+     libesedb_table_t *table,
+     int *number_of_indexes,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_number_of_indexes";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( libesedb_table_definition_get_number_of_index_catalog_definitions(
+	     internal_table->table_definition,
+	     number_of_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of indexes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_index(
+     libesedb_table_t *table,
+     int index_entry,
+     libesedb_index_t **index,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table               = NULL;
+	libesedb_catalog_definition_t *index_catalog_definition = NULL;
+	static char *function                                   = "libesedb_table_get_index";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_definition_get_index_catalog_definition_by_index(
+	     internal_table->table_definition,
+	     index_entry,
+	     &index_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_index_initialize(
+	     index,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     index_catalog_definition,
+	     internal_table->table_state->pages_vector,
+	     internal_table->table_state->pages_cache,
+	     internal_table->table_state->long_values_pages_vector,
+	     internal_table->table_state->long_values_pages_cache,
+	     internal_table->table_state->table_page_tree,
+	     internal_table->table_state->long_values_page_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of records in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_number_of_records(
+     libesedb_table_t *table,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_number_of_records";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( libesedb_page_tree_get_number_of_leaf_values(
+	     internal_table->table_state->table_page_tree,
+	     internal_table->file_io_handle,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf values from table page tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the space statistics
+ * The statistics are determined from the space trees and page headers of the table
+ * without reading the records
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_space_statistics(
+     libesedb_table_t *table,
+     uint64_t *statistics,
+     int number_of_statistics,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_space_statistics";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( libesedb_page_tree_get_space_statistics(
+	     internal_table->table_state->table_page_tree,
+	     internal_table->file_io_handle,
+	     statistics,
+	     number_of_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve space statistics from table page tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_record(
+     libesedb_table_t *table,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	static char *function                              = "libesedb_table_get_record";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_leaf_value_by_index(
+	     internal_table->table_state->table_page_tree,
+	     internal_table->file_io_handle,
+	     record_entry,
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from table values tree.",
+		 function,
+		 record_entry );
+
+		goto on_error;
+	}
+	if( libesedb_record_initialize(
+	     record,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     internal_table->table_state->pages_vector,
+	     internal_table->table_state->pages_cache,
+	     internal_table->table_state->long_values_pages_vector,
+	     internal_table->table_state->long_values_pages_cache,
+	     record_data_definition,
+	     internal_table->table_state->long_values_page_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record: %d.",
+		 function,
+		 record_entry );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+
+/* Carves records from the pages in a specific range
+ * The records are carved from the defunct values of the leaf pages of the table
+ * and from the leaf pages that were released by the table. Carved values that
+ * cannot be read as a record of the table are ignored. Previously carved records
+ * are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_carve_records(
+     libesedb_table_t *table,
+     uint32_t first_page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *data_definitions_array           = NULL;
+	libcdata_array_t *values_array                     = NULL;
+	libesedb_data_definition_t *carved_data_definition = NULL;
+	libesedb_data_definition_t *data_definition        = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	static char *function                              = "libesedb_table_carve_records";
+	uint8_t record_flags                               = 0;
+	int data_definition_index                          = 0;
+	int entry_index                                    = 0;
+	int number_of_data_definitions                     = 0;
+	int result                                         = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->carved_data_definitions_array == NULL )
+	{
+		if( libcdata_array_initialize(
+		     &( internal_table->carved_data_definitions_array ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create carved data definitions array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libcdata_array_empty(
+		     internal_table->carved_data_definitions_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_data_definition_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to empty carved data definitions array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_initialize(
+	     &data_definitions_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definitions array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_carve_leaf_values(
+	     internal_table->table_state->table_page_tree,
+	     internal_table->file_io_handle,
+	     first_page_number,
+	     number_of_pages,
+	     data_definitions_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to carve leaf values from table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     data_definitions_array,
+	     &number_of_data_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data definitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &values_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values array.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_definition_index = 0;
+	     data_definition_index < number_of_data_definitions;
+	     data_definition_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     data_definitions_array,
+		     data_definition_index,
+		     (intptr_t **) &data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data definition: %d.",
+			 function,
+			 data_definition_index );
+
+			goto on_error;
+		}
+		/* The carved value is only kept when it can be read as a record of the table
+		 */
+		result = libesedb_data_definition_read_record(
+		          data_definition,
+		          internal_table->file_io_handle,
+		          internal_table->io_handle,
+		          internal_table->table_state->pages_vector,
+		          internal_table->table_state->pages_cache,
+		          internal_table->table_definition,
+		          internal_table->template_table_definition,
+		          values_array,
+		          &record_flags,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_free(
+			 error );
+		}
+		if( libcdata_array_empty(
+		     values_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to empty values array.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			continue;
+		}
+		if( libesedb_data_definition_clone(
+		     &carved_data_definition,
+		     data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create carved data definition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     internal_table->carved_data_definitions_array,
+		     &entry_index,
+		     (intptr_t *) carved_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append carved data definition to array.",
+			 function );
+
+			goto on_error;
+		}
+		carved_data_definition = NULL;
+	}
+	if( libcdata_array_free(
+	     &values_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free values array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_free(
+	     &data_definitions_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_data_definition_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data definitions array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( carved_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &carved_data_definition,
+		 NULL );
+	}
+	if( values_array != NULL )
+	{
+		libcdata_array_free(
+		 &values_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+		 NULL );
+	}
+	if( data_definitions_array != NULL )
+	{
+		libcdata_array_free(
+		 &data_definitions_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_data_definition_free,
+		 NULL );
+	}
+	if( internal_table->carved_data_definitions_array != NULL )
+	{
+		libcdata_array_empty(
+		 internal_table->carved_data_definitions_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_data_definition_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of carved records
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_number_of_carved_records(
+     libesedb_table_t *table,
      int *number_of_records,
      libcerror_error_t **error )
 {
 	libesedb_internal_table_t *internal_table = NULL;
-	static char *function                     = "libesedb_table_get_number_of_records";
+	static char *function                     = "libesedb_table_get_number_of_carved_records";
 
 	if( table == NULL )
 	{
@@ -1443,9 +1982,25 @@ int libesedb_table_get_number_of_records(
 	}
 	internal_table = (libesedb_internal_table_t *) table;
 
-	if( libesedb_page_tree_get_number_of_leaf_values(
-	     internal_table->table_page_tree,
-	     internal_table->file_io_handle,
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->carved_data_definitions_array == NULL )
+	{
+		*number_of_records = 0;
+
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_table->carved_data_definitions_array,
 	     number_of_records,
 	     error ) != 1 )
 	{
@@ -1453,7 +2008,7 @@ int libesedb_table_get_number_of_records(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of leaf values from table page tree.",
+		 "%s: unable to retrieve number of carved data definitions.",
 		 function );
 
 		return( -1 );
@@ -1461,18 +2016,19 @@ int libesedb_table_get_number_of_records(
 	return( 1 );
 }
 
-/* Retrieves a specific record
+/* Retrieves a specific carved record
  * Returns 1 if successful or -1 on error
  */
-int libesedb_table_get_record(
+int libesedb_table_get_carved_record(
      libesedb_table_t *table,
      int record_entry,
      libesedb_record_t **record,
      libcerror_error_t **error )
 {
+	libesedb_data_definition_t *carved_data_definition = NULL;
 	libesedb_data_definition_t *record_data_definition = NULL;
 	libesedb_internal_table_t *internal_table          = NULL;
-	static char *function                              = "libesedb_table_get_record";
+	static char *function                              = "libesedb_table_get_carved_record";
 
 	if( table == NULL )
 	{
@@ -1509,42 +2065,57 @@ int libesedb_table_get_record(
 
 		return( -1 );
 	}
-	if( libesedb_page_tree_get_leaf_value_by_index(
-	     internal_table->table_page_tree,
-	     internal_table->file_io_handle,
+	if( libcdata_array_get_entry_by_index(
+	     internal_table->carved_data_definitions_array,
 	     record_entry,
-	     &record_data_definition,
+	     (intptr_t **) &carved_data_definition,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value: %d from table values tree.",
+		 "%s: unable to retrieve carved data definition: %d.",
 		 function,
 		 record_entry );
 
 		goto on_error;
 	}
+	/* The record takes over the data definition
+	 */
+	if( libesedb_data_definition_clone(
+	     &record_data_definition,
+	     carved_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record data definition.",
+		 function );
+
+		goto on_error;
+	}
 	if( libesedb_record_initialize(
 	     record,
 	     internal_table->file_io_handle,
 	     internal_table->io_handle,
 	     internal_table->table_definition,
 	     internal_table->template_table_definition,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
-	     internal_table->long_values_pages_cache,
+	     internal_table->table_state->pages_vector,
+	     internal_table->table_state->pages_cache,
+	     internal_table->table_state->long_values_pages_vector,
+	     internal_table->table_state->long_values_pages_cache,
 	     record_data_definition,
-	     internal_table->long_values_page_tree,
+	     internal_table->table_state->long_values_page_tree,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record: %d.",
+		 "%s: unable to create carved record: %d.",
 		 function,
 		 record_entry );
 
@@ -1561,4 +2132,3 @@ on_error:
 	}
 	return( -1 );
 }
-
@@ -28,11 +28,13 @@
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
+#include "libesedb_table_state.h"
 #include "libesedb_types.h"
 
 #if defined( __cplusplus )
@@ -59,29 +61,13 @@ struct libesedb_internal_table
 	 */
 	libesedb_table_definition_t *template_table_definition;
 
-	/* The pages vector
+	/* The table state
 	 */
-	libfdata_vector_t *pages_vector;
+	libesedb_table_state_t *table_state;
 
-	/* The pages cache
+	/* The carved data definitions array
 	 */
-	libfcache_cache_t *pages_cache;
-
-	/* The long values pages vector
-	 */
-	libfdata_vector_t *long_values_pages_vector;
-
-	/* The long values pages cache
-	 */
-	libfcache_cache_t *long_values_pages_cache;
-
-	/* The table page tree
-	 */
-	libesedb_page_tree_t *table_page_tree;
-
-	/* The long values page tree
-	 */
-	libesedb_page_tree_t *long_values_page_tree;
+	libcdata_array_t *carved_data_definitions_array;
 };
 
 int libesedb_table_initialize(
@@ -90,6 +76,7 @@ int libesedb_table_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     libesedb_table_state_t *table_state,
      libcerror_error_t **error );
 
 LIBESEDB_EXTERN \
@@ -170,6 +157,24 @@ int libesedb_table_get_column(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_by_utf8_name(
+     libesedb_table_t *table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_column_by_utf16_name(
+     libesedb_table_t *table,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libesedb_column_t **column,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_number_of_indexes(
      libesedb_table_t *table,
@@ -189,6 +194,13 @@ int libesedb_table_get_number_of_records(
      int *number_of_records,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_space_statistics(
+     libesedb_table_t *table,
+     uint64_t *statistics,
+     int number_of_statistics,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_record(
      libesedb_table_t *table,
@@ -196,6 +208,26 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_carve_records(
+     libesedb_table_t *table,
+     uint32_t first_page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_number_of_carved_records(
+     libesedb_table_t *table,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_carved_record(
+     libesedb_table_t *table,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -28,6 +28,9 @@
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libuna.h"
+#include "libesedb_name_hash_table.h"
+#include "libesedb_record_layout.h"
 #include "libesedb_table_definition.h"
 
 /* Creates a table definition
@@ -147,6 +150,19 @@ int libesedb_table_definition_initialize(
 
 		goto on_error;
 	}
+	if( libesedb_name_hash_table_initialize(
+	     &( ( *table_definition )->column_catalog_definition_name_hash_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column catalog definition name hash table.",
+		 function );
+
+		goto on_error;
+	}
 	( *table_definition )->table_catalog_definition = table_catalog_definition;
 
 	return( 1 );
@@ -154,6 +170,19 @@ int libesedb_table_definition_initialize(
 on_error:
 	if( *table_definition != NULL )
 	{
+		if( ( *table_definition )->column_catalog_definition_name_hash_table != NULL )
+		{
+			libesedb_name_hash_table_free(
+			 &( ( *table_definition )->column_catalog_definition_name_hash_table ),
+			 NULL );
+		}
+		if( ( *table_definition )->index_catalog_definition_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *table_definition )->index_catalog_definition_array ),
+			 NULL,
+			 NULL );
+		}
 		if( ( *table_definition )->column_catalog_definition_array != NULL )
 		{
 			libcdata_array_free(
@@ -240,6 +269,35 @@ int libesedb_table_definition_free(
 				result = -1;
 			}
 		}
+		if( libesedb_name_hash_table_free(
+		     &( ( *table_definition )->column_catalog_definition_name_hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column catalog definition name hash table.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *table_definition )->record_layout != NULL )
+		{
+			if( libesedb_record_layout_free(
+			     &( ( *table_definition )->record_layout ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record layout.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_array_free(
 		     &( ( *table_definition )->column_catalog_definition_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_catalog_definition_free,
@@ -475,6 +533,118 @@ int libesedb_table_definition_get_column_catalog_definition_by_index(
 	return( 1 );
 }
 
+/* Retrieves the column catalog definition for the specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such column catalog definition or -1 on error
+ */
+int libesedb_table_definition_get_column_catalog_definition_by_utf8_name(
+     libesedb_table_definition_t *table_definition,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_definition_get_column_catalog_definition_by_utf8_name";
+	int result            = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_name_hash_table_get_value_by_utf8_name(
+	          table_definition->column_catalog_definition_name_hash_table,
+	          utf8_string,
+	          utf8_string_length,
+	          (intptr_t **) column_catalog_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition by UTF-8 name from name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the column catalog definition for the specific UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such column catalog definition or -1 on error
+ */
+int libesedb_table_definition_get_column_catalog_definition_by_utf16_name(
+     libesedb_table_definition_t *table_definition,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_definition_get_column_catalog_definition_by_utf16_name";
+	int result            = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_name_hash_table_get_value_by_utf16_name(
+	          table_definition->column_catalog_definition_name_hash_table,
+	          utf16_string,
+	          utf16_string_length,
+	          (intptr_t **) column_catalog_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition by UTF-16 name from name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Appends a column catalog definition to the table definition
  * Returns 1 if successful or -1 on error
  */
@@ -520,6 +690,24 @@ int libesedb_table_definition_append_column_catalog_definition(
 
 		return( -1 );
 	}
+	/* The record layout is determined again when the next record is read
+	 */
+	if( table_definition->record_layout != NULL )
+	{
+		if( libesedb_record_layout_free(
+		     &( table_definition->record_layout ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record layout.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libcdata_array_append_entry(
 	     table_definition->column_catalog_definition_array,
 	     &entry_index,
@@ -535,7 +723,249 @@ int libesedb_table_definition_append_column_catalog_definition(
 
 		return( -1 );
 	}
+	/* If there are multiple column catalog definitions with the same name the first one is used
+	 */
+	if( libesedb_name_hash_table_insert_value(
+	     table_definition->column_catalog_definition_name_hash_table,
+	     column_catalog_definition,
+	     (intptr_t *) column_catalog_definition,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert column catalog definition into name hash table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	/* Remove the column catalog definition from the array since on error
+	 * the caller retains ownership of the column catalog definition
+	 */
+	libcdata_array_set_entry_by_index(
+	 table_definition->column_catalog_definition_array,
+	 entry_index,
+	 NULL,
+	 NULL );
+
+	libcdata_array_resize(
+	 table_definition->column_catalog_definition_array,
+	 entry_index,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_catalog_definition_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the record layout
+ * The record layout is determined from the column catalog definitions of the template table
+ * and the table on first use and reused for all the records of the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_definition_get_record_layout(
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_record_layout_t **record_layout,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	static char *function                                    = "libesedb_table_definition_get_record_layout";
+	int column_catalog_definition_index                      = 0;
+	int number_of_column_catalog_definitions                 = 0;
+	int number_of_table_column_catalog_definitions           = 0;
+	int number_of_template_table_column_catalog_definitions  = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->record_layout != NULL )
+	{
+		*record_layout = table_definition->record_layout;
+
+		return( 1 );
+	}
+	if( template_table_definition != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     template_table_definition->column_catalog_definition_array,
+		     &number_of_template_table_column_catalog_definitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of template table column catalog definitions.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     table_definition->column_catalog_definition_array,
+	     &number_of_table_column_catalog_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table column catalog definitions.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_column_catalog_definitions = number_of_table_column_catalog_definitions;
+
+	if( template_table_definition != NULL )
+	{
+		if( number_of_table_column_catalog_definitions > number_of_template_table_column_catalog_definitions )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of table column catalog definitions value exceeds number in template table.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_column_catalog_definitions += number_of_template_table_column_catalog_definitions;
+	}
+	if( libesedb_record_layout_initialize(
+	     &( table_definition->record_layout ),
+	     number_of_column_catalog_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record layout.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_catalog_definition_index = 0;
+	     column_catalog_definition_index < number_of_column_catalog_definitions;
+	     column_catalog_definition_index++ )
+	{
+		if( column_catalog_definition_index < number_of_template_table_column_catalog_definitions )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     template_table_definition->column_catalog_definition_array,
+			     column_catalog_definition_index,
+			     (intptr_t **) &column_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column catalog definition: %d from template table.",
+				 function,
+				 column_catalog_definition_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libcdata_array_get_entry_by_index(
+			     table_definition->column_catalog_definition_array,
+			     column_catalog_definition_index - number_of_template_table_column_catalog_definitions,
+			     (intptr_t **) &column_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column catalog definition: %d from table.",
+				 function,
+				 column_catalog_definition_index );
+
+				goto on_error;
+			}
+		}
+		if( column_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column catalog definition: %d.",
+			 function,
+			 column_catalog_definition_index );
+
+			goto on_error;
+		}
+		if( ( template_table_definition != NULL )
+		 && ( column_catalog_definition_index == number_of_template_table_column_catalog_definitions ) )
+		{
+			if( column_catalog_definition->identifier != 256 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: only tagged data types supported in tables using a template table.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libesedb_record_layout_append_column(
+		     table_definition->record_layout,
+		     column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append column: %d to record layout.",
+			 function,
+			 column_catalog_definition_index );
+
+			goto on_error;
+		}
+	}
+	*record_layout = table_definition->record_layout;
+
 	return( 1 );
+
+on_error:
+	if( table_definition->record_layout != NULL )
+	{
+		libesedb_record_layout_free(
+		 &( table_definition->record_layout ),
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the number of index catalog definitions
@@ -28,6 +28,8 @@
 #include "libesedb_catalog_definition.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_name_hash_table.h"
+#include "libesedb_record_layout.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -41,6 +43,19 @@ struct libesedb_table_definition
 	 */
 	libesedb_catalog_definition_t *table_catalog_definition;
 
+	/* The catalog leaf page number that contains the table catalog definition
+	 * or 0 if the other catalog definitions of the table have been read
+	 */
+	uint32_t catalog_leaf_page_number;
+
+	/* The catalog page value index of the table catalog definition
+	 */
+	uint16_t catalog_page_value_index;
+
+	/* Value to indicate the other catalog definitions of the table could not be read
+	 */
+	uint8_t catalog_read_failed;
+
 	/* The long value catalog definition
 	 */
 	libesedb_catalog_definition_t *long_value_catalog_definition;
@@ -56,6 +71,15 @@ struct libesedb_table_definition
 	/* The index catalog definition array
 	 */
 	libcdata_array_t *index_catalog_definition_array;
+
+	/* The column catalog definition name hash table
+	 */
+	libesedb_name_hash_table_t *column_catalog_definition_name_hash_table;
+
+	/* The record layout
+	 * which is determined when the first record of the table is read
+	 */
+	libesedb_record_layout_t *record_layout;
 };
 
 int libesedb_table_definition_initialize(
@@ -88,11 +112,31 @@ int libesedb_table_definition_get_column_catalog_definition_by_index(
      libesedb_catalog_definition_t **column_catalog_definition,
      libcerror_error_t **error );
 
+int libesedb_table_definition_get_column_catalog_definition_by_utf8_name(
+     libesedb_table_definition_t *table_definition,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_get_column_catalog_definition_by_utf16_name(
+     libesedb_table_definition_t *table_definition,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libesedb_catalog_definition_t **column_catalog_definition,
+     libcerror_error_t **error );
+
 int libesedb_table_definition_append_column_catalog_definition(
      libesedb_table_definition_t *table_definition,
      libesedb_catalog_definition_t *column_catalog_definition,
      libcerror_error_t **error );
 
+int libesedb_table_definition_get_record_layout(
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_record_layout_t **record_layout,
+     libcerror_error_t **error );
+
 int libesedb_table_definition_get_number_of_index_catalog_definitions(
      libesedb_table_definition_t *table_definition,
      int *number_of_definitions,
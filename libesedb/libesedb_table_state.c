@@ -0,0 +1,463 @@
+/*
+ * Table state functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_table_state.h"
+
+/* Creates a table state
+ * Make sure the value table_state is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_state_initialize(
+     libesedb_table_state_t **table_state,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_state_initialize";
+	int segment_index     = 0;
+
+	if( table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table state value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	*table_state = memory_allocate_structure(
+	                libesedb_table_state_t );
+
+	if( *table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table state.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *table_state,
+	     0,
+	     sizeof( libesedb_table_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear table state.",
+		 function );
+
+		memory_free(
+		 *table_state );
+
+		*table_state = NULL;
+
+		return( -1 );
+	}
+	if( libfdata_vector_initialize(
+	     &( ( *table_state )->pages_vector ),
+	     (size64_t) io_handle->page_size,
+	     (intptr_t *) io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pages vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     ( *table_state )->pages_vector,
+	     &segment_index,
+	     0,
+	     io_handle->pages_data_offset,
+	     io_handle->pages_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment to pages vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( ( *table_state )->pages_cache ),
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pages cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_initialize(
+	     &( ( *table_state )->table_page_tree ),
+	     io_handle,
+	     ( *table_state )->pages_vector,
+	     ( *table_state )->pages_cache,
+	     table_definition->table_catalog_definition->identifier,
+	     table_definition->table_catalog_definition->father_data_page_number,
+	     table_definition,
+	     template_table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( table_definition->long_value_catalog_definition != NULL )
+	{
+		if( libfdata_vector_initialize(
+		     &( ( *table_state )->long_values_pages_vector ),
+		     (size64_t) io_handle->page_size,
+		     (intptr_t *) io_handle,
+		     NULL,
+		     NULL,
+		     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+		     NULL,
+		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create long values pages vector.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdata_vector_append_segment(
+		     ( *table_state )->long_values_pages_vector,
+		     &segment_index,
+		     0,
+		     io_handle->pages_data_offset,
+		     io_handle->pages_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment to long values pages vector.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfcache_cache_initialize(
+		     &( ( *table_state )->long_values_pages_cache ),
+		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create long values pages cache.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_initialize(
+		     &( ( *table_state )->long_values_page_tree ),
+		     io_handle,
+		     ( *table_state )->long_values_pages_vector,
+		     ( *table_state )->long_values_pages_cache,
+		     table_definition->long_value_catalog_definition->identifier,
+		     table_definition->long_value_catalog_definition->father_data_page_number,
+		     table_definition,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create long value page tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *table_state )->number_of_references = 1;
+
+	return( 1 );
+
+on_error:
+	if( *table_state != NULL )
+	{
+		if( ( *table_state )->long_values_pages_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *table_state )->long_values_pages_cache ),
+			 NULL );
+		}
+		if( ( *table_state )->long_values_pages_vector != NULL )
+		{
+			libfdata_vector_free(
+			 &( ( *table_state )->long_values_pages_vector ),
+			 NULL );
+		}
+		if( ( *table_state )->long_values_page_tree != NULL )
+		{
+			libesedb_page_tree_free(
+			 &( ( *table_state )->long_values_page_tree ),
+			 NULL );
+		}
+		if( ( *table_state )->table_page_tree != NULL )
+		{
+			libesedb_page_tree_free(
+			 &( ( *table_state )->table_page_tree ),
+			 NULL );
+		}
+		if( ( *table_state )->pages_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *table_state )->pages_cache ),
+			 NULL );
+		}
+		if( ( *table_state )->pages_vector != NULL )
+		{
+			libfdata_vector_free(
+			 &( ( *table_state )->pages_vector ),
+			 NULL );
+		}
+		memory_free(
+		 *table_state );
+
+		*table_state = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a table state
+ * The table state is only freed when its last reference is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_state_free(
+     libesedb_table_state_t **table_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_state_free";
+	int result            = 1;
+
+	if( table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_state != NULL )
+	{
+		( *table_state )->number_of_references -= 1;
+
+		if( ( *table_state )->number_of_references > 0 )
+		{
+			*table_state = NULL;
+
+			return( 1 );
+		}
+		/* The io_handle and table_definition references are freed elsewhere
+		 */
+		if( libfdata_vector_free(
+		     &( ( *table_state )->pages_vector ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pages vector.",
+			 function );
+
+			result = -1;
+		}
+		if( libfcache_cache_free(
+		     &( ( *table_state )->pages_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pages cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *table_state )->long_values_pages_vector != NULL )
+		{
+			if( libfdata_vector_free(
+			     &( ( *table_state )->long_values_pages_vector ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long values pages vector.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *table_state )->long_values_pages_cache != NULL )
+		{
+			if( libfcache_cache_free(
+			     &( ( *table_state )->long_values_pages_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long values pages cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *table_state )->long_values_page_tree != NULL )
+		{
+			if( libesedb_page_tree_free(
+			     &( ( *table_state )->long_values_page_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long values page tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libesedb_page_tree_free(
+		     &( ( *table_state )->table_page_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table page tree.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *table_state );
+
+		*table_state = NULL;
+	}
+	return( result );
+}
+
@@ -0,0 +1,88 @@
+/*
+ * Table state functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_TABLE_STATE_H )
+#define _LIBESEDB_TABLE_STATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_io_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_table_definition.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_table_state libesedb_table_state_t;
+
+struct libesedb_table_state
+{
+	/* The pages vector
+	 */
+	libfdata_vector_t *pages_vector;
+
+	/* The pages cache
+	 */
+	libfcache_cache_t *pages_cache;
+
+	/* The long values pages vector
+	 */
+	libfdata_vector_t *long_values_pages_vector;
+
+	/* The long values pages cache
+	 */
+	libfcache_cache_t *long_values_pages_cache;
+
+	/* The table page tree
+	 */
+	libesedb_page_tree_t *table_page_tree;
+
+	/* The long values page tree
+	 */
+	libesedb_page_tree_t *long_values_page_tree;
+
+	/* The number of references
+	 */
+	int number_of_references;
+};
+
+int libesedb_table_state_initialize(
+     libesedb_table_state_t **table_state,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcerror_error_t **error );
+
+int libesedb_table_state_free(
+     libesedb_table_state_t **table_state,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_TABLE_STATE_H ) */
+
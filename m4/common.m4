@@ -312,7 +312,7 @@ AC_DEFUN([AX_COMMON_CHECK_LOCAL],
   AC_CHECK_HEADERS([wchar.h wctype.h])
 
   dnl File stream functions used in common/file_stream.h
-  AC_CHECK_FUNCS([fclose feof fgets fopen fread fseeko fseeko64 fwrite vfprintf])
+  AC_CHECK_FUNCS([fclose feof fflush fgets fopen fread fseeko fseeko64 ftello ftello64 fwrite vfprintf])
 
   AS_IF(
     [test "x$ac_cv_func_fclose" != xyes],
@@ -328,6 +328,13 @@ AC_DEFUN([AX_COMMON_CHECK_LOCAL],
       [1])
   ])
 
+  AS_IF(
+    [test "x$ac_cv_func_fflush" != xyes],
+    [AC_MSG_FAILURE(
+      [Missing function: fflush],
+      [1])
+  ])
+
   AS_IF(
     [test "x$ac_cv_func_fgets" != xyes],
     [AC_MSG_FAILURE(
@@ -356,6 +363,13 @@ AC_DEFUN([AX_COMMON_CHECK_LOCAL],
       [1])
   ])
 
+  AS_IF(
+    [test "x$ac_cv_func_ftello" != xyes && test "x$ac_cv_func_ftello64" != xyes],
+    [AC_MSG_FAILURE(
+      [Missing function: ftello and ftello64],
+      [1])
+  ])
+
   AS_IF(
     [test "x$ac_cv_func_fwrite" != xyes],
     [AC_MSG_FAILURE(
@@ -0,0 +1,183 @@
+dnl Checks for sqlite3 required headers and functions
+dnl
+dnl Version: 20201018
+
+dnl Function to detect if sqlite3 is available
+dnl ac_sqlite3_dummy is used to prevent AC_CHECK_LIB adding unnecessary -l<library> arguments
+AC_DEFUN([AX_SQLITE3_CHECK_LIB],
+  [AS_IF(
+    [test "x$ac_cv_with_sqlite3" = xno],
+    [ac_cv_sqlite3=no],
+    [ac_cv_sqlite3=check
+    dnl Check if the directory provided as parameter exists
+    AS_IF(
+      [test "x$ac_cv_with_sqlite3" != x && test "x$ac_cv_with_sqlite3" != xauto-detect],
+      [AS_IF(
+        [test -d "$ac_cv_with_sqlite3"],
+        [CFLAGS="$CFLAGS -I${ac_cv_with_sqlite3}/include"
+        LDFLAGS="$LDFLAGS -L${ac_cv_with_sqlite3}/lib"],
+        [AC_MSG_FAILURE(
+          [no such directory: $ac_cv_with_sqlite3],
+          [1])
+        ])
+      ],
+      [dnl Check for a pkg-config file
+      AS_IF(
+        [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
+        [PKG_CHECK_MODULES(
+          [sqlite3],
+          [sqlite3 >= 3.7.0],
+          [ac_cv_sqlite3=yes],
+          [ac_cv_sqlite3=check])
+        ])
+      AS_IF(
+        [test "x$ac_cv_sqlite3" = xyes],
+        [ac_cv_sqlite3_CPPFLAGS="$pkg_cv_sqlite3_CFLAGS"
+        ac_cv_sqlite3_LIBADD="$pkg_cv_sqlite3_LIBS"])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_sqlite3" = xcheck],
+      [dnl Check for headers
+      AC_CHECK_HEADERS([sqlite3.h])
+
+      AS_IF(
+        [test "x$ac_cv_header_sqlite3_h" = xno],
+        [ac_cv_sqlite3=no],
+        [dnl Check for the individual functions
+        ac_cv_sqlite3=yes
+
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_open_v2,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_close,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_errmsg,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_exec,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+
+        dnl Prepared statement functions
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_prepare_v2,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_bind_blob,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_bind_double,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_bind_int64,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_bind_null,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_bind_text,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_step,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_reset,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+        AC_CHECK_LIB(
+          sqlite3,
+          sqlite3_finalize,
+          [ac_cv_sqlite3_dummy=yes],
+          [ac_cv_sqlite3=no])
+
+        ac_cv_sqlite3_LIBADD="-lsqlite3"])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_with_sqlite3" != x && test "x$ac_cv_with_sqlite3" != xauto-detect && test "x$ac_cv_sqlite3" != xyes],
+      [AC_MSG_FAILURE(
+        [unable to find supported sqlite3 in directory: $ac_cv_with_sqlite3],
+        [1])
+      ])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_sqlite3" = xyes],
+    [AC_DEFINE(
+      [HAVE_SQLITE3],
+      [1],
+      [Define to 1 if you have the `sqlite3' library (-lsqlite3).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_sqlite3" = xyes],
+    [AC_SUBST(
+      [HAVE_SQLITE3],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_SQLITE3],
+      [0])
+    ])
+  ])
+
+dnl Function to detect how to enable sqlite3
+AC_DEFUN([AX_SQLITE3_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [sqlite3],
+    [sqlite3],
+    [search for sqlite3 in includedir and libdir or in the specified DIR, or no if not to use sqlite3],
+    [auto-detect],
+    [DIR])
+
+  dnl Check for a shared library version
+  AX_SQLITE3_CHECK_LIB
+
+  AS_IF(
+    [test "x$ac_cv_sqlite3_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [SQLITE3_CPPFLAGS],
+      [$ac_cv_sqlite3_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_sqlite3_LIBADD" != "x"],
+    [AC_SUBST(
+      [SQLITE3_LIBADD],
+      [$ac_cv_sqlite3_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_sqlite3" = xyes],
+    [AC_SUBST(
+      [ax_sqlite3_spec_requires],
+      [sqlite])
+    AC_SUBST(
+      [ax_sqlite3_spec_build_requires],
+      [sqlite-devel])
+    ])
+  ])
+
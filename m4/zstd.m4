@@ -0,0 +1,141 @@
+dnl Checks for zstd required headers and functions
+dnl
+dnl Version: 20201018
+
+dnl Function to detect if zstd is available
+dnl ac_zstd_dummy is used to prevent AC_CHECK_LIB adding unnecessary -l<library> arguments
+AC_DEFUN([AX_ZSTD_CHECK_LIB],
+  [AS_IF(
+    [test "x$ac_cv_with_zstd" = xno],
+    [ac_cv_zstd=no],
+    [ac_cv_zstd=check
+    dnl Check if the directory provided as parameter exists
+    AS_IF(
+      [test "x$ac_cv_with_zstd" != x && test "x$ac_cv_with_zstd" != xauto-detect],
+      [AS_IF(
+        [test -d "$ac_cv_with_zstd"],
+        [CFLAGS="$CFLAGS -I${ac_cv_with_zstd}/include"
+        LDFLAGS="$LDFLAGS -L${ac_cv_with_zstd}/lib"],
+        [AC_MSG_FAILURE(
+          [no such directory: $ac_cv_with_zstd],
+          [1])
+        ])
+      ],
+      [dnl Check for a pkg-config file
+      AS_IF(
+        [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
+        [PKG_CHECK_MODULES(
+          [zstd],
+          [libzstd >= 1.4.0],
+          [ac_cv_zstd=yes],
+          [ac_cv_zstd=check])
+        ])
+      AS_IF(
+        [test "x$ac_cv_zstd" = xyes],
+        [ac_cv_zstd_CPPFLAGS="$pkg_cv_zstd_CFLAGS"
+        ac_cv_zstd_LIBADD="$pkg_cv_zstd_LIBS"])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_zstd" = xcheck],
+      [dnl Check for headers
+      AC_CHECK_HEADERS([zstd.h])
+
+      AS_IF(
+        [test "x$ac_cv_header_zstd_h" = xno],
+        [ac_cv_zstd=no],
+        [dnl Check for the individual functions
+        ac_cv_zstd=yes
+
+        AC_CHECK_LIB(
+          zstd,
+          ZSTD_createCCtx,
+          [ac_cv_zstd_dummy=yes],
+          [ac_cv_zstd=no])
+        AC_CHECK_LIB(
+          zstd,
+          ZSTD_freeCCtx,
+          [ac_cv_zstd_dummy=yes],
+          [ac_cv_zstd=no])
+        AC_CHECK_LIB(
+          zstd,
+          ZSTD_compressStream2,
+          [ac_cv_zstd_dummy=yes],
+          [ac_cv_zstd=no])
+        AC_CHECK_LIB(
+          zstd,
+          ZSTD_isError,
+          [ac_cv_zstd_dummy=yes],
+          [ac_cv_zstd=no])
+        AC_CHECK_LIB(
+          zstd,
+          ZSTD_getErrorName,
+          [ac_cv_zstd_dummy=yes],
+          [ac_cv_zstd=no])
+
+        ac_cv_zstd_LIBADD="-lzstd"])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_with_zstd" != x && test "x$ac_cv_with_zstd" != xauto-detect && test "x$ac_cv_zstd" != xyes],
+      [AC_MSG_FAILURE(
+        [unable to find supported zstd in directory: $ac_cv_with_zstd],
+        [1])
+      ])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_zstd" = xyes],
+    [AC_DEFINE(
+      [HAVE_ZSTD],
+      [1],
+      [Define to 1 if you have the `zstd' library (-lzstd).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_zstd" = xyes],
+    [AC_SUBST(
+      [HAVE_ZSTD],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_ZSTD],
+      [0])
+    ])
+  ])
+
+dnl Function to detect how to enable zstd
+AC_DEFUN([AX_ZSTD_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [zstd],
+    [zstd],
+    [search for zstd in includedir and libdir or in the specified DIR, or no if not to use zstd],
+    [auto-detect],
+    [DIR])
+
+  dnl Check for a shared library version
+  AX_ZSTD_CHECK_LIB
+
+  AS_IF(
+    [test "x$ac_cv_zstd_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [ZSTD_CPPFLAGS],
+      [$ac_cv_zstd_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_zstd_LIBADD" != "x"],
+    [AC_SUBST(
+      [ZSTD_LIBADD],
+      [$ac_cv_zstd_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_zstd" = xyes],
+    [AC_SUBST(
+      [ax_zstd_spec_requires],
+      [libzstd])
+    AC_SUBST(
+      [ax_zstd_spec_build_requires],
+      [libzstd-devel])
+    ])
+  ])
+
@@ -0,0 +1,2191 @@
+/*
+ * Library benchmark program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "esedb_test_getopt.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_memory.h"
+
+#include "../esedbtools/esedbtools_system_string.h"
+
+#define ESEDB_BENCH_DEFAULT_NUMBER_OF_ITERATIONS	10
+#define ESEDB_BENCH_DEFAULT_NUMBER_OF_RANDOM_ACCESSES	10000
+
+enum ESEDB_BENCH_WORKLOADS
+{
+	ESEDB_BENCH_WORKLOAD_LONG_VALUES	= (int) 'l',
+	ESEDB_BENCH_WORKLOAD_SCAN		= (int) 's',
+	ESEDB_BENCH_WORKLOAD_STRINGS		= (int) 'u'
+};
+
+typedef struct esedb_bench_result esedb_bench_result_t;
+
+struct esedb_bench_result
+{
+	/* The name of the workload
+	 */
+	const char *name;
+
+	/* The number of operations
+	 */
+	uint64_t number_of_operations;
+
+	/* The number of bytes processed
+	 */
+	uint64_t number_of_bytes;
+
+	/* The start timestamp in nanoseconds
+	 */
+	uint64_t start_timestamp;
+
+	/* The elapsed time in nanoseconds
+	 */
+	uint64_t elapsed_time;
+
+	/* The number of allocations at the start
+	 */
+	uint64_t start_number_of_allocations;
+
+	/* The number of allocations
+	 */
+	uint64_t number_of_allocations;
+};
+
+/* Prints usage information
+ */
+void esedb_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use esedb_bench to measure the performance of libesedb on\n"
+	                 "a corpus of Extensible Storage Engine (ESE) Database Files.\n\n" );
+
+	fprintf( stream, "Usage: esedb_bench [ -i iterations ] [ -n accesses ] [ -h ] source ...\n\n" );
+
+	fprintf( stream, "\tsource: the source file(s), files without an ESE signature are skipped\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     number of iterations of opening a file, the default is: %d\n",
+	         ESEDB_BENCH_DEFAULT_NUMBER_OF_ITERATIONS );
+	fprintf( stream, "\t-n:     number of random record accesses, the default is: %d\n",
+	         ESEDB_BENCH_DEFAULT_NUMBER_OF_RANDOM_ACCESSES );
+	fprintf( stream, "\n" );
+	fprintf( stream, "The results are written to stdout in JSON.\n" );
+}
+
+/* Retrieves a monotonic timestamp in nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_get_timestamp(
+     uint64_t *timestamp,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+#else
+	struct timespec time_value;
+#endif
+
+	static char *function = "esedb_bench_get_timestamp";
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*timestamp = ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	           + ( ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart );
+#else
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic clock time.",
+		 function );
+
+		return( -1 );
+	}
+	*timestamp = ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec;
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of bytes read from a file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_get_number_of_bytes_read(
+     libesedb_file_t *file,
+     uint64_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	uint64_t statistics[ LIBESEDB_NUMBER_OF_STATISTICS ];
+
+	static char *function = "esedb_bench_get_number_of_bytes_read";
+
+	if( number_of_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_get_statistics(
+	     file,
+	     statistics,
+	     LIBESEDB_NUMBER_OF_STATISTICS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_bytes = statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGE_BYTES_READ ]
+	                 + statistics[ LIBESEDB_STATISTIC_NUMBER_OF_DATA_SEGMENT_BYTES_READ ];
+
+	return( 1 );
+}
+
+/* Starts the measurement of a workload
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_result_start(
+     esedb_bench_result_t *result,
+     const char *name,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_result_start";
+
+	if( result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     result,
+	     0,
+	     sizeof( esedb_bench_result_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear result.",
+		 function );
+
+		return( -1 );
+	}
+	result->name = name;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	result->start_number_of_allocations = esedb_test_number_of_allocations;
+#endif
+	if( esedb_bench_get_timestamp(
+	     &( result->start_timestamp ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Stops the measurement of a workload
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_result_stop(
+     esedb_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_result_stop";
+	uint64_t timestamp    = 0;
+
+	if( result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_bench_get_timestamp(
+	     &timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stop timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	result->elapsed_time = timestamp - result->start_timestamp;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	result->number_of_allocations = esedb_test_number_of_allocations - result->start_number_of_allocations;
+#endif
+	return( 1 );
+}
+
+/* Prints a result as a JSON object
+ */
+void esedb_bench_result_fprint(
+      esedb_bench_result_t *result,
+      FILE *stream,
+      uint8_t is_last )
+{
+	double mega_bytes_per_second     = 0.0;
+	double nanoseconds_per_operation = 0.0;
+
+	if( ( result == NULL )
+	 || ( stream == NULL ) )
+	{
+		return;
+	}
+	if( result->number_of_operations > 0 )
+	{
+		nanoseconds_per_operation = (double) result->elapsed_time / (double) result->number_of_operations;
+	}
+	if( result->elapsed_time > 0 )
+	{
+		mega_bytes_per_second = ( (double) result->number_of_bytes * 1000.0 ) / (double) result->elapsed_time;
+	}
+	fprintf(
+	 stream,
+	 "        { \"name\": \"%s\", \"operations\": %" PRIu64 ", \"nanoseconds\": %" PRIu64 ", \"ns_per_op\": %.1f, \"bytes\": %" PRIu64 ", \"mb_per_second\": %.3f, ",
+	 result->name,
+	 result->number_of_operations,
+	 result->elapsed_time,
+	 nanoseconds_per_operation,
+	 result->number_of_bytes,
+	 mega_bytes_per_second );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	fprintf(
+	 stream,
+	 "\"allocations\": %" PRIu64 " }",
+	 result->number_of_allocations );
+#else
+	fprintf(
+	 stream,
+	 "\"allocations\": null }" );
+#endif
+	if( is_last == 0 )
+	{
+		fprintf(
+		 stream,
+		 "," );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+}
+
+/* Prints a string as a JSON string
+ */
+void esedb_bench_json_string_fprint(
+      const system_character_t *string,
+      FILE *stream )
+{
+	size_t string_index = 0;
+
+	if( ( string == NULL )
+	 || ( stream == NULL ) )
+	{
+		return;
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] == (system_character_t) '"' )
+		 || ( string[ string_index ] == (system_character_t) '\\' ) )
+		{
+			fprintf(
+			 stream,
+			 "\\%c",
+			 (char) string[ string_index ] );
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		else if( ( string[ string_index ] < 0x20 )
+		      || ( string[ string_index ] > 0x7e ) )
+#else
+		else if( (uint8_t) string[ string_index ] < 0x20 )
+#endif
+		{
+			fprintf(
+			 stream,
+			 "\\u%04" PRIx32 "",
+			 (uint32_t) ( string[ string_index ] & 0x0000ffffUL ) );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "%c",
+			 (char) string[ string_index ] );
+		}
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+}
+
+/* Opens a file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_file_open(
+     libesedb_file_t **file,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_file_open";
+
+	if( libesedb_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     *file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libesedb_file_open(
+	     *file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libesedb_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_file_close(
+     libesedb_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_file_close";
+	int result            = 1;
+
+	if( libesedb_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Measures opening and closing a file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_open(
+     const system_character_t *filename,
+     int number_of_iterations,
+     esedb_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libesedb_file_t *file    = NULL;
+	static char *function    = "esedb_bench_open";
+	uint64_t number_of_bytes = 0;
+	int iteration            = 0;
+
+	if( esedb_bench_result_start(
+	     result,
+	     "open",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start measurement.",
+		 function );
+
+		goto on_error;
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( esedb_bench_file_open(
+		     &file,
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			goto on_error;
+		}
+		if( esedb_bench_get_number_of_bytes_read(
+		     file,
+		     &number_of_bytes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of bytes read.",
+			 function );
+
+			goto on_error;
+		}
+		result->number_of_bytes += number_of_bytes;
+
+		if( esedb_bench_file_close(
+		     &file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+		result->number_of_operations += 1;
+	}
+	if( esedb_bench_result_stop(
+	     result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop measurement.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Measures retrieving the tables and their columns from the catalog
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_tables(
+     libesedb_file_t *file,
+     esedb_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libesedb_column_t *column = NULL;
+	libesedb_table_t *table   = NULL;
+	static char *function     = "esedb_bench_tables";
+	int column_entry          = 0;
+	int number_of_columns     = 0;
+	int number_of_tables      = 0;
+	int table_entry           = 0;
+
+	if( esedb_bench_result_start(
+	     result,
+	     "tables",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start measurement.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_get_number_of_tables(
+	     file,
+	     &number_of_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tables.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_entry = 0;
+	     table_entry < number_of_tables;
+	     table_entry++ )
+	{
+		if( libesedb_file_get_table(
+		     file,
+		     table_entry,
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table: %d.",
+			 function,
+			 table_entry );
+
+			goto on_error;
+		}
+		if( libesedb_table_get_number_of_columns(
+		     table,
+		     &number_of_columns,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of columns.",
+			 function );
+
+			goto on_error;
+		}
+		for( column_entry = 0;
+		     column_entry < number_of_columns;
+		     column_entry++ )
+		{
+			if( libesedb_table_get_column(
+			     table,
+			     column_entry,
+			     &column,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column: %d.",
+				 function,
+				 column_entry );
+
+				goto on_error;
+			}
+			if( libesedb_column_free(
+			     &column,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free column.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libesedb_table_free(
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table.",
+			 function );
+
+			goto on_error;
+		}
+		result->number_of_operations += 1;
+	}
+	if( esedb_bench_result_stop(
+	     result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop measurement.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Resizes the value data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_resize_value_data(
+     uint8_t **value_data,
+     size_t *value_data_size,
+     size_t required_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "esedb_bench_resize_value_data";
+
+	if( required_size <= *value_data_size )
+	{
+		return( 1 );
+	}
+	if( required_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            *value_data,
+	                            sizeof( uint8_t ) * required_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize value data.",
+		 function );
+
+		return( -1 );
+	}
+	*value_data      = reallocation;
+	*value_data_size = required_size;
+
+	return( 1 );
+}
+
+/* Reads the values of a record for a specific workload
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_read_record_values(
+     libesedb_record_t *record,
+     int workload,
+     uint8_t **value_data,
+     size_t *value_data_size,
+     esedb_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_t *long_value = NULL;
+	static char *function             = "esedb_bench_read_record_values";
+	size64_t long_value_data_size     = 0;
+	size_t utf8_string_size           = 0;
+	uint32_t column_type              = 0;
+	uint8_t value_data_flags          = 0;
+	int number_of_values              = 0;
+	int value_entry                   = 0;
+	int value_result                  = 0;
+
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		goto on_error;
+	}
+	if( workload == ESEDB_BENCH_WORKLOAD_SCAN )
+	{
+		return( 1 );
+	}
+	for( value_entry = 0;
+	     value_entry < number_of_values;
+	     value_entry++ )
+	{
+		if( libesedb_record_get_value_data_flags(
+		     record,
+		     value_entry,
+		     &value_data_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d data flags.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		if( workload == ESEDB_BENCH_WORKLOAD_LONG_VALUES )
+		{
+			if( ( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) == 0 )
+			 || ( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 ) )
+			{
+				continue;
+			}
+			value_result = libesedb_record_get_long_value(
+			                record,
+			                value_entry,
+			                &long_value,
+			                error );
+
+			if( value_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve long value: %d.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+			else if( value_result == 0 )
+			{
+				continue;
+			}
+			if( libesedb_long_value_get_data_size(
+			     long_value,
+			     &long_value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve long value: %d data size.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+			if( long_value_data_size > 0 )
+			{
+				if( esedb_bench_resize_value_data(
+				     value_data,
+				     value_data_size,
+				     (size_t) long_value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize value data.",
+					 function );
+
+					goto on_error;
+				}
+				if( libesedb_long_value_get_data(
+				     long_value,
+				     *value_data,
+				     (size_t) long_value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve long value: %d data.",
+					 function,
+					 value_entry );
+
+					goto on_error;
+				}
+			}
+			if( libesedb_long_value_free(
+			     &long_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long value.",
+				 function );
+
+				goto on_error;
+			}
+			result->number_of_operations += 1;
+			result->number_of_bytes      += (uint64_t) long_value_data_size;
+		}
+		else if( workload == ESEDB_BENCH_WORKLOAD_STRINGS )
+		{
+			if( ( value_data_flags & ~( LIBESEDB_VALUE_FLAG_VARIABLE_SIZE | LIBESEDB_VALUE_FLAG_COMPRESSED ) ) != 0 )
+			{
+				continue;
+			}
+			if( libesedb_record_get_column_type(
+			     record,
+			     value_entry,
+			     &column_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value: %d column type.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+			if( ( column_type != LIBESEDB_COLUMN_TYPE_TEXT )
+			 && ( column_type != LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+			{
+				continue;
+			}
+			value_result = libesedb_record_get_value_utf8_string_size(
+			                record,
+			                value_entry,
+			                &utf8_string_size,
+			                error );
+
+			if( value_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value: %d UTF-8 string size.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+			else if( ( value_result == 0 )
+			      || ( utf8_string_size == 0 ) )
+			{
+				continue;
+			}
+			if( esedb_bench_resize_value_data(
+			     value_data,
+			     value_data_size,
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize value data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_record_get_value_utf8_string(
+			     record,
+			     value_entry,
+			     *value_data,
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value: %d UTF-8 string.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+			result->number_of_operations += 1;
+			result->number_of_bytes      += (uint64_t) utf8_string_size;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Measures reading the records of all tables for a specific workload
+ * The scan workload counts records and the number of bytes read from the file,
+ * the other workloads count the values read and their size
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_read_records(
+     libesedb_file_t *file,
+     int workload,
+     esedb_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libesedb_record_t *record     = NULL;
+	libesedb_table_t *table       = NULL;
+	uint8_t *value_data           = NULL;
+	const char *name              = NULL;
+	static char *function         = "esedb_bench_read_records";
+	size_t value_data_size        = 0;
+	uint64_t number_of_bytes_read = 0;
+	int number_of_records         = 0;
+	int number_of_tables          = 0;
+	int record_entry              = 0;
+	int table_entry               = 0;
+
+	switch( workload )
+	{
+		case ESEDB_BENCH_WORKLOAD_LONG_VALUES:
+			name = "long_values";
+			break;
+
+		case ESEDB_BENCH_WORKLOAD_SCAN:
+			name = "scan";
+			break;
+
+		case ESEDB_BENCH_WORKLOAD_STRINGS:
+			name = "utf8_strings";
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported workload.",
+			 function );
+
+			return( -1 );
+	}
+	if( esedb_bench_get_number_of_bytes_read(
+	     file,
+	     &number_of_bytes_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of bytes read.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_result_start(
+	     result,
+	     name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start measurement.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_get_number_of_tables(
+	     file,
+	     &number_of_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tables.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_entry = 0;
+	     table_entry < number_of_tables;
+	     table_entry++ )
+	{
+		if( libesedb_file_get_table(
+		     file,
+		     table_entry,
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table: %d.",
+			 function,
+			 table_entry );
+
+			goto on_error;
+		}
+		if( libesedb_table_get_number_of_records(
+		     table,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_entry = 0;
+		     record_entry < number_of_records;
+		     record_entry++ )
+		{
+			if( libesedb_table_get_record(
+			     table,
+			     record_entry,
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 record_entry );
+
+				goto on_error;
+			}
+			if( esedb_bench_read_record_values(
+			     record,
+			     workload,
+			     &value_data,
+			     &value_data_size,
+			     result,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read record: %d values.",
+				 function,
+				 record_entry );
+
+				goto on_error;
+			}
+			if( libesedb_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				goto on_error;
+			}
+			if( workload == ESEDB_BENCH_WORKLOAD_SCAN )
+			{
+				result->number_of_operations += 1;
+			}
+		}
+		if( libesedb_table_free(
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( esedb_bench_result_stop(
+	     result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop measurement.",
+		 function );
+
+		goto on_error;
+	}
+	if( workload == ESEDB_BENCH_WORKLOAD_SCAN )
+	{
+		if( esedb_bench_get_number_of_bytes_read(
+		     file,
+		     &( result->number_of_bytes ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of bytes read.",
+			 function );
+
+			goto on_error;
+		}
+		result->number_of_bytes -= number_of_bytes_read;
+	}
+	if( value_data != NULL )
+	{
+		memory_free(
+		 value_data );
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( value_data != NULL )
+	{
+		memory_free(
+		 value_data );
+	}
+	return( -1 );
+}
+
+/* Measures reading records of the table with the most records in a pseudo random order
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_random_access(
+     libesedb_file_t *file,
+     int number_of_accesses,
+     esedb_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libesedb_record_t *record     = NULL;
+	libesedb_table_t *table       = NULL;
+	static char *function         = "esedb_bench_random_access";
+	uint64_t number_of_bytes_read = 0;
+	uint64_t random_value         = 0x2545f4914f6cdd1dUL;
+	int access_index              = 0;
+	int largest_table_entry       = 0;
+	int maximum_number_of_records = 0;
+	int number_of_records         = 0;
+	int number_of_tables          = 0;
+	int record_entry              = 0;
+	int table_entry               = 0;
+
+	if( libesedb_file_get_number_of_tables(
+	     file,
+	     &number_of_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tables.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_entry = 0;
+	     table_entry < number_of_tables;
+	     table_entry++ )
+	{
+		if( libesedb_file_get_table(
+		     file,
+		     table_entry,
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table: %d.",
+			 function,
+			 table_entry );
+
+			goto on_error;
+		}
+		if( libesedb_table_get_number_of_records(
+		     table,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_table_free(
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_records > maximum_number_of_records )
+		{
+			maximum_number_of_records = number_of_records;
+			largest_table_entry       = table_entry;
+		}
+	}
+	if( esedb_bench_get_number_of_bytes_read(
+	     file,
+	     &number_of_bytes_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of bytes read.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_result_start(
+	     result,
+	     "random_access",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start measurement.",
+		 function );
+
+		goto on_error;
+	}
+	if( maximum_number_of_records > 0 )
+	{
+		if( libesedb_file_get_table(
+		     file,
+		     largest_table_entry,
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table: %d.",
+			 function,
+			 largest_table_entry );
+
+			goto on_error;
+		}
+		/* A fixed seed is used so that the access pattern is the same between runs
+		 */
+		for( access_index = 0;
+		     access_index < number_of_accesses;
+		     access_index++ )
+		{
+			random_value ^= random_value >> 12;
+			random_value ^= random_value << 25;
+			random_value ^= random_value >> 27;
+
+			record_entry = (int) ( ( random_value * 0x2545f4914f6cdd1dUL ) % (uint64_t) maximum_number_of_records );
+
+			if( libesedb_table_get_record(
+			     table,
+			     record_entry,
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 record_entry );
+
+				goto on_error;
+			}
+			if( libesedb_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				goto on_error;
+			}
+			result->number_of_operations += 1;
+		}
+		if( libesedb_table_free(
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( esedb_bench_result_stop(
+	     result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop measurement.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_get_number_of_bytes_read(
+	     file,
+	     &( result->number_of_bytes ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of bytes read.",
+		 function );
+
+		goto on_error;
+	}
+	result->number_of_bytes -= number_of_bytes_read;
+
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Measures walking the records of all indexes of all tables
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_index_walk(
+     libesedb_file_t *file,
+     esedb_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libesedb_index_t *index       = NULL;
+	libesedb_record_t *record     = NULL;
+	libesedb_table_t *table       = NULL;
+	static char *function         = "esedb_bench_index_walk";
+	uint64_t number_of_bytes_read = 0;
+	int index_entry               = 0;
+	int number_of_indexes         = 0;
+	int number_of_records         = 0;
+	int number_of_tables          = 0;
+	int record_entry              = 0;
+	int table_entry               = 0;
+
+	if( esedb_bench_get_number_of_bytes_read(
+	     file,
+	     &number_of_bytes_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of bytes read.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_result_start(
+	     result,
+	     "index_walk",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start measurement.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_get_number_of_tables(
+	     file,
+	     &number_of_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tables.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_entry = 0;
+	     table_entry < number_of_tables;
+	     table_entry++ )
+	{
+		if( libesedb_file_get_table(
+		     file,
+		     table_entry,
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table: %d.",
+			 function,
+			 table_entry );
+
+			goto on_error;
+		}
+		if( libesedb_table_get_number_of_indexes(
+		     table,
+		     &number_of_indexes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of indexes.",
+			 function );
+
+			goto on_error;
+		}
+		for( index_entry = 0;
+		     index_entry < number_of_indexes;
+		     index_entry++ )
+		{
+			if( libesedb_table_get_index(
+			     table,
+			     index_entry,
+			     &index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve index: %d.",
+				 function,
+				 index_entry );
+
+				goto on_error;
+			}
+			if( libesedb_index_get_number_of_records(
+			     index,
+			     &number_of_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of index records.",
+				 function );
+
+				goto on_error;
+			}
+			for( record_entry = 0;
+			     record_entry < number_of_records;
+			     record_entry++ )
+			{
+				if( libesedb_index_get_record(
+				     index,
+				     record_entry,
+				     &record,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve index record: %d.",
+					 function,
+					 record_entry );
+
+					goto on_error;
+				}
+				if( libesedb_record_free(
+				     &record,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record.",
+					 function );
+
+					goto on_error;
+				}
+				result->number_of_operations += 1;
+			}
+			if( libesedb_index_free(
+			     &index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libesedb_table_free(
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( esedb_bench_result_stop(
+	     result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop measurement.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_get_number_of_bytes_read(
+	     file,
+	     &( result->number_of_bytes ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of bytes read.",
+		 function );
+
+		goto on_error;
+	}
+	result->number_of_bytes -= number_of_bytes_read;
+
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( index != NULL )
+	{
+		libesedb_index_free(
+		 &index,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs the workloads on a file and prints the results as a JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_run_file(
+     const system_character_t *filename,
+     int number_of_iterations,
+     int number_of_accesses,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	esedb_bench_result_t results[ 7 ];
+
+	libesedb_file_t *file = NULL;
+	static char *function = "esedb_bench_run_file";
+	int result_index      = 0;
+
+	if( esedb_bench_open(
+	     filename,
+	     number_of_iterations,
+	     &( results[ 0 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run open workload.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_file_open(
+	     &file,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_tables(
+	     file,
+	     &( results[ 1 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run tables workload.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_read_records(
+	     file,
+	     ESEDB_BENCH_WORKLOAD_SCAN,
+	     &( results[ 2 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run scan workload.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_random_access(
+	     file,
+	     number_of_accesses,
+	     &( results[ 3 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run random access workload.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_index_walk(
+	     file,
+	     &( results[ 4 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run index walk workload.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_read_records(
+	     file,
+	     ESEDB_BENCH_WORKLOAD_LONG_VALUES,
+	     &( results[ 5 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run long values workload.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_read_records(
+	     file,
+	     ESEDB_BENCH_WORKLOAD_STRINGS,
+	     &( results[ 6 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run UTF-8 strings workload.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_file_close(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 stream,
+	 "    {\n"
+	 "      \"file\": " );
+
+	esedb_bench_json_string_fprint(
+	 filename,
+	 stream );
+
+	fprintf(
+	 stream,
+	 ",\n"
+	 "      \"workloads\": [\n" );
+
+	for( result_index = 0;
+	     result_index < 7;
+	     result_index++ )
+	{
+		esedb_bench_result_fprint(
+		 &( results[ result_index ] ),
+		 stream,
+		 (uint8_t) ( result_index == 6 ) );
+	}
+	fprintf(
+	 stream,
+	 "      ]\n"
+	 "    }" );
+
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libcerror_error_t *error              = NULL;
+	system_character_t *option_accesses   = NULL;
+	system_character_t *option_iterations = NULL;
+	system_integer_t option               = 0;
+	uint64_t value_64bit                  = 0;
+	size_t string_length                  = 0;
+	int argument_index                    = 0;
+	int number_of_accesses                = ESEDB_BENCH_DEFAULT_NUMBER_OF_RANDOM_ACCESSES;
+	int number_of_files                   = 0;
+	int number_of_iterations              = ESEDB_BENCH_DEFAULT_NUMBER_OF_ITERATIONS;
+	int result                            = 0;
+
+	while( ( option = esedb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hi:n:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				esedb_bench_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				esedb_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_accesses = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file(s).\n" );
+
+		esedb_bench_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_iterations != NULL )
+	{
+		string_length = system_string_length(
+		                 option_iterations );
+
+		if( ( esedbtools_system_string_copy_to_64_bit_in_decimal(
+		       option_iterations,
+		       string_length + 1,
+		       &value_64bit,
+		       &error ) != 1 )
+		 || ( value_64bit == 0 )
+		 || ( value_64bit > (uint64_t) INT32_MAX ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations.\n" );
+
+			goto on_error;
+		}
+		number_of_iterations = (int) value_64bit;
+	}
+	if( option_accesses != NULL )
+	{
+		string_length = system_string_length(
+		                 option_accesses );
+
+		if( ( esedbtools_system_string_copy_to_64_bit_in_decimal(
+		       option_accesses,
+		       string_length + 1,
+		       &value_64bit,
+		       &error ) != 1 )
+		 || ( value_64bit > (uint64_t) INT32_MAX ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of random accesses.\n" );
+
+			goto on_error;
+		}
+		number_of_accesses = (int) value_64bit;
+	}
+	fprintf(
+	 stdout,
+	 "{\n"
+	 "  \"benchmarks\": [\n" );
+
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libesedb_check_file_signature_wide(
+		          argv[ argument_index ],
+		          &error );
+#else
+		result = libesedb_check_file_signature(
+		          argv[ argument_index ],
+		          &error );
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Skipping: %" PRIs_SYSTEM " no ESE database signature found.\n",
+			 argv[ argument_index ] );
+
+			continue;
+		}
+		if( number_of_files > 0 )
+		{
+			fprintf(
+			 stdout,
+			 ",\n" );
+		}
+		if( esedb_bench_run_file(
+		     argv[ argument_index ],
+		     number_of_iterations,
+		     number_of_accesses,
+		     stdout,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
+
+			goto on_error;
+		}
+		number_of_files++;
+	}
+	fprintf(
+	 stdout,
+	 "\n"
+	 "  ]\n"
+	 "}\n" );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,4730 @@
+/*
+ * Synthetic database generator program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_getopt.h"
+#include "esedb_test_libcerror.h"
+
+#include "../esedbtools/esedbtools_system_string.h"
+
+#include "../libesedb/esedb_file_header.h"
+#include "../libesedb/esedb_page.h"
+#include "../libesedb/esedb_page_values.h"
+#include "../libesedb/libesedb_checksum.h"
+#include "../libesedb/libesedb_definitions.h"
+
+#define ESEDB_GENERATE_DEFAULT_COLUMN_MIX		"fixed:4,variable:2,tagged:1,multi:1,long:1,7bit:1,lzxpress:1"
+#define ESEDB_GENERATE_DEFAULT_FORMAT_REVISION		0x14
+#define ESEDB_GENERATE_DEFAULT_LONG_VALUE_SIZE		4096
+#define ESEDB_GENERATE_DEFAULT_NUMBER_OF_RECORDS	1000
+#define ESEDB_GENERATE_DEFAULT_NUMBER_OF_TABLES		1
+#define ESEDB_GENERATE_DEFAULT_PAGE_SIZE		8192
+#define ESEDB_GENERATE_DEFAULT_SEED			1
+
+#define ESEDB_GENERATE_MAXIMUM_NUMBER_OF_COLUMNS	256
+#define ESEDB_GENERATE_MAXIMUM_NUMBER_OF_TREE_LEVELS	16
+#define ESEDB_GENERATE_MAXIMUM_KEY_SIZE			16
+
+/* The database, catalog and backup catalog use fixed page numbers,
+ * the pages of the tables are allocated after the backup catalog
+ */
+#define ESEDB_GENERATE_DATABASE_PAGE_NUMBER		1
+#define ESEDB_GENERATE_CATALOG_PAGE_NUMBER		4
+#define ESEDB_GENERATE_BACKUP_CATALOG_PAGE_NUMBER	24
+#define ESEDB_GENERATE_FIRST_PAGE_NUMBER		25
+
+/* The first object identifier that is available for tables
+ */
+#define ESEDB_GENERATE_FIRST_OBJECT_IDENTIFIER		4
+
+enum ESEDB_GENERATE_COLUMN_KINDS
+{
+	ESEDB_GENERATE_COLUMN_KIND_FIXED		= 0,
+	ESEDB_GENERATE_COLUMN_KIND_VARIABLE		= 1,
+	ESEDB_GENERATE_COLUMN_KIND_TAGGED		= 2,
+	ESEDB_GENERATE_COLUMN_KIND_MULTI_VALUE		= 3,
+	ESEDB_GENERATE_COLUMN_KIND_LONG_VALUE		= 4,
+	ESEDB_GENERATE_COLUMN_KIND_7BIT_COMPRESSED	= 5,
+	ESEDB_GENERATE_COLUMN_KIND_LZXPRESS_COMPRESSED	= 6
+};
+
+#define ESEDB_GENERATE_NUMBER_OF_COLUMN_KINDS		7
+
+/* The names of the column kinds as used in the column mix
+ */
+const char *esedb_generate_column_kind_names[ ESEDB_GENERATE_NUMBER_OF_COLUMN_KINDS ] = {
+	"fixed",
+	"variable",
+	"tagged",
+	"multi",
+	"long",
+	"7bit",
+	"lzxpress" };
+
+/* The column types and sizes of the fixed size columns after the identifier and sequence columns
+ */
+const uint32_t esedb_generate_fixed_column_types[ 11 ] = {
+	LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED,
+	LIBESEDB_COLUMN_TYPE_DATE_TIME,
+	LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT,
+	LIBESEDB_COLUMN_TYPE_BOOLEAN,
+	LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED,
+	LIBESEDB_COLUMN_TYPE_GUID,
+	LIBESEDB_COLUMN_TYPE_CURRENCY,
+	LIBESEDB_COLUMN_TYPE_FLOAT_32BIT,
+	LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED,
+	LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED };
+
+const uint32_t esedb_generate_fixed_column_sizes[ 11 ] = {
+	8, 8, 8, 1, 2, 16, 8, 4, 1, 4, 2 };
+
+/* The words used to generate text values
+ */
+const char *esedb_generate_words[ 16 ] = {
+	"alfa", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel",
+	"india", "juliett", "kilo", "lima", "mike", "november", "oscar", "papa" };
+
+typedef struct esedb_generate_column esedb_generate_column_t;
+
+struct esedb_generate_column
+{
+	/* The column identifier
+	 */
+	uint32_t identifier;
+
+	/* The column type
+	 */
+	uint32_t column_type;
+
+	/* The column kind
+	 */
+	int kind;
+
+	/* The (maximum) size of the column data
+	 */
+	uint32_t size;
+
+	/* The codepage
+	 */
+	uint32_t codepage;
+
+	/* The column flags
+	 */
+	uint32_t flags;
+
+	/* The index of the column within the long value columns
+	 */
+	int long_value_index;
+
+	/* The column name
+	 */
+	char name[ 32 ];
+};
+
+typedef struct esedb_generate_tree_level esedb_generate_tree_level_t;
+
+struct esedb_generate_tree_level
+{
+	/* The values data of the current page
+	 */
+	uint8_t *values_data;
+
+	/* The values data size of the current page
+	 */
+	size_t values_data_size;
+
+	/* The sizes of the values of the current page
+	 */
+	uint16_t *value_sizes;
+
+	/* The number of values of the current page
+	 */
+	int number_of_values;
+
+	/* The page number of the current page or 0 if not yet allocated
+	 */
+	uint32_t page_number;
+
+	/* The page number of the previous page on the same level
+	 */
+	uint32_t previous_page_number;
+};
+
+typedef struct esedb_generate_tree esedb_generate_tree_t;
+
+struct esedb_generate_tree
+{
+	/* The object identifier of the tree
+	 */
+	uint32_t object_identifier;
+
+	/* The father data page number of the tree
+	 */
+	uint32_t parent_page_number;
+
+	/* The page flags specific to the tree
+	 */
+	uint32_t page_flags;
+
+	/* The maximum number of values per page or 0 if only limited by the page size
+	 */
+	int maximum_number_of_values;
+
+	/* The levels, where level 0 contains the leaf pages
+	 */
+	esedb_generate_tree_level_t levels[ ESEDB_GENERATE_MAXIMUM_NUMBER_OF_TREE_LEVELS ];
+
+	/* The number of levels
+	 */
+	int number_of_levels;
+
+	/* The root page number, if 0 the root page number is allocated when the tree is finalized
+	 */
+	uint32_t root_page_number;
+
+	/* The number of leaf pages
+	 */
+	uint32_t number_of_leaf_pages;
+
+	/* The number of pages
+	 */
+	uint32_t number_of_pages;
+};
+
+typedef struct esedb_generate_table esedb_generate_table_t;
+
+struct esedb_generate_table
+{
+	/* The object identifier
+	 */
+	uint32_t object_identifier;
+
+	/* The root page number of the data tree
+	 */
+	uint32_t root_page_number;
+
+	/* The object identifier of the long values tree
+	 */
+	uint32_t long_value_object_identifier;
+
+	/* The root page number of the long values tree
+	 */
+	uint32_t long_value_root_page_number;
+
+	/* The object identifier of the index tree
+	 */
+	uint32_t index_object_identifier;
+
+	/* The root page number of the index tree
+	 */
+	uint32_t index_root_page_number;
+
+	/* The table name
+	 */
+	char name[ 32 ];
+};
+
+typedef struct esedb_generate esedb_generate_t;
+
+struct esedb_generate
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The format revision
+	 */
+	uint32_t format_revision;
+
+	/* The page size
+	 */
+	uint32_t page_size;
+
+	/* The page header size
+	 */
+	size_t page_header_size;
+
+	/* Value to indicate the pages have an extended page header
+	 */
+	uint8_t has_extended_page_header;
+
+	/* The page data
+	 */
+	uint8_t *page_data;
+
+	/* The record data
+	 */
+	uint8_t *record_data;
+
+	/* The value data
+	 */
+	uint8_t *value_data;
+
+	/* The text data
+	 */
+	uint8_t *text_data;
+
+	/* The last allocated page number
+	 */
+	uint32_t last_page_number;
+
+	/* The last allocated object identifier
+	 */
+	uint32_t last_object_identifier;
+
+	/* The seed of the pseudo random number generator
+	 */
+	uint64_t seed;
+
+	/* The columns of the tables
+	 */
+	esedb_generate_column_t columns[ ESEDB_GENERATE_MAXIMUM_NUMBER_OF_COLUMNS ];
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The number of fixed size columns
+	 */
+	int number_of_fixed_size_columns;
+
+	/* The number of variable size columns
+	 */
+	int number_of_variable_size_columns;
+
+	/* The number of long value columns
+	 */
+	int number_of_long_value_columns;
+
+	/* The number of records per table
+	 */
+	int number_of_records;
+
+	/* The number of deleted records per table
+	 */
+	int number_of_deleted_records;
+
+	/* The number of tables
+	 */
+	int number_of_tables;
+
+	/* The size of a long value
+	 */
+	uint32_t long_value_size;
+
+	/* The size of a long value segment
+	 */
+	uint32_t long_value_segment_size;
+
+	/* The depth of the data trees or 0 if only limited by the page size
+	 */
+	int data_tree_depth;
+
+	/* The maximum number of values per data tree page
+	 */
+	int maximum_number_of_values;
+
+	/* The step between the values of the sequence column
+	 */
+	uint64_t sequence_step;
+
+	/* The multiplicative inverse of the sequence step
+	 */
+	uint64_t sequence_inverse;
+
+	/* The deepest data tree
+	 */
+	int maximum_data_tree_depth;
+
+	/* The largest number of leaf pages of a tree
+	 */
+	uint32_t maximum_number_of_leaf_pages;
+};
+
+/* Prints usage information
+ */
+void esedb_generate_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf(
+	 stream,
+	 "Use esedb_generate to create a synthetic Extensible Storage Engine (ESE)\n"
+	 "Database File for scale and benchmark testing.\n\n" );
+
+	fprintf(
+	 stream,
+	 "Usage: esedb_generate [ -c mix ] [ -d depth ] [ -l size ] [ -n records ]\n"
+	 "                      [ -p page_size ] [ -r revision ] [ -s seed ]\n"
+	 "                      [ -t tables ] [ -x deleted ] [ -h ] target\n\n" );
+
+	fprintf(
+	 stream,
+	 "\ttarget: the target file, which is overwritten if it exists\n\n" );
+
+	fprintf(
+	 stream,
+	 "\t-c:     column mix of every table as a comma separated list of kind:count\n"
+	 "\t        where kind is: fixed, variable, tagged, multi, long, 7bit or lzxpress\n"
+	 "\t        the default is: %s\n",
+	 ESEDB_GENERATE_DEFAULT_COLUMN_MIX );
+
+	fprintf(
+	 stream,
+	 "\t-d:     depth of the table data trees, the default is limited by the page size\n" );
+
+	fprintf(
+	 stream,
+	 "\t-h:     shows this help\n" );
+
+	fprintf(
+	 stream,
+	 "\t-l:     size of a long value, the default is: %d\n",
+	 ESEDB_GENERATE_DEFAULT_LONG_VALUE_SIZE );
+
+	fprintf(
+	 stream,
+	 "\t-n:     number of records per table, the default is: %d\n",
+	 ESEDB_GENERATE_DEFAULT_NUMBER_OF_RECORDS );
+
+	fprintf(
+	 stream,
+	 "\t-p:     page size, the default is: %d\n",
+	 ESEDB_GENERATE_DEFAULT_PAGE_SIZE );
+
+	fprintf(
+	 stream,
+	 "\t-r:     format revision, the default is: %d\n",
+	 ESEDB_GENERATE_DEFAULT_FORMAT_REVISION );
+
+	fprintf(
+	 stream,
+	 "\t-s:     seed of the pseudo random values, the default is: %d\n",
+	 ESEDB_GENERATE_DEFAULT_SEED );
+
+	fprintf(
+	 stream,
+	 "\t-t:     number of tables, the default is: %d\n",
+	 ESEDB_GENERATE_DEFAULT_NUMBER_OF_TABLES );
+
+	fprintf(
+	 stream,
+	 "\t-x:     number of deleted records per table, which are stored as defunct\n"
+	 "\t        values where every second deleted record is truncated, at most\n"
+	 "\t        the number of records, the default is: 0\n" );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "The same options and seed always generate the same file.\n" );
+}
+
+/* Initializes the pseudo random number generator state of a value
+ * Every value has its own state so that values can be generated in any order
+ * Returns the pseudo random number generator state
+ */
+uint64_t esedb_generate_random_initialize(
+          uint64_t seed,
+          int table_index,
+          int record_index,
+          int column_index )
+{
+	uint64_t random_state = 0;
+
+	random_state = seed
+	             ^ ( (uint64_t) table_index << 48 )
+	             ^ ( (uint64_t) record_index << 12 )
+	             ^ (uint64_t) column_index;
+
+	random_state += 0x9e3779b97f4a7c15UL;
+	random_state  = ( random_state ^ ( random_state >> 30 ) ) * 0xbf58476d1ce4e5b9UL;
+	random_state  = ( random_state ^ ( random_state >> 27 ) ) * 0x94d049bb133111ebUL;
+	random_state ^= random_state >> 31;
+
+	if( random_state == 0 )
+	{
+		random_state = 0x2545f4914f6cdd1dUL;
+	}
+	return( random_state );
+}
+
+/* Retrieves a pseudo random value
+ * Returns the pseudo random value
+ */
+uint32_t esedb_generate_random_get_value(
+          uint64_t *random_state )
+{
+	*random_state ^= *random_state >> 12;
+	*random_state ^= *random_state << 25;
+	*random_state ^= *random_state >> 27;
+
+	return( (uint32_t) ( ( *random_state * 0x2545f4914f6cdd1dUL ) >> 32 ) );
+}
+
+/* Copies pseudo random text
+ */
+void esedb_generate_copy_text(
+      uint8_t *data,
+      size_t data_size,
+      uint64_t *random_state )
+{
+	const char *word   = NULL;
+	size_t data_offset = 0;
+
+	while( data_offset < data_size )
+	{
+		if( data_offset > 0 )
+		{
+			data[ data_offset++ ] = (uint8_t) ' ';
+		}
+		word = esedb_generate_words[ esedb_generate_random_get_value( random_state ) % 16 ];
+
+		while( ( *word != 0 )
+		    && ( data_offset < data_size ) )
+		{
+			data[ data_offset++ ] = (uint8_t) *word++;
+		}
+	}
+}
+
+/* Copies a normalized 32-bit signed integer key
+ */
+void esedb_generate_copy_integer_key(
+      uint8_t *key,
+      uint32_t value )
+{
+	key[ 0 ] = 0x7f;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( key[ 1 ] ),
+	 value ^ 0x80000000UL );
+}
+
+/* Compresses data using 7-bit compression
+ * The decompressed size is determined from the compressed size, hence the number of
+ * characters should not be 7 more than a multiple of 8
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_compress_7bit(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "esedb_generate_compress_7bit";
+	size_t compressed_data_offset  = 0;
+	size_t required_data_size      = 0;
+	size_t uncompressed_data_index = 0;
+	uint32_t value_32bit           = 0;
+	uint8_t bit_index              = 0;
+	uint8_t number_of_bits         = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( ( uncompressed_data_size % 8 ) == 7 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	required_data_size = 1 + ( ( uncompressed_data_size * 7 ) + 7 ) / 8;
+
+	if( *compressed_data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The lower 3 bits of the leading byte contain the number of bits used in the last byte minus 1
+	 */
+	number_of_bits = (uint8_t) ( ( uncompressed_data_size * 7 ) % 8 );
+
+	if( number_of_bits == 0 )
+	{
+		number_of_bits = 8;
+	}
+	compressed_data[ compressed_data_offset++ ] = 0x10 | ( number_of_bits - 1 );
+
+	for( uncompressed_data_index = 0;
+	     uncompressed_data_index < uncompressed_data_size;
+	     uncompressed_data_index++ )
+	{
+		value_32bit |= (uint32_t) ( uncompressed_data[ uncompressed_data_index ] & 0x7f ) << bit_index;
+		bit_index   += 7;
+
+		while( bit_index >= 8 )
+		{
+			compressed_data[ compressed_data_offset++ ] = (uint8_t) ( value_32bit & 0xff );
+
+			value_32bit >>= 8;
+			bit_index    -= 8;
+		}
+	}
+	if( bit_index > 0 )
+	{
+		compressed_data[ compressed_data_offset++ ] = (uint8_t) ( value_32bit & 0xff );
+	}
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Compresses data using LZXPRESS (plain LZ77) compression
+ * Only matches of 3 to 9 bytes are used, which do not require an extended length
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_compress_lzxpress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	uint32_t match_offsets[ 4096 ];
+
+	static char *function          = "esedb_generate_compress_lzxpress";
+	size_t compressed_data_offset  = 0;
+	size_t indicator_offset        = 0;
+	size_t match_offset            = 0;
+	size_t match_size              = 0;
+	size_t maximum_match_size      = 0;
+	size_t required_data_size      = 0;
+	size_t uncompressed_data_index = 0;
+	uint32_t hash_value            = 0;
+	uint32_t indicator_value       = 0;
+	uint8_t indicator_bit_index    = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The worst case is a literal for every byte and an indicator for every 32 literals
+	 */
+	required_data_size = 3 + uncompressed_data_size + ( 4 * ( ( uncompressed_data_size / 32 ) + 1 ) );
+
+	if( *compressed_data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     match_offsets,
+	     0,
+	     sizeof( uint32_t ) * 4096 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear match offsets.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data[ 0 ] = 0x18;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( compressed_data[ 1 ] ),
+	 (uint16_t) uncompressed_data_size );
+
+	indicator_offset       = 3;
+	compressed_data_offset = 7;
+
+	while( uncompressed_data_index < uncompressed_data_size )
+	{
+		if( indicator_bit_index == 32 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( compressed_data[ indicator_offset ] ),
+			 indicator_value );
+
+			indicator_offset        = compressed_data_offset;
+			compressed_data_offset += 4;
+			indicator_value         = 0;
+			indicator_bit_index     = 0;
+		}
+		match_size = 0;
+
+		if( ( uncompressed_data_index + 3 ) <= uncompressed_data_size )
+		{
+			hash_value = ( (uint32_t) uncompressed_data[ uncompressed_data_index ] << 16 )
+			           | ( (uint32_t) uncompressed_data[ uncompressed_data_index + 1 ] << 8 )
+			           | (uint32_t) uncompressed_data[ uncompressed_data_index + 2 ];
+			hash_value = ( ( hash_value * 2654435761UL ) >> 20 ) & 0x0fff;
+
+			/* The match offsets are stored + 1 so that 0 represents no match
+			 */
+			if( match_offsets[ hash_value ] != 0 )
+			{
+				match_offset = uncompressed_data_index - ( match_offsets[ hash_value ] - 1 );
+
+				if( match_offset <= 8192 )
+				{
+					maximum_match_size = uncompressed_data_size - uncompressed_data_index;
+
+					if( maximum_match_size > 9 )
+					{
+						maximum_match_size = 9;
+					}
+					while( ( match_size < maximum_match_size )
+					    && ( uncompressed_data[ uncompressed_data_index + match_size ] == uncompressed_data[ uncompressed_data_index + match_size - match_offset ] ) )
+					{
+						match_size++;
+					}
+				}
+			}
+			match_offsets[ hash_value ] = (uint32_t) uncompressed_data_index + 1;
+		}
+		if( match_size >= 3 )
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 (uint16_t) ( ( ( match_offset - 1 ) << 3 ) | ( match_size - 3 ) ) );
+
+			compressed_data_offset  += 2;
+			uncompressed_data_index += match_size;
+			indicator_value         |= (uint32_t) 1 << ( 31 - indicator_bit_index );
+		}
+		else
+		{
+			compressed_data[ compressed_data_offset++ ] = uncompressed_data[ uncompressed_data_index++ ];
+		}
+		indicator_bit_index++;
+	}
+	/* The unused bits of the last indicator are set
+	 */
+	if( indicator_bit_index < 32 )
+	{
+		indicator_value |= ( (uint32_t) 1 << ( 32 - indicator_bit_index ) ) - 1;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ indicator_offset ] ),
+	 indicator_value );
+
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Allocates a page number
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_allocate_page_number(
+     esedb_generate_t *generate,
+     uint32_t *page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_generate_allocate_page_number";
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page number.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate->last_page_number >= (uint32_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid last page number value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	generate->last_page_number += 1;
+
+	*page_number = generate->last_page_number;
+
+	return( 1 );
+}
+
+/* Writes a page
+ * The values data contains the values without the page tag 0 value
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_write_page(
+     esedb_generate_t *generate,
+     uint32_t page_number,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     uint32_t object_identifier,
+     uint32_t parent_page_number,
+     uint32_t page_flags,
+     const uint8_t *values_data,
+     size_t values_data_size,
+     const uint16_t *value_sizes,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	uint8_t *page_tags_data   = NULL;
+	uint8_t *page_values_data = NULL;
+	static char *function     = "esedb_generate_write_page";
+	size_t page_tag_offset    = 0;
+	size_t page_tag_size      = 0;
+	size_t page_values_size   = 0;
+	ssize_t write_count       = 0;
+	uint32_t ecc32_checksum   = 0;
+	uint32_t xor32_checksum   = 0;
+	uint16_t page_tag_flags   = 0;
+	int value_index           = 0;
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( values_data == NULL )
+	 && ( values_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_sizes == NULL )
+	 && ( number_of_values > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+	{
+		page_tag_size = sizeof( esedb_root_page_header_t );
+	}
+	page_values_size = page_tag_size + values_data_size;
+
+	if( ( generate->page_header_size + page_values_size + ( 4 * ( (size_t) number_of_values + 1 ) ) ) > (size_t) generate->page_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid values data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     generate->page_data,
+	     0,
+	     (size_t) generate->page_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate->format_revision >= LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
+	{
+		page_flags |= LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT;
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_page_header_t *) generate->page_data )->database_modification_time,
+	 (uint64_t) 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) generate->page_data )->previous_page,
+	 previous_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) generate->page_data )->next_page,
+	 next_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) generate->page_data )->father_data_page_object_identifier,
+	 object_identifier );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_page_header_t *) generate->page_data )->available_data_size,
+	 (uint16_t) ( generate->page_size - generate->page_header_size - page_values_size - ( 4 * ( (size_t) number_of_values + 1 ) ) ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_page_header_t *) generate->page_data )->available_data_offset,
+	 (uint16_t) page_values_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_page_header_t *) generate->page_data )->available_page_tag,
+	 (uint16_t) ( number_of_values + 1 ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) generate->page_data )->page_flags,
+	 page_flags );
+
+	if( generate->has_extended_page_header != 0 )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (esedb_extended_page_header_t *) &( generate->page_data[ sizeof( esedb_page_header_t ) ] ) )->page_number,
+		 (uint64_t) page_number );
+	}
+	page_values_data = &( generate->page_data[ generate->page_header_size ] );
+
+	/* Page tag 0 contains the root page header or the (empty) common key
+	 */
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_root_page_header_t *) page_values_data )->initial_number_of_pages,
+		 1 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_root_page_header_t *) page_values_data )->parent_father_data_page_number,
+		 parent_page_number );
+	}
+	if( values_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( page_values_data[ page_tag_size ] ),
+		     values_data,
+		     values_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy values data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The page tags are stored at the end of the page in reverse order
+	 */
+	page_tags_data = &( generate->page_data[ generate->page_size - 4 ] );
+
+	for( value_index = 0;
+	     value_index <= number_of_values;
+	     value_index++ )
+	{
+		page_tag_flags = 0;
+
+		/* The page tag flags of a value are stored in the upper 3 bits of its key size,
+		 * which pages without an extended page header store in the page tag instead
+		 */
+		if( ( value_index > 0 )
+		 && ( generate->has_extended_page_header == 0 ) )
+		{
+			page_tag_flags = (uint16_t) ( page_values_data[ page_tag_offset + 1 ] >> 5 );
+
+			page_values_data[ page_tag_offset + 1 ] &= 0x1f;
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_tags_data[ 0 ] ),
+		 (uint16_t) page_tag_size );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page_tags_data[ 2 ] ),
+		 (uint16_t) page_tag_offset | ( page_tag_flags << 13 ) );
+
+		page_tags_data  -= 4;
+		page_tag_offset += page_tag_size;
+
+		if( value_index < number_of_values )
+		{
+			page_tag_size = (size_t) value_sizes[ value_index ];
+		}
+	}
+	/* The checksums of pages with an extended page header are not validated
+	 */
+	if( generate->has_extended_page_header == 0 )
+	{
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 )
+		{
+			if( libesedb_checksum_calculate_little_endian_ecc32(
+			     &ecc32_checksum,
+			     &xor32_checksum,
+			     generate->page_data,
+			     (size_t) generate->page_size,
+			     8,
+			     page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unable to calculate ECC-32 and XOR-32 checksum.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (esedb_page_header_t *) generate->page_data )->ecc_checksum,
+			 ecc32_checksum );
+		}
+		else
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (esedb_page_header_t *) generate->page_data )->page_number,
+			 page_number );
+
+			if( libesedb_checksum_calculate_little_endian_xor32(
+			     &xor32_checksum,
+			     &( generate->page_data[ 4 ] ),
+			     (size_t) generate->page_size - 4,
+			     0x89abcdef,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unable to calculate XOR-32 checksum.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_page_header_t *) generate->page_data )->xor_checksum,
+		 xor32_checksum );
+	}
+	if( file_stream_seek_offset(
+	     generate->stream,
+	     (off64_t) ( page_number + 1 ) * generate->page_size,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               generate->stream,
+	               generate->page_data,
+	               (size_t) generate->page_size );
+
+	if( write_count != (ssize_t) generate->page_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Initializes a tree
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_tree_initialize(
+     esedb_generate_tree_t *tree,
+     uint32_t object_identifier,
+     uint32_t parent_page_number,
+     uint32_t page_flags,
+     uint32_t root_page_number,
+     int maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_generate_tree_initialize";
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     tree,
+	     0,
+	     sizeof( esedb_generate_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tree.",
+		 function );
+
+		return( -1 );
+	}
+	tree->object_identifier        = object_identifier;
+	tree->parent_page_number       = parent_page_number;
+	tree->page_flags               = page_flags;
+	tree->root_page_number         = root_page_number;
+	tree->maximum_number_of_values = maximum_number_of_values;
+
+	return( 1 );
+}
+
+/* Frees the levels of a tree
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_tree_free(
+     esedb_generate_tree_t *tree,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_generate_tree_free";
+	int level_index       = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	for( level_index = 0;
+	     level_index < tree->number_of_levels;
+	     level_index++ )
+	{
+		if( tree->levels[ level_index ].value_sizes != NULL )
+		{
+			memory_free(
+			 tree->levels[ level_index ].value_sizes );
+
+			tree->levels[ level_index ].value_sizes = NULL;
+		}
+		if( tree->levels[ level_index ].values_data != NULL )
+		{
+			memory_free(
+			 tree->levels[ level_index ].values_data );
+
+			tree->levels[ level_index ].values_data = NULL;
+		}
+	}
+	tree->number_of_levels = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a specific level of a tree, the level is created if needed
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_tree_get_level(
+     esedb_generate_t *generate,
+     esedb_generate_tree_t *tree,
+     int level_index,
+     esedb_generate_tree_level_t **level,
+     libcerror_error_t **error )
+{
+	esedb_generate_tree_level_t *tree_level = NULL;
+	static char *function                   = "esedb_generate_tree_get_level";
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( level_index < 0 )
+	 || ( level_index > tree->number_of_levels )
+	 || ( level_index >= ESEDB_GENERATE_MAXIMUM_NUMBER_OF_TREE_LEVELS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid level index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid level.",
+		 function );
+
+		return( -1 );
+	}
+	tree_level = &( tree->levels[ level_index ] );
+
+	if( level_index == tree->number_of_levels )
+	{
+		tree_level->values_data = (uint8_t *) memory_allocate(
+		                                       sizeof( uint8_t ) * generate->page_size );
+
+		if( tree_level->values_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create values data.",
+			 function );
+
+			return( -1 );
+		}
+		/* Every value requires at least a page tag and a key size
+		 */
+		tree_level->value_sizes = (uint16_t *) memory_allocate(
+		                                        sizeof( uint16_t ) * ( generate->page_size / 6 ) );
+
+		if( tree_level->value_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value sizes.",
+			 function );
+
+			memory_free(
+			 tree_level->values_data );
+
+			tree_level->values_data = NULL;
+
+			return( -1 );
+		}
+		tree_level->values_data_size     = 0;
+		tree_level->number_of_values     = 0;
+		tree_level->page_number          = 0;
+		tree_level->previous_page_number = 0;
+
+		tree->number_of_levels += 1;
+	}
+	*level = tree_level;
+
+	return( 1 );
+}
+
+/* Writes the current page of a tree level
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_tree_write_level_page(
+     esedb_generate_t *generate,
+     esedb_generate_tree_t *tree,
+     int level_index,
+     uint32_t page_number,
+     uint32_t next_page_number,
+     uint32_t page_flags,
+     libcerror_error_t **error )
+{
+	esedb_generate_tree_level_t *level = NULL;
+	static char *function              = "esedb_generate_tree_write_level_page";
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	level = &( tree->levels[ level_index ] );
+
+	if( level_index == 0 )
+	{
+		page_flags |= LIBESEDB_PAGE_FLAG_IS_LEAF;
+	}
+	else
+	{
+		page_flags |= LIBESEDB_PAGE_FLAG_IS_PARENT;
+	}
+	/* Only the leaf pages are linked to their siblings
+	 */
+	if( esedb_generate_write_page(
+	     generate,
+	     page_number,
+	     ( level_index == 0 ) ? level->previous_page_number : 0,
+	     ( level_index == 0 ) ? next_page_number : 0,
+	     tree->object_identifier,
+	     tree->parent_page_number,
+	     page_flags | tree->page_flags,
+	     level->values_data,
+	     level->values_data_size,
+	     level->value_sizes,
+	     level->number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	if( level_index == 0 )
+	{
+		tree->number_of_leaf_pages += 1;
+	}
+	tree->number_of_pages += 1;
+
+	level->values_data_size     = 0;
+	level->number_of_values     = 0;
+	level->previous_page_number = page_number;
+	level->page_number          = next_page_number;
+
+	return( 1 );
+}
+
+/* Appends a value to a specific level of a tree
+ * The values must be appended in key order
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_tree_append_value(
+     esedb_generate_t *generate,
+     esedb_generate_tree_t *tree,
+     int level_index,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t page_tag_flags,
+     libcerror_error_t **error )
+{
+	uint8_t child_page_number_data[ 4 ];
+	uint8_t separator_key[ ESEDB_GENERATE_MAXIMUM_KEY_SIZE ];
+
+	esedb_generate_tree_level_t *level = NULL;
+	uint8_t *value_data                = NULL;
+	static char *function              = "esedb_generate_tree_append_value";
+	size_t required_size               = 0;
+	size_t separator_key_size          = 0;
+	size_t value_size                  = 0;
+	uint32_t next_page_number          = 0;
+	uint32_t page_number               = 0;
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key == NULL )
+	 && ( key_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size > ESEDB_GENERATE_MAXIMUM_KEY_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_generate_tree_get_level(
+	     generate,
+	     tree,
+	     level_index,
+	     &level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve tree level: %d.",
+		 function,
+		 level_index );
+
+		return( -1 );
+	}
+	/* A value is stored as: key size, key and data
+	 * and space is reserved for a root page header, page tag 0 and the page tag of the value
+	 */
+	value_size    = 2 + key_size + data_size;
+	required_size = generate->page_header_size + sizeof( esedb_root_page_header_t ) + value_size + 8;
+
+	if( required_size > (size_t) generate->page_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
+		 "%s: value of %" PRIzd " bytes too large for page size: %" PRIu32 ".",
+		 function,
+		 value_size,
+		 generate->page_size );
+
+		return( -1 );
+	}
+	required_size += level->values_data_size + ( 4 * (size_t) level->number_of_values );
+
+	if( ( level->number_of_values > 0 )
+	 && ( ( required_size > (size_t) generate->page_size )
+	  ||  ( ( tree->maximum_number_of_values > 0 )
+	   &&   ( level->number_of_values >= tree->maximum_number_of_values ) ) ) )
+	{
+		/* The key of the parent value is the first key of the next page
+		 */
+		if( level_index == 0 )
+		{
+			if( key_size > 0 )
+			{
+				if( memory_copy(
+				     separator_key,
+				     key,
+				     key_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy separator key.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			separator_key_size = key_size;
+
+			if( level->page_number == 0 )
+			{
+				if( esedb_generate_allocate_page_number(
+				     generate,
+				     &( level->page_number ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to allocate page number.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( esedb_generate_allocate_page_number(
+			     generate,
+			     &next_page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to allocate next page number.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			/* The key of the last value of a branch page is the first key of the next page
+			 */
+			value_data = &( level->values_data[ level->values_data_size - level->value_sizes[ level->number_of_values - 1 ] ] );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 value_data,
+			 separator_key_size );
+
+			if( memory_copy(
+			     separator_key,
+			     &( value_data[ 2 ] ),
+			     separator_key_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy separator key.",
+				 function );
+
+				return( -1 );
+			}
+			if( esedb_generate_allocate_page_number(
+			     generate,
+			     &( level->page_number ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to allocate page number.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		page_number = level->page_number;
+
+		if( esedb_generate_tree_write_level_page(
+		     generate,
+		     tree,
+		     level_index,
+		     page_number,
+		     next_page_number,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write level: %d page.",
+			 function,
+			 level_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 child_page_number_data,
+		 page_number );
+
+		if( esedb_generate_tree_append_value(
+		     generate,
+		     tree,
+		     level_index + 1,
+		     separator_key,
+		     separator_key_size,
+		     child_page_number_data,
+		     4,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value to level: %d.",
+			 function,
+			 level_index + 1 );
+
+			return( -1 );
+		}
+	}
+	value_data = &( level->values_data[ level->values_data_size ] );
+
+	/* The page tag flags are stored in the upper 3 bits of the key size
+	 */
+	byte_stream_copy_from_uint16_little_endian(
+	 value_data,
+	 (uint16_t) key_size | ( (uint16_t) page_tag_flags << 13 ) );
+
+	if( key_size > 0 )
+	{
+		if( memory_copy(
+		     &( value_data[ 2 ] ),
+		     key,
+		     key_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( value_data[ 2 + key_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	level->value_sizes[ level->number_of_values ] = (uint16_t) value_size;
+
+	level->values_data_size += value_size;
+	level->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Finalizes a tree
+ * The last page of every level is written and the top level page becomes the root page
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_tree_finalize(
+     esedb_generate_t *generate,
+     esedb_generate_tree_t *tree,
+     libcerror_error_t **error )
+{
+	uint8_t child_page_number_data[ 4 ];
+
+	esedb_generate_tree_level_t *level = NULL;
+	static char *function              = "esedb_generate_tree_finalize";
+	uint32_t page_flags                = 0;
+	uint32_t page_number               = 0;
+	int level_index                    = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty tree consists of an empty root leaf page
+	 */
+	if( tree->number_of_levels == 0 )
+	{
+		if( esedb_generate_tree_get_level(
+		     generate,
+		     tree,
+		     0,
+		     &level,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve tree level: 0.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The number of levels can increase while the last pages are written
+	 */
+	for( level_index = 0;
+	     level_index < tree->number_of_levels;
+	     level_index++ )
+	{
+		level = &( tree->levels[ level_index ] );
+
+		if( ( level_index + 1 ) == tree->number_of_levels )
+		{
+			if( tree->root_page_number == 0 )
+			{
+				if( esedb_generate_allocate_page_number(
+				     generate,
+				     &( tree->root_page_number ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to allocate root page number.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			page_number = tree->root_page_number;
+			page_flags  = LIBESEDB_PAGE_FLAG_IS_ROOT;
+		}
+		else
+		{
+			if( level->page_number == 0 )
+			{
+				if( esedb_generate_allocate_page_number(
+				     generate,
+				     &( level->page_number ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to allocate page number.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			page_number = level->page_number;
+			page_flags  = 0;
+		}
+		if( esedb_generate_tree_write_level_page(
+		     generate,
+		     tree,
+		     level_index,
+		     page_number,
+		     0,
+		     page_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write level: %d page.",
+			 function,
+			 level_index );
+
+			return( -1 );
+		}
+		if( page_flags == 0 )
+		{
+			/* The last value of a level has an empty key since it has no upper bound
+			 */
+			byte_stream_copy_from_uint32_little_endian(
+			 child_page_number_data,
+			 page_number );
+
+			if( esedb_generate_tree_append_value(
+			     generate,
+			     tree,
+			     level_index + 1,
+			     NULL,
+			     0,
+			     child_page_number_data,
+			     4,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value to level: %d.",
+				 function,
+				 level_index + 1 );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Parses the column mix and sets the columns
+ * The column mix is a comma separated list of kind:count, such as: "fixed:4,tagged:1"
+ * Returns 1 if successful, 0 if the column mix is not supported or -1 on error
+ */
+int esedb_generate_parse_column_mix(
+     esedb_generate_t *generate,
+     const system_character_t *column_mix,
+     libcerror_error_t **error )
+{
+	int number_of_columns_per_kind[ ESEDB_GENERATE_NUMBER_OF_COLUMN_KINDS ];
+
+	esedb_generate_column_t *column = NULL;
+	const char *kind_name           = NULL;
+	static char *function           = "esedb_generate_parse_column_mix";
+	size_t kind_name_length         = 0;
+	size_t name_index               = 0;
+	size_t name_length              = 0;
+	size_t name_start               = 0;
+	size_t string_index             = 0;
+	size_t string_length            = 0;
+	size_t value_start              = 0;
+	uint64_t value_64bit            = 0;
+	int column_index                = 0;
+	int kind                        = 0;
+	int kind_column_index           = 0;
+	int number_of_columns           = 0;
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_mix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column mix.",
+		 function );
+
+		return( -1 );
+	}
+	for( kind = 0;
+	     kind < ESEDB_GENERATE_NUMBER_OF_COLUMN_KINDS;
+	     kind++ )
+	{
+		number_of_columns_per_kind[ kind ] = 0;
+	}
+	string_length = system_string_length(
+	                 column_mix );
+
+	while( string_index < string_length )
+	{
+		name_start = string_index;
+
+		while( ( string_index < string_length )
+		    && ( column_mix[ string_index ] != (system_character_t) ':' ) )
+		{
+			string_index++;
+		}
+		if( string_index >= string_length )
+		{
+			return( 0 );
+		}
+		name_length = string_index - name_start;
+
+		string_index++;
+
+		value_start = string_index;
+
+		while( ( string_index < string_length )
+		    && ( column_mix[ string_index ] != (system_character_t) ',' ) )
+		{
+			string_index++;
+		}
+		if( string_index == value_start )
+		{
+			return( 0 );
+		}
+		for( kind = 0;
+		     kind < ESEDB_GENERATE_NUMBER_OF_COLUMN_KINDS;
+		     kind++ )
+		{
+			kind_name        = esedb_generate_column_kind_names[ kind ];
+			kind_name_length = narrow_string_length(
+			                    kind_name );
+
+			if( kind_name_length != name_length )
+			{
+				continue;
+			}
+			for( name_index = 0;
+			     name_index < name_length;
+			     name_index++ )
+			{
+				if( column_mix[ name_start + name_index ] != (system_character_t) kind_name[ name_index ] )
+				{
+					break;
+				}
+			}
+			if( name_index == name_length )
+			{
+				break;
+			}
+		}
+		if( kind >= ESEDB_GENERATE_NUMBER_OF_COLUMN_KINDS )
+		{
+			return( 0 );
+		}
+		if( esedbtools_system_string_copy_to_64_bit_in_decimal(
+		     &( column_mix[ value_start ] ),
+		     string_index - value_start,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			return( 0 );
+		}
+		if( value_64bit > (uint64_t) ESEDB_GENERATE_MAXIMUM_NUMBER_OF_COLUMNS )
+		{
+			return( 0 );
+		}
+		number_of_columns_per_kind[ kind ] += (int) value_64bit;
+		number_of_columns                  += (int) value_64bit;
+
+		/* Skip the separator
+		 */
+		string_index++;
+	}
+	/* The fixed size columns use identifiers 1 to 127 and the variable size columns 128 to 255
+	 */
+	if( ( number_of_columns == 0 )
+	 || ( number_of_columns > ESEDB_GENERATE_MAXIMUM_NUMBER_OF_COLUMNS )
+	 || ( number_of_columns_per_kind[ ESEDB_GENERATE_COLUMN_KIND_FIXED ] > 127 )
+	 || ( number_of_columns_per_kind[ ESEDB_GENERATE_COLUMN_KIND_VARIABLE ] > 128 ) )
+	{
+		return( 0 );
+	}
+	generate->number_of_columns               = 0;
+	generate->number_of_fixed_size_columns    = number_of_columns_per_kind[ ESEDB_GENERATE_COLUMN_KIND_FIXED ];
+	generate->number_of_variable_size_columns = number_of_columns_per_kind[ ESEDB_GENERATE_COLUMN_KIND_VARIABLE ];
+	generate->number_of_long_value_columns    = number_of_columns_per_kind[ ESEDB_GENERATE_COLUMN_KIND_LONG_VALUE ];
+
+	/* The columns are ordered by identifier, the tagged columns of all kinds share an identifier range
+	 */
+	for( kind = 0;
+	     kind < ESEDB_GENERATE_NUMBER_OF_COLUMN_KINDS;
+	     kind++ )
+	{
+		for( kind_column_index = 0;
+		     kind_column_index < number_of_columns_per_kind[ kind ];
+		     kind_column_index++ )
+		{
+			column_index = generate->number_of_columns;
+			column       = &( generate->columns[ column_index ] );
+
+			if( memory_set(
+			     column,
+			     0,
+			     sizeof( esedb_generate_column_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear column: %d.",
+				 function,
+				 column_index );
+
+				return( -1 );
+			}
+			column->kind             = kind;
+			column->long_value_index = -1;
+
+			switch( kind )
+			{
+				case ESEDB_GENERATE_COLUMN_KIND_FIXED:
+					column->identifier = (uint32_t) kind_column_index + 1;
+					column->flags      = 0x00000001UL;
+
+					if( kind_column_index < 2 )
+					{
+						column->column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED;
+						column->size        = 4;
+					}
+					else
+					{
+						column->column_type = esedb_generate_fixed_column_types[ ( kind_column_index - 2 ) % 11 ];
+						column->size        = esedb_generate_fixed_column_sizes[ ( kind_column_index - 2 ) % 11 ];
+					}
+					if( kind_column_index == 0 )
+					{
+						narrow_string_snprintf(
+						 column->name,
+						 32,
+						 "Identifier" );
+					}
+					else if( kind_column_index == 1 )
+					{
+						narrow_string_snprintf(
+						 column->name,
+						 32,
+						 "Sequence" );
+					}
+					else
+					{
+						narrow_string_snprintf(
+						 column->name,
+						 32,
+						 "Fixed%d",
+						 kind_column_index );
+					}
+					break;
+
+				case ESEDB_GENERATE_COLUMN_KIND_VARIABLE:
+					column->identifier = (uint32_t) kind_column_index + 128;
+					column->size       = 255;
+
+					if( ( kind_column_index % 2 ) == 0 )
+					{
+						column->column_type = LIBESEDB_COLUMN_TYPE_TEXT;
+						column->codepage    = 1252;
+					}
+					else
+					{
+						column->column_type = LIBESEDB_COLUMN_TYPE_BINARY_DATA;
+					}
+					narrow_string_snprintf(
+					 column->name,
+					 32,
+					 "Variable%d",
+					 kind_column_index );
+
+					break;
+
+				default:
+					column->identifier = (uint32_t) ( column_index - generate->number_of_fixed_size_columns - generate->number_of_variable_size_columns ) + 256;
+					column->flags      = 0x00000002UL;
+
+					break;
+			}
+			switch( kind )
+			{
+				case ESEDB_GENERATE_COLUMN_KIND_TAGGED:
+					column->column_type = LIBESEDB_COLUMN_TYPE_LARGE_TEXT;
+					column->codepage    = 1252;
+
+					narrow_string_snprintf(
+					 column->name,
+					 32,
+					 "Tagged%d",
+					 kind_column_index );
+
+					break;
+
+				case ESEDB_GENERATE_COLUMN_KIND_MULTI_VALUE:
+					column->column_type = LIBESEDB_COLUMN_TYPE_TEXT;
+					column->codepage    = 1252;
+					column->flags      |= 0x00000400UL;
+
+					narrow_string_snprintf(
+					 column->name,
+					 32,
+					 "MultiValue%d",
+					 kind_column_index );
+
+					break;
+
+				case ESEDB_GENERATE_COLUMN_KIND_LONG_VALUE:
+					column->column_type      = LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA;
+					column->long_value_index = kind_column_index;
+
+					narrow_string_snprintf(
+					 column->name,
+					 32,
+					 "LongValue%d",
+					 kind_column_index );
+
+					break;
+
+				case ESEDB_GENERATE_COLUMN_KIND_7BIT_COMPRESSED:
+					column->column_type = LIBESEDB_COLUMN_TYPE_LARGE_TEXT;
+					column->codepage    = 1252;
+
+					narrow_string_snprintf(
+					 column->name,
+					 32,
+					 "Compressed7bit%d",
+					 kind_column_index );
+
+					break;
+
+				/* LZXPRESS compressed strings are stored as UTF-16 little-endian
+				 */
+				case ESEDB_GENERATE_COLUMN_KIND_LZXPRESS_COMPRESSED:
+					column->column_type = LIBESEDB_COLUMN_TYPE_LARGE_TEXT;
+					column->codepage    = 1200;
+
+					narrow_string_snprintf(
+					 column->name,
+					 32,
+					 "CompressedLzxpress%d",
+					 kind_column_index );
+
+					break;
+
+				default:
+					break;
+			}
+			generate->number_of_columns += 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Builds the data of a record
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_build_record(
+     esedb_generate_t *generate,
+     int table_index,
+     int record_index,
+     size_t *record_data_size,
+     libcerror_error_t **error )
+{
+	uint16_t tagged_value_identifiers[ ESEDB_GENERATE_MAXIMUM_NUMBER_OF_COLUMNS ];
+	uint16_t tagged_value_offsets[ ESEDB_GENERATE_MAXIMUM_NUMBER_OF_COLUMNS ];
+	uint8_t tagged_value_has_flags[ ESEDB_GENERATE_MAXIMUM_NUMBER_OF_COLUMNS ];
+
+	byte_stream_float32_t value_float32;
+	byte_stream_float64_t value_float64;
+
+	esedb_generate_column_t *column    = NULL;
+	uint8_t *record_data               = NULL;
+	uint8_t *value_data                = NULL;
+	static char *function              = "esedb_generate_build_record";
+	size_t compressed_data_size        = 0;
+	size_t record_data_offset          = 0;
+	size_t text_data_index             = 0;
+	size_t text_data_size              = 0;
+	size_t value_data_offset           = 0;
+	size_t value_data_size             = 0;
+	uint64_t random_state              = 0;
+	uint64_t value_64bit               = 0;
+	uint32_t number_of_values          = 0;
+	uint32_t value_32bit               = 0;
+	uint16_t multi_value_offset        = 0;
+	uint16_t variable_size_data_offset = 0;
+	uint16_t variable_size_data_size   = 0;
+	uint8_t value_flags                = 0;
+	int column_index                   = 0;
+	int number_of_tagged_values        = 0;
+	int tagged_value_index             = 0;
+	int value_index                    = 0;
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data size.",
+		 function );
+
+		return( -1 );
+	}
+	record_data = generate->record_data;
+
+	record_data[ 0 ] = (uint8_t) generate->number_of_fixed_size_columns;
+	record_data[ 1 ] = (uint8_t) ( 127 + generate->number_of_variable_size_columns );
+
+	record_data_offset = sizeof( esedb_data_definition_header_t );
+
+	for( column_index = 0;
+	     column_index < generate->number_of_columns;
+	     column_index++ )
+	{
+		column = &( generate->columns[ column_index ] );
+
+		if( column->kind != ESEDB_GENERATE_COLUMN_KIND_FIXED )
+		{
+			break;
+		}
+		if( ( record_data_offset + column->size ) > (size_t) generate->page_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: record data too large for page size.",
+			 function );
+
+			return( -1 );
+		}
+		value_data   = &( record_data[ record_data_offset ] );
+		random_state = esedb_generate_random_initialize(
+		                generate->seed,
+		                table_index,
+		                record_index,
+		                (int) column->identifier );
+
+		/* The first column contains the record identifier and the second column a permutation
+		 * of the record identifiers, which is used as the key of the index
+		 */
+		if( column_index == 0 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 value_data,
+			 (uint32_t) record_index + 1 );
+		}
+		else if( column_index == 1 )
+		{
+			value_64bit = ( (uint64_t) record_index * generate->sequence_step ) % (uint64_t) generate->number_of_records;
+
+			byte_stream_copy_from_uint32_little_endian(
+			 value_data,
+			 (uint32_t) value_64bit + 1 );
+		}
+		else
+		{
+			value_64bit = ( (uint64_t) esedb_generate_random_get_value( &random_state ) << 32 )
+			            | esedb_generate_random_get_value( &random_state );
+
+			switch( column->column_type )
+			{
+				case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+					value_data[ 0 ] = ( ( value_64bit & 1 ) != 0 ) ? 0xff : 0x00;
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+					/* A FILETIME in 2015 incremented by 1 second per record
+					 */
+					value_64bit = 0x01d0000000000000ULL
+					            + ( (uint64_t) record_index * 10000000UL )
+					            + ( value_64bit % 10000000UL );
+
+					byte_stream_copy_from_uint64_little_endian(
+					 value_data,
+					 value_64bit );
+
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+					value_float64.floating_point = (double) ( value_64bit & 0xffffffffUL ) / 1000.0;
+
+					byte_stream_copy_from_uint64_little_endian(
+					 value_data,
+					 value_float64.integer );
+
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+					value_float32.floating_point = (float) ( value_64bit & 0x0000ffffUL ) / 100.0f;
+
+					byte_stream_copy_from_uint32_little_endian(
+					 value_data,
+					 value_float32.integer );
+
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_GUID:
+					byte_stream_copy_from_uint64_little_endian(
+					 value_data,
+					 value_64bit );
+
+					value_64bit = ( (uint64_t) esedb_generate_random_get_value( &random_state ) << 32 )
+					            | esedb_generate_random_get_value( &random_state );
+
+					byte_stream_copy_from_uint64_little_endian(
+					 &( value_data[ 8 ] ),
+					 value_64bit );
+
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+					value_data[ 0 ] = (uint8_t) ( value_64bit & 0xff );
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+					byte_stream_copy_from_uint16_little_endian(
+					 value_data,
+					 (uint16_t) ( value_64bit & 0xffff ) );
+
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+					byte_stream_copy_from_uint32_little_endian(
+					 value_data,
+					 (uint32_t) ( value_64bit & 0xffffffffUL ) );
+
+					break;
+
+				default:
+					byte_stream_copy_from_uint64_little_endian(
+					 value_data,
+					 value_64bit );
+
+					break;
+			}
+		}
+		record_data_offset += column->size;
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( record_data[ 2 ] ),
+	 (uint16_t) record_data_offset );
+
+	/* The variable size data type sizes are followed by the variable size data
+	 */
+	variable_size_data_offset = (uint16_t) ( record_data_offset + ( 2 * generate->number_of_variable_size_columns ) );
+
+	if( ( (size_t) variable_size_data_offset + ( 32 * generate->number_of_variable_size_columns ) ) > (size_t) generate->page_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: record data too large for page size.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = generate->number_of_fixed_size_columns;
+	     column_index < generate->number_of_columns;
+	     column_index++ )
+	{
+		column = &( generate->columns[ column_index ] );
+
+		if( column->kind != ESEDB_GENERATE_COLUMN_KIND_VARIABLE )
+		{
+			break;
+		}
+		random_state = esedb_generate_random_initialize(
+		                generate->seed,
+		                table_index,
+		                record_index,
+		                (int) column->identifier );
+
+		value_data_size = (size_t) ( esedb_generate_random_get_value( &random_state ) % 33 );
+		value_data      = &( record_data[ variable_size_data_offset + variable_size_data_size ] );
+
+		if( value_data_size == 0 )
+		{
+			/* The most significant bit indicates an empty value
+			 */
+			byte_stream_copy_from_uint16_little_endian(
+			 &( record_data[ record_data_offset ] ),
+			 variable_size_data_size | 0x8000 );
+		}
+		else
+		{
+			if( column->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+			{
+				esedb_generate_copy_text(
+				 value_data,
+				 value_data_size,
+				 &random_state );
+			}
+			else
+			{
+				for( value_index = 0;
+				     value_index < (int) value_data_size;
+				     value_index++ )
+				{
+					value_data[ value_index ] = (uint8_t) ( esedb_generate_random_get_value( &random_state ) & 0xff );
+				}
+			}
+			variable_size_data_size += (uint16_t) value_data_size;
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( record_data[ record_data_offset ] ),
+			 variable_size_data_size );
+		}
+		record_data_offset += 2;
+	}
+	record_data_offset = (size_t) variable_size_data_offset + variable_size_data_size;
+
+	/* The tagged data is built in the value data since the size of the tagged data type offsets
+	 * depends on the number of tagged values
+	 */
+	for( column_index = generate->number_of_fixed_size_columns + generate->number_of_variable_size_columns;
+	     column_index < generate->number_of_columns;
+	     column_index++ )
+	{
+		column       = &( generate->columns[ column_index ] );
+		random_state = esedb_generate_random_initialize(
+		                generate->seed,
+		                table_index,
+		                record_index,
+		                (int) column->identifier );
+
+		/* About 1 in 8 tagged values is not set
+		 */
+		if( ( esedb_generate_random_get_value( &random_state ) % 8 ) == 0 )
+		{
+			continue;
+		}
+		if( ( value_data_offset + 8 ) > (size_t) generate->page_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: record data too large for page size.",
+			 function );
+
+			return( -1 );
+		}
+		switch( column->kind )
+		{
+			case ESEDB_GENERATE_COLUMN_KIND_MULTI_VALUE:
+				value_flags = LIBESEDB_VALUE_FLAG_MULTI_VALUE;
+				break;
+
+			case ESEDB_GENERATE_COLUMN_KIND_LONG_VALUE:
+				value_flags = LIBESEDB_VALUE_FLAG_LONG_VALUE;
+				break;
+
+			case ESEDB_GENERATE_COLUMN_KIND_7BIT_COMPRESSED:
+			case ESEDB_GENERATE_COLUMN_KIND_LZXPRESS_COMPRESSED:
+				value_flags = LIBESEDB_VALUE_FLAG_COMPRESSED;
+				break;
+
+			default:
+				value_flags = 0;
+				break;
+		}
+		tagged_value_identifiers[ number_of_tagged_values ] = (uint16_t) column->identifier;
+		tagged_value_offsets[ number_of_tagged_values ]     = (uint16_t) value_data_offset;
+		tagged_value_has_flags[ number_of_tagged_values ]   = 0;
+
+		/* Pages with an extended page header always store the value flags
+		 */
+		if( ( generate->has_extended_page_header != 0 )
+		 || ( value_flags != 0 ) )
+		{
+			generate->value_data[ value_data_offset++ ] = value_flags;
+
+			tagged_value_has_flags[ number_of_tagged_values ] = 1;
+		}
+		number_of_tagged_values++;
+
+		value_data      = &( generate->value_data[ value_data_offset ] );
+		value_data_size = (size_t) generate->page_size - value_data_offset;
+
+		switch( column->kind )
+		{
+			case ESEDB_GENERATE_COLUMN_KIND_MULTI_VALUE:
+				/* The multi value data starts with the offsets of the values
+				 */
+				number_of_values   = 1 + ( esedb_generate_random_get_value( &random_state ) % 4 );
+				multi_value_offset = (uint16_t) ( 2 * number_of_values );
+
+				if( value_data_size < (size_t) ( multi_value_offset + ( number_of_values * 23 ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: record data too large for page size.",
+					 function );
+
+					return( -1 );
+				}
+				for( value_index = 0;
+				     value_index < (int) number_of_values;
+				     value_index++ )
+				{
+					byte_stream_copy_from_uint16_little_endian(
+					 &( value_data[ 2 * value_index ] ),
+					 multi_value_offset );
+
+					text_data_size = (size_t) ( 4 + ( esedb_generate_random_get_value( &random_state ) % 20 ) );
+
+					esedb_generate_copy_text(
+					 &( value_data[ multi_value_offset ] ),
+					 text_data_size,
+					 &random_state );
+
+					multi_value_offset += (uint16_t) text_data_size;
+				}
+				value_data_size = (size_t) multi_value_offset;
+
+				break;
+
+			case ESEDB_GENERATE_COLUMN_KIND_LONG_VALUE:
+				/* The long value identifiers are unique within the table
+				 */
+				value_32bit = (uint32_t) ( ( record_index * generate->number_of_long_value_columns ) + column->long_value_index + 1 );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 value_data,
+				 value_32bit );
+
+				value_data_size = 4;
+
+				break;
+
+			case ESEDB_GENERATE_COLUMN_KIND_7BIT_COMPRESSED:
+				text_data_size = (size_t) ( 32 + ( esedb_generate_random_get_value( &random_state ) % ( generate->page_size / 32 ) ) );
+
+				if( ( text_data_size % 8 ) == 7 )
+				{
+					text_data_size += 1;
+				}
+				esedb_generate_copy_text(
+				 generate->text_data,
+				 text_data_size,
+				 &random_state );
+
+				compressed_data_size = value_data_size;
+
+				if( esedb_generate_compress_7bit(
+				     generate->text_data,
+				     text_data_size,
+				     value_data,
+				     &compressed_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compress 7-bit value.",
+					 function );
+
+					return( -1 );
+				}
+				value_data_size = compressed_data_size;
+
+				break;
+
+			case ESEDB_GENERATE_COLUMN_KIND_LZXPRESS_COMPRESSED:
+				text_data_size = (size_t) ( 64 + ( esedb_generate_random_get_value( &random_state ) % ( generate->page_size / 32 ) ) );
+
+				esedb_generate_copy_text(
+				 generate->text_data,
+				 text_data_size,
+				 &random_state );
+
+				/* Convert the text into UTF-16 little-endian in place
+				 */
+				for( text_data_index = text_data_size;
+				     text_data_index > 0;
+				     text_data_index-- )
+				{
+					generate->text_data[ ( 2 * text_data_index ) - 1 ] = 0;
+					generate->text_data[ ( 2 * text_data_index ) - 2 ] = generate->text_data[ text_data_index - 1 ];
+				}
+				compressed_data_size = value_data_size;
+
+				if( esedb_generate_compress_lzxpress(
+				     generate->text_data,
+				     2 * text_data_size,
+				     value_data,
+				     &compressed_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compress LZXPRESS value.",
+					 function );
+
+					return( -1 );
+				}
+				value_data_size = compressed_data_size;
+
+				break;
+
+			default:
+				text_data_size = (size_t) ( 16 + ( esedb_generate_random_get_value( &random_state ) % ( generate->page_size / 64 ) ) );
+
+				if( value_data_size < text_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: record data too large for page size.",
+					 function );
+
+					return( -1 );
+				}
+				esedb_generate_copy_text(
+				 value_data,
+				 text_data_size,
+				 &random_state );
+
+				value_data_size = text_data_size;
+
+				break;
+		}
+		value_data_offset += value_data_size;
+	}
+	if( ( record_data_offset + ( 4 * (size_t) number_of_tagged_values ) + value_data_offset ) > (size_t) generate->page_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: record data too large for page size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The tagged data type offsets are relative to the start of the tagged data
+	 */
+	for( tagged_value_index = 0;
+	     tagged_value_index < number_of_tagged_values;
+	     tagged_value_index++ )
+	{
+		value_32bit = ( 4 * (uint32_t) number_of_tagged_values ) + tagged_value_offsets[ tagged_value_index ];
+
+		if( ( generate->has_extended_page_header == 0 )
+		 && ( tagged_value_has_flags[ tagged_value_index ] != 0 ) )
+		{
+			value_32bit |= 0x4000;
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( record_data[ record_data_offset ] ),
+		 tagged_value_identifiers[ tagged_value_index ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( record_data[ record_data_offset + 2 ] ),
+		 (uint16_t) value_32bit );
+
+		record_data_offset += 4;
+	}
+	if( value_data_offset > 0 )
+	{
+		if( memory_copy(
+		     &( record_data[ record_data_offset ] ),
+		     generate->value_data,
+		     value_data_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy tagged data.",
+			 function );
+
+			return( -1 );
+		}
+		record_data_offset += value_data_offset;
+	}
+	*record_data_size = record_data_offset;
+
+	return( 1 );
+}
+
+/* Appends the long values of a record to the long values tree
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_append_long_values(
+     esedb_generate_t *generate,
+     esedb_generate_tree_t *tree,
+     int table_index,
+     int record_index,
+     libcerror_error_t **error )
+{
+	uint8_t long_value_key[ 8 ];
+	uint8_t long_value_header[ 8 ];
+
+	esedb_generate_column_t *column = NULL;
+	static char *function           = "esedb_generate_append_long_values";
+	uint64_t random_state           = 0;
+	uint32_t long_value_identifier  = 0;
+	uint32_t segment_offset         = 0;
+	uint32_t segment_size           = 0;
+	uint32_t value_index            = 0;
+	int column_index                = 0;
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < generate->number_of_columns;
+	     column_index++ )
+	{
+		column = &( generate->columns[ column_index ] );
+
+		if( column->kind != ESEDB_GENERATE_COLUMN_KIND_LONG_VALUE )
+		{
+			continue;
+		}
+		/* The presence of the value is determined the same way as in the record
+		 */
+		random_state = esedb_generate_random_initialize(
+		                generate->seed,
+		                table_index,
+		                record_index,
+		                (int) column->identifier );
+
+		if( ( esedb_generate_random_get_value( &random_state ) % 8 ) == 0 )
+		{
+			continue;
+		}
+		long_value_identifier = (uint32_t) ( ( record_index * generate->number_of_long_value_columns ) + column->long_value_index + 1 );
+
+		/* The long value header contains the reference count and the size
+		 */
+		byte_stream_copy_from_uint32_big_endian(
+		 long_value_key,
+		 long_value_identifier );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( long_value_header[ 0 ] ),
+		 1 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( long_value_header[ 4 ] ),
+		 generate->long_value_size );
+
+		if( esedb_generate_tree_append_value(
+		     generate,
+		     tree,
+		     0,
+		     long_value_key,
+		     4,
+		     long_value_header,
+		     8,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append long value: %" PRIu32 " header.",
+			 function,
+			 long_value_identifier );
+
+			return( -1 );
+		}
+		/* The key of a long value segment consists of the long value identifier and the segment offset
+		 */
+		for( segment_offset = 0;
+		     segment_offset < generate->long_value_size;
+		     segment_offset += segment_size )
+		{
+			segment_size = generate->long_value_size - segment_offset;
+
+			if( segment_size > generate->long_value_segment_size )
+			{
+				segment_size = generate->long_value_segment_size;
+			}
+			for( value_index = 0;
+			     value_index < segment_size;
+			     value_index++ )
+			{
+				generate->value_data[ value_index ] = (uint8_t) ( esedb_generate_random_get_value( &random_state ) & 0xff );
+			}
+			byte_stream_copy_from_uint32_big_endian(
+			 &( long_value_key[ 4 ] ),
+			 segment_offset );
+
+			if( esedb_generate_tree_append_value(
+			     generate,
+			     tree,
+			     0,
+			     long_value_key,
+			     8,
+			     generate->value_data,
+			     (size_t) segment_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append long value: %" PRIu32 " segment at offset: %" PRIu32 ".",
+				 function,
+				 long_value_identifier,
+				 segment_offset );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Updates the tree statistics
+ */
+void esedb_generate_update_statistics(
+      esedb_generate_t *generate,
+      esedb_generate_tree_t *tree )
+{
+	if( tree->number_of_leaf_pages > generate->maximum_number_of_leaf_pages )
+	{
+		generate->maximum_number_of_leaf_pages = tree->number_of_leaf_pages;
+	}
+}
+
+/* Writes a table, which consists of the data tree, long values tree and index tree
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_write_table(
+     esedb_generate_t *generate,
+     int table_index,
+     esedb_generate_table_t *table,
+     libcerror_error_t **error )
+{
+	uint8_t index_key[ 5 ];
+	uint8_t record_key[ 5 ];
+
+	esedb_generate_tree_t data_tree;
+	esedb_generate_tree_t index_tree;
+	esedb_generate_tree_t long_value_tree;
+
+	static char *function   = "esedb_generate_write_table";
+	size_t record_data_size = 0;
+	uint64_t record_64bit   = 0;
+	int record_index        = 0;
+	int value_index         = 0;
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the trees can be freed on error
+	 */
+	data_tree.number_of_levels       = 0;
+	index_tree.number_of_levels      = 0;
+	long_value_tree.number_of_levels = 0;
+
+	generate->last_object_identifier += 1;
+
+	table->object_identifier = generate->last_object_identifier;
+
+	narrow_string_snprintf(
+	 table->name,
+	 32,
+	 "Table%d",
+	 table_index + 1 );
+
+	/* The root page of the data tree is allocated first as the father data page of the table
+	 */
+	if( esedb_generate_allocate_page_number(
+	     generate,
+	     &( table->root_page_number ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to allocate root page number.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_generate_tree_initialize(
+	     &data_tree,
+	     table->object_identifier,
+	     ESEDB_GENERATE_DATABASE_PAGE_NUMBER,
+	     0,
+	     table->root_page_number,
+	     generate->maximum_number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize data tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( generate->number_of_long_value_columns > 0 )
+	{
+		generate->last_object_identifier += 1;
+
+		table->long_value_object_identifier = generate->last_object_identifier;
+
+		if( esedb_generate_tree_initialize(
+		     &long_value_tree,
+		     table->long_value_object_identifier,
+		     table->root_page_number,
+		     LIBESEDB_PAGE_FLAG_IS_LONG_VALUE,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize long values tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( record_index = 0;
+	     record_index < generate->number_of_records;
+	     record_index++ )
+	{
+		if( esedb_generate_build_record(
+		     generate,
+		     table_index,
+		     record_index,
+		     &record_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to build record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		esedb_generate_copy_integer_key(
+		 record_key,
+		 (uint32_t) record_index + 1 );
+
+		if( esedb_generate_tree_append_value(
+		     generate,
+		     &data_tree,
+		     0,
+		     record_key,
+		     5,
+		     generate->record_data,
+		     record_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( generate->number_of_long_value_columns > 0 )
+		{
+			if( esedb_generate_append_long_values(
+			     generate,
+			     &long_value_tree,
+			     table_index,
+			     record_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append long values of record: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+	}
+	/* Deleted records are stored as defunct values after the records, where every
+	 * second deleted record is truncated to its record header so that its values
+	 * cannot be read
+	 */
+	for( record_index = generate->number_of_records;
+	     record_index < ( generate->number_of_records + generate->number_of_deleted_records );
+	     record_index++ )
+	{
+		if( esedb_generate_build_record(
+		     generate,
+		     table_index,
+		     record_index,
+		     &record_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to build deleted record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( ( ( record_index - generate->number_of_records ) % 2 ) != 0 )
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( generate->record_data[ 2 ] ),
+			 0xffff );
+
+			record_data_size = 4;
+		}
+		esedb_generate_copy_integer_key(
+		 record_key,
+		 (uint32_t) record_index + 1 );
+
+		if( esedb_generate_tree_append_value(
+		     generate,
+		     &data_tree,
+		     0,
+		     record_key,
+		     5,
+		     generate->record_data,
+		     record_data_size,
+		     LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append deleted record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( generate->number_of_long_value_columns > 0 )
+		{
+			if( esedb_generate_append_long_values(
+			     generate,
+			     &long_value_tree,
+			     table_index,
+			     record_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append long values of deleted record: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( esedb_generate_tree_finalize(
+	     generate,
+	     &data_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize data tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_tree.number_of_levels > generate->maximum_data_tree_depth )
+	{
+		generate->maximum_data_tree_depth = data_tree.number_of_levels;
+	}
+	esedb_generate_update_statistics(
+	 generate,
+	 &data_tree );
+
+	if( esedb_generate_tree_free(
+	     &data_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( generate->number_of_long_value_columns > 0 )
+	{
+		if( esedb_generate_tree_finalize(
+		     generate,
+		     &long_value_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize long values tree.",
+			 function );
+
+			goto on_error;
+		}
+		table->long_value_root_page_number = long_value_tree.root_page_number;
+
+		esedb_generate_update_statistics(
+		 generate,
+		 &long_value_tree );
+
+		if( esedb_generate_tree_free(
+		     &long_value_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free long values tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The index is on the sequence column, its values are stored in index key order
+	 * and refer to the records by their primary key
+	 */
+	if( generate->number_of_fixed_size_columns >= 2 )
+	{
+		generate->last_object_identifier += 1;
+
+		table->index_object_identifier = generate->last_object_identifier;
+
+		if( esedb_generate_tree_initialize(
+		     &index_tree,
+		     table->index_object_identifier,
+		     table->root_page_number,
+		     LIBESEDB_PAGE_FLAG_IS_INDEX,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize index tree.",
+			 function );
+
+			goto on_error;
+		}
+		for( value_index = 0;
+		     value_index < generate->number_of_records;
+		     value_index++ )
+		{
+			record_64bit = ( (uint64_t) value_index * generate->sequence_inverse ) % (uint64_t) generate->number_of_records;
+
+			esedb_generate_copy_integer_key(
+			 index_key,
+			 (uint32_t) value_index + 1 );
+
+			esedb_generate_copy_integer_key(
+			 record_key,
+			 (uint32_t) record_64bit + 1 );
+
+			if( esedb_generate_tree_append_value(
+			     generate,
+			     &index_tree,
+			     0,
+			     index_key,
+			     5,
+			     record_key,
+			     5,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append index value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		if( esedb_generate_tree_finalize(
+		     generate,
+		     &index_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize index tree.",
+			 function );
+
+			goto on_error;
+		}
+		table->index_root_page_number = index_tree.root_page_number;
+
+		esedb_generate_update_statistics(
+		 generate,
+		 &index_tree );
+
+		if( esedb_generate_tree_free(
+		     &index_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	esedb_generate_tree_free(
+	 &index_tree,
+	 NULL );
+	esedb_generate_tree_free(
+	 &long_value_tree,
+	 NULL );
+	esedb_generate_tree_free(
+	 &data_tree,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Appends a catalog definition to the catalog tree
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_append_catalog_definition(
+     esedb_generate_t *generate,
+     esedb_generate_tree_t *tree,
+     uint32_t father_data_page_object_identifier,
+     uint16_t type,
+     uint32_t identifier,
+     uint32_t father_data_page_number,
+     uint32_t space_usage,
+     uint32_t flags,
+     uint32_t number_of_pages,
+     const char *name,
+     libcerror_error_t **error )
+{
+	uint8_t definition_key[ 10 ];
+
+	esedb_data_definition_t *data_definition = NULL;
+	static char *function                    = "esedb_generate_append_catalog_definition";
+	size_t definition_data_size              = 0;
+	size_t name_length                       = 0;
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	definition_data_size = sizeof( esedb_data_definition_header_t ) + sizeof( esedb_data_definition_t ) + 2 + name_length;
+
+	if( memory_set(
+	     generate->record_data,
+	     0,
+	     definition_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear definition data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The catalog definition contains the fixed size data types 1 - 11 and the name as
+	 * variable size data type 128
+	 */
+	( (esedb_data_definition_header_t *) generate->record_data )->last_fixed_size_data_type    = 11;
+	( (esedb_data_definition_header_t *) generate->record_data )->last_variable_size_data_type = 128;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_data_definition_header_t *) generate->record_data )->variable_size_data_types_offset,
+	 (uint16_t) ( sizeof( esedb_data_definition_header_t ) + sizeof( esedb_data_definition_t ) ) );
+
+	data_definition = (esedb_data_definition_t *) &( generate->record_data[ sizeof( esedb_data_definition_header_t ) ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 data_definition->father_data_page_object_identifier,
+	 father_data_page_object_identifier );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 data_definition->type,
+	 type );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 data_definition->identifier,
+	 identifier );
+
+	/* The father data page number and column type share the same storage
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 data_definition->father_data_page_number,
+	 father_data_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 data_definition->space_usage,
+	 space_usage );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 data_definition->flags,
+	 flags );
+
+	/* The number of pages, codepage and locale identifier share the same storage
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 data_definition->number_of_pages,
+	 number_of_pages );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( generate->record_data[ sizeof( esedb_data_definition_header_t ) + sizeof( esedb_data_definition_t ) ] ),
+	 (uint16_t) name_length );
+
+	if( memory_copy(
+	     &( generate->record_data[ sizeof( esedb_data_definition_header_t ) + sizeof( esedb_data_definition_t ) + 2 ] ),
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	/* The key consists of the father data page object identifier, type and identifier
+	 * which keeps the definitions of a table together
+	 */
+	byte_stream_copy_from_uint32_big_endian(
+	 &( definition_key[ 0 ] ),
+	 father_data_page_object_identifier );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( definition_key[ 4 ] ),
+	 type );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( definition_key[ 6 ] ),
+	 identifier );
+
+	if( esedb_generate_tree_append_value(
+	     generate,
+	     tree,
+	     0,
+	     definition_key,
+	     10,
+	     generate->record_data,
+	     definition_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append catalog definition: %s.",
+		 function,
+		 name );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the catalog
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_write_catalog(
+     esedb_generate_t *generate,
+     esedb_generate_table_t *tables,
+     uint32_t object_identifier,
+     uint32_t root_page_number,
+     libcerror_error_t **error )
+{
+	esedb_generate_tree_t catalog_tree;
+
+	esedb_generate_column_t *column = NULL;
+	esedb_generate_table_t *table   = NULL;
+	static char *function           = "esedb_generate_write_catalog";
+	int column_index                = 0;
+	int table_index                 = 0;
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	if( tables == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tables.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_generate_tree_initialize(
+	     &catalog_tree,
+	     object_identifier,
+	     ESEDB_GENERATE_DATABASE_PAGE_NUMBER,
+	     0,
+	     root_page_number,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize catalog tree.",
+		 function );
+
+		return( -1 );
+	}
+	for( table_index = 0;
+	     table_index < generate->number_of_tables;
+	     table_index++ )
+	{
+		table = &( tables[ table_index ] );
+
+		if( esedb_generate_append_catalog_definition(
+		     generate,
+		     &catalog_tree,
+		     table->object_identifier,
+		     LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE,
+		     table->object_identifier,
+		     table->root_page_number,
+		     80,
+		     0,
+		     1,
+		     table->name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append table: %d definition.",
+			 function,
+			 table_index );
+
+			goto on_error;
+		}
+		for( column_index = 0;
+		     column_index < generate->number_of_columns;
+		     column_index++ )
+		{
+			column = &( generate->columns[ column_index ] );
+
+			if( esedb_generate_append_catalog_definition(
+			     generate,
+			     &catalog_tree,
+			     table->object_identifier,
+			     LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN,
+			     column->identifier,
+			     column->column_type,
+			     column->size,
+			     column->flags,
+			     column->codepage,
+			     column->name,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append table: %d column: %d definition.",
+				 function,
+				 table_index,
+				 column_index );
+
+				goto on_error;
+			}
+		}
+		if( table->index_root_page_number != 0 )
+		{
+			if( esedb_generate_append_catalog_definition(
+			     generate,
+			     &catalog_tree,
+			     table->object_identifier,
+			     LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX,
+			     table->index_object_identifier,
+			     table->index_root_page_number,
+			     80,
+			     0,
+			     1033,
+			     "SequenceIndex",
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append table: %d index definition.",
+				 function,
+				 table_index );
+
+				goto on_error;
+			}
+		}
+		if( table->long_value_root_page_number != 0 )
+		{
+			if( esedb_generate_append_catalog_definition(
+			     generate,
+			     &catalog_tree,
+			     table->object_identifier,
+			     LIBESEDB_CATALOG_DEFINITION_TYPE_LONG_VALUE,
+			     table->long_value_object_identifier,
+			     table->long_value_root_page_number,
+			     80,
+			     0,
+			     1,
+			     "LV",
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append table: %d long value definition.",
+				 function,
+				 table_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( esedb_generate_tree_finalize(
+	     generate,
+	     &catalog_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize catalog tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_generate_tree_free(
+	     &catalog_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free catalog tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	esedb_generate_tree_free(
+	 &catalog_tree,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes the file header and its backup
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_write_file_header(
+     esedb_generate_t *generate,
+     libcerror_error_t **error )
+{
+	esedb_file_header_t *file_header = NULL;
+	static char *function            = "esedb_generate_write_file_header";
+	ssize_t write_count              = 0;
+	uint64_t random_state            = 0;
+	uint32_t xor32_checksum          = 0;
+	int header_index                 = 0;
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     generate->page_data,
+	     0,
+	     (size_t) generate->page_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page data.",
+		 function );
+
+		return( -1 );
+	}
+	file_header = (esedb_file_header_t *) generate->page_data;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->signature,
+	 0x89abcdefUL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->format_version,
+	 0x620 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->file_type,
+	 LIBESEDB_FILE_TYPE_DATABASE );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->database_time,
+	 (uint64_t) 1 );
+
+	/* The database signature is derived from the seed
+	 */
+	random_state = esedb_generate_random_initialize(
+	                generate->seed,
+	                0,
+	                0,
+	                0 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->database_signature,
+	 esedb_generate_random_get_value( &random_state ) );
+
+	/* The database state is clean shutdown
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->database_state,
+	 3 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->last_object_identifier,
+	 generate->last_object_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->format_revision,
+	 generate->format_revision );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->page_size,
+	 generate->page_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->creation_format_version,
+	 0x620 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->creation_format_revision,
+	 generate->format_revision );
+
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &xor32_checksum,
+	     &( generate->page_data[ 4 ] ),
+	     sizeof( esedb_file_header_t ) - 4,
+	     0x89abcdefUL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->checksum,
+	 xor32_checksum );
+
+	/* The backup file header is stored directly after the file header
+	 */
+	for( header_index = 0;
+	     header_index < 2;
+	     header_index++ )
+	{
+		if( file_stream_seek_offset(
+		     generate->stream,
+		     (off64_t) header_index * generate->page_size,
+		     SEEK_SET ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file header: %d offset.",
+			 function,
+			 header_index );
+
+			return( -1 );
+		}
+		write_count = file_stream_write(
+		               generate->stream,
+		               generate->page_data,
+		               (size_t) generate->page_size );
+
+		if( write_count != (ssize_t) generate->page_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write file header: %d.",
+			 function,
+			 header_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the step of the sequence column and its modular inverse
+ * The sequence column contains a permutation of the record numbers so that
+ * the order of the index differs from the order of the records
+ */
+void esedb_generate_initialize_sequence(
+      esedb_generate_t *generate )
+{
+	int64_t inverse          = 0;
+	int64_t next_inverse     = 0;
+	int64_t next_remainder   = 0;
+	int64_t quotient         = 0;
+	int64_t remainder        = 0;
+	int64_t value_64bit      = 0;
+	uint64_t number_of_steps = 0;
+	uint64_t step            = 0;
+
+	generate->sequence_step    = 1;
+	generate->sequence_inverse = 1;
+
+	if( generate->number_of_records <= 1 )
+	{
+		return;
+	}
+	number_of_steps = (uint64_t) generate->number_of_records;
+
+	step = ( number_of_steps * 618 ) / 1000;
+
+	if( step == 0 )
+	{
+		step = 1;
+	}
+	/* The step must be coprime with the number of records
+	 */
+	for( ;; )
+	{
+		remainder      = (int64_t) number_of_steps;
+		next_remainder = (int64_t) step;
+
+		while( next_remainder != 0 )
+		{
+			value_64bit    = remainder % next_remainder;
+			remainder      = next_remainder;
+			next_remainder = value_64bit;
+		}
+		if( remainder == 1 )
+		{
+			break;
+		}
+		step++;
+	}
+	/* Determine the modular inverse using the extended Euclidean algorithm
+	 */
+	remainder      = (int64_t) number_of_steps;
+	next_remainder = (int64_t) step;
+	inverse        = 0;
+	next_inverse   = 1;
+
+	while( next_remainder != 0 )
+	{
+		quotient = remainder / next_remainder;
+
+		value_64bit    = remainder - ( quotient * next_remainder );
+		remainder      = next_remainder;
+		next_remainder = value_64bit;
+
+		value_64bit  = inverse - ( quotient * next_inverse );
+		inverse      = next_inverse;
+		next_inverse = value_64bit;
+	}
+	if( inverse < 0 )
+	{
+		inverse += (int64_t) number_of_steps;
+	}
+	generate->sequence_step    = step % number_of_steps;
+	generate->sequence_inverse = (uint64_t) inverse % number_of_steps;
+}
+
+/* Writes the database
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_generate_write_database(
+     esedb_generate_t *generate,
+     esedb_generate_table_t *tables,
+     libcerror_error_t **error )
+{
+	esedb_generate_tree_t database_tree;
+
+	static char *function = "esedb_generate_write_database";
+	int table_index       = 0;
+
+	if( generate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate.",
+		 function );
+
+		return( -1 );
+	}
+	if( tables == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tables.",
+		 function );
+
+		return( -1 );
+	}
+	generate->last_page_number       = ESEDB_GENERATE_FIRST_PAGE_NUMBER - 1;
+	generate->last_object_identifier = ESEDB_GENERATE_FIRST_OBJECT_IDENTIFIER - 1;
+
+	/* The database tree consists of an empty root page
+	 */
+	if( esedb_generate_tree_initialize(
+	     &database_tree,
+	     1,
+	     0,
+	     0,
+	     ESEDB_GENERATE_DATABASE_PAGE_NUMBER,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize database tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_generate_tree_finalize(
+	     generate,
+	     &database_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize database tree.",
+		 function );
+
+		esedb_generate_tree_free(
+		 &database_tree,
+		 NULL );
+
+		return( -1 );
+	}
+	if( esedb_generate_tree_free(
+	     &database_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free database tree.",
+		 function );
+
+		return( -1 );
+	}
+	for( table_index = 0;
+	     table_index < generate->number_of_tables;
+	     table_index++ )
+	{
+		if( esedb_generate_write_table(
+		     generate,
+		     table_index,
+		     &( tables[ table_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write table: %d.",
+			 function,
+			 table_index );
+
+			return( -1 );
+		}
+	}
+	if( esedb_generate_write_catalog(
+	     generate,
+	     tables,
+	     2,
+	     ESEDB_GENERATE_CATALOG_PAGE_NUMBER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_generate_write_catalog(
+	     generate,
+	     tables,
+	     3,
+	     ESEDB_GENERATE_BACKUP_CATALOG_PAGE_NUMBER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write backup catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_generate_write_file_header(
+	     generate,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value of a numeric option
+ * Returns 1 if successful, 0 if the value is not supported or -1 on error
+ */
+int esedb_generate_get_option_value(
+     const system_character_t *option_value,
+     uint64_t minimum_value,
+     uint64_t maximum_value,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_generate_get_option_value";
+	size_t string_length  = 0;
+
+	if( option_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid option value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 option_value );
+
+	if( esedbtools_system_string_copy_to_64_bit_in_decimal(
+	     option_value,
+	     string_length + 1,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy option value to 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *value_64bit < minimum_value )
+	 || ( *value_64bit > maximum_value ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	esedb_generate_t generate;
+
+	esedb_generate_table_t *tables        = NULL;
+	libcerror_error_t *error              = NULL;
+	const system_character_t *option_mix  = _SYSTEM_STRING( ESEDB_GENERATE_DEFAULT_COLUMN_MIX );
+	system_character_t *option_depth      = NULL;
+	system_character_t *option_long_value = NULL;
+	system_character_t *option_page_size  = NULL;
+	system_character_t *option_records    = NULL;
+	system_character_t *option_revision   = NULL;
+	system_character_t *option_seed       = NULL;
+	system_character_t *option_tables     = NULL;
+	system_character_t *option_deleted    = NULL;
+	system_integer_t option               = 0;
+	uint64_t maximum_number_of_values     = 0;
+	uint64_t number_of_leaf_values        = 0;
+	uint64_t value_64bit                  = 0;
+	int level_index                       = 0;
+	int result                            = 0;
+
+	if( memory_set(
+	     &generate,
+	     0,
+	     sizeof( esedb_generate_t ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear generate.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	generate.format_revision   = ESEDB_GENERATE_DEFAULT_FORMAT_REVISION;
+	generate.long_value_size   = ESEDB_GENERATE_DEFAULT_LONG_VALUE_SIZE;
+	generate.number_of_records = ESEDB_GENERATE_DEFAULT_NUMBER_OF_RECORDS;
+	generate.number_of_tables  = ESEDB_GENERATE_DEFAULT_NUMBER_OF_TABLES;
+	generate.page_size         = ESEDB_GENERATE_DEFAULT_PAGE_SIZE;
+	generate.seed              = ESEDB_GENERATE_DEFAULT_SEED;
+
+	while( ( option = esedb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:d:hl:n:p:r:s:t:x:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				esedb_generate_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_mix = optarg;
+
+				break;
+
+			case (system_integer_t) 'd':
+				option_depth = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				esedb_generate_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'l':
+				option_long_value = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_records = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_page_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_revision = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_seed = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_tables = optarg;
+
+				break;
+
+			case (system_integer_t) 'x':
+				option_deleted = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target file.\n" );
+
+		esedb_generate_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_revision != NULL )
+	{
+		/* The linear tagged data type format of revision 2 and earlier is not supported
+		 */
+		if( esedb_generate_get_option_value(
+		     option_revision,
+		     3,
+		     255,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported format revision.\n" );
+
+			goto on_error;
+		}
+		generate.format_revision = (uint32_t) value_64bit;
+	}
+	if( option_page_size != NULL )
+	{
+		if( esedb_generate_get_option_value(
+		     option_page_size,
+		     2048,
+		     32768,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			value_64bit = 0;
+		}
+		generate.page_size = (uint32_t) value_64bit;
+	}
+	if( generate.format_revision < LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	{
+		result = ( ( generate.page_size == 4096 ) || ( generate.page_size == 8192 ) );
+	}
+	else
+	{
+		result = ( ( generate.page_size >= 2048 ) && ( ( generate.page_size & ( generate.page_size - 1 ) ) == 0 ) );
+	}
+	if( result == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported page size for format revision: %" PRIu32 ".\n",
+		 generate.format_revision );
+
+		goto on_error;
+	}
+	if( option_records != NULL )
+	{
+		if( esedb_generate_get_option_value(
+		     option_records,
+		     0,
+		     (uint64_t) INT32_MAX,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of records.\n" );
+
+			goto on_error;
+		}
+		generate.number_of_records = (int) value_64bit;
+	}
+	if( option_tables != NULL )
+	{
+		if( esedb_generate_get_option_value(
+		     option_tables,
+		     1,
+		     1024,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of tables.\n" );
+
+			goto on_error;
+		}
+		generate.number_of_tables = (int) value_64bit;
+	}
+	if( option_deleted != NULL )
+	{
+		if( esedb_generate_get_option_value(
+		     option_deleted,
+		     0,
+		     (uint64_t) generate.number_of_records,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of deleted records.\n" );
+
+			goto on_error;
+		}
+		generate.number_of_deleted_records = (int) value_64bit;
+	}
+	if( option_long_value != NULL )
+	{
+		if( esedb_generate_get_option_value(
+		     option_long_value,
+		     1,
+		     (uint64_t) INT32_MAX,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported long value size.\n" );
+
+			goto on_error;
+		}
+		generate.long_value_size = (uint32_t) value_64bit;
+	}
+	if( option_seed != NULL )
+	{
+		if( esedb_generate_get_option_value(
+		     option_seed,
+		     0,
+		     UINT64_MAX,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported seed.\n" );
+
+			goto on_error;
+		}
+		generate.seed = value_64bit;
+	}
+	if( option_depth != NULL )
+	{
+		if( esedb_generate_get_option_value(
+		     option_depth,
+		     1,
+		     ESEDB_GENERATE_MAXIMUM_NUMBER_OF_TREE_LEVELS,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported data tree depth.\n" );
+
+			goto on_error;
+		}
+		generate.data_tree_depth = (int) value_64bit;
+	}
+	result = esedb_generate_parse_column_mix(
+	          &generate,
+	          option_mix,
+	          &error );
+
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported column mix: %" PRIs_SYSTEM ".\n",
+		 option_mix );
+
+		goto on_error;
+	}
+	/* The long value identifiers of all the records of a table must fit in 31-bit
+	 */
+	if( ( ( (uint64_t) generate.number_of_records + generate.number_of_deleted_records ) * generate.number_of_long_value_columns ) > (uint64_t) INT32_MAX )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of records for the number of long value columns.\n" );
+
+		goto on_error;
+	}
+	if( ( generate.format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( generate.page_size >= 16384 ) )
+	{
+		generate.has_extended_page_header = 1;
+		generate.page_header_size         = sizeof( esedb_page_header_t ) + sizeof( esedb_extended_page_header_t );
+	}
+	else
+	{
+		generate.page_header_size = sizeof( esedb_page_header_t );
+	}
+	generate.long_value_segment_size = (uint32_t) ( ( generate.page_size - generate.page_header_size - 64 ) & ~( (size_t) 0xff ) );
+
+	esedb_generate_initialize_sequence(
+	 &generate );
+
+	/* The maximum number of values per page of the data tree is the smallest
+	 * number for which the data tree of the requested depth can contain all the records
+	 */
+	if( ( generate.data_tree_depth > 0 )
+	 && ( generate.number_of_records > 1 ) )
+	{
+		for( maximum_number_of_values = 2;
+		     maximum_number_of_values < (uint64_t) generate.number_of_records;
+		     maximum_number_of_values++ )
+		{
+			number_of_leaf_values = 1;
+
+			for( level_index = 0;
+			     level_index < generate.data_tree_depth;
+			     level_index++ )
+			{
+				number_of_leaf_values *= maximum_number_of_values;
+
+				if( number_of_leaf_values >= (uint64_t) generate.number_of_records )
+				{
+					break;
+				}
+			}
+			if( number_of_leaf_values >= (uint64_t) generate.number_of_records )
+			{
+				break;
+			}
+		}
+		generate.maximum_number_of_values = (int) maximum_number_of_values;
+	}
+	generate.page_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * generate.page_size );
+
+	generate.record_data = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * generate.page_size );
+
+	generate.value_data = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * generate.page_size );
+
+	generate.text_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * generate.page_size );
+
+	tables = (esedb_generate_table_t *) memory_allocate(
+	                                     sizeof( esedb_generate_table_t ) * generate.number_of_tables );
+
+	if( ( generate.page_data == NULL )
+	 || ( generate.record_data == NULL )
+	 || ( generate.value_data == NULL )
+	 || ( generate.text_data == NULL )
+	 || ( tables == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffers.\n" );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     tables,
+	     0,
+	     sizeof( esedb_generate_table_t ) * generate.number_of_tables ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear tables.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	generate.stream = file_stream_open_wide(
+	                   argv[ optind ],
+	                   _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	generate.stream = file_stream_open(
+	                   argv[ optind ],
+	                   FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( generate.stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target file: %" PRIs_SYSTEM ".\n",
+		 argv[ optind ] );
+
+		goto on_error;
+	}
+	if( esedb_generate_write_database(
+	     &generate,
+	     tables,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate: %" PRIs_SYSTEM ".\n",
+		 argv[ optind ] );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     generate.stream ) != 0 )
+	{
+		generate.stream = NULL;
+
+		fprintf(
+		 stderr,
+		 "Unable to close target file: %" PRIs_SYSTEM ".\n",
+		 argv[ optind ] );
+
+		goto on_error;
+	}
+	generate.stream = NULL;
+
+	fprintf(
+	 stdout,
+	 "Generated: %" PRIs_SYSTEM " with %d tables of %d records and %" PRIu32 " pages of %" PRIu32 " bytes.\n",
+	 argv[ optind ],
+	 generate.number_of_tables,
+	 generate.number_of_records,
+	 generate.last_page_number + 2,
+	 generate.page_size );
+
+	fprintf(
+	 stdout,
+	 "Data tree depth: %d, maximum number of leaf pages per tree: %" PRIu32 ".\n",
+	 generate.maximum_data_tree_depth,
+	 generate.maximum_number_of_leaf_pages );
+
+	if( generate.maximum_number_of_leaf_pages > LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES )
+	{
+		fprintf(
+		 stdout,
+		 "Warning: the number of leaf pages exceeds the maximum supported by libesedb: %d.\n",
+		 LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES );
+	}
+	memory_free(
+	 tables );
+	memory_free(
+	 generate.text_data );
+	memory_free(
+	 generate.value_data );
+	memory_free(
+	 generate.record_data );
+	memory_free(
+	 generate.page_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( generate.stream != NULL )
+	{
+		file_stream_close(
+		 generate.stream );
+	}
+	if( tables != NULL )
+	{
+		memory_free(
+		 tables );
+	}
+	if( generate.text_data != NULL )
+	{
+		memory_free(
+		 generate.text_data );
+	}
+	if( generate.value_data != NULL )
+	{
+		memory_free(
+		 generate.value_data );
+	}
+	if( generate.record_data != NULL )
+	{
+		memory_free(
+		 generate.record_data );
+	}
+	if( generate.page_data != NULL )
+	{
+		memory_free(
+		 generate.page_data );
+	}
+	return( EXIT_FAILURE );
+}
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -28,6 +29,7 @@
 #endif
 
 #include "esedb_test_functions.h"
+#include "esedb_test_getopt.h"
 #include "esedb_test_libbfio.h"
 #include "esedb_test_libcdata.h"
 #include "esedb_test_libcerror.h"
@@ -37,7 +39,11 @@
 #include "esedb_test_unused.h"
 
 #include "../libesedb/libesedb_catalog.h"
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_file.h"
 #include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_table_definition.h"
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
@@ -53,7 +59,7 @@ int esedb_test_catalog_initialize(
 	int result                      = 0;
 
 #if defined( HAVE_ESEDB_TEST_MEMORY )
-	int number_of_malloc_fail_tests = 3;
+	int number_of_malloc_fail_tests = 4;
 	int number_of_memset_fail_tests = 1;
 	int test_number                 = 0;
 #endif
@@ -430,6 +436,7 @@ int esedb_test_catalog_read_file_io_handle(
 	result = libesedb_catalog_read_file_io_handle(
 	          NULL,
 	          file_io_handle,
+	          0,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -524,6 +531,675 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_catalog_read_table_definition_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_read_table_definition_file_io_handle(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libesedb_catalog_t *catalog                             = NULL;
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                         = NULL;
+	libesedb_table_definition_t *table_definition           = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_initialize(
+	          &table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_catalog_definition",
+	 table_catalog_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          table_catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_catalog_definition = NULL;
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_read_table_definition_file_io_handle(
+	          catalog,
+	          NULL,
+	          table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_read_table_definition_file_io_handle(
+	          NULL,
+	          NULL,
+	          table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_read_table_definition_file_io_handle(
+	          catalog,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	table_definition->catalog_read_failed = 1;
+
+	result = libesedb_catalog_read_table_definition_file_io_handle(
+	          catalog,
+	          NULL,
+	          table_definition,
+	          &error );
+
+	table_definition->catalog_read_failed = 0;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_read_table_definition_file_io_handle function
+ * on a catalog that was read with LIBESEDB_CATALOG_READ_FLAG_TABLES_ONLY
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_read_table_definition_file_io_handle_tables_only(
+     const system_character_t *source )
+{
+	libcerror_error_t *error                            = NULL;
+	libesedb_catalog_t *catalog                         = NULL;
+	libesedb_catalog_t *tables_only_catalog             = NULL;
+	libesedb_file_t *file                               = NULL;
+	libesedb_file_t *tables_only_file                   = NULL;
+	libesedb_table_definition_t *table_definition       = NULL;
+	libesedb_table_definition_t *tables_only_definition = NULL;
+	int number_of_catalog_definitions                   = 0;
+	int number_of_table_definitions                     = 0;
+	int number_of_tables_only_catalog_definitions       = 0;
+	int number_of_tables_only_table_definitions         = 0;
+	int result                                          = 0;
+	int table_definition_index                          = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_file_open_wide(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#else
+	result = libesedb_file_open(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#endif
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_initialize(
+	          &tables_only_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "tables_only_file",
+	 tables_only_file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_file_open_wide(
+	          tables_only_file,
+	          source,
+	          LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	          &error );
+#else
+	result = libesedb_file_open(
+	          tables_only_file,
+	          source,
+	          LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	          &error );
+#endif
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	catalog             = ( (libesedb_internal_file_t *) file )->catalog;
+	tables_only_catalog = ( (libesedb_internal_file_t *) tables_only_file )->catalog;
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "tables_only_catalog",
+	 tables_only_catalog );
+
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          catalog,
+	          &number_of_table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          tables_only_catalog,
+	          &number_of_tables_only_table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tables_only_table_definitions",
+	 number_of_tables_only_table_definitions,
+	 number_of_table_definitions );
+
+	/* Test regular cases
+	 */
+	for( table_definition_index = 0;
+	     table_definition_index < number_of_table_definitions;
+	     table_definition_index++ )
+	{
+		result = libesedb_catalog_get_table_definition_by_index(
+		          catalog,
+		          table_definition_index,
+		          &table_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "table_definition",
+		 table_definition );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_catalog_get_table_definition_by_index(
+		          tables_only_catalog,
+		          table_definition_index,
+		          &tables_only_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "tables_only_definition",
+		 tables_only_definition );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_catalog_read_table_definition_file_io_handle(
+		          tables_only_catalog,
+		          ( (libesedb_internal_file_t *) tables_only_file )->file_io_handle,
+		          tables_only_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "tables_only_definition->catalog_leaf_page_number",
+		 tables_only_definition->catalog_leaf_page_number,
+		 0 );
+
+		result = libesedb_table_definition_get_number_of_column_catalog_definitions(
+		          table_definition,
+		          &number_of_catalog_definitions,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_definition_get_number_of_column_catalog_definitions(
+		          tables_only_definition,
+		          &number_of_tables_only_catalog_definitions,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_tables_only_catalog_definitions",
+		 number_of_tables_only_catalog_definitions,
+		 number_of_catalog_definitions );
+
+		result = libesedb_table_definition_get_number_of_index_catalog_definitions(
+		          table_definition,
+		          &number_of_catalog_definitions,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_definition_get_number_of_index_catalog_definitions(
+		          tables_only_definition,
+		          &number_of_tables_only_catalog_definitions,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_tables_only_catalog_definitions",
+		 number_of_tables_only_catalog_definitions,
+		 number_of_catalog_definitions );
+
+		/* Test that reading a table definition a second time is a no-op
+		 */
+		result = libesedb_catalog_read_table_definition_file_io_handle(
+		          tables_only_catalog,
+		          ( (libesedb_internal_file_t *) tables_only_file )->file_io_handle,
+		          tables_only_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_definition_get_number_of_column_catalog_definitions(
+		          tables_only_definition,
+		          &number_of_tables_only_catalog_definitions,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_definition_get_number_of_column_catalog_definitions(
+		          table_definition,
+		          &number_of_catalog_definitions,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_tables_only_catalog_definitions",
+		 number_of_tables_only_catalog_definitions,
+		 number_of_catalog_definitions );
+	}
+	/* Clean up
+	 */
+	result = libesedb_file_close(
+	          tables_only_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_free(
+	          &tables_only_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "tables_only_file",
+	 tables_only_file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_close(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tables_only_file != NULL )
+	{
+		libesedb_file_free(
+		 &tables_only_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_catalog_get_number_of_table_definitions function
  * Returns 1 if successful or 0 if not
  */
@@ -1100,12 +1776,12 @@ on_error:
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
@@ -1117,9 +1793,30 @@ int main(
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+	system_character_t *source      = NULL;
+	system_integer_t option         = 0;
 
+	while( ( option = esedb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 	ESEDB_TEST_RUN(
@@ -1138,6 +1835,20 @@ int main(
 	 "libesedb_catalog_read_file_io_handle",
 	 esedb_test_catalog_read_file_io_handle );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_read_table_definition_file_io_handle",
+	 esedb_test_catalog_read_table_definition_file_io_handle );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_catalog_read_table_definition_file_io_handle_tables_only",
+		 esedb_test_catalog_read_table_definition_file_io_handle_tables_only,
+		 source );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize test
@@ -35,6 +35,13 @@
 
 #include "../libesedb/libesedb_data_definition.h"
 
+/* Record data: 1 fixed size data type, 2 variable size data types and 3 tagged data types
+ */
+uint8_t esedb_test_data_definition_record_data1[ 35 ] = {
+	0x01, 0x81, 0x08, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x03, 0x80, 0x61, 0x62, 0x63, 0x00,
+	0x01, 0x0c, 0x00, 0x02, 0x01, 0x0e, 0x40, 0x2c, 0x01, 0x11, 0x00, 0x11, 0x22, 0x01, 0x33, 0x44,
+	0x55, 0x66, 0x77 };
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 /* Tests the libesedb_data_definition_initialize function
@@ -270,6 +277,188 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_data_definition_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_clone(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libesedb_data_definition_t *destination_data_definition = NULL;
+	libesedb_data_definition_t *source_data_definition      = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_data_definition_initialize(
+	          &source_data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "source_data_definition",
+	 source_data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_data_definition->page_number      = 12;
+	source_data_definition->page_value_index = 3;
+	source_data_definition->data_offset      = 128;
+	source_data_definition->data_size        = 35;
+
+	/* Test regular cases
+	 */
+	result = libesedb_data_definition_clone(
+	          &destination_data_definition,
+	          source_data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_data_definition",
+	 destination_data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "destination_data_definition->page_number",
+	 destination_data_definition->page_number,
+	 (uint32_t) 12 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "destination_data_definition->data_offset",
+	 destination_data_definition->data_offset,
+	 (uint16_t) 128 );
+
+	result = libesedb_data_definition_free(
+	          &destination_data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "destination_data_definition",
+	 destination_data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_clone(
+	          &destination_data_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "destination_data_definition",
+	 destination_data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_clone(
+	          NULL,
+	          source_data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_data_definition = (libesedb_data_definition_t *) 0x12345678UL;
+
+	result = libesedb_data_definition_clone(
+	          &destination_data_definition,
+	          source_data_definition,
+	          &error );
+
+	destination_data_definition = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &source_data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "source_data_definition",
+	 source_data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &destination_data_definition,
+		 NULL );
+	}
+	if( source_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &source_data_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_data_definition_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -360,6 +549,455 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_data_definition_get_tagged_data_types_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_get_tagged_data_types_offset(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	uint16_t tagged_data_types_offset = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_data_definition_get_tagged_data_types_offset(
+	          esedb_test_data_definition_record_data1,
+	          35,
+	          &tagged_data_types_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "tagged_data_types_offset",
+	 tagged_data_types_offset,
+	 15 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_get_tagged_data_types_offset(
+	          NULL,
+	          35,
+	          &tagged_data_types_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_tagged_data_types_offset(
+	          esedb_test_data_definition_record_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &tagged_data_types_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_tagged_data_types_offset(
+	          esedb_test_data_definition_record_data1,
+	          35,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with record data too small to contain the variable size data types
+	 */
+	result = libesedb_data_definition_get_tagged_data_types_offset(
+	          esedb_test_data_definition_record_data1,
+	          10,
+	          &tagged_data_types_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_data_definition_get_tagged_data_type_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_get_tagged_data_type_by_identifier(
+     void )
+{
+	uint16_t column_identifiers[ 5 ] = {
+		100, 257, 259, 301, 512 };
+
+	libcerror_error_t *error         = NULL;
+	uint16_t tagged_data_type_offset = 0;
+	uint16_t tagged_data_type_size   = 0;
+	int identifier_index             = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          &( esedb_test_data_definition_record_data1[ 15 ] ),
+	          20,
+	          0x3fff,
+	          256,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "tagged_data_type_offset",
+	 tagged_data_type_offset,
+	 0x000c );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "tagged_data_type_size",
+	 tagged_data_type_size,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          &( esedb_test_data_definition_record_data1[ 15 ] ),
+	          20,
+	          0x3fff,
+	          258,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "tagged_data_type_offset",
+	 tagged_data_type_offset,
+	 0x400e );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "tagged_data_type_size",
+	 tagged_data_type_size,
+	 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          &( esedb_test_data_definition_record_data1[ 15 ] ),
+	          20,
+	          0x3fff,
+	          300,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "tagged_data_type_offset",
+	 tagged_data_type_offset,
+	 0x0011 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "tagged_data_type_size",
+	 tagged_data_type_size,
+	 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( identifier_index = 0;
+	     identifier_index < 5;
+	     identifier_index++ )
+	{
+		result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+		          &( esedb_test_data_definition_record_data1[ 15 ] ),
+		          20,
+		          0x3fff,
+		          column_identifiers[ identifier_index ],
+		          &tagged_data_type_offset,
+		          &tagged_data_type_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test without tagged data types
+	 */
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          &( esedb_test_data_definition_record_data1[ 15 ] ),
+	          0,
+	          0x3fff,
+	          256,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          NULL,
+	          20,
+	          0x3fff,
+	          256,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          &( esedb_test_data_definition_record_data1[ 15 ] ),
+	          (size_t) SSIZE_MAX + 1,
+	          0x3fff,
+	          256,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          &( esedb_test_data_definition_record_data1[ 15 ] ),
+	          20,
+	          0x3fff,
+	          256,
+	          NULL,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          &( esedb_test_data_definition_record_data1[ 15 ] ),
+	          20,
+	          0x3fff,
+	          256,
+	          &tagged_data_type_offset,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with tagged data types data too small to contain the tagged data type index
+	 */
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          &( esedb_test_data_definition_record_data1[ 15 ] ),
+	          8,
+	          0x3fff,
+	          256,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a tagged data type offset that exceeds the tagged data types data size
+	 */
+	result = libesedb_data_definition_get_tagged_data_type_by_identifier(
+	          &( esedb_test_data_definition_record_data1[ 15 ] ),
+	          16,
+	          0x3fff,
+	          300,
+	          &tagged_data_type_offset,
+	          &tagged_data_type_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_data_definition_read_tagged_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_read_tagged_value(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_read_tagged_value(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_data_definition_read_long_value function
  * Returns 1 if successful or 0 if not
  */
@@ -472,6 +1110,10 @@ int main(
 	 "libesedb_data_definition_free",
 	 esedb_test_data_definition_free );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_clone",
+	 esedb_test_data_definition_clone );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_data_definition_read_data",
 	 esedb_test_data_definition_read_data );
@@ -480,6 +1122,18 @@ int main(
 	 "libesedb_data_definition_read_record",
 	 esedb_test_data_definition_read_record );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_get_tagged_data_types_offset",
+	 esedb_test_data_definition_get_tagged_data_types_offset );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_get_tagged_data_type_by_identifier",
+	 esedb_test_data_definition_get_tagged_data_type_by_identifier );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_read_tagged_value",
+	 esedb_test_data_definition_read_tagged_value );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_data_definition_read_long_value",
 	 esedb_test_data_definition_read_long_value );
@@ -37,6 +37,7 @@
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
 
 #include "../libesedb/libesedb_file.h"
 
@@ -1001,18 +1002,1438 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_file_open_memory function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_open_memory(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libesedb_file_t *file            = NULL;
+	uint8_t *data                    = NULL;
+	size64_t data_size               = 0;
+	size_t string_length             = 0;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+	 "data_size",
+	 (uint64_t) data_size,
+	 (uint64_t) SSIZE_MAX );
+
+	data = (uint8_t *) memory_allocate(
+	                    (size_t) data_size );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              data,
+	              (size_t) data_size,
+	              &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) data_size );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_open_memory(
+	          NULL,
+	          data,
+	          (size_t) data_size,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_open_memory(
+	          file,
+	          NULL,
+	          (size_t) data_size,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_open_memory(
+	          file,
+	          data,
+	          0,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_open_memory(
+	          file,
+	          data,
+	          (size_t) data_size,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open
+	 */
+	result = libesedb_file_open_memory(
+	          file,
+	          data,
+	          (size_t) data_size,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open when already opened
+	 */
+	result = libesedb_file_open_memory(
+	          file,
+	          data,
+	          (size_t) data_size,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test close
+	 */
+	result = libesedb_file_close(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libesedb_file_close function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_file_close(
-     void )
+int esedb_test_file_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_file_close(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_open and libesedb_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libesedb_file_t *file    = NULL;
+	libesedb_table_t *table  = NULL;
+	int number_of_tables     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_file_open_wide(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#else
+	result = libesedb_file_open(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#endif
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_close(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_file_open_wide(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#else
+	result = libesedb_file_open(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#endif
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_close(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close with the table definitions read on demand
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_file_open_wide(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	          &error );
+#else
+	result = libesedb_file_open(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	          &error );
+#endif
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_get_number_of_tables(
+	          file,
+	          &number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_tables > 0 )
+	{
+		result = libesedb_file_get_table(
+		          file,
+		          0,
+		          &table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "table",
+		 table );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_free(
+		          &table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libesedb_file_close(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests libesedb_file_get_table with the table definitions read on demand
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_get_table_lazy_catalog(
+     const system_character_t *source )
+{
+	libcerror_error_t *error     = NULL;
+	libesedb_file_t *file        = NULL;
+	libesedb_file_t *lazy_file   = NULL;
+	libesedb_table_t *lazy_table = NULL;
+	libesedb_table_t *table      = NULL;
+	int lazy_number_of_columns   = 0;
+	int lazy_number_of_indexes   = 0;
+	int lazy_number_of_tables    = 0;
+	int number_of_columns        = 0;
+	int number_of_indexes        = 0;
+	int number_of_tables         = 0;
+	int result                   = 0;
+	int table_index              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_file_open_wide(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#else
+	result = libesedb_file_open(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#endif
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_initialize(
+	          &lazy_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "lazy_file",
+	 lazy_file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_file_open_wide(
+	          lazy_file,
+	          source,
+	          LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	          &error );
+#else
+	result = libesedb_file_open(
+	          lazy_file,
+	          source,
+	          LIBESEDB_OPEN_READ_LAZY_CATALOG,
+	          &error );
+#endif
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_get_number_of_tables(
+	          file,
+	          &number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_get_number_of_tables(
+	          lazy_file,
+	          &lazy_number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "lazy_number_of_tables",
+	 lazy_number_of_tables,
+	 number_of_tables );
+
+	/* Test regular cases
+	 */
+	for( table_index = 0;
+	     table_index < number_of_tables;
+	     table_index++ )
+	{
+		result = libesedb_file_get_table(
+		          file,
+		          table_index,
+		          &table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "table",
+		 table );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_file_get_table(
+		          lazy_file,
+		          table_index,
+		          &lazy_table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "lazy_table",
+		 lazy_table );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_get_number_of_columns(
+		          table,
+		          &number_of_columns,
+		          0,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_get_number_of_columns(
+		          lazy_table,
+		          &lazy_number_of_columns,
+		          0,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "lazy_number_of_columns",
+		 lazy_number_of_columns,
+		 number_of_columns );
+
+		result = libesedb_table_get_number_of_indexes(
+		          table,
+		          &number_of_indexes,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_get_number_of_indexes(
+		          lazy_table,
+		          &lazy_number_of_indexes,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "lazy_number_of_indexes",
+		 lazy_number_of_indexes,
+		 number_of_indexes );
+
+		result = libesedb_table_free(
+		          &lazy_table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_free(
+		          &table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libesedb_file_close(
+	          lazy_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_free(
+	          &lazy_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "lazy_file",
+	 lazy_file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_close(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lazy_table != NULL )
+	{
+		libesedb_table_free(
+		 &lazy_table,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( lazy_file != NULL )
+	{
+		libesedb_file_free(
+		 &lazy_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_set_memory_limit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_set_memory_limit(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libesedb_file_t *file    = NULL;
+	size64_t memory_usage    = 0;
+	int result               = 0;
+
+	/* Test open with a memory limit that is too small to hold a page
+	 */
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_set_memory_limit(
+	          file,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_file_open_wide(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#else
+	result = libesedb_file_open(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#endif
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_MEMORY,
+	          LIBESEDB_MEMORY_ERROR_LIMIT_EXCEEDED );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open without a memory limit
+	 */
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_set_memory_limit(
+	          file,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_file_open_wide(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#else
+	result = libesedb_file_open(
+	          file,
+	          source,
+	          LIBESEDB_OPEN_READ,
+	          &error );
+#endif
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_get_memory_usage(
+	          file,
+	          &memory_usage,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "memory_usage",
+	 (int64_t) memory_usage,
+	 (int64_t) 0 );
+
+	/* Test a memory limit that holds the current memory usage
+	 */
+	result = libesedb_file_set_memory_limit(
+	          file,
+	          memory_usage,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_set_memory_limit(
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_memory_usage(
+	          NULL,
+	          &memory_usage,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_memory_usage(
+	          file,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_file_close(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_signal_abort(
+     libesedb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_signal_abort(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_signal_abort(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_get_type function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_get_type(
+     libesedb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_get_type(
+	          file,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_get_type(
+	          NULL,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_type(
+	          file,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_get_page_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_get_page_size(
+     libesedb_file_t *file )
 {
 	libcerror_error_t *error = NULL;
+	uint32_t page_size       = 0;
 	int result               = 0;
 
+	/* Test regular cases
+	 */
+	result = libesedb_file_get_page_size(
+	          file,
+	          &page_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = libesedb_file_close(
+	result = libesedb_file_get_page_size(
+	          NULL,
+	          &page_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_page_size(
+	          file,
 	          NULL,
 	          &error );
 
@@ -1039,20 +2460,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_file_open and libesedb_file_close functions
+/* Tests the libesedb_file_get_number_of_pages function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_file_open_close(
-     const system_character_t *source )
+int esedb_test_file_get_number_of_pages(
+     libesedb_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	libesedb_file_t *file    = NULL;
+	uint32_t number_of_pages = 0;
 	int result               = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = libesedb_file_initialize(
-	          &file,
+	result = libesedb_file_get_number_of_pages(
+	          file,
+	          &number_of_pages,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1060,29 +2482,96 @@ int esedb_test_file_open_close(
 	 result,
 	 1 );
 
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "number_of_pages",
+	 (int32_t) number_of_pages,
+	 (int32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_get_number_of_pages(
+	          NULL,
+	          &number_of_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
+	 "error",
+	 error );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_number_of_pages(
+	          file,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_get_page_information function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_get_page_information(
+     libesedb_file_t *file )
+{
+	libcerror_error_t *error                    = NULL;
+	uint32_t father_data_page_object_identifier = 0;
+	uint32_t number_of_pages                    = 0;
+	uint32_t page_size                          = 0;
+	uint16_t available_data_size                = 0;
+	uint8_t page_type                           = 0;
+	int result                                  = 0;
+
+	/* Initialize test
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libesedb_file_open_wide(
+	result = libesedb_file_get_number_of_pages(
 	          file,
-	          source,
-	          LIBESEDB_OPEN_READ,
+	          &number_of_pages,
 	          &error );
-#else
-	result = libesedb_file_open(
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_get_page_size(
 	          file,
-	          source,
-	          LIBESEDB_OPEN_READ,
+	          &page_size,
 	          &error );
-#endif
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1093,76 +2582,163 @@ int esedb_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libesedb_file_close(
+	/* Test regular cases
+	 * The first page is the root page of the database
+	 */
+	result = libesedb_file_get_page_information(
 	          file,
+	          1,
+	          &father_data_page_object_identifier,
+	          &page_type,
+	          &available_data_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "father_data_page_object_identifier",
+	 father_data_page_object_identifier,
+	 (uint32_t) 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "page_type",
+	 page_type,
+	 (uint8_t) LIBESEDB_PAGE_TYPE_ROOT );
+
+	ESEDB_TEST_ASSERT_LESS_THAN_UINT32(
+	 "available_data_size",
+	 (uint32_t) available_data_size,
+	 page_size );
+
+	/* Test error cases
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libesedb_file_open_wide(
+	result = libesedb_file_get_page_information(
+	          NULL,
+	          1,
+	          &father_data_page_object_identifier,
+	          &page_type,
+	          &available_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_page_information(
 	          file,
-	          source,
-	          LIBESEDB_OPEN_READ,
+	          0,
+	          &father_data_page_object_identifier,
+	          &page_type,
+	          &available_data_size,
 	          &error );
-#else
-	result = libesedb_file_open(
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_page_information(
 	          file,
-	          source,
-	          LIBESEDB_OPEN_READ,
+	          number_of_pages + 1,
+	          &father_data_page_object_identifier,
+	          &page_type,
+	          &available_data_size,
 	          &error );
-#endif
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libesedb_file_close(
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_page_information(
 	          file,
+	          1,
+	          NULL,
+	          &page_type,
+	          &available_data_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_page_information(
+	          file,
+	          1,
+	          &father_data_page_object_identifier,
+	          NULL,
+	          &available_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libesedb_file_free(
-	          &file,
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_page_information(
+	          file,
+	          1,
+	          &father_data_page_object_identifier,
+	          &page_type,
+	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
+	 -1 );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1171,28 +2747,24 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file != NULL )
-	{
-		libesedb_file_free(
-		 &file,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libesedb_file_signal_abort function
+/* Tests the libesedb_file_get_number_of_tables function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_file_signal_abort(
+int esedb_test_file_get_number_of_tables(
      libesedb_file_t *file )
 {
 	libcerror_error_t *error = NULL;
+	int number_of_tables     = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_file_signal_abort(
+	result = libesedb_file_get_number_of_tables(
 	          file,
+	          &number_of_tables,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1206,7 +2778,25 @@ int esedb_test_file_signal_abort(
 
 	/* Test error cases
 	 */
-	result = libesedb_file_signal_abort(
+	result = libesedb_file_get_number_of_tables(
+	          NULL,
+	          &number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_number_of_tables(
+	          file,
 	          NULL,
 	          &error );
 
@@ -1233,21 +2823,172 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_file_get_type function
+/* Reads the first record of the first table that contains records
+ * Returns 1 if a record was read, 0 if no table contains records or -1 on error
+ */
+int esedb_test_file_read_first_record(
+     libesedb_file_t *file,
+     libcerror_error_t **error )
+{
+	libesedb_record_t *record = NULL;
+	libesedb_table_t *table   = NULL;
+	static char *function     = "esedb_test_file_read_first_record";
+	int number_of_records     = 0;
+	int number_of_tables      = 0;
+	int table_index           = 0;
+
+	if( libesedb_file_get_number_of_tables(
+	     file,
+	     &number_of_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tables.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_index = 0;
+	     table_index < number_of_tables;
+	     table_index++ )
+	{
+		if( libesedb_file_get_table(
+		     file,
+		     table_index,
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table: %d.",
+			 function,
+			 table_index );
+
+			goto on_error;
+		}
+		if( libesedb_table_get_number_of_records(
+		     table,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records of table: %d.",
+			 function,
+			 table_index );
+
+			goto on_error;
+		}
+		if( number_of_records > 0 )
+		{
+			if( libesedb_table_get_record(
+			     table,
+			     0,
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: 0 of table: %d.",
+				 function,
+				 table_index );
+
+				goto on_error;
+			}
+			if( libesedb_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libesedb_table_free(
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table: %d.",
+			 function,
+			 table_index );
+
+			goto on_error;
+		}
+		if( number_of_records > 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libesedb_file_get_statistics function
+
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_file_get_type(
+int esedb_test_file_get_statistics(
      libesedb_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t type            = 0;
-	int result               = 0;
+	uint64_t statistics[ LIBESEDB_NUMBER_OF_STATISTICS ];
+
+	libcerror_error_t *error   = NULL;
+	int number_of_records_read = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	number_of_records_read = esedb_test_file_read_first_record(
+	                          file,
+	                          &error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "number_of_records_read",
+	 number_of_records_read,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libesedb_file_get_type(
+	result = libesedb_file_get_statistics(
 	          file,
-	          &type,
+	          statistics,
+	          LIBESEDB_NUMBER_OF_STATISTICS,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1259,11 +3000,36 @@ int esedb_test_file_get_type(
 	 "error",
 	 error );
 
+	/* The pages of the catalog are read when the file is opened
+	 */
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGES_READ ]",
+	 (int64_t) statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGES_READ ],
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGE_BYTES_READ ]",
+	 (int64_t) statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGE_BYTES_READ ],
+	 (int64_t) 0 );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_MISSES ]",
+	 (int64_t) statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_MISSES ],
+	 (int64_t) 0 );
+
+	if( number_of_records_read > 0 )
+	{
+		ESEDB_TEST_ASSERT_NOT_EQUAL_INT64(
+		 "statistics[ LIBESEDB_STATISTIC_NUMBER_OF_RECORDS ]",
+		 (int64_t) statistics[ LIBESEDB_STATISTIC_NUMBER_OF_RECORDS ],
+		 (int64_t) 0 );
+	}
 	/* Test error cases
 	 */
-	result = libesedb_file_get_type(
+	result = libesedb_file_get_statistics(
 	          NULL,
-	          &type,
+	          statistics,
+	          LIBESEDB_NUMBER_OF_STATISTICS,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1278,9 +3044,28 @@ int esedb_test_file_get_type(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_file_get_type(
+	result = libesedb_file_get_statistics(
 	          file,
 	          NULL,
+	          LIBESEDB_NUMBER_OF_STATISTICS,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_statistics(
+	          file,
+	          statistics,
+	          LIBESEDB_NUMBER_OF_STATISTICS + 1,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1306,21 +3091,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_file_get_page_size function
+/* Tests the libesedb_file_reset_statistics function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_file_get_page_size(
+int esedb_test_file_reset_statistics(
      libesedb_file_t *file )
 {
+	uint64_t statistics[ LIBESEDB_NUMBER_OF_STATISTICS ];
+
 	libcerror_error_t *error = NULL;
-	uint32_t page_size       = 0;
 	int result               = 0;
+	int statistic_index      = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_file_get_page_size(
+	result = libesedb_file_reset_statistics(
 	          file,
-	          &page_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1332,27 +3118,33 @@ int esedb_test_file_get_page_size(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libesedb_file_get_page_size(
-	          NULL,
-	          &page_size,
+	result = libesedb_file_get_statistics(
+	          file,
+	          statistics,
+	          LIBESEDB_NUMBER_OF_STATISTICS,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libesedb_file_get_page_size(
-	          file,
+	for( statistic_index = 0;
+	     statistic_index < LIBESEDB_NUMBER_OF_STATISTICS;
+	     statistic_index++ )
+	{
+		ESEDB_TEST_ASSERT_EQUAL_UINT64(
+		 "statistics[ statistic_index ]",
+		 statistics[ statistic_index ],
+		 (uint64_t) 0 );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_file_reset_statistics(
 	          NULL,
 	          &error );
 
@@ -1379,21 +3171,83 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_file_get_number_of_tables function
+/* The trace test data
+ */
+typedef struct esedb_test_file_trace_data esedb_test_file_trace_data_t;
+
+struct esedb_test_file_trace_data
+{
+	/* The number of events
+	 */
+	int number_of_events;
+
+	/* The number of events with an end timestamp before the start timestamp
+	 */
+	int number_of_invalid_events;
+
+	/* The number of record decode events
+	 */
+	int number_of_record_decode_events;
+};
+
+/* The trace test callback function
+ */
+void esedb_test_file_trace_callback(
+      intptr_t *callback_data,
+      int event,
+      uint64_t identifier ESEDB_TEST_ATTRIBUTE_UNUSED,
+      uint64_t start_timestamp,
+      uint64_t end_timestamp,
+      uint64_t size ESEDB_TEST_ATTRIBUTE_UNUSED )
+{
+	esedb_test_file_trace_data_t *trace_data = NULL;
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( identifier )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( size )
+
+	if( callback_data == NULL )
+	{
+		return;
+	}
+	trace_data = (esedb_test_file_trace_data_t *) callback_data;
+
+	trace_data->number_of_events += 1;
+
+	if( end_timestamp < start_timestamp )
+	{
+		trace_data->number_of_invalid_events += 1;
+	}
+	if( event == LIBESEDB_TRACE_EVENT_RECORD_DECODE )
+	{
+		trace_data->number_of_record_decode_events += 1;
+	}
+}
+
+/* Tests the libesedb_file_set_trace_callback function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_file_get_number_of_tables(
+int esedb_test_file_set_trace_callback(
      libesedb_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	int number_of_tables     = 0;
-	int result               = 0;
+	esedb_test_file_trace_data_t trace_data;
+
+	libcerror_error_t *error   = NULL;
+	int number_of_events       = 0;
+	int number_of_records_read = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	trace_data.number_of_events               = 0;
+	trace_data.number_of_invalid_events       = 0;
+	trace_data.number_of_record_decode_events = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_file_get_number_of_tables(
+	result = libesedb_file_set_trace_callback(
 	          file,
-	          &number_of_tables,
+	          &esedb_test_file_trace_callback,
+	          (intptr_t *) &trace_data,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1405,28 +3259,79 @@ int esedb_test_file_get_number_of_tables(
 	 "error",
 	 error );
 
-	/* Test error cases
+	number_of_records_read = esedb_test_file_read_first_record(
+	                          file,
+	                          &error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "number_of_records_read",
+	 number_of_records_read,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records_read > 0 )
+	{
+		ESEDB_TEST_ASSERT_GREATER_THAN_INT(
+		 "trace_data.number_of_events",
+		 trace_data.number_of_events,
+		 0 );
+
+		ESEDB_TEST_ASSERT_GREATER_THAN_INT(
+		 "trace_data.number_of_record_decode_events",
+		 trace_data.number_of_record_decode_events,
+		 0 );
+	}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "trace_data.number_of_invalid_events",
+	 trace_data.number_of_invalid_events,
+	 0 );
+
+	/* Test if tracing is disabled
 	 */
-	result = libesedb_file_get_number_of_tables(
+	result = libesedb_file_set_trace_callback(
+	          file,
+	          NULL,
 	          NULL,
-	          &number_of_tables,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_events = trace_data.number_of_events;
+
+	number_of_records_read = esedb_test_file_read_first_record(
+	                          file,
+	                          &error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "number_of_records_read",
+	 number_of_records_read,
 	 -1 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "trace_data.number_of_events",
+	 trace_data.number_of_events,
+	 number_of_events );
 
-	result = libesedb_file_get_number_of_tables(
-	          file,
+	/* Test error cases
+	 */
+	result = libesedb_file_set_trace_callback(
 	          NULL,
+	          &esedb_test_file_trace_callback,
+	          (intptr_t *) &trace_data,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1449,6 +3354,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	libesedb_file_set_trace_callback(
+	 file,
+	 NULL,
+	 NULL,
+	 NULL );
+
 	return( 0 );
 }
 
@@ -1588,6 +3499,11 @@ int main(
 		 esedb_test_file_open_file_io_handle,
 		 source );
 
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_open_memory",
+		 esedb_test_file_open_memory,
+		 source );
+
 		ESEDB_TEST_RUN(
 		 "libesedb_file_close",
 		 esedb_test_file_close );
@@ -1597,6 +3513,16 @@ int main(
 		 esedb_test_file_open_close,
 		 source );
 
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_get_table_lazy_catalog",
+		 esedb_test_file_get_table_lazy_catalog,
+		 source );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_set_memory_limit",
+		 esedb_test_file_set_memory_limit,
+		 source );
+
 		/* Initialize file for tests
 		 */
 		result = esedb_test_file_open_source(
@@ -1642,6 +3568,31 @@ int main(
 		 esedb_test_file_get_page_size,
 		 file );
 
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_get_number_of_pages",
+		 esedb_test_file_get_number_of_pages,
+		 file );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_get_page_information",
+		 esedb_test_file_get_page_information,
+		 file );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_get_statistics",
+		 esedb_test_file_get_statistics,
+		 file );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_reset_statistics",
+		 esedb_test_file_reset_statistics,
+		 file );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_set_trace_callback",
+		 esedb_test_file_set_trace_callback,
+		 file );
+
 		ESEDB_TEST_RUN_WITH_ARGS(
 		 "libesedb_file_get_number_of_tables",
 		 esedb_test_file_get_number_of_tables,
@@ -21,12 +21,16 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_getopt.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
@@ -34,6 +38,145 @@
 #include "esedb_test_unused.h"
 
 #include "../libesedb/libesedb_index.h"
+#include "../libesedb/libesedb_page_tree.h"
+#include "../libesedb/libesedb_page_tree_key.h"
+#include "../libesedb/libesedb_record.h"
+
+#if !defined( LIBESEDB_HAVE_BFIO )
+
+LIBESEDB_EXTERN \
+int libesedb_file_open_file_io_handle(
+     libesedb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libesedb_error_t **error );
+
+#endif /* !defined( LIBESEDB_HAVE_BFIO ) */
+
+/* Creates and opens a source file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_index_open_source(
+     libesedb_file_t **file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_index_open_source";
+	int result            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_file_open_file_io_handle(
+	          *file,
+	          file_io_handle,
+	          LIBESEDB_OPEN_READ,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libesedb_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a source file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_index_close_source(
+     libesedb_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_index_close_source";
+	int result            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
 
 /* Tests the libesedb_index_free function
  * Returns 1 if successful or 0 if not
@@ -73,25 +216,578 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_index_get_record_key_size and libesedb_index_get_record_key functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_record_key(
+     libesedb_index_t *index )
+{
+	uint8_t key[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t key_size          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_get_record_key_size(
+	          index,
+	          0,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( key_size <= 256 )
+	{
+		result = libesedb_index_get_record_key(
+		          index,
+		          0,
+		          key,
+		          key_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_index_get_record_key_size(
+	          NULL,
+	          0,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record_key_size(
+	          index,
+	          -1,
+	          &key_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record_key_size(
+	          index,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record_key(
+	          NULL,
+	          0,
+	          key,
+	          256,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record_key(
+	          index,
+	          0,
+	          NULL,
+	          256,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( key_size > 0 )
+	{
+		result = libesedb_index_get_record_key(
+		          index,
+		          0,
+		          key,
+		          key_size - 1,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_get_record_bookmark_size and libesedb_index_get_record_bookmark functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_record_bookmark(
+     libesedb_index_t *index )
+{
+	uint8_t bookmark[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t bookmark_size     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_get_record_bookmark_size(
+	          index,
+	          0,
+	          &bookmark_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( bookmark_size <= 256 )
+	{
+		result = libesedb_index_get_record_bookmark(
+		          index,
+		          0,
+		          bookmark,
+		          bookmark_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_index_get_record_bookmark_size(
+	          NULL,
+	          0,
+	          &bookmark_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record_bookmark_size(
+	          index,
+	          -1,
+	          &bookmark_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record_bookmark_size(
+	          index,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record_bookmark(
+	          NULL,
+	          0,
+	          bookmark,
+	          256,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_record_bookmark(
+	          index,
+	          0,
+	          NULL,
+	          256,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( bookmark_size > 0 )
+	{
+		result = libesedb_index_get_record_bookmark(
+		          index,
+		          0,
+		          bookmark,
+		          bookmark_size - 1,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Tests that the bookmark of an index record is the key of the record in the table
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_record_bookmark_matches_record_key(
+     libesedb_index_t *index )
+{
+	uint8_t bookmark[ 256 ];
+
+	libcerror_error_t *error           = NULL;
+	libesedb_internal_record_t *record = NULL;
+	libesedb_page_tree_key_t *key      = NULL;
+	size_t bookmark_size               = 0;
+	int number_of_records              = 0;
+	int record_entry                   = 0;
+	int result                         = 0;
+
+	result = libesedb_index_get_number_of_records(
+	          index,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( record_entry = 0;
+	     ( record_entry < number_of_records ) && ( record_entry < 16 );
+	     record_entry++ )
+	{
+		result = libesedb_index_get_record_bookmark_size(
+		          index,
+		          record_entry,
+		          &bookmark_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( bookmark_size > 256 )
+		{
+			continue;
+		}
+		result = libesedb_index_get_record_bookmark(
+		          index,
+		          record_entry,
+		          bookmark,
+		          bookmark_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_index_get_record(
+		          index,
+		          record_entry,
+		          (libesedb_record_t **) &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_tree_get_leaf_value_key(
+		          ( (libesedb_internal_index_t *) index )->table_page_tree,
+		          ( (libesedb_internal_index_t *) index )->file_io_handle,
+		          record->data_definition,
+		          &key,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "key",
+		 key );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "key->data_size",
+		 key->data_size,
+		 bookmark_size );
+
+		result = memory_compare(
+		          key->data,
+		          bookmark,
+		          bookmark_size );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libesedb_page_tree_key_free(
+		          &key,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_record_free(
+		          (libesedb_record_t **) &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &key,
+		 NULL );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 (libesedb_record_t **) &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libesedb_file_t *file            = NULL;
+	libesedb_index_t *index          = NULL;
+	libesedb_table_t *table          = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int index_entry                  = 0;
+	int number_of_indexes            = 0;
+	int number_of_records            = 0;
+	int number_of_tables             = 0;
+	int result                       = 0;
+	int table_entry                  = 0;
+
+	while( ( option = esedb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
 
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 	/* TODO: add tests for libesedb_index_initialize */
@@ -102,27 +798,330 @@ int main(
 	 "libesedb_index_free",
 	 esedb_test_index_free );
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Initialize file for tests
+		 */
+		result = esedb_test_index_open_source(
+		          &file,
+		          file_io_handle,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_file_get_number_of_tables(
+		          file,
+		          &number_of_tables,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Find an index with records for the tests
+	 */
+	for( table_entry = 0;
+	     table_entry < number_of_tables;
+	     table_entry++ )
+	{
+		result = libesedb_file_get_table(
+		          file,
+		          table_entry,
+		          &table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_get_number_of_indexes(
+		          table,
+		          &number_of_indexes,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	/* TODO: add tests for libesedb_index_get_identifier */
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* TODO: add tests for libesedb_index_get_utf8_name_size */
+		for( index_entry = 0;
+		     index_entry < number_of_indexes;
+		     index_entry++ )
+		{
+			result = libesedb_table_get_index(
+			          table,
+			          index_entry,
+			          &index,
+			          &error );
 
-	/* TODO: add tests for libesedb_index_get_utf8_name */
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
 
-	/* TODO: add tests for libesedb_index_get_utf16_name_size */
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
 
-	/* TODO: add tests for libesedb_index_get_utf16_name */
+			result = libesedb_index_get_number_of_records(
+			          index,
+			          &number_of_records,
+			          &error );
 
-	/* TODO: add tests for libesedb_index_get_number_of_records */
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
 
-	/* TODO: add tests for libesedb_index_get_record */
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( number_of_records > 0 )
+			{
+				break;
+			}
+			result = libesedb_index_free(
+			          &index,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		if( index != NULL )
+		{
+			break;
+		}
+		result = libesedb_table_free(
+		          &table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( index != NULL )
+	{
+		/* TODO: add tests for libesedb_index_get_identifier */
+
+		/* TODO: add tests for libesedb_index_get_utf8_name_size */
+
+		/* TODO: add tests for libesedb_index_get_utf8_name */
+
+		/* TODO: add tests for libesedb_index_get_utf16_name_size */
+
+		/* TODO: add tests for libesedb_index_get_utf16_name */
+
+		/* TODO: add tests for libesedb_index_get_number_of_records */
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_index_get_record_key",
+		 esedb_test_index_get_record_key,
+		 index );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_index_get_record_bookmark",
+		 esedb_test_index_get_record_bookmark,
+		 index );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_index_get_record_bookmark_matches_record_key",
+		 esedb_test_index_get_record_bookmark_matches_record_key,
+		 index );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
+		/* TODO: add tests for libesedb_index_get_record */
+
+		/* Clean up
+		 */
+		result = libesedb_index_free(
+		          &index,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "index",
+		 index );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_free(
+		          &table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "table",
+		 table );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file != NULL )
+	{
+		result = esedb_test_index_close_source(
+		          &file,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "file",
+		 file );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		libesedb_index_free(
+		 &index,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
@@ -398,6 +398,1201 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_io_handle_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_get_statistics(
+     void )
+{
+	uint64_t statistics[ LIBESEDB_NUMBER_OF_STATISTICS ];
+
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGES_READ ] = 3;
+	io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_LOOKUPS ]  = 5;
+	io_handle->statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_MISSES ]   = 2;
+	io_handle->statistics[ LIBESEDB_STATISTIC_NUMBER_OF_RECORDS ]    = 7;
+
+	/* Test regular cases
+	 */
+	result = libesedb_io_handle_get_statistics(
+	          io_handle,
+	          statistics,
+	          LIBESEDB_NUMBER_OF_STATISTICS,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGES_READ ]",
+	 statistics[ LIBESEDB_STATISTIC_NUMBER_OF_PAGES_READ ],
+	 (uint64_t) 3 );
+
+	/* The cache hits are the cache lookups that were not a miss
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_HITS ]",
+	 statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_HITS ],
+	 (uint64_t) 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_MISSES ]",
+	 statistics[ LIBESEDB_STATISTIC_PAGES_CACHE_MISSES ],
+	 (uint64_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBESEDB_STATISTIC_NUMBER_OF_RECORDS ]",
+	 statistics[ LIBESEDB_STATISTIC_NUMBER_OF_RECORDS ],
+	 (uint64_t) 7 );
+
+	/* Test retrieving a part of the statistics
+	 */
+	statistics[ LIBESEDB_STATISTIC_NUMBER_OF_RECORDS ] = 0;
+
+	result = libesedb_io_handle_get_statistics(
+	          io_handle,
+	          statistics,
+	          LIBESEDB_STATISTIC_NUMBER_OF_RECORDS,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBESEDB_STATISTIC_NUMBER_OF_RECORDS ]",
+	 statistics[ LIBESEDB_STATISTIC_NUMBER_OF_RECORDS ],
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_get_statistics(
+	          NULL,
+	          statistics,
+	          LIBESEDB_NUMBER_OF_STATISTICS,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_get_statistics(
+	          io_handle,
+	          NULL,
+	          LIBESEDB_NUMBER_OF_STATISTICS,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_get_statistics(
+	          io_handle,
+	          statistics,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_get_statistics(
+	          io_handle,
+	          statistics,
+	          LIBESEDB_NUMBER_OF_STATISTICS + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_reset_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_reset_statistics(
+     void )
+{
+	uint64_t statistics[ LIBESEDB_NUMBER_OF_STATISTICS ];
+
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+	int statistic_index             = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( statistic_index = 0;
+	     statistic_index < LIBESEDB_NUMBER_OF_STATISTICS;
+	     statistic_index++ )
+	{
+		io_handle->statistics[ statistic_index ] = (uint64_t) statistic_index + 1;
+	}
+	/* Test regular cases
+	 */
+	result = libesedb_io_handle_reset_statistics(
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_get_statistics(
+	          io_handle,
+	          statistics,
+	          LIBESEDB_NUMBER_OF_STATISTICS,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( statistic_index = 0;
+	     statistic_index < LIBESEDB_NUMBER_OF_STATISTICS;
+	     statistic_index++ )
+	{
+		ESEDB_TEST_ASSERT_EQUAL_UINT64(
+		 "statistics[ statistic_index ]",
+		 statistics[ statistic_index ],
+		 (uint64_t) 0 );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_reset_statistics(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	/* Test libesedb_io_handle_reset_statistics with memset failing
+	 */
+	esedb_test_memset_attempts_before_fail = 0;
+
+	result = libesedb_io_handle_reset_statistics(
+	          io_handle,
+	          &error );
+
+	if( esedb_test_memset_attempts_before_fail != -1 )
+	{
+		esedb_test_memset_attempts_before_fail = -1;
+	}
+	else
+	{
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_set_memory_limit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_set_memory_limit(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_io_handle_set_memory_limit(
+	          io_handle,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->memory_limit",
+	 (uint64_t) io_handle->memory_limit,
+	 (uint64_t) 100 );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_set_memory_limit(
+	          NULL,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_get_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_get_memory_usage(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	size64_t memory_usage           = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_io_handle_get_memory_usage(
+	          io_handle,
+	          &memory_usage,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_get_memory_usage(
+	          NULL,
+	          &memory_usage,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_get_memory_usage(
+	          io_handle,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_check_memory_limit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_check_memory_limit(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, where every size can be held without a memory limit
+	 */
+	result = libesedb_io_handle_check_memory_limit(
+	          io_handle,
+	          (size64_t) UINT64_MAX,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_set_memory_limit(
+	          io_handle,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->memory_usage = 60;
+
+	/* Test a size that reaches the memory limit
+	 */
+	result = libesedb_io_handle_check_memory_limit(
+	          io_handle,
+	          40,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size that exceeds the memory limit
+	 */
+	result = libesedb_io_handle_check_memory_limit(
+	          io_handle,
+	          41,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_check_memory_limit(
+	          io_handle,
+	          101,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_check_memory_limit(
+	          NULL,
+	          40,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_add_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_add_memory_usage(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	size64_t memory_usage           = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_set_memory_limit(
+	          io_handle,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_io_handle_add_memory_usage(
+	          io_handle,
+	          60,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_get_memory_usage(
+	          io_handle,
+	          &memory_usage,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 60 );
+
+	/* Test a size that exceeds the memory limit
+	 */
+	result = libesedb_io_handle_add_memory_usage(
+	          io_handle,
+	          41,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_MEMORY,
+	          LIBESEDB_MEMORY_ERROR_LIMIT_EXCEEDED );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_get_memory_usage(
+	          io_handle,
+	          &memory_usage,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 60 );
+
+	/* Test a size that reaches the memory limit
+	 */
+	result = libesedb_io_handle_add_memory_usage(
+	          io_handle,
+	          40,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_get_memory_usage(
+	          io_handle,
+	          &memory_usage,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 100 );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_add_memory_usage(
+	          NULL,
+	          40,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_remove_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_remove_memory_usage(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	size64_t memory_usage           = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_set_memory_limit(
+	          io_handle,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_add_memory_usage(
+	          io_handle,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_io_handle_remove_memory_usage(
+	          io_handle,
+	          30,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_get_memory_usage(
+	          io_handle,
+	          &memory_usage,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 70 );
+
+	/* Test if the memory can be added again after it was removed
+	 */
+	result = libesedb_io_handle_add_memory_usage(
+	          io_handle,
+	          30,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_get_memory_usage(
+	          io_handle,
+	          &memory_usage,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 100 );
+
+	/* Test a size that exceeds the memory usage
+	 */
+	result = libesedb_io_handle_remove_memory_usage(
+	          io_handle,
+	          200,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_get_memory_usage(
+	          io_handle,
+	          &memory_usage,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_remove_memory_usage(
+	          NULL,
+	          30,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -433,6 +1628,40 @@ int main(
 
 	/* TODO: add tests for libesedb_io_handle_read_page */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_get_statistics",
+	 esedb_test_io_handle_get_statistics );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_reset_statistics",
+	 esedb_test_io_handle_reset_statistics );
+
+	/* TODO: add tests for libesedb_io_handle_set_trace_callback */
+
+	/* TODO: add tests for libesedb_io_handle_get_trace_timestamp */
+
+	/* TODO: add tests for libesedb_io_handle_trace_event */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_get_memory_usage",
+	 esedb_test_io_handle_get_memory_usage );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_set_memory_limit",
+	 esedb_test_io_handle_set_memory_limit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_check_memory_limit",
+	 esedb_test_io_handle_check_memory_limit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_add_memory_usage",
+	 esedb_test_io_handle_add_memory_usage );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_remove_memory_usage",
+	 esedb_test_io_handle_remove_memory_usage );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
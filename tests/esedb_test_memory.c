@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
@@ -45,6 +46,10 @@ int esedb_test_memcpy_attempts_before_fail                           = -1;
 int esedb_test_memset_attempts_before_fail                           = -1;
 int esedb_test_realloc_attempts_before_fail                          = -1;
 
+/* The number of successful malloc and realloc calls
+ */
+uint64_t esedb_test_number_of_allocations                            = 0;
+
 /* Custom malloc for testing memory error cases
  * Note this function might fail if compiled with optimation
  * Returns a pointer to newly allocated data or NULL
@@ -73,6 +78,10 @@ void *malloc(
 	ptr = esedb_test_real_malloc(
 	       size );
 
+	if( ptr != NULL )
+	{
+		esedb_test_number_of_allocations++;
+	}
 	return( ptr );
 }
 
@@ -170,6 +179,10 @@ void *realloc(
 	       ptr,
 	       size );
 
+	if( ptr != NULL )
+	{
+		esedb_test_number_of_allocations++;
+	}
 	return( ptr );
 }
 
@@ -23,6 +23,7 @@
 #define _ESEDB_TEST_MEMORY_H
 
 #include <common.h>
+#include <types.h>
 
 #if defined( __cplusplus )
 extern "C" {
@@ -42,6 +43,8 @@ extern int esedb_test_memset_attempts_before_fail;
 
 extern int esedb_test_realloc_attempts_before_fail;
 
+extern uint64_t esedb_test_number_of_allocations;
+
 #endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
 
 #if defined( __cplusplus )
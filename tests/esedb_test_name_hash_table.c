@@ -0,0 +1,904 @@
+/*
+ * Library name_hash_table type test program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_name_hash_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+#define ESEDB_TEST_NAME_HASH_TABLE_NUMBER_OF_NAMES	64
+
+/* Sets the name of a catalog definition
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_name_hash_table_set_catalog_definition_name(
+     libesedb_catalog_definition_t *catalog_definition,
+     const char *name )
+{
+	size_t name_size = 0;
+
+	name_size = narrow_string_length(
+	             name ) + 1;
+
+	catalog_definition->name = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * name_size );
+
+	if( catalog_definition->name == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     catalog_definition->name,
+	     name,
+	     name_size ) == NULL )
+	{
+		return( -1 );
+	}
+	catalog_definition->name_size = name_size;
+
+	return( 1 );
+}
+
+/* Tests the libesedb_name_hash_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_name_hash_table_initialize(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libesedb_name_hash_table_t *name_hash_table = NULL;
+	int result                                  = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests             = 1;
+	int number_of_memset_fail_tests             = 1;
+	int test_number                             = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_name_hash_table_initialize(
+	          &name_hash_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_free(
+	          &name_hash_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_name_hash_table_initialize(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_hash_table = (libesedb_name_hash_table_t *) 0x12345678UL;
+
+	result = libesedb_name_hash_table_initialize(
+	          &name_hash_table,
+	          &error );
+
+	name_hash_table = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_name_hash_table_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_name_hash_table_initialize(
+		          &name_hash_table,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( name_hash_table != NULL )
+			{
+				libesedb_name_hash_table_free(
+				 &name_hash_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "name_hash_table",
+			 name_hash_table );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_name_hash_table_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_name_hash_table_initialize(
+		          &name_hash_table,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( name_hash_table != NULL )
+			{
+				libesedb_name_hash_table_free(
+				 &name_hash_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "name_hash_table",
+			 name_hash_table );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_hash_table != NULL )
+	{
+		libesedb_name_hash_table_free(
+		 &name_hash_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_name_hash_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_name_hash_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_name_hash_table_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_name_hash_table_calculate_hash_from_byte_stream, libesedb_name_hash_table_calculate_hash_from_utf8_string
+ * and libesedb_name_hash_table_calculate_hash_from_utf16_string functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_name_hash_table_calculate_hash(
+     void )
+{
+	uint16_t utf16_string[ 7 ] = {
+		'M', 's', 'g', 0x00e9, 'F', 'o', 'o' };
+
+	uint8_t byte_stream[ 8 ] = {
+		'M', 's', 'g', 0xe9, 'F', 'o', 'o', 0 };
+
+	uint8_t utf8_string[ 8 ] = {
+		'M', 's', 'g', 0xc3, 0xa9, 'F', 'o', 'o' };
+
+	libcerror_error_t *error  = NULL;
+	uint32_t byte_stream_hash = 0;
+	uint32_t utf16_hash       = 0;
+	uint32_t utf8_hash        = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	          byte_stream,
+	          8,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &byte_stream_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf8_string(
+	          utf8_string,
+	          8,
+	          &utf8_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "utf8_hash",
+	 utf8_hash,
+	 byte_stream_hash );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf16_string(
+	          utf16_string,
+	          7,
+	          &utf16_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "utf16_hash",
+	 utf16_hash,
+	 byte_stream_hash );
+
+	/* Test error cases
+	 */
+	result = libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	          NULL,
+	          8,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          &byte_stream_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_byte_stream(
+	          byte_stream,
+	          8,
+	          LIBESEDB_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf8_string(
+	          NULL,
+	          8,
+	          &utf8_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_calculate_hash_from_utf16_string(
+	          NULL,
+	          7,
+	          &utf16_hash,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_name_hash_table_insert_value and libesedb_name_hash_table_get_value_by_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_name_hash_table_insert_value(
+     void )
+{
+	char name[ 16 ];
+
+	libesedb_catalog_definition_t *catalog_definitions[ ESEDB_TEST_NAME_HASH_TABLE_NUMBER_OF_NAMES ];
+
+	uint16_t utf16_name[ 7 ] = {
+		'N', 'a', 'm', 'e', '_', '1', '7' };
+
+	libcerror_error_t *error                          = NULL;
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_name_hash_table_t *name_hash_table       = NULL;
+	intptr_t *value                                   = NULL;
+	int definition_index                              = 0;
+	int result                                        = 0;
+
+	for( definition_index = 0;
+	     definition_index < ESEDB_TEST_NAME_HASH_TABLE_NUMBER_OF_NAMES;
+	     definition_index++ )
+	{
+		catalog_definitions[ definition_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libesedb_name_hash_table_initialize(
+	          &name_hash_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( definition_index = 0;
+	     definition_index < ESEDB_TEST_NAME_HASH_TABLE_NUMBER_OF_NAMES;
+	     definition_index++ )
+	{
+		result = libesedb_catalog_definition_initialize(
+		          &( catalog_definitions[ definition_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		narrow_string_snprintf(
+		 name,
+		 16,
+		 "Name_%d",
+		 definition_index );
+
+		catalog_definitions[ definition_index ]->identifier = (uint32_t) definition_index;
+
+		result = esedb_test_name_hash_table_set_catalog_definition_name(
+		          catalog_definitions[ definition_index ],
+		          name );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libesedb_name_hash_table_insert_value(
+		          name_hash_table,
+		          catalog_definitions[ definition_index ],
+		          (intptr_t *) catalog_definitions[ definition_index ],
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "name_hash_table->number_of_entries",
+	 name_hash_table->number_of_entries,
+	 ESEDB_TEST_NAME_HASH_TABLE_NUMBER_OF_NAMES );
+
+	/* Test inserting a duplicate name keeps the first value
+	 */
+	result = libesedb_name_hash_table_insert_value(
+	          name_hash_table,
+	          catalog_definitions[ 3 ],
+	          (intptr_t *) catalog_definitions[ 5 ],
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_get_value_by_name(
+	          name_hash_table,
+	          (uint8_t *) "Name_3",
+	          7,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value->identifier",
+	 ( (libesedb_catalog_definition_t *) value )->identifier,
+	 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_get_value_by_utf8_name(
+	          name_hash_table,
+	          (uint8_t *) "Name_42",
+	          7,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value->identifier",
+	 ( (libesedb_catalog_definition_t *) value )->identifier,
+	 42 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_get_value_by_utf16_name(
+	          name_hash_table,
+	          utf16_name,
+	          7,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value->identifier",
+	 ( (libesedb_catalog_definition_t *) value )->identifier,
+	 17 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_name_hash_table_get_value_by_utf8_name(
+	          name_hash_table,
+	          (uint8_t *) "Name_99",
+	          7,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inserting a catalog definition without a name
+	 */
+	result = libesedb_catalog_definition_initialize(
+	          &catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_name_hash_table_insert_value(
+	          name_hash_table,
+	          catalog_definition,
+	          (intptr_t *) catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_name_hash_table_insert_value(
+	          NULL,
+	          catalog_definitions[ 0 ],
+	          (intptr_t *) catalog_definitions[ 0 ],
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_insert_value(
+	          name_hash_table,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_get_value_by_name(
+	          NULL,
+	          (uint8_t *) "Name_3",
+	          7,
+	          &value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_table_get_value_by_name(
+	          name_hash_table,
+	          (uint8_t *) "Name_3",
+	          7,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_name_hash_table_free(
+	          &name_hash_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "name_hash_table",
+	 name_hash_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_definition_free(
+	          &catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( definition_index = 0;
+	     definition_index < ESEDB_TEST_NAME_HASH_TABLE_NUMBER_OF_NAMES;
+	     definition_index++ )
+	{
+		result = libesedb_catalog_definition_free(
+		          &( catalog_definitions[ definition_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_hash_table != NULL )
+	{
+		libesedb_name_hash_table_free(
+		 &name_hash_table,
+		 NULL );
+	}
+	if( catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &catalog_definition,
+		 NULL );
+	}
+	for( definition_index = 0;
+	     definition_index < ESEDB_TEST_NAME_HASH_TABLE_NUMBER_OF_NAMES;
+	     definition_index++ )
+	{
+		if( catalog_definitions[ definition_index ] != NULL )
+		{
+			libesedb_catalog_definition_free(
+			 &( catalog_definitions[ definition_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_name_hash_table_initialize",
+	 esedb_test_name_hash_table_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_name_hash_table_free",
+	 esedb_test_name_hash_table_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_name_hash_table_calculate_hash",
+	 esedb_test_name_hash_table_calculate_hash );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_name_hash_table_insert_value",
+	 esedb_test_name_hash_table_insert_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -1770,6 +1770,79 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_get_available_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_get_available_data_size(
+     libesedb_page_t *page )
+{
+	libcerror_error_t *error     = NULL;
+	uint16_t available_data_size = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_get_available_data_size(
+	          page,
+	          &available_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "available_data_size",
+	 available_data_size,
+	 (uint16_t) 4036 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_get_available_data_size(
+	          NULL,
+	          &available_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_get_available_data_size(
+	          page,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
 /* Tests the libesedb_page_get_flags function
  * Returns 1 if successful or 0 if not
  */
@@ -1843,6 +1916,79 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_get_type function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_get_type(
+     libesedb_page_t *page )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t page_type        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_get_type(
+	          page,
+	          &page_type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "page_type",
+	 page_type,
+	 (uint8_t) LIBESEDB_PAGE_TYPE_ROOT );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_get_type(
+	          NULL,
+	          &page_type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_get_type(
+	          page,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
 /* Tests the libesedb_page_get_number_of_values function
  * Returns 1 if successful or 0 if not
  */
@@ -2164,11 +2310,21 @@ int main(
 	 esedb_test_page_get_father_data_page_object_identifier,
 	 page );
 
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_page_get_available_data_size",
+	 esedb_test_page_get_available_data_size,
+	 page );
+
 	ESEDB_TEST_RUN_WITH_ARGS(
 	 "libesedb_page_get_flags",
 	 esedb_test_page_get_flags,
 	 page );
 
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_page_get_type",
+	 esedb_test_page_get_type,
+	 page );
+
 	ESEDB_TEST_RUN_WITH_ARGS(
 	 "libesedb_page_get_number_of_values",
 	 esedb_test_page_get_number_of_values,
@@ -700,6 +700,79 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_header_get_available_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_header_get_available_data_size(
+     libesedb_page_header_t *page_header )
+{
+	libcerror_error_t *error     = NULL;
+	uint16_t available_data_size = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_header_get_available_data_size(
+	          page_header,
+	          &available_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "available_data_size",
+	 available_data_size,
+	 (uint16_t) 4036 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_header_get_available_data_size(
+	          NULL,
+	          &available_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_header_get_available_data_size(
+	          page_header,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
 /* Tests the libesedb_page_header_get_flags function
  * Returns 1 if successful or 0 if not
  */
@@ -887,6 +960,11 @@ int main(
 	 esedb_test_page_header_get_father_data_page_object_identifier,
 	 page_header );
 
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_page_header_get_available_data_size",
+	 esedb_test_page_header_get_available_data_size,
+	 page_header );
+
 	ESEDB_TEST_RUN_WITH_ARGS(
 	 "libesedb_page_header_get_flags",
 	 esedb_test_page_header_get_flags,
@@ -455,14 +455,22 @@ int main(
 
 	/* TODO: add tests for libesedb_page_tree_get_number_of_leaf_values */
 
+	/* TODO: add tests for libesedb_page_tree_get_space_statistics_from_page */
+
+	/* TODO: add tests for libesedb_page_tree_get_space_statistics */
+
 	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_index_from_page */
 
 	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_index */
 
+	/* TODO: add tests for libesedb_page_tree_get_leaf_value_key */
+
 	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_key_from_page */
 
 	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_key */
 
+	/* TODO: add tests for libesedb_page_tree_carve_leaf_values */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
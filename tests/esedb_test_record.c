@@ -106,6 +106,12 @@ int main(
 
 	/* TODO: add tests for libesedb_record_get_number_of_values */
 
+	/* TODO: add tests for libesedb_record_get_page_number */
+
+	/* TODO: add tests for libesedb_record_get_data_offset */
+
+	/* TODO: add tests for libesedb_record_get_carve_confidence */
+
 	/* TODO: add tests for libesedb_record_get_column_catalog_definition */
 
 	/* TODO: add tests for libesedb_record_get_column_identifier */
@@ -0,0 +1,957 @@
+/*
+ * Library record_layout type test program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_record_layout.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_record_layout_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libesedb_record_layout_t *record_layout = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 2;
+	int number_of_memset_fail_tests         = 2;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_record_layout_initialize(
+	          &record_layout,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_layout",
+	 record_layout );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_layout_free(
+	          &record_layout,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_layout",
+	 record_layout );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_layout = (libesedb_record_layout_t *) 0x12345678UL;
+
+	result = libesedb_record_layout_initialize(
+	          &record_layout,
+	          4,
+	          &error );
+
+	record_layout = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_layout_initialize(
+	          &record_layout,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_layout",
+	 record_layout );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_record_layout_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_record_layout_initialize(
+		          &record_layout,
+		          4,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( record_layout != NULL )
+			{
+				libesedb_record_layout_free(
+				 &record_layout,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "record_layout",
+			 record_layout );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_record_layout_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_record_layout_initialize(
+		          &record_layout,
+		          4,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( record_layout != NULL )
+			{
+				libesedb_record_layout_free(
+				 &record_layout,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "record_layout",
+			 record_layout );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_layout != NULL )
+	{
+		libesedb_record_layout_free(
+		 &record_layout,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_layout_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_layout_append_column function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_append_column(
+     void )
+{
+	libesedb_catalog_definition_t *catalog_definitions[ 4 ] = {
+		NULL, NULL, NULL, NULL };
+
+	uint32_t column_identifiers[ 4 ] = {
+		1, 2, 128, 256 };
+
+	uint32_t column_sizes[ 4 ] = {
+		4, 8, 0, 0 };
+
+	uint32_t column_types[ 4 ] = {
+		LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+		LIBESEDB_COLUMN_TYPE_DATE_TIME,
+		LIBESEDB_COLUMN_TYPE_TEXT,
+		LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA };
+
+	libcerror_error_t *error                = NULL;
+	libesedb_record_layout_t *record_layout = NULL;
+	int definition_index                    = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	for( definition_index = 0;
+	     definition_index < 4;
+	     definition_index++ )
+	{
+		result = libesedb_catalog_definition_initialize(
+		          &( catalog_definitions[ definition_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "catalog_definition",
+		 catalog_definitions[ definition_index ] );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		catalog_definitions[ definition_index ]->type        = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+		catalog_definitions[ definition_index ]->identifier  = column_identifiers[ definition_index ];
+		catalog_definitions[ definition_index ]->column_type = column_types[ definition_index ];
+		catalog_definitions[ definition_index ]->size        = column_sizes[ definition_index ];
+	}
+	result = libesedb_record_layout_initialize(
+	          &record_layout,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_layout",
+	 record_layout );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( definition_index = 0;
+	     definition_index < 4;
+	     definition_index++ )
+	{
+		result = libesedb_record_layout_append_column(
+		          record_layout,
+		          catalog_definitions[ definition_index ],
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_layout->number_of_columns",
+	 record_layout->number_of_columns,
+	 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_layout->number_of_fixed_size_columns",
+	 record_layout->number_of_fixed_size_columns,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_layout->number_of_variable_size_columns",
+	 record_layout->number_of_variable_size_columns,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_layout->number_of_tagged_columns",
+	 record_layout->number_of_tagged_columns,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "record_layout->fixed_size_columns_data_size",
+	 record_layout->fixed_size_columns_data_size,
+	 12 );
+
+	/* The fixed size columns data starts after the 4 byte data definition header
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "record_layout->columns[ 0 ].data_offset",
+	 record_layout->columns[ 0 ].data_offset,
+	 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "record_layout->columns[ 0 ].data_size",
+	 record_layout->columns[ 0 ].data_size,
+	 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "record_layout->columns[ 1 ].data_offset",
+	 record_layout->columns[ 1 ].data_offset,
+	 8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "record_layout->columns[ 1 ].data_size",
+	 record_layout->columns[ 1 ].data_size,
+	 8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "record_layout->columns[ 2 ].identifier",
+	 record_layout->columns[ 2 ].identifier,
+	 128 );
+
+	/* A text column without a codepage uses the default codepage of the file
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_layout->columns[ 2 ].encoding",
+	 record_layout->columns[ 2 ].encoding,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "record_layout->columns[ 3 ].identifier",
+	 record_layout->columns[ 3 ].identifier,
+	 256 );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_append_column(
+	          NULL,
+	          catalog_definitions[ 0 ],
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libesedb_record_layout_append_column with more columns than the maximum
+	 */
+	result = libesedb_record_layout_append_column(
+	          record_layout,
+	          catalog_definitions[ 0 ],
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_layout_free(
+	          &record_layout,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_layout",
+	 record_layout );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libesedb_record_layout_append_column with a column catalog definition of an unsupported column type
+	 */
+	result = libesedb_record_layout_initialize(
+	          &record_layout,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_layout",
+	 record_layout );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	catalog_definitions[ 0 ]->column_type = 0xffff;
+
+	result = libesedb_record_layout_append_column(
+	          record_layout,
+	          catalog_definitions[ 0 ],
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_layout_append_column(
+	          record_layout,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_layout_free(
+	          &record_layout,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_layout",
+	 record_layout );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( definition_index = 0;
+	     definition_index < 4;
+	     definition_index++ )
+	{
+		result = libesedb_catalog_definition_free(
+		          &( catalog_definitions[ definition_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_layout != NULL )
+	{
+		libesedb_record_layout_free(
+		 &record_layout,
+		 NULL );
+	}
+	for( definition_index = 0;
+	     definition_index < 4;
+	     definition_index++ )
+	{
+		if( catalog_definitions[ definition_index ] != NULL )
+		{
+			libesedb_catalog_definition_free(
+			 &( catalog_definitions[ definition_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_definition_get_record_layout function with a template table
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_definition_get_record_layout(
+     void )
+{
+	uint32_t column_identifiers[ 4 ] = {
+		1, 2, 128, 256 };
+
+	uint32_t column_sizes[ 4 ] = {
+		4, 8, 0, 0 };
+
+	uint32_t column_types[ 4 ] = {
+		LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+		LIBESEDB_COLUMN_TYPE_DATE_TIME,
+		LIBESEDB_COLUMN_TYPE_TEXT,
+		LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA };
+
+	libcerror_error_t *error                               = NULL;
+	libesedb_catalog_definition_t *catalog_definition      = NULL;
+	libesedb_record_layout_t *record_layout                = NULL;
+	libesedb_table_definition_t *table_definition          = NULL;
+	libesedb_table_definition_t *template_table_definition = NULL;
+	int definition_index                                   = 0;
+	int result                                             = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_catalog_definition_initialize(
+	          &catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	result = libesedb_table_definition_initialize(
+	          &template_table_definition,
+	          catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	catalog_definition = NULL;
+
+	result = libesedb_catalog_definition_initialize(
+	          &catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	result = libesedb_table_definition_initialize(
+	          &table_definition,
+	          catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	catalog_definition = NULL;
+
+	/* The template table defines the fixed and variable size columns
+	 * and the table only its own tagged column
+	 */
+	for( definition_index = 0;
+	     definition_index < 4;
+	     definition_index++ )
+	{
+		result = libesedb_catalog_definition_initialize(
+		          &catalog_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		catalog_definition->type        = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+		catalog_definition->identifier  = column_identifiers[ definition_index ];
+		catalog_definition->column_type = column_types[ definition_index ];
+		catalog_definition->size        = column_sizes[ definition_index ];
+
+		if( definition_index < 3 )
+		{
+			result = libesedb_table_definition_append_column_catalog_definition(
+			          template_table_definition,
+			          catalog_definition,
+			          &error );
+		}
+		else
+		{
+			result = libesedb_table_definition_append_column_catalog_definition(
+			          table_definition,
+			          catalog_definition,
+			          &error );
+		}
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		catalog_definition = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libesedb_table_definition_get_record_layout(
+	          table_definition,
+	          template_table_definition,
+	          &record_layout,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_layout",
+	 record_layout );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_layout->number_of_columns",
+	 record_layout->number_of_columns,
+	 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "record_layout->columns[ 2 ].identifier",
+	 record_layout->columns[ 2 ].identifier,
+	 128 );
+
+	/* The column of the table follows the columns of the template table
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "record_layout->columns[ 3 ].identifier",
+	 record_layout->columns[ 3 ].identifier,
+	 256 );
+
+	/* Test error cases
+	 */
+	record_layout = NULL;
+
+	result = libesedb_table_definition_get_record_layout(
+	          NULL,
+	          template_table_definition,
+	          &record_layout,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_layout",
+	 record_layout );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_definition_get_record_layout(
+	          table_definition,
+	          template_table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_table_definition_free(
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          &template_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &catalog_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( template_table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &template_table_definition,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_initialize",
+	 esedb_test_record_layout_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_free",
+	 esedb_test_record_layout_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_append_column",
+	 esedb_test_record_layout_append_column );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_definition_get_record_layout",
+	 esedb_test_table_definition_get_record_layout );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
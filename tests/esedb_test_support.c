@@ -713,6 +713,164 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_check_page_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_check_page_data(
+     void )
+{
+	uint8_t empty_block[ 4096 ];
+
+	libcerror_error_t *error                    = NULL;
+	void *memset_result                         = NULL;
+	uint32_t father_data_page_object_identifier = 0;
+	uint32_t page_flags                         = 0;
+	uint32_t page_number                        = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 empty_block,
+	                 0,
+	                 sizeof( uint8_t ) * 4096 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test check page data with empty block
+	 */
+	result = libesedb_check_page_data(
+	          empty_block,
+	          4096,
+	          &page_number,
+	          &father_data_page_object_identifier,
+	          &page_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_check_page_data(
+	          NULL,
+	          4096,
+	          &page_number,
+	          &father_data_page_object_identifier,
+	          &page_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_check_page_data(
+	          empty_block,
+	          1000,
+	          &page_number,
+	          &father_data_page_object_identifier,
+	          &page_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_check_page_data(
+	          empty_block,
+	          4096,
+	          NULL,
+	          &father_data_page_object_identifier,
+	          &page_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_check_page_data(
+	          empty_block,
+	          4096,
+	          &page_number,
+	          NULL,
+	          &page_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_check_page_data(
+	          empty_block,
+	          4096,
+	          &page_number,
+	          &father_data_page_object_identifier,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -788,6 +946,10 @@ int main(
 
 #endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_check_page_data",
+	 esedb_test_check_page_data );
+
 	return( EXIT_SUCCESS );
 
 on_error:
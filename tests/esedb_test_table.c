@@ -21,12 +21,15 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_getopt.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
@@ -35,18 +38,1391 @@
 
 #include "../libesedb/libesedb_table.h"
 
+#if !defined( LIBESEDB_HAVE_BFIO )
+
+LIBESEDB_EXTERN \
+int libesedb_file_open_file_io_handle(
+     libesedb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libesedb_error_t **error );
+
+#endif /* !defined( LIBESEDB_HAVE_BFIO ) */
+
+/* Creates and opens a source file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_open_source(
+     libesedb_file_t **file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_table_open_source";
+	int result            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_file_open_file_io_handle(
+	          *file,
+	          file_io_handle,
+	          LIBESEDB_OPEN_READ,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libesedb_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a source file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_close_source(
+     libesedb_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_table_close_source";
+	int result            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
 /* Tests the libesedb_table_free function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_table_free(
-     void )
+int esedb_test_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_table_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_column_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_column_by_utf8_name(
+     libesedb_table_t *table )
+{
+	uint8_t utf8_name[ 256 ];
+
+	libcerror_error_t *error         = NULL;
+	libesedb_column_t *column        = NULL;
+	libesedb_column_t *named_column  = NULL;
+	uint32_t column_identifier       = 0;
+	uint32_t named_column_identifier = 0;
+	size_t utf8_name_size            = 0;
+	int number_of_columns            = 0;
+	int result                       = 0;
+
+	result = libesedb_table_get_number_of_columns(
+	          table,
+	          &number_of_columns,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_columns == 0 )
+	{
+		return( 1 );
+	}
+	result = libesedb_table_get_column(
+	          table,
+	          0,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_utf8_name_size(
+	          column,
+	          &utf8_name_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_utf8_name(
+	          column,
+	          utf8_name,
+	          256,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          utf8_name,
+	          utf8_name_size - 1,
+	          &named_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "named_column",
+	 named_column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          named_column,
+	          &named_column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "named_column_identifier",
+	 named_column_identifier,
+	 column_identifier );
+
+	result = libesedb_column_free(
+	          &named_column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          (uint8_t *) "?NoSuchColumn?",
+	          14,
+	          &named_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "named_column",
+	 named_column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_column_by_utf8_name(
+	          NULL,
+	          utf8_name,
+	          utf8_name_size - 1,
+	          &named_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          NULL,
+	          utf8_name_size - 1,
+	          &named_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          utf8_name,
+	          0,
+	          &named_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          utf8_name,
+	          utf8_name_size - 1,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf8_name(
+	          table,
+	          utf8_name,
+	          utf8_name_size - 1,
+	          &named_column,
+	          0xff,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( named_column != NULL )
+	{
+		libesedb_column_free(
+		 &named_column,
+		 NULL );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_column_by_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_column_by_utf16_name(
+     libesedb_table_t *table )
+{
+	uint16_t utf16_name[ 256 ];
+	uint16_t no_such_column_name[ 4 ] = { '?', 'N', 'o', '?' };
+
+	libcerror_error_t *error         = NULL;
+	libesedb_column_t *column        = NULL;
+	libesedb_column_t *named_column  = NULL;
+	uint32_t column_identifier       = 0;
+	uint32_t named_column_identifier = 0;
+	size_t utf16_name_size            = 0;
+	int number_of_columns            = 0;
+	int result                       = 0;
+
+	result = libesedb_table_get_number_of_columns(
+	          table,
+	          &number_of_columns,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_columns == 0 )
+	{
+		return( 1 );
+	}
+	result = libesedb_table_get_column(
+	          table,
+	          0,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column",
+	 column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_utf16_name_size(
+	          column,
+	          &utf16_name_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_utf16_name(
+	          column,
+	          utf16_name,
+	          256,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_name,
+	          utf16_name_size - 1,
+	          &named_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "named_column",
+	 named_column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_column_get_identifier(
+	          named_column,
+	          &named_column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "named_column_identifier",
+	 named_column_identifier,
+	 column_identifier );
+
+	result = libesedb_column_free(
+	          &named_column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          no_such_column_name,
+	          4,
+	          &named_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "named_column",
+	 named_column );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_column_by_utf16_name(
+	          NULL,
+	          utf16_name,
+	          utf16_name_size - 1,
+	          &named_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          NULL,
+	          utf16_name_size - 1,
+	          &named_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_name,
+	          0,
+	          &named_column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_name,
+	          utf16_name_size - 1,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_column_by_utf16_name(
+	          table,
+	          utf16_name,
+	          utf16_name_size - 1,
+	          &named_column,
+	          0xff,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( named_column != NULL )
+	{
+		libesedb_column_free(
+		 &named_column,
+		 NULL );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_space_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_space_statistics(
+     libesedb_table_t *table )
+{
+	uint64_t partial_statistics[ LIBESEDB_NUMBER_OF_TABLE_STATISTICS ];
+	uint64_t statistics[ LIBESEDB_NUMBER_OF_TABLE_STATISTICS ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int statistic_index      = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_space_statistics(
+	          table,
+	          statistics,
+	          LIBESEDB_NUMBER_OF_TABLE_STATISTICS,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every table has at least a root page and the leaf pages are a subset of the pages
+	 */
+	ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+	 "statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES ]",
+	 (uint64_t) 0,
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES ] );
+
+	ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+	 "statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES ]",
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES ],
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_PAGES ] + 1 );
+
+	ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+	 "statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_SAMPLED_LEAF_PAGES ]",
+	 (uint64_t) 0,
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_SAMPLED_LEAF_PAGES ] );
+
+	ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+	 "statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_SAMPLED_LEAF_PAGES ]",
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_SAMPLED_LEAF_PAGES ],
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES ] + 1 );
+
+	ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+	 "statistics[ LIBESEDB_TABLE_STATISTIC_FILL_FACTOR ]",
+	 statistics[ LIBESEDB_TABLE_STATISTIC_FILL_FACTOR ],
+	 (uint64_t) 101 );
+
+	/* The pages of the table and its available pages are part of the owned pages
+	 */
+	if( statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_OWNED_PAGES ] > 0 )
+	{
+		ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+		 "statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_AVAILABLE_PAGES ]",
+		 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_AVAILABLE_PAGES ],
+		 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_OWNED_PAGES ] + 1 );
+
+		ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+		 "statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_PAGES ]",
+		 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_PAGES ],
+		 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_OWNED_PAGES ] - statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_AVAILABLE_PAGES ] + 1 );
+	}
+	/* Test retrieving a part of the statistics
+	 */
+	for( statistic_index = 0;
+	     statistic_index < LIBESEDB_NUMBER_OF_TABLE_STATISTICS;
+	     statistic_index++ )
+	{
+		partial_statistics[ statistic_index ] = 0xffffffffffffffffULL;
+	}
+	result = libesedb_table_get_space_statistics(
+	          table,
+	          partial_statistics,
+	          LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "partial_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_PAGES ]",
+	 partial_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_PAGES ],
+	 statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_PAGES ] );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "partial_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES ]",
+	 partial_statistics[ LIBESEDB_TABLE_STATISTIC_NUMBER_OF_LEAF_PAGES ],
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_space_statistics(
+	          NULL,
+	          statistics,
+	          LIBESEDB_NUMBER_OF_TABLE_STATISTICS,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_space_statistics(
+	          table,
+	          NULL,
+	          LIBESEDB_NUMBER_OF_TABLE_STATISTICS,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_space_statistics(
+	          table,
+	          statistics,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_space_statistics(
+	          table,
+	          statistics,
+	          LIBESEDB_NUMBER_OF_TABLE_STATISTICS + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_carve_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_carve_records(
+     libesedb_table_t *table )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_carve_records(
+	          table,
+	          1,
+	          UINT32_MAX,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_carve_records(
+	          NULL,
+	          1,
+	          UINT32_MAX,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_carve_records(
+	          table,
+	          0,
+	          UINT32_MAX,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_number_of_carved_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_number_of_carved_records(
+     libesedb_table_t *table )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error     = NULL;
+	int number_of_carved_records = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_number_of_carved_records(
+	          table,
+	          &number_of_carved_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_carved_records",
+	 number_of_carved_records,
+	 -1 );
 
 	/* Test error cases
 	 */
-	result = libesedb_table_free(
+	result = libesedb_table_get_number_of_carved_records(
+	          NULL,
+	          &number_of_carved_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_number_of_carved_records(
+	          table,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_carved_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_carved_record(
+     libesedb_table_t *table )
+{
+	libcerror_error_t *error     = NULL;
+	libesedb_record_t *record    = NULL;
+	off64_t data_offset          = 0;
+	uint32_t page_number         = 0;
+	uint8_t carve_confidence     = 0;
+	int number_of_carved_records = 0;
+	int number_of_columns        = 0;
+	int number_of_values         = 0;
+	int record_entry             = 0;
+	int result                   = 0;
+
+	result = libesedb_table_get_number_of_columns(
+	          table,
+	          &number_of_columns,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_number_of_carved_records(
+	          table,
+	          &number_of_carved_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Carved values that cannot be read as a record, such as truncated values,
+	 * are not carved hence every carved record must provide all its values
+	 */
+	for( record_entry = 0;
+	     record_entry < number_of_carved_records;
+	     record_entry++ )
+	{
+		result = libesedb_table_get_carved_record(
+		          table,
+		          record_entry,
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_record_get_carve_confidence(
+		          record,
+		          &carve_confidence,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_GREATER_THAN_INT(
+		 "carve_confidence",
+		 (int) carve_confidence,
+		 LIBESEDB_CARVE_CONFIDENCE_NONE );
+
+		ESEDB_TEST_ASSERT_LESS_THAN_INT(
+		 "carve_confidence",
+		 (int) carve_confidence,
+		 LIBESEDB_CARVE_CONFIDENCE_HIGH + 1 );
+
+		result = libesedb_record_get_page_number(
+		          record,
+		          &page_number,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "page_number",
+		 (int) page_number,
+		 0 );
+
+		result = libesedb_record_get_data_offset(
+		          record,
+		          &data_offset,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_NOT_EQUAL_INT64(
+		 "data_offset",
+		 (int64_t) data_offset,
+		 (int64_t) 0 );
+
+		result = libesedb_record_get_number_of_values(
+		          record,
+		          &number_of_values,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_values",
+		 number_of_values,
+		 number_of_columns );
+
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "record",
+		 record );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_table_get_carved_record(
+	          NULL,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_carved_record(
+	          table,
+	          -1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_carved_record(
+	          table,
+	          number_of_carved_records,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_carved_record(
+	          table,
+	          0,
 	          NULL,
 	          &error );
 
@@ -70,6 +1446,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -81,17 +1463,45 @@ on_error:
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libesedb_file_t *file            = NULL;
+	libesedb_table_t *table          = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int number_of_tables             = 0;
+	int result                       = 0;
 
+	while( ( option = esedb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
 	/* TODO: add tests for libesedb_table_initialize */
@@ -102,43 +1512,251 @@ int main(
 	 "libesedb_table_free",
 	 esedb_test_table_free );
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* TODO: add tests for libesedb_table_get_identifier */
+		/* Initialize file for tests
+		 */
+		result = esedb_test_table_open_source(
+		          &file,
+		          file_io_handle,
+		          &error );
 
-	/* TODO: add tests for libesedb_table_get_utf8_name_size */
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	/* TODO: add tests for libesedb_table_get_utf8_name */
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
 
-	/* TODO: add tests for libesedb_table_get_utf16_name_size */
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* TODO: add tests for libesedb_table_get_utf16_name */
+		result = libesedb_file_get_number_of_tables(
+		          file,
+		          &number_of_tables,
+		          &error );
 
-	/* TODO: add tests for libesedb_table_get_utf8_template_name_size */
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	/* TODO: add tests for libesedb_table_get_utf8_template_name */
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( number_of_tables > 0 )
+	{
+		result = libesedb_file_get_table(
+		          file,
+		          0,
+		          &table,
+		          &error );
 
-	/* TODO: add tests for libesedb_table_get_utf16_template_name_size */
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	/* TODO: add tests for libesedb_table_get_utf16_template_name */
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "table",
+		 table );
 
-	/* TODO: add tests for libesedb_table_get_number_of_columns */
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* TODO: add tests for libesedb_table_get_column */
+		/* TODO: add tests for libesedb_table_get_identifier */
 
-	/* TODO: add tests for libesedb_table_get_number_of_indexes */
+		/* TODO: add tests for libesedb_table_get_utf8_name_size */
 
-	/* TODO: add tests for libesedb_table_get_index */
+		/* TODO: add tests for libesedb_table_get_utf8_name */
 
-	/* TODO: add tests for libesedb_table_get_number_of_records */
+		/* TODO: add tests for libesedb_table_get_utf16_name_size */
 
-	/* TODO: add tests for libesedb_table_get_record */
+		/* TODO: add tests for libesedb_table_get_utf16_name */
 
-#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+		/* TODO: add tests for libesedb_table_get_utf8_template_name_size */
+
+		/* TODO: add tests for libesedb_table_get_utf8_template_name */
+
+		/* TODO: add tests for libesedb_table_get_utf16_template_name_size */
+
+		/* TODO: add tests for libesedb_table_get_utf16_template_name */
+
+		/* TODO: add tests for libesedb_table_get_number_of_columns */
+
+		/* TODO: add tests for libesedb_table_get_column */
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_table_get_column_by_utf8_name",
+		 esedb_test_table_get_column_by_utf8_name,
+		 table );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_table_get_column_by_utf16_name",
+		 esedb_test_table_get_column_by_utf16_name,
+		 table );
+
+		/* TODO: add tests for libesedb_table_get_number_of_indexes */
+
+		/* TODO: add tests for libesedb_table_get_index */
+
+		/* TODO: add tests for libesedb_table_get_number_of_records */
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_table_get_space_statistics",
+		 esedb_test_table_get_space_statistics,
+		 table );
+
+		/* TODO: add tests for libesedb_table_get_record */
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_table_carve_records",
+		 esedb_test_table_carve_records,
+		 table );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_table_get_number_of_carved_records",
+		 esedb_test_table_get_number_of_carved_records,
+		 table );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_table_get_carved_record",
+		 esedb_test_table_get_carved_record,
+		 table );
+
+		/* Clean up
+		 */
+		result = libesedb_table_free(
+		          &table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "table",
+		 table );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file != NULL )
+	{
+		result = esedb_test_table_close_source(
+		          &file,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "file",
+		 file );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
 
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
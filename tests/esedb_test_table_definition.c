@@ -50,7 +50,7 @@ int esedb_test_table_definition_initialize(
 	int result                                              = 0;
 
 #if defined( HAVE_ESEDB_TEST_MEMORY )
-	int number_of_malloc_fail_tests                         = 3;
+	int number_of_malloc_fail_tests                         = 5;
 	int number_of_memset_fail_tests                         = 1;
 	int test_number                                         = 0;
 #endif
@@ -0,0 +1,1315 @@
+/*
+ * Tools Arrow writer functions test program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_unused.h"
+
+#include "../esedbtools/arrow_writer.h"
+#include "../esedbtools/output_buffer.h"
+
+uint8_t esedb_test_arrow_writer_end_of_stream[ 8 ] = {
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 };
+
+/* Retrieves the metadata offset of a field of a flatbuffer table
+ * Returns 1 if successful, 0 if the field is not stored or -1 on error
+ */
+int esedb_test_tools_arrow_writer_get_table_field(
+     const uint8_t *metadata,
+     size_t metadata_size,
+     size_t table_offset,
+     int field_index,
+     size_t *field_offset )
+{
+	size_t vtable_offset            = 0;
+	uint32_t vtable_relative_offset = 0;
+	uint16_t relative_field_offset  = 0;
+	uint16_t vtable_size            = 0;
+
+	if( ( metadata == NULL )
+	 || ( field_index < 0 )
+	 || ( field_offset == NULL ) )
+	{
+		return( -1 );
+	}
+	if( ( table_offset + 4 ) > metadata_size )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( metadata[ table_offset ] ),
+	 vtable_relative_offset );
+
+	/* The vtable is stored before the table
+	 */
+	if( ( vtable_relative_offset == 0 )
+	 || ( (size_t) vtable_relative_offset > table_offset ) )
+	{
+		return( -1 );
+	}
+	vtable_offset = table_offset - vtable_relative_offset;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( metadata[ vtable_offset ] ),
+	 vtable_size );
+
+	if( ( vtable_size < 4 )
+	 || ( ( vtable_offset + vtable_size ) > metadata_size ) )
+	{
+		return( -1 );
+	}
+	if( ( 4 + ( 2 * (size_t) field_index ) + 2 ) > (size_t) vtable_size )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( metadata[ vtable_offset + 4 + ( 2 * field_index ) ] ),
+	 relative_field_offset );
+
+	if( relative_field_offset == 0 )
+	{
+		return( 0 );
+	}
+	*field_offset = table_offset + relative_field_offset;
+
+	if( *field_offset >= metadata_size )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the metadata offset of an object referenced by a field of a flatbuffer table
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_tools_arrow_writer_get_table_object(
+     const uint8_t *metadata,
+     size_t metadata_size,
+     size_t table_offset,
+     int field_index,
+     size_t *object_offset )
+{
+	size_t field_offset      = 0;
+	uint32_t relative_offset = 0;
+
+	if( object_offset == NULL )
+	{
+		return( -1 );
+	}
+	if( esedb_test_tools_arrow_writer_get_table_field(
+	     metadata,
+	     metadata_size,
+	     table_offset,
+	     field_index,
+	     &field_offset ) != 1 )
+	{
+		return( -1 );
+	}
+	if( ( field_offset + 4 ) > metadata_size )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( metadata[ field_offset ] ),
+	 relative_offset );
+
+	*object_offset = field_offset + relative_offset;
+
+	if( *object_offset >= metadata_size )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a row with an identifier and a name to the Arrow writer
+ * A name of NULL is used to append a row of which the values are not set
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_tools_arrow_writer_append_row(
+     arrow_writer_t *arrow_writer,
+     output_buffer_t *output_buffer,
+     uint32_t identifier,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	size_t row_index              = 0;
+	int column_index              = 0;
+
+	if( arrow_writer == NULL )
+	{
+		return( -1 );
+	}
+	row_index = (size_t) arrow_writer->number_of_rows;
+
+	if( name == NULL )
+	{
+		for( column_index = 0;
+		     column_index < arrow_writer->number_of_columns;
+		     column_index++ )
+		{
+			if( arrow_writer_append_value(
+			     arrow_writer,
+			     &( ( arrow_writer->columns )[ column_index ] ),
+			     NULL,
+			     column_index,
+			     NULL,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+	}
+	else
+	{
+		/* The values are stored in the same way as by arrow_writer_append_value
+		 */
+		column = &( ( arrow_writer->columns )[ 0 ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( column->values_data[ row_index * 4 ] ),
+		 identifier );
+
+		column->validity_data[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+		column = &( ( arrow_writer->columns )[ 1 ] );
+
+		if( arrow_writer_resize_values_data(
+		     column,
+		     column->values_data_offset + name_length,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( column->values_data[ column->values_data_offset ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			return( -1 );
+		}
+		column->values_data_offset += name_length;
+
+		column->validity_data[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( column->offsets_data[ ( row_index + 1 ) * 4 ] ),
+		 (uint32_t) column->values_data_offset );
+	}
+	arrow_writer->number_of_rows += 1;
+
+	if( arrow_writer->number_of_rows >= arrow_writer->maximum_number_of_rows )
+	{
+		if( arrow_writer_write_record_batch(
+		     arrow_writer,
+		     output_buffer,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the arrow_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_arrow_writer_initialize(
+     void )
+{
+	arrow_writer_t *arrow_writer = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = arrow_writer_initialize(
+	          &arrow_writer,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "arrow_writer",
+	 arrow_writer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_free(
+	          &arrow_writer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "arrow_writer",
+	 arrow_writer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = arrow_writer_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arrow_writer = (arrow_writer_t *) 0x12345678UL;
+
+	result = arrow_writer_initialize(
+	          &arrow_writer,
+	          16,
+	          &error );
+
+	arrow_writer = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = arrow_writer_initialize(
+	          &arrow_writer,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "arrow_writer",
+	 arrow_writer );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = arrow_writer_initialize(
+	          &arrow_writer,
+	          ( INT32_MAX / 8 ) + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "arrow_writer",
+	 arrow_writer );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arrow_writer != NULL )
+	{
+		arrow_writer_free(
+		 &arrow_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the arrow_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_arrow_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = arrow_writer_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the arrow_writer_append_column function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_arrow_writer_append_column(
+     void )
+{
+	arrow_writer_t *arrow_writer = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = arrow_writer_initialize(
+	          &arrow_writer,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          (uint8_t *) "Id",
+	          2,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          (uint8_t *) "Name",
+	          4,
+	          1,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          (uint8_t *) "Flag",
+	          4,
+	          2,
+	          LIBESEDB_COLUMN_TYPE_BOOLEAN,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "arrow_writer->number_of_columns",
+	 arrow_writer->number_of_columns,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "arrow_type",
+	 arrow_writer->columns[ 0 ].arrow_type,
+	 (uint8_t) ARROW_WRITER_TYPE_INTEGER );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "value_size",
+	 arrow_writer->columns[ 0 ].value_size,
+	 (uint8_t) 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "is_signed",
+	 arrow_writer->columns[ 0 ].is_signed,
+	 (uint8_t) 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "arrow_type",
+	 arrow_writer->columns[ 1 ].arrow_type,
+	 (uint8_t) ARROW_WRITER_TYPE_UTF8 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "offsets_data",
+	 arrow_writer->columns[ 1 ].offsets_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "arrow_type",
+	 arrow_writer->columns[ 2 ].arrow_type,
+	 (uint8_t) ARROW_WRITER_TYPE_BOOLEAN );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "values_data_size",
+	 arrow_writer->columns[ 2 ].values_data_size,
+	 (size_t) 2 );
+
+	/* Test error cases
+	 */
+	result = arrow_writer_append_column(
+	          NULL,
+	          (uint8_t *) "Id",
+	          2,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          NULL,
+	          2,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          (uint8_t *) "Id",
+	          0,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Columns cannot be appended once the record batch contains rows
+	 */
+	arrow_writer->number_of_rows = 1;
+
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          (uint8_t *) "Id",
+	          2,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	          &error );
+
+	arrow_writer->number_of_rows = 0;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = arrow_writer_free(
+	          &arrow_writer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arrow_writer != NULL )
+	{
+		arrow_writer_free(
+		 &arrow_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the arrow_writer_write_schema, arrow_writer_write_record_batch
+ * and arrow_writer_write_end_of_stream functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_arrow_writer_write_stream(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	arrow_writer_t *arrow_writer   = NULL;
+	FILE *stream                   = NULL;
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	const uint8_t *metadata        = NULL;
+	size_t body_offset             = 0;
+	size_t buffer_offset           = 0;
+	size_t buffers_offset          = 0;
+	size_t data_offset             = 0;
+	size_t expected_buffer_offset  = 0;
+	size_t field_offset            = 0;
+	size_t message_offset          = 0;
+	size_t metadata_size           = 0;
+	size_t nodes_offset            = 0;
+	size_t read_count              = 0;
+	size_t record_batch_offset     = 0;
+	uint64_t body_length           = 0;
+	uint64_t buffer_data_offset    = 0;
+	uint64_t buffer_data_size      = 0;
+	uint64_t number_of_rows        = 0;
+	uint64_t null_count            = 0;
+	uint32_t continuation_marker   = 0;
+	uint32_t number_of_buffers     = 0;
+	uint32_t value_32bit           = 0;
+	uint8_t header_type            = 0;
+	int buffer_index               = 0;
+	int message_index              = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	stream = tmpfile();
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a small record batch so that the rows are written in 2 record batches
+	 */
+	result = arrow_writer_initialize(
+	          &arrow_writer,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          (uint8_t *) "Id",
+	          2,
+	          0,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          (uint8_t *) "Name",
+	          4,
+	          1,
+	          LIBESEDB_COLUMN_TYPE_TEXT,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = arrow_writer_write_schema(
+	          arrow_writer,
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_tools_arrow_writer_append_row(
+	          arrow_writer,
+	          output_buffer,
+	          1,
+	          "a",
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_tools_arrow_writer_append_row(
+	          arrow_writer,
+	          output_buffer,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The full record batch has been written
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "arrow_writer->number_of_rows",
+	 arrow_writer->number_of_rows,
+	 0 );
+
+	result = esedb_test_tools_arrow_writer_append_row(
+	          arrow_writer,
+	          output_buffer,
+	          3,
+	          "ccc",
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_write_end_of_stream(
+	          arrow_writer,
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_finish(
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = file_stream_seek_offset(
+	          stream,
+	          0,
+	          SEEK_SET );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = file_stream_read(
+	              stream,
+	              data,
+	              4096 );
+
+	/* The stream consists of a schema message, 2 record batch messages
+	 * and the end-of-stream marker
+	 */
+	for( message_index = 0;
+	     message_index < 3;
+	     message_index++ )
+	{
+		ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+		 "data_offset",
+		 (uint64_t) ( data_offset + 8 ),
+		 (uint64_t) read_count );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 continuation_marker );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "continuation_marker",
+		 continuation_marker,
+		 (uint32_t) 0xffffffffUL );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset + 4 ] ),
+		 value_32bit );
+
+		metadata_size = (size_t) value_32bit;
+
+		/* The metadata is padded so that the message body is 8-byte aligned
+		 */
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "metadata_size % 8",
+		 metadata_size % 8,
+		 (size_t) 0 );
+
+		ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+		 "metadata_size",
+		 (uint64_t) ( data_offset + 8 + metadata_size ),
+		 (uint64_t) read_count );
+
+		metadata = &( data[ data_offset + 8 ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 metadata,
+		 value_32bit );
+
+		message_offset = (size_t) value_32bit;
+
+		/* Message: version, header_type, header, bodyLength
+		 */
+		result = esedb_test_tools_arrow_writer_get_table_field(
+		          metadata,
+		          metadata_size,
+		          message_offset,
+		          1,
+		          &field_offset );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		header_type = metadata[ field_offset ];
+
+		result = esedb_test_tools_arrow_writer_get_table_field(
+		          metadata,
+		          metadata_size,
+		          message_offset,
+		          3,
+		          &field_offset );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( metadata[ field_offset ] ),
+		 body_length );
+
+		body_offset = data_offset + 8 + metadata_size;
+
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "body_offset % 8",
+		 body_offset % 8,
+		 (size_t) 0 );
+
+		if( message_index == 0 )
+		{
+			/* Schema
+			 */
+			ESEDB_TEST_ASSERT_EQUAL_UINT8(
+			 "header_type",
+			 header_type,
+			 (uint8_t) 1 );
+
+			ESEDB_TEST_ASSERT_EQUAL_UINT64(
+			 "body_length",
+			 body_length,
+			 (uint64_t) 0 );
+
+			data_offset = body_offset;
+
+			continue;
+		}
+		/* Record batch: length, nodes, buffers
+		 */
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "header_type",
+		 header_type,
+		 (uint8_t) 3 );
+
+		result = esedb_test_tools_arrow_writer_get_table_object(
+		          metadata,
+		          metadata_size,
+		          message_offset,
+		          2,
+		          &record_batch_offset );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = esedb_test_tools_arrow_writer_get_table_field(
+		          metadata,
+		          metadata_size,
+		          record_batch_offset,
+		          0,
+		          &field_offset );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( metadata[ field_offset ] ),
+		 number_of_rows );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_rows",
+		 number_of_rows,
+		 (uint64_t) ( ( message_index == 1 ) ? 2 : 1 ) );
+
+		result = esedb_test_tools_arrow_writer_get_table_object(
+		          metadata,
+		          metadata_size,
+		          record_batch_offset,
+		          1,
+		          &nodes_offset );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* The FieldNode of the Id column: length, null_count
+		 */
+		byte_stream_copy_to_uint64_little_endian(
+		 &( metadata[ nodes_offset + 4 + 8 ] ),
+		 null_count );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT64(
+		 "null_count",
+		 null_count,
+		 (uint64_t) ( ( message_index == 1 ) ? 1 : 0 ) );
+
+		result = esedb_test_tools_arrow_writer_get_table_object(
+		          metadata,
+		          metadata_size,
+		          record_batch_offset,
+		          2,
+		          &buffers_offset );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* The buffers vector elements are 8-byte aligned
+		 */
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "( buffers_offset + 4 ) % 8",
+		 ( buffers_offset + 4 ) % 8,
+		 (size_t) 0 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( metadata[ buffers_offset ] ),
+		 number_of_buffers );
+
+		/* Id: validity and values, Name: validity, offsets and values
+		 */
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "number_of_buffers",
+		 number_of_buffers,
+		 (uint32_t) 5 );
+
+		expected_buffer_offset = 0;
+
+		for( buffer_index = 0;
+		     buffer_index < 5;
+		     buffer_index++ )
+		{
+			buffer_offset = buffers_offset + 4 + ( 16 * buffer_index );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( metadata[ buffer_offset ] ),
+			 buffer_data_offset );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( metadata[ buffer_offset + 8 ] ),
+			 buffer_data_size );
+
+			/* Every buffer starts at an 8-byte aligned offset directly after the previous buffer
+			 */
+			ESEDB_TEST_ASSERT_EQUAL_UINT64(
+			 "buffer_data_offset",
+			 buffer_data_offset,
+			 (uint64_t) expected_buffer_offset );
+
+			expected_buffer_offset += ( (size_t) buffer_data_size + 7 ) & ~( (size_t) 7 );
+		}
+		ESEDB_TEST_ASSERT_EQUAL_UINT64(
+		 "body_length",
+		 body_length,
+		 (uint64_t) expected_buffer_offset );
+
+		ESEDB_TEST_ASSERT_LESS_THAN_UINT64(
+		 "body_length",
+		 (uint64_t) ( body_offset + body_length ),
+		 (uint64_t) read_count );
+
+		/* The Id validity bitmap and the first Id value
+		 */
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "validity",
+		 data[ body_offset ],
+		 (uint8_t) 0x01 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ body_offset + 8 ] ),
+		 value_32bit );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 (uint32_t) ( ( message_index == 1 ) ? 1 : 3 ) );
+
+		data_offset = body_offset + (size_t) body_length;
+	}
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 data_offset + 8 );
+
+	result = memory_compare(
+	          &( data[ data_offset ] ),
+	          esedb_test_arrow_writer_end_of_stream,
+	          8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = arrow_writer_write_schema(
+	          NULL,
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = arrow_writer_write_record_batch(
+	          NULL,
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = arrow_writer_write_end_of_stream(
+	          NULL,
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = arrow_writer_free(
+	          &arrow_writer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream_close(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arrow_writer != NULL )
+	{
+		arrow_writer_free(
+		 &arrow_writer,
+		 NULL );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ESEDB_TEST_RUN(
+	 "arrow_writer_initialize",
+	 esedb_test_tools_arrow_writer_initialize )
+
+	ESEDB_TEST_RUN(
+	 "arrow_writer_free",
+	 esedb_test_tools_arrow_writer_free )
+
+	ESEDB_TEST_RUN(
+	 "arrow_writer_append_column",
+	 esedb_test_tools_arrow_writer_append_column )
+
+	/* TODO: add tests for arrow_writer_set_columns_from_table */
+
+	/* TODO: add tests for arrow_writer_set_columns_from_record */
+
+	ESEDB_TEST_RUN(
+	 "arrow_writer_write_stream",
+	 esedb_test_tools_arrow_writer_write_stream )
+
+	/* TODO: add tests for arrow_writer_append_record */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
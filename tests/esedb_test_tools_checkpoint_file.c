@@ -0,0 +1,607 @@
+/*
+ * Tools checkpoint file functions test program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_unused.h"
+
+#include "../esedbtools/checkpoint_file.h"
+
+/* The checkpoint file used by the tests, which is created in the current working directory
+ */
+#define ESEDB_TEST_CHECKPOINT_FILENAME		"esedb_test_tools_checkpoint_file.checkpoint"
+
+/* The checksum of the export settings used by the tests
+ */
+#define ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM	2166136261UL
+
+/* Checkpoint file contents that cannot be parsed and are considered to be
+ * at the start of the export, such as the result of an interrupted write
+ */
+const char *esedb_test_checkpoint_file_corrupt_contents[ 9 ] = {
+	"",
+	"1024",
+	"1024 65536",
+	"1024 65536 2166136261",
+	"1024 65536 2166136261 7\n",
+	"1024  65536 2166136261\n",
+	"-1 65536 2166136261\n",
+	"2147483648 65536 2166136261\n",
+	"1024 65536 4294967296\n" };
+
+/* Writes a string to the checkpoint file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_tools_checkpoint_file_write_string(
+     const char *string,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "esedb_test_tools_checkpoint_file_write_string";
+	size_t string_length  = 0;
+	size_t write_count    = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	stream = file_stream_open(
+	          ESEDB_TEST_CHECKPOINT_FILENAME,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = narrow_string_length(
+	                 string );
+
+	if( string_length > 0 )
+	{
+		write_count = file_stream_write(
+		               stream,
+		               string,
+		               string_length );
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_count != string_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the checkpoint_file_write function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_checkpoint_file_write(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = checkpoint_file_write(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM,
+	          1024,
+	          65536,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = checkpoint_file_remove(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = checkpoint_file_write(
+	          NULL,
+	          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM,
+	          1024,
+	          65536,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checkpoint_file_write(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM,
+	          -1,
+	          65536,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checkpoint_file_write(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM,
+	          1024,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checkpoint_file_read function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_checkpoint_file_read(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	off64_t stream_offset    = 0;
+	int record_index         = 0;
+	int result               = 0;
+
+	/* Test reading a checkpoint file that does not exist
+	 */
+	result = checkpoint_file_read(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM,
+	          &record_index,
+	          &stream_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading back a written checkpoint file
+	 */
+	result = checkpoint_file_write(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM,
+	          1024,
+	          (off64_t) 0x100000000ULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = checkpoint_file_read(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM,
+	          &record_index,
+	          &stream_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 1024 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "stream_offset",
+	 (int64_t) stream_offset,
+	 (int64_t) 0x100000000LL );
+
+	/* Test reading a checkpoint file that was written with different export settings
+	 */
+	result = checkpoint_file_read(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM + 1,
+	          &record_index,
+	          &stream_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = checkpoint_file_read(
+	          NULL,
+	          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM,
+	          &record_index,
+	          &stream_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checkpoint_file_read(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM,
+	          NULL,
+	          &stream_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checkpoint_file_read(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM,
+	          &record_index,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = checkpoint_file_remove(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	checkpoint_file_remove(
+	 _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the checkpoint_file_read function with a corrupt checkpoint file
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_checkpoint_file_read_corrupt(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	off64_t stream_offset    = 0;
+	int contents_index       = 0;
+	int record_index         = 0;
+	int result               = 0;
+
+	for( contents_index = 0;
+	     contents_index < 9;
+	     contents_index++ )
+	{
+		result = esedb_test_tools_checkpoint_file_write_string(
+		          esedb_test_checkpoint_file_corrupt_contents[ contents_index ],
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		record_index  = -1;
+		stream_offset = -1;
+
+		/* The export should restart at the start instead of resuming at a corrupt position
+		 */
+		result = checkpoint_file_read(
+		          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+		          ESEDB_TEST_CHECKPOINT_SETTINGS_CHECKSUM,
+		          &record_index,
+		          &stream_offset,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "record_index",
+		 record_index,
+		 0 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT64(
+		 "stream_offset",
+		 (int64_t) stream_offset,
+		 (int64_t) 0 );
+	}
+	result = checkpoint_file_remove(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	checkpoint_file_remove(
+	 _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the checkpoint_file_remove function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_checkpoint_file_remove(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = checkpoint_file_remove(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checkpoint_file_remove(
+	          _SYSTEM_STRING( ESEDB_TEST_CHECKPOINT_FILENAME ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ESEDB_TEST_RUN(
+	 "checkpoint_file_write",
+	 esedb_test_tools_checkpoint_file_write )
+
+	ESEDB_TEST_RUN(
+	 "checkpoint_file_read",
+	 esedb_test_tools_checkpoint_file_read )
+
+	ESEDB_TEST_RUN(
+	 "checkpoint_file_read_corrupt",
+	 esedb_test_tools_checkpoint_file_read_corrupt )
+
+	ESEDB_TEST_RUN(
+	 "checkpoint_file_remove",
+	 esedb_test_tools_checkpoint_file_remove )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
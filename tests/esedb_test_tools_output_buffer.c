@@ -0,0 +1,908 @@
+/*
+ * Tools output buffer functions test program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_unused.h"
+
+#include "../esedbtools/output_buffer.h"
+
+/* The data size of the output buffer used by the tests
+ * which is deliberately small so that the data is flushed multiple times
+ */
+#define ESEDB_TEST_OUTPUT_BUFFER_DATA_SIZE	16
+
+uint8_t esedb_test_output_buffer_hexadecimal_data[ 5 ] = {
+	0x00, 0x0f, 0x5a, 0xab, 0xff };
+
+/* Reads the data written to the stream
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t esedb_test_tools_output_buffer_read_stream(
+         FILE *stream,
+         uint8_t *data,
+         size_t data_size )
+{
+	size_t read_count = 0;
+
+	if( file_stream_seek_offset(
+	     stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		return( -1 );
+	}
+	read_count = file_stream_read(
+	              stream,
+	              data,
+	              data_size );
+
+	return( (ssize_t) read_count );
+}
+
+/* Tests the output_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_output_buffer_initialize(
+     void )
+{
+	FILE *stream                   = NULL;
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	int result                     = 0;
+
+	stream = tmpfile();
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	/* Test regular cases
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          ESEDB_TEST_OUTPUT_BUFFER_DATA_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = output_buffer_initialize(
+	          NULL,
+	          stream,
+	          ESEDB_TEST_OUTPUT_BUFFER_DATA_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	output_buffer = (output_buffer_t *) 0x12345678UL;
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          ESEDB_TEST_OUTPUT_BUFFER_DATA_SIZE,
+	          &error );
+
+	output_buffer = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          ESEDB_TEST_OUTPUT_BUFFER_DATA_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	file_stream_close(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_output_buffer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = output_buffer_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_set_compression_method function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_output_buffer_set_compression_method(
+     void )
+{
+	FILE *stream                   = NULL;
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	stream = tmpfile();
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          ESEDB_TEST_OUTPUT_BUFFER_DATA_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_buffer_set_compression_method(
+	          output_buffer,
+	          OUTPUT_BUFFER_COMPRESSION_METHOD_NONE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = output_buffer_set_compression_method(
+	          NULL,
+	          OUTPUT_BUFFER_COMPRESSION_METHOD_NONE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_set_compression_method(
+	          output_buffer,
+	          (int) 'X',
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream_close(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_write functions
+ * The written data must be the same as that printed by the corresponding format
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_output_buffer_write(
+     void )
+{
+	char expected_data[ 256 ];
+	uint8_t data[ 256 ];
+
+	FILE *stream                   = NULL;
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	ssize_t read_count             = 0;
+	int expected_data_size         = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	stream = tmpfile();
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          ESEDB_TEST_OUTPUT_BUFFER_DATA_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_data_size = narrow_string_snprintf(
+	                      expected_data,
+	                      256,
+	                      "Name\t%" PRIu64 "\t%" PRIu64 "\t%" PRIi64 "\t%" PRIi64 "\t%" PRIi64 "\t%02" PRIx8 "%02" PRIx8 "%02" PRIx8 "%02" PRIx8 "%02" PRIx8 "\t%s: %d\t%.3f\n",
+	                      (uint64_t) 0,
+	                      (uint64_t) UINT64_MAX,
+	                      (int64_t) INT64_MIN,
+	                      (int64_t) -1,
+	                      (int64_t) 1234567890,
+	                      esedb_test_output_buffer_hexadecimal_data[ 0 ],
+	                      esedb_test_output_buffer_hexadecimal_data[ 1 ],
+	                      esedb_test_output_buffer_hexadecimal_data[ 2 ],
+	                      esedb_test_output_buffer_hexadecimal_data[ 3 ],
+	                      esedb_test_output_buffer_hexadecimal_data[ 4 ],
+	                      "A formatted string larger than the buffer",
+	                      42,
+	                      1.5 );
+
+	ESEDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "expected_data_size",
+	 expected_data_size,
+	 0 );
+
+	/* Test regular cases
+	 */
+	output_buffer_write_string(
+	 output_buffer,
+	 "Name" );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 '\t' );
+
+	output_buffer_write_unsigned_decimal(
+	 output_buffer,
+	 0 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 '\t' );
+
+	output_buffer_write_unsigned_decimal(
+	 output_buffer,
+	 UINT64_MAX );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 '\t' );
+
+	output_buffer_write_signed_decimal(
+	 output_buffer,
+	 INT64_MIN );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 '\t' );
+
+	output_buffer_write_signed_decimal(
+	 output_buffer,
+	 -1 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 '\t' );
+
+	output_buffer_write_signed_decimal(
+	 output_buffer,
+	 1234567890 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 '\t' );
+
+	output_buffer_write_hexadecimal_data(
+	 output_buffer,
+	 esedb_test_output_buffer_hexadecimal_data,
+	 5 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 '\t' );
+
+	output_buffer_printf(
+	 output_buffer,
+	 "%s: %d",
+	 "A formatted string larger than the buffer",
+	 42 );
+
+	output_buffer_printf(
+	 output_buffer,
+	 "\t%.3f\n",
+	 1.5 );
+
+	result = output_buffer_finish(
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "output_buffer->write_failed",
+	 output_buffer->write_failed,
+	 0 );
+
+	read_count = esedb_test_tools_output_buffer_read_stream(
+	              stream,
+	              data,
+	              256 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) expected_data_size );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          (size_t) expected_data_size );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_buffer_flush(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A failed write must be reported by the next flush
+	 */
+	output_buffer->write_failed = 1;
+
+	result = output_buffer_flush(
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream_close(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_ZLIB ) || defined( HAVE_ZSTD )
+
+/* Tests the output_buffer_write functions with a compression method
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_output_buffer_write_compressed(
+     int compression_method )
+{
+	uint8_t data[ 256 ];
+
+	FILE *stream                   = NULL;
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	ssize_t read_count             = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	stream = tmpfile();
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          ESEDB_TEST_OUTPUT_BUFFER_DATA_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_set_compression_method(
+	          output_buffer,
+	          compression_method,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	output_buffer_write_string(
+	 output_buffer,
+	 "A string larger than the buffer that is compressed" );
+
+	output_buffer_printf(
+	 output_buffer,
+	 "\t%s\n",
+	 "A formatted string larger than the buffer" );
+
+	result = output_buffer_finish(
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Calling finish again must not write another member or frame
+	 */
+	result = output_buffer_finish(
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = esedb_test_tools_output_buffer_read_stream(
+	              stream,
+	              data,
+	              256 );
+
+	ESEDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "read_count",
+	 (int) read_count,
+	 4 );
+
+#if defined( HAVE_ZLIB )
+	if( compression_method == OUTPUT_BUFFER_COMPRESSION_METHOD_GZIP )
+	{
+		/* The gzip member signature
+		 */
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "data[ 0 ]",
+		 (int) data[ 0 ],
+		 0x1f );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "data[ 1 ]",
+		 (int) data[ 1 ],
+		 0x8b );
+	}
+#endif
+#if defined( HAVE_ZSTD )
+	if( compression_method == OUTPUT_BUFFER_COMPRESSION_METHOD_ZSTD )
+	{
+		/* The zstd frame signature
+		 */
+		result = memory_compare(
+		          data,
+		          "\x28\xb5\x2f\xfd",
+		          4 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+#endif
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream_close(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_ZLIB ) || defined( HAVE_ZSTD ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ESEDB_TEST_RUN(
+	 "output_buffer_initialize",
+	 esedb_test_tools_output_buffer_initialize )
+
+	ESEDB_TEST_RUN(
+	 "output_buffer_free",
+	 esedb_test_tools_output_buffer_free )
+
+	ESEDB_TEST_RUN(
+	 "output_buffer_set_compression_method",
+	 esedb_test_tools_output_buffer_set_compression_method )
+
+	ESEDB_TEST_RUN(
+	 "output_buffer_write",
+	 esedb_test_tools_output_buffer_write )
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+#if defined( HAVE_ZLIB )
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "output_buffer_write_compressed",
+	 esedb_test_tools_output_buffer_write_compressed,
+	 OUTPUT_BUFFER_COMPRESSION_METHOD_GZIP )
+#endif
+
+#if defined( HAVE_ZSTD )
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "output_buffer_write_compressed",
+	 esedb_test_tools_output_buffer_write_compressed,
+	 OUTPUT_BUFFER_COMPRESSION_METHOD_ZSTD )
+#endif
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
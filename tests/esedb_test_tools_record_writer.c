@@ -0,0 +1,1390 @@
+/*
+ * Tools record writer functions test program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_unused.h"
+
+#include "../esedbtools/output_buffer.h"
+#include "../esedbtools/record_writer.h"
+
+uint8_t esedb_test_record_writer_binary_data[ 50 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31 };
+
+uint8_t esedb_test_record_writer_guid_data[ 16 ] = {
+	0x33, 0x22, 0x11, 0x00, 0x55, 0x44, 0x77, 0x66, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff };
+
+/* Creates a record writer and an output buffer that writes to a temporary file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_tools_record_writer_open(
+     int format,
+     record_writer_t **record_writer,
+     output_buffer_t **output_buffer,
+     FILE **stream,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_tools_record_writer_open";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	*stream = tmpfile();
+
+	if( *stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open temporary file.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_initialize(
+	     output_buffer,
+	     *stream,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_writer_initialize(
+	     record_writer,
+	     format,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *output_buffer != NULL )
+	{
+		output_buffer_free(
+		 output_buffer,
+		 NULL );
+	}
+	file_stream_close(
+	 *stream );
+
+	*stream = NULL;
+
+	return( -1 );
+}
+
+/* Frees the record writer and output buffer and compares the data written
+ * to the temporary file with the expected string
+ * Returns 1 if the data matches, 0 if not or -1 on error
+ */
+int esedb_test_tools_record_writer_close(
+     record_writer_t **record_writer,
+     output_buffer_t **output_buffer,
+     FILE **stream,
+     const char *expected_string,
+     libcerror_error_t **error )
+{
+	uint8_t data[ 512 ];
+
+	static char *function         = "esedb_test_tools_record_writer_close";
+	size_t expected_string_length = 0;
+	size_t read_count             = 0;
+	int result                    = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( expected_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expected string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_finish(
+	     *output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to finish output buffer.",
+		 function );
+
+		result = -1;
+	}
+	else if( file_stream_seek_offset(
+	          *stream,
+	          0,
+	          SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of temporary file.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		read_count = file_stream_read(
+		              *stream,
+		              data,
+		              512 );
+
+		expected_string_length = narrow_string_length(
+		                          expected_string );
+
+		if( ( read_count != expected_string_length )
+		 || ( memory_compare(
+		       data,
+		       expected_string,
+		       expected_string_length ) != 0 ) )
+		{
+			fprintf(
+			 stdout,
+			 "%s: unexpected data: %.*s\n",
+			 function,
+			 (int) read_count,
+			 (char *) data );
+
+			result = 0;
+		}
+	}
+	if( record_writer_free(
+	     record_writer,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	if( output_buffer_free(
+	     output_buffer,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	file_stream_close(
+	 *stream );
+
+	*stream = NULL;
+
+	return( result );
+}
+
+/* Tests the record_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_record_writer_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	record_writer_t *record_writer = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = record_writer_initialize(
+	          &record_writer,
+	          RECORD_WRITER_FORMAT_CSV,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_writer",
+	 record_writer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = record_writer_free(
+	          &record_writer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_writer",
+	 record_writer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = record_writer_initialize(
+	          NULL,
+	          RECORD_WRITER_FORMAT_CSV,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_writer = (record_writer_t *) 0x12345678UL;
+
+	result = record_writer_initialize(
+	          &record_writer,
+	          RECORD_WRITER_FORMAT_CSV,
+	          &error );
+
+	record_writer = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = record_writer_initialize(
+	          &record_writer,
+	          (int) 'X',
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_writer",
+	 record_writer );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_writer != NULL )
+	{
+		record_writer_free(
+		 &record_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the record_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_record_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = record_writer_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the record_writer_resize_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_record_writer_resize_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = record_writer_resize_data(
+	          &data,
+	          &data_size,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 64 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Data that is large enough is not reallocated
+	 */
+	result = record_writer_resize_data(
+	          &data,
+	          &data_size,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 64 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = record_writer_resize_data(
+	          NULL,
+	          &data_size,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = record_writer_resize_data(
+	          &data,
+	          NULL,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = record_writer_resize_data(
+	          &data,
+	          &data_size,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the record_writer_write_header function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_record_writer_write_header(
+     int format,
+     const char *expected_string )
+{
+	FILE *stream                   = NULL;
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	record_writer_t *record_writer = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_tools_record_writer_open(
+	          format,
+	          &record_writer,
+	          &output_buffer,
+	          &stream,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The column names: Id and Na"me
+	 */
+	result = record_writer_resize_data(
+	          &( record_writer->column_names_data ),
+	          &( record_writer->column_names_data_size ),
+	          7,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record_writer->column_name_offsets = (size_t *) memory_allocate(
+	                                                 sizeof( size_t ) * 3 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record_writer->column_name_offsets",
+	 record_writer->column_name_offsets );
+
+	if( memory_copy(
+	     record_writer->column_names_data,
+	     "IdNa\"me",
+	     7 ) == NULL )
+	{
+		goto on_error;
+	}
+	record_writer->column_name_offsets[ 0 ] = 0;
+	record_writer->column_name_offsets[ 1 ] = 2;
+	record_writer->column_name_offsets[ 2 ] = 7;
+	record_writer->number_of_column_names   = 2;
+
+	/* Test regular cases
+	 */
+	result = record_writer_write_header(
+	          record_writer,
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = record_writer_write_header(
+	          NULL,
+	          output_buffer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = record_writer_write_header(
+	          record_writer,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_tools_record_writer_close(
+	          &record_writer,
+	          &output_buffer,
+	          &stream,
+	          expected_string,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_writer != NULL )
+	{
+		record_writer_free(
+		 &record_writer,
+		 NULL );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* Tests the record_writer_write_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_record_writer_write_string(
+     int format,
+     const char *expected_string )
+{
+	FILE *stream                   = NULL;
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	record_writer_t *record_writer = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_tools_record_writer_open(
+	          format,
+	          &record_writer,
+	          &output_buffer,
+	          &stream,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	record_writer_write_string(
+	 record_writer,
+	 output_buffer,
+	 (uint8_t *) "Say \"hi\",\r\nbye",
+	 14,
+	 0 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	record_writer_write_string(
+	 record_writer,
+	 output_buffer,
+	 (uint8_t *) "\\\b\f\t\x01\x1f",
+	 6,
+	 0 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	/* A character outside the Unicode basic multilingual plane: U+1F600
+	 */
+	record_writer_write_string(
+	 record_writer,
+	 output_buffer,
+	 (uint8_t *) "\xc3\xa9\xf0\x9f\x98\x80",
+	 6,
+	 0 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	/* The string is terminated by the first end-of-string character
+	 */
+	record_writer_write_string(
+	 record_writer,
+	 output_buffer,
+	 (uint8_t *) "\"x\"\0y",
+	 5,
+	 1 );
+
+	/* Clean up
+	 */
+	result = esedb_test_tools_record_writer_close(
+	          &record_writer,
+	          &output_buffer,
+	          &stream,
+	          expected_string,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_writer != NULL )
+	{
+		record_writer_free(
+		 &record_writer,
+		 NULL );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* Tests the record_writer_write_floating_point function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_record_writer_write_floating_point(
+     int format,
+     const char *expected_string )
+{
+	FILE *stream                   = NULL;
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	record_writer_t *record_writer = NULL;
+	double value_double            = 0.0;
+	double zero_double             = 0.0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_tools_record_writer_open(
+	          format,
+	          &record_writer,
+	          &output_buffer,
+	          &stream,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	record_writer_write_floating_point(
+	 record_writer,
+	 output_buffer,
+	 0.1,
+	 0 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	record_writer_write_floating_point(
+	 record_writer,
+	 output_buffer,
+	 (double) 0.1f,
+	 1 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	record_writer_write_floating_point(
+	 record_writer,
+	 output_buffer,
+	 1e300,
+	 0 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	/* NaN and infinity are written as values that are not set
+	 */
+	value_double = zero_double / zero_double;
+
+	record_writer_write_floating_point(
+	 record_writer,
+	 output_buffer,
+	 value_double,
+	 0 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	value_double = 1.0 / zero_double;
+
+	record_writer_write_floating_point(
+	 record_writer,
+	 output_buffer,
+	 value_double,
+	 0 );
+
+	/* Clean up
+	 */
+	result = esedb_test_tools_record_writer_close(
+	          &record_writer,
+	          &output_buffer,
+	          &stream,
+	          expected_string,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_writer != NULL )
+	{
+		record_writer_free(
+		 &record_writer,
+		 NULL );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* Tests the record_writer_write_base64_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_record_writer_write_base64_data(
+     int format,
+     const char *expected_string )
+{
+	FILE *stream                   = NULL;
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	record_writer_t *record_writer = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_tools_record_writer_open(
+	          format,
+	          &record_writer,
+	          &output_buffer,
+	          &stream,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	record_writer_write_base64_data(
+	 record_writer,
+	 output_buffer,
+	 NULL,
+	 0 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	record_writer_write_base64_data(
+	 record_writer,
+	 output_buffer,
+	 (uint8_t *) "f",
+	 1 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	record_writer_write_base64_data(
+	 record_writer,
+	 output_buffer,
+	 (uint8_t *) "fo",
+	 2 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	record_writer_write_base64_data(
+	 record_writer,
+	 output_buffer,
+	 (uint8_t *) "foo",
+	 3 );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	/* Data of which the base64 encoded string does not fit in a single block of 64 characters
+	 */
+	record_writer_write_base64_data(
+	 record_writer,
+	 output_buffer,
+	 esedb_test_record_writer_binary_data,
+	 50 );
+
+	/* Clean up
+	 */
+	result = esedb_test_tools_record_writer_close(
+	          &record_writer,
+	          &output_buffer,
+	          &stream,
+	          expected_string,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_writer != NULL )
+	{
+		record_writer_free(
+		 &record_writer,
+		 NULL );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* Tests the record_writer_write_filetime and record_writer_write_guid functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_record_writer_write_filetime_and_guid(
+     int format,
+     const char *expected_string )
+{
+	FILE *stream                   = NULL;
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	record_writer_t *record_writer = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_tools_record_writer_open(
+	          format,
+	          &record_writer,
+	          &output_buffer,
+	          &stream,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = record_writer_write_filetime(
+	          record_writer,
+	          output_buffer,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	/* 1970-01-01 00:00:00 UTC and 100 nano seconds
+	 */
+	result = record_writer_write_filetime(
+	          record_writer,
+	          output_buffer,
+	          116444736000000001UL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	output_buffer_write_character(
+	 output_buffer,
+	 ' ' );
+
+	result = record_writer_write_guid(
+	          record_writer,
+	          output_buffer,
+	          esedb_test_record_writer_guid_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = record_writer_write_filetime(
+	          NULL,
+	          output_buffer,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = record_writer_write_guid(
+	          NULL,
+	          output_buffer,
+	          esedb_test_record_writer_guid_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = record_writer_write_guid(
+	          record_writer,
+	          output_buffer,
+	          esedb_test_record_writer_guid_data,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_tools_record_writer_close(
+	          &record_writer,
+	          &output_buffer,
+	          &stream,
+	          expected_string,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_writer != NULL )
+	{
+		record_writer_free(
+		 &record_writer,
+		 NULL );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ESEDB_TEST_RUN(
+	 "record_writer_initialize",
+	 esedb_test_tools_record_writer_initialize )
+
+	ESEDB_TEST_RUN(
+	 "record_writer_free",
+	 esedb_test_tools_record_writer_free )
+
+	ESEDB_TEST_RUN(
+	 "record_writer_resize_data",
+	 esedb_test_tools_record_writer_resize_data )
+
+	/* TODO: add tests for record_writer_set_column_names_from_table */
+
+	/* TODO: add tests for record_writer_set_column_names_from_record */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "record_writer_write_header",
+	 esedb_test_tools_record_writer_write_header,
+	 RECORD_WRITER_FORMAT_CSV,
+	 "\"Id\",\"Na\"\"me\"\r\n" )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "record_writer_write_header",
+	 esedb_test_tools_record_writer_write_header,
+	 RECORD_WRITER_FORMAT_JSONL,
+	 "" )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "record_writer_write_string",
+	 esedb_test_tools_record_writer_write_string,
+	 RECORD_WRITER_FORMAT_CSV,
+	 "\"Say \"\"hi\"\",\r\nbye\" \"\\\b\f\t\x01\x1f\" \"\xc3\xa9\xf0\x9f\x98\x80\" \"\"x\"\"" )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "record_writer_write_string",
+	 esedb_test_tools_record_writer_write_string,
+	 RECORD_WRITER_FORMAT_JSONL,
+	 "\"Say \\\"hi\\\",\\r\\nbye\" \"\\\\\\b\\f\\t\\u0001\\u001f\" \"\xc3\xa9\xf0\x9f\x98\x80\" \"\\\"x\\\"\"" )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "record_writer_write_floating_point",
+	 esedb_test_tools_record_writer_write_floating_point,
+	 RECORD_WRITER_FORMAT_CSV,
+	 "0.10000000000000001 0.100000001 1.0000000000000001e+300  " )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "record_writer_write_floating_point",
+	 esedb_test_tools_record_writer_write_floating_point,
+	 RECORD_WRITER_FORMAT_JSONL,
+	 "0.10000000000000001 0.100000001 1.0000000000000001e+300 null null" )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "record_writer_write_base64_data",
+	 esedb_test_tools_record_writer_write_base64_data,
+	 RECORD_WRITER_FORMAT_CSV,
+	 " Zg== Zm8= Zm9v AAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8gISIjJCUmJygpKissLS4vMDE=" )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "record_writer_write_base64_data",
+	 esedb_test_tools_record_writer_write_base64_data,
+	 RECORD_WRITER_FORMAT_JSONL,
+	 "\"\" \"Zg==\" \"Zm8=\" \"Zm9v\" \"AAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8gISIjJCUmJygpKissLS4vMDE=\"" )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "record_writer_write_filetime_and_guid",
+	 esedb_test_tools_record_writer_write_filetime_and_guid,
+	 RECORD_WRITER_FORMAT_CSV,
+	 "\"1601-01-01T00:00:00.000000000Z\" \"1970-01-01T00:00:00.000000100Z\" 00112233-4455-6677-8899-aabbccddeeff" )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "record_writer_write_filetime_and_guid",
+	 esedb_test_tools_record_writer_write_filetime_and_guid,
+	 RECORD_WRITER_FORMAT_JSONL,
+	 "\"1601-01-01T00:00:00.000000000Z\" \"1970-01-01T00:00:00.000000100Z\" \"00112233-4455-6677-8899-aabbccddeeff\"" )
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	/* TODO: add tests for record_writer_write_record */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,734 @@
+/*
+ * Tools SQLite writer functions test program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_unused.h"
+
+#include "../esedbtools/sqlite_writer.h"
+
+#if defined( HAVE_SQLITE3 )
+
+/* Tests the sqlite_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_sqlite_writer_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	sqlite_writer_t *sqlite_writer = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = sqlite_writer_initialize(
+	          &sqlite_writer,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "sqlite_writer",
+	 sqlite_writer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sqlite_writer_free(
+	          &sqlite_writer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "sqlite_writer",
+	 sqlite_writer );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = sqlite_writer_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sqlite_writer = (sqlite_writer_t *) 0x12345678UL;
+
+	result = sqlite_writer_initialize(
+	          &sqlite_writer,
+	          16,
+	          &error );
+
+	sqlite_writer = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = sqlite_writer_initialize(
+	          &sqlite_writer,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "sqlite_writer",
+	 sqlite_writer );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sqlite_writer != NULL )
+	{
+		sqlite_writer_free(
+		 &sqlite_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the sqlite_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_sqlite_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = sqlite_writer_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the sqlite_writer_append_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_sqlite_writer_append_identifier(
+     const char *identifier,
+     const char *expected_statement )
+{
+	libcerror_error_t *error       = NULL;
+	sqlite_writer_t *sqlite_writer = NULL;
+	size_t expected_length         = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = sqlite_writer_initialize(
+	          &sqlite_writer,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_length = narrow_string_length(
+	                   expected_statement );
+
+	/* Test regular cases
+	 */
+	result = sqlite_writer_append_identifier(
+	          sqlite_writer,
+	          (uint8_t *) identifier,
+	          narrow_string_length(
+	           identifier ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "sqlite_writer->statement_data_offset",
+	 sqlite_writer->statement_data_offset,
+	 expected_length );
+
+	result = memory_compare(
+	          sqlite_writer->statement_data,
+	          expected_statement,
+	          expected_length + 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = sqlite_writer_append_identifier(
+	          NULL,
+	          (uint8_t *) identifier,
+	          narrow_string_length(
+	           identifier ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = sqlite_writer_append_identifier(
+	          sqlite_writer,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = sqlite_writer_free(
+	          &sqlite_writer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sqlite_writer != NULL )
+	{
+		sqlite_writer_free(
+		 &sqlite_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests if quoted table and column names that contain double quotes
+ * are created with the original names
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_sqlite_writer_quoted_names(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	sqlite3_stmt *statement        = NULL;
+	sqlite_writer_t *sqlite_writer = NULL;
+	const char *column_name        = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = sqlite_writer_initialize(
+	          &sqlite_writer,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sqlite_writer_open(
+	          sqlite_writer,
+	          _SYSTEM_STRING( ":memory:" ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = sqlite_writer_append_statement(
+	          sqlite_writer,
+	          (uint8_t *) "CREATE TABLE ",
+	          13,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sqlite_writer_append_identifier(
+	          sqlite_writer,
+	          (uint8_t *) "My \"table\"",
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sqlite_writer_append_statement(
+	          sqlite_writer,
+	          (uint8_t *) " ( ",
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sqlite_writer_append_identifier(
+	          sqlite_writer,
+	          (uint8_t *) "\"); DROP TABLE x; --",
+	          20,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sqlite_writer_append_statement(
+	          sqlite_writer,
+	          (uint8_t *) " INTEGER )",
+	          10,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sqlite_writer_execute(
+	          sqlite_writer,
+	          (char *) sqlite_writer->statement_data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table and column must be created with the original names
+	 */
+	result = sqlite3_prepare_v2(
+	          sqlite_writer->database,
+	          "SELECT * FROM \"My \"\"table\"\"\"",
+	          -1,
+	          &statement,
+	          NULL );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 SQLITE_OK );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number of columns",
+	 sqlite3_column_count( statement ),
+	 1 );
+
+	column_name = sqlite3_column_name(
+	               statement,
+	               0 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_name",
+	 column_name );
+
+	result = narrow_string_compare(
+	          column_name,
+	          "\"); DROP TABLE x; --",
+	          21 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sqlite3_finalize(
+	 statement );
+
+	statement = NULL;
+
+	/* Test error cases
+	 */
+	result = sqlite_writer_execute(
+	          sqlite_writer,
+	          "CREATE TABLE \"My \"\"table\"\"\" ( x INTEGER )",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = sqlite_writer_close(
+	          sqlite_writer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sqlite_writer_execute(
+	          sqlite_writer,
+	          "SELECT 1",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = sqlite_writer_free(
+	          &sqlite_writer,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statement != NULL )
+	{
+		sqlite3_finalize(
+		 statement );
+	}
+	if( sqlite_writer != NULL )
+	{
+		sqlite_writer_free(
+		 &sqlite_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the sqlite_writer_get_column_type_name function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_sqlite_writer_get_column_type_name(
+     void )
+{
+	const char *type_name = NULL;
+	int result            = 0;
+
+	/* Test regular cases
+	 */
+	type_name = sqlite_writer_get_column_type_name(
+	             LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED );
+
+	result = narrow_string_compare(
+	          type_name,
+	          "INTEGER",
+	          8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	type_name = sqlite_writer_get_column_type_name(
+	             LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT );
+
+	result = narrow_string_compare(
+	          type_name,
+	          "REAL",
+	          5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	type_name = sqlite_writer_get_column_type_name(
+	             LIBESEDB_COLUMN_TYPE_GUID );
+
+	result = narrow_string_compare(
+	          type_name,
+	          "TEXT",
+	          5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	type_name = sqlite_writer_get_column_type_name(
+	             LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA );
+
+	result = narrow_string_compare(
+	          type_name,
+	          "BLOB",
+	          5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( HAVE_SQLITE3 ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_SQLITE3 )
+
+	ESEDB_TEST_RUN(
+	 "sqlite_writer_initialize",
+	 esedb_test_tools_sqlite_writer_initialize )
+
+	ESEDB_TEST_RUN(
+	 "sqlite_writer_free",
+	 esedb_test_tools_sqlite_writer_free )
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "sqlite_writer_append_identifier",
+	 esedb_test_tools_sqlite_writer_append_identifier,
+	 "Name",
+	 "\"Name\"" )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "sqlite_writer_append_identifier",
+	 esedb_test_tools_sqlite_writer_append_identifier,
+	 "Na\"me",
+	 "\"Na\"\"me\"" )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "sqlite_writer_append_identifier",
+	 esedb_test_tools_sqlite_writer_append_identifier,
+	 "\"\"",
+	 "\"\"\"\"\"\"" )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "sqlite_writer_append_identifier",
+	 esedb_test_tools_sqlite_writer_append_identifier,
+	 "",
+	 "\"\"" )
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	ESEDB_TEST_RUN(
+	 "sqlite_writer_quoted_names",
+	 esedb_test_tools_sqlite_writer_quoted_names )
+
+	ESEDB_TEST_RUN(
+	 "sqlite_writer_get_column_type_name",
+	 esedb_test_tools_sqlite_writer_get_column_type_name )
+
+	/* TODO: add tests for sqlite_writer_create_table */
+
+	/* TODO: add tests for sqlite_writer_insert_record */
+
+#endif /* defined( HAVE_SQLITE3 ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_SQLITE3 )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_SQLITE3 ) */
+}
+
@@ -28,18 +28,35 @@ test_callback()
 	(cd ${TMPDIR} && run_test_with_input_and_arguments "${TEST_EXECUTABLE}" "${INPUT_FILE_FULL_PATH}" ${ARGUMENTS[@]} ${OPTIONS[@]});
 	local RESULT=$?;
 
-	local TEST_LOG="${TEST_OUTPUT}.log";
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		compare_with_stored_test_results "${TMPDIR}" "${INPUT_NAME}.export" "${TEST_OUTPUT}.log" "${TEST_SET_DIRECTORY}";
+		RESULT=$?;
+	fi
+	return ${RESULT};
+}
+
+# Compares the MD5 sums of the exported files with the stored test results.
+# The test results are stored if they do not exist.
+compare_with_stored_test_results()
+{
+	local TMPDIR=$1;
+	local EXPORT_DIRECTORY=$2;
+	local TEST_LOG=$3;
+	local STORED_TEST_RESULTS_DIRECTORY=$4;
+
+	local RESULT=${EXIT_SUCCESS};
 
 	if test "${PLATFORM}" = "Darwin";
 	then
-		(cd ${TMPDIR} && find "${INPUT_NAME}.export" -type f -exec md5 {} \; | sort -k 2 > "${TEST_LOG}");
+		(cd ${TMPDIR} && find "${EXPORT_DIRECTORY}" -type f -exec md5 {} \; | sort -k 2 > "${TEST_LOG}");
 	else
 		# md5sum prefixes the output of a filename with an escape character (\) with \
-                (cd ${TMPDIR} && find "${INPUT_NAME}.export" -type f -exec md5sum {} \; | sed 's/^\\//' | sort -k 2 > "${TEST_LOG}");
+                (cd ${TMPDIR} && find "${EXPORT_DIRECTORY}" -type f -exec md5sum {} \; | sed 's/^\\//' | sort -k 2 > "${TEST_LOG}");
 	fi
 
 	local TEST_RESULTS="${TMPDIR}/${TEST_LOG}";
-	local STORED_TEST_RESULTS="${TEST_SET_DIRECTORY}/${TEST_LOG}.gz";
+	local STORED_TEST_RESULTS="${STORED_TEST_RESULTS_DIRECTORY}/${TEST_LOG}.gz";
 
 	if test -f "${STORED_TEST_RESULTS}";
 	then
@@ -50,11 +67,202 @@ test_callback()
 	else
 		gzip "${TEST_RESULTS}";
 
-		mv "${TEST_RESULTS}.gz" ${TEST_SET_DIRECTORY};
+		mv "${TEST_RESULTS}.gz" ${STORED_TEST_RESULTS_DIRECTORY};
+	fi
+	return ${RESULT};
+}
+
+# Tests the export of a generated database.
+# The export in every output format is compared with the stored test results
+# if a test profile directory is provided. Since the generated database is the same
+# on every run this detects any change in the output formats.
+test_export_generated_database()
+{
+	local TMPDIR=$1;
+	local TEST_PROFILE_DIRECTORY=$2;
+
+	local GENERATE_EXECUTABLE="./esedb_generate";
+
+	if ! test -x "${GENERATE_EXECUTABLE}";
+	then
+		GENERATE_EXECUTABLE="${GENERATE_EXECUTABLE}.exe";
+	fi
+
+	if ! test -x "${GENERATE_EXECUTABLE}";
+	then
+		echo "Missing generate executable: ${GENERATE_EXECUTABLE}";
+
+		return ${EXIT_IGNORE};
+	fi
+	local INPUT_FILE="${TMPDIR}/generated.edb";
+
+	run_test_with_arguments "Generating database" "${GENERATE_EXECUTABLE}" -n 100 -t 2 ${INPUT_FILE};
+	local RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		return ${RESULT};
+	fi
+	for FORMAT in text csv jsonl arrow;
+	do
+		local TARGET="generated_${FORMAT}";
+
+		run_test_with_arguments "Testing export of generated database in format: ${FORMAT}" "${TEST_EXECUTABLE}" -f ${FORMAT} -t ${TMPDIR}/${TARGET} ${INPUT_FILE};
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			return ${RESULT};
+		fi
+		if test ${FORMAT} = "jsonl";
+		then
+			# Every line must contain a single JSON object.
+			local NUMBER_OF_LINES=`cat ${TMPDIR}/${TARGET}.export/* | grep -v -c '^{.*}$'`;
+
+			if test ${NUMBER_OF_LINES} -ne 0;
+			then
+				echo "Export in format: ${FORMAT} contains ${NUMBER_OF_LINES} lines that are not a JSON object";
+
+				return ${EXIT_FAILURE};
+			fi
+		fi
+		if test ${FORMAT} = "arrow";
+		then
+			# Every stream must be terminated by the end-of-stream marker.
+			for EXPORT_FILE in ${TMPDIR}/${TARGET}.export/*;
+			do
+				local END_OF_STREAM=`tail -c 8 "${EXPORT_FILE}" | od -A n -t x1 | tr -d ' \n'`;
+
+				if test "${END_OF_STREAM}" != "ffffffff00000000";
+				then
+					echo "Export in format: ${FORMAT} is missing end-of-stream marker in: ${EXPORT_FILE}";
+
+					return ${EXIT_FAILURE};
+				fi
+			done
+		fi
+		if test -n "${TEST_PROFILE_DIRECTORY}";
+		then
+			compare_with_stored_test_results "${TMPDIR}" "${TARGET}.export" "${TARGET}.log" "${TEST_PROFILE_DIRECTORY}";
+			RESULT=$?;
+
+			if test ${RESULT} -ne ${EXIT_SUCCESS};
+			then
+				return ${RESULT};
+			fi
+		fi
+	done
+	# The sqlite format is only available if esedbexport was built with sqlite3 support
+	# and the sqlite3 binary is needed to read back the database.
+	if ! ${TEST_EXECUTABLE} -h 2>&1 | grep "sqlite" > /dev/null;
+	then
+		echo "Skipping export in format: sqlite, since it is not supported by: ${TEST_EXECUTABLE}";
+	elif ! which sqlite3 > /dev/null 2>&1;
+	then
+		echo "Skipping export in format: sqlite, since the sqlite3 binary is missing";
+	else
+		local TARGET="generated_sqlite";
+
+		run_test_with_arguments "Testing export of generated database in format: sqlite" "${TEST_EXECUTABLE}" -f sqlite -t ${TMPDIR}/${TARGET} ${INPUT_FILE};
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			return ${RESULT};
+		fi
+		local INTEGRITY_CHECK=`sqlite3 ${TMPDIR}/${TARGET}.db "PRAGMA integrity_check"`;
+
+		if test "${INTEGRITY_CHECK}" != "ok";
+		then
+			echo "Export in format: sqlite failed integrity check: ${INTEGRITY_CHECK}";
+
+			return ${EXIT_FAILURE};
+		fi
+		if test -n "${TEST_PROFILE_DIRECTORY}";
+		then
+			# The database file itself is not byte for byte reproducible, hence its SQL dump is compared.
+			mkdir -p ${TMPDIR}/${TARGET}.export;
+
+			sqlite3 ${TMPDIR}/${TARGET}.db .dump > ${TMPDIR}/${TARGET}.export/${TARGET}.sql;
+
+			compare_with_stored_test_results "${TMPDIR}" "${TARGET}.export" "${TARGET}.log" "${TEST_PROFILE_DIRECTORY}";
+			RESULT=$?;
+		fi
 	fi
 	return ${RESULT};
 }
 
+# Tests resuming an interrupted export of a generated database.
+# The resumed export must be the same as an export that was not interrupted.
+test_resume_interrupted_export()
+{
+	local TMPDIR=$1;
+
+	local GENERATE_EXECUTABLE="./esedb_generate";
+
+	if ! test -x "${GENERATE_EXECUTABLE}";
+	then
+		GENERATE_EXECUTABLE="${GENERATE_EXECUTABLE}.exe";
+	fi
+
+	if ! test -x "${GENERATE_EXECUTABLE}";
+	then
+		echo "Missing generate executable: ${GENERATE_EXECUTABLE}";
+
+		return ${EXIT_IGNORE};
+	fi
+	local INPUT_FILE="${TMPDIR}/resume.edb";
+
+	# The database is large enough for the export to be interrupted in the middle of a table.
+	run_test_with_arguments "Generating database" "${GENERATE_EXECUTABLE}" -n 10000 -t 2 ${INPUT_FILE};
+	local RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		return ${RESULT};
+	fi
+	run_test_with_arguments "Testing export of generated database" "${TEST_EXECUTABLE}" -b 100 -t ${TMPDIR}/resume_complete ${INPUT_FILE};
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		return ${RESULT};
+	fi
+	${TEST_EXECUTABLE} -b 100 -t ${TMPDIR}/resume ${INPUT_FILE} > /dev/null 2>&1 &
+	local PID=$!;
+
+	# Interrupt the export once it has written the checkpoint file of a table.
+	# If the export has already completed the resume should skip every table.
+	while kill -0 ${PID} 2> /dev/null && ! ls ${TMPDIR}/resume.export/*.checkpoint > /dev/null 2>&1;
+	do
+		:
+	done
+	kill -INT ${PID} 2> /dev/null;
+
+	wait ${PID};
+
+	run_test_with_arguments "Testing resume of interrupted export of generated database" "${TEST_EXECUTABLE}" -b 100 -r -t ${TMPDIR}/resume ${INPUT_FILE};
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		return ${RESULT};
+	fi
+	if ls ${TMPDIR}/resume.export/*.checkpoint > /dev/null 2>&1;
+	then
+		echo "Resumed export contains checkpoint files";
+
+		return ${EXIT_FAILURE};
+	fi
+	if ! diff -r ${TMPDIR}/resume_complete.export ${TMPDIR}/resume.export > /dev/null;
+	then
+		echo "Resumed export differs from the export that was not interrupted";
+
+		return ${EXIT_FAILURE};
+	fi
+	return ${EXIT_SUCCESS};
+}
+
 if test -n "${SKIP_TOOLS_TESTS}" || test -n "${SKIP_TOOLS_END_TO_END_TESTS}";
 then
 	exit ${EXIT_IGNORE};
@@ -101,6 +309,34 @@ else
 	assert_availability_binary md5sum;
 fi
 
+TEST_PROFILE_DIRECTORY="";
+
+if test -d "input";
+then
+	TEST_PROFILE_DIRECTORY=$(get_test_profile_directory "input" "esedbexport");
+fi
+
+TMPDIR="tmp$$";
+
+rm -rf ${TMPDIR};
+mkdir ${TMPDIR};
+
+test_export_generated_database "${TMPDIR}" "${TEST_PROFILE_DIRECTORY}";
+RESULT=$?;
+
+if test ${RESULT} -eq ${EXIT_SUCCESS};
+then
+	test_resume_interrupted_export "${TMPDIR}";
+	RESULT=$?;
+fi
+
+rm -rf ${TMPDIR};
+
+if test ${RESULT} -ne ${EXIT_SUCCESS} && test ${RESULT} -ne ${EXIT_IGNORE};
+then
+	exit ${RESULT};
+fi
+
 if ! test -d "input";
 then
 	echo "Test input directory not found.";
@@ -7,12 +7,67 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-PROFILES=("esedbinfo");
-OPTIONS_PER_PROFILE=("");
+PROFILES=("esedbinfo" "esedbinfo_page_layout");
+OPTIONS_PER_PROFILE=("" "-p");
 OPTION_SETS="";
 
 INPUT_GLOB="*";
 
+# Tests printing the page layout of a generated database.
+# The number of pages per page type must add up to the number of pages.
+test_page_layout_of_generated_database()
+{
+	local TMPDIR=$1;
+
+	local GENERATE_EXECUTABLE="./esedb_generate";
+
+	if ! test -x "${GENERATE_EXECUTABLE}";
+	then
+		GENERATE_EXECUTABLE="${GENERATE_EXECUTABLE}.exe";
+	fi
+
+	if ! test -x "${GENERATE_EXECUTABLE}";
+	then
+		echo "Missing generate executable: ${GENERATE_EXECUTABLE}";
+
+		return ${EXIT_IGNORE};
+	fi
+	local INPUT_FILE="${TMPDIR}/generated.edb";
+
+	run_test_with_arguments "Generating database" "${GENERATE_EXECUTABLE}" -n 100 -t 2 ${INPUT_FILE};
+	local RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		return ${RESULT};
+	fi
+	run_test_with_arguments "Testing page layout of generated database" "${TEST_EXECUTABLE}" -p ${INPUT_FILE};
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		return ${RESULT};
+	fi
+	local OUTPUT=`${TEST_EXECUTABLE} -p ${INPUT_FILE}`;
+
+	local NUMBER_OF_PAGES=`echo "${OUTPUT}" | awk '/^Page layout:/ { in_page_layout = 1 } in_page_layout && /^\tNumber of pages:/ { print $NF; exit }'`;
+	local NUMBER_OF_PAGES_PER_TYPE=`echo "${OUTPUT}" | awk '/^\tPage types:/ { in_page_types = 1; next } /^$/ { in_page_types = 0 } in_page_types { total += $NF } END { print total + 0 }'`;
+
+	if test -z "${NUMBER_OF_PAGES}" || test ${NUMBER_OF_PAGES} -eq 0;
+	then
+		echo "Page layout of generated database is missing the number of pages";
+
+		return ${EXIT_FAILURE};
+	fi
+	if test ${NUMBER_OF_PAGES_PER_TYPE} -ne ${NUMBER_OF_PAGES};
+	then
+		echo "Page layout of generated database contains: ${NUMBER_OF_PAGES_PER_TYPE} pages per type, expected: ${NUMBER_OF_PAGES}";
+
+		return ${EXIT_FAILURE};
+	fi
+	return ${EXIT_SUCCESS};
+}
+
 if test -n "${SKIP_TOOLS_TESTS}" || test -n "${SKIP_TOOLS_END_TO_END_TESTS}";
 then
 	exit ${EXIT_IGNORE};
@@ -48,6 +103,21 @@ fi
 
 source ${TEST_RUNNER};
 
+TMPDIR="tmp$$";
+
+rm -rf ${TMPDIR};
+mkdir ${TMPDIR};
+
+test_page_layout_of_generated_database "${TMPDIR}";
+RESULT=$?;
+
+rm -rf ${TMPDIR};
+
+if test ${RESULT} -ne ${EXIT_SUCCESS} && test ${RESULT} -ne ${EXIT_IGNORE};
+then
+	exit ${RESULT};
+fi
+
 if ! test -d "input";
 then
 	echo "Test input directory not found.";
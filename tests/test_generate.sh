@@ -0,0 +1,134 @@
+#!/bin/bash
+# Tests the library and tools on generated databases.
+#
+# Version: 20200705
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+# The page size and format revision of the generated databases.
+GENERATE_OPTION_SETS="4096:9 8192:12 8192:20 16384:20 32768:20";
+
+LIBRARY_TESTS_WITH_INPUT="file table";
+
+if test -n "${SKIP_LIBRARY_TESTS}";
+then
+	exit ${EXIT_IGNORE};
+fi
+
+GENERATE_EXECUTABLE="./esedb_generate";
+
+if ! test -x "${GENERATE_EXECUTABLE}";
+then
+	GENERATE_EXECUTABLE="${GENERATE_EXECUTABLE}.exe";
+fi
+
+if ! test -x "${GENERATE_EXECUTABLE}";
+then
+	echo "Missing generate executable: ${GENERATE_EXECUTABLE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+EXPORT_EXECUTABLE="../esedbtools/esedbexport";
+
+if ! test -x "${EXPORT_EXECUTABLE}";
+then
+	EXPORT_EXECUTABLE="${EXPORT_EXECUTABLE}.exe";
+fi
+
+TEST_RUNNER="tests/test_runner.sh";
+
+if ! test -f "${TEST_RUNNER}";
+then
+	TEST_RUNNER="./test_runner.sh";
+fi
+
+if ! test -f "${TEST_RUNNER}";
+then
+	echo "Missing test runner: ${TEST_RUNNER}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+source ${TEST_RUNNER};
+
+TMPDIR="tmp$$";
+
+rm -rf ${TMPDIR};
+mkdir ${TMPDIR};
+
+RESULT=${EXIT_SUCCESS};
+
+for GENERATE_OPTION_SET in ${GENERATE_OPTION_SETS};
+do
+	PAGE_SIZE=`echo ${GENERATE_OPTION_SET} | cut -d ':' -f 1`;
+	FORMAT_REVISION=`echo ${GENERATE_OPTION_SET} | cut -d ':' -f 2`;
+
+	INPUT_FILE="${TMPDIR}/generated_${PAGE_SIZE}_${FORMAT_REVISION}.edb";
+
+	run_test_with_arguments "Generating: page size: ${PAGE_SIZE} format revision: ${FORMAT_REVISION}" "${GENERATE_EXECUTABLE}" -n 200 -p ${PAGE_SIZE} -r ${FORMAT_REVISION} -t 2 -x 4 ${INPUT_FILE};
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		break;
+	fi
+	for TEST_NAME in ${LIBRARY_TESTS_WITH_INPUT};
+	do
+		TEST_EXECUTABLE="./esedb_test_${TEST_NAME}";
+
+		if ! test -x "${TEST_EXECUTABLE}";
+		then
+			TEST_EXECUTABLE="${TEST_EXECUTABLE}.exe";
+		fi
+
+		run_test_with_arguments "Testing: ${TEST_NAME} with page size: ${PAGE_SIZE} format revision: ${FORMAT_REVISION}" "${TEST_EXECUTABLE}" ${INPUT_FILE};
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			break;
+		fi
+	done
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		break;
+	fi
+	# Scan all the records of the generated tables.
+	if test -x "${EXPORT_EXECUTABLE}";
+	then
+		run_test_with_arguments "Scanning: page size: ${PAGE_SIZE} format revision: ${FORMAT_REVISION}" "${EXPORT_EXECUTABLE}" -t ${TMPDIR}/export_${PAGE_SIZE}_${FORMAT_REVISION} ${INPUT_FILE};
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			break;
+		fi
+		# Carve the deleted records of the generated tables, every table contains
+		# 2 deleted records that can be read and 2 truncated ones that must be ignored.
+		run_test_with_arguments "Carving: page size: ${PAGE_SIZE} format revision: ${FORMAT_REVISION}" "${EXPORT_EXECUTABLE}" -m carve -t ${TMPDIR}/carve_${PAGE_SIZE}_${FORMAT_REVISION} ${INPUT_FILE};
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			break;
+		fi
+		NUMBER_OF_CARVED_RECORDS=`cat ${TMPDIR}/carve_${PAGE_SIZE}_${FORMAT_REVISION}.export/*.carved.* 2> /dev/null | grep -v "^PageNumber" | wc -l`;
+
+		if test ${NUMBER_OF_CARVED_RECORDS} -ne 4;
+		then
+			echo "Unexpected number of carved records: ${NUMBER_OF_CARVED_RECORDS}, expected: 4";
+
+			RESULT=${EXIT_FAILURE};
+
+			break;
+		fi
+	fi
+done
+
+rm -rf ${TMPDIR};
+
+exit ${RESULT};